@@ -0,0 +1,171 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/arch/CMakeLists.txt"
+  "/root/repo/arch/eCos/CMakeLists.txt"
+  "/root/repo/arch/freertosLWIP/CMakeLists.txt"
+  "/root/repo/arch/freertosTCP/CMakeLists.txt"
+  "/root/repo/arch/posix/CMakeLists.txt"
+  "/root/repo/arch/vxworks/CMakeLists.txt"
+  "/root/repo/arch/wec7/CMakeLists.txt"
+  "/root/repo/arch/win32/CMakeLists.txt"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/doc/conf.py"
+  "/root/repo/include/open62541/config.h.in"
+  "/root/repo/open62541.pc.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/nodeset-compiler/CMakeLists.txt"
+  "/root/repo/tools/cmake/AssignSourceGroup.cmake"
+  "/root/repo/tools/cmake/CompilerFlags.cmake"
+  "/root/repo/tools/cmake/FindCheck.cmake"
+  "/root/repo/tools/cmake/FindClangTools.cmake"
+  "/root/repo/tools/cmake/FindSphinx.cmake"
+  "/root/repo/tools/cmake/SetGitBasedVersion.cmake"
+  "/root/repo/tools/cmake/linting_build.cmake"
+  "/root/repo/tools/cmake/linting_target.cmake"
+  "/root/repo/tools/cmake/macros_internal.cmake"
+  "/root/repo/tools/cmake/macros_public.cmake"
+  "/root/repo/tools/cmake/open62541Config.cmake.in"
+  "/root/repo/tools/packaging/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLATEX.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "src_generated/open62541/config.h"
+  "src_generated/open62541.pc"
+  "open62541Config.cmake"
+  "open62541ConfigVersion.cmake"
+  "open62541Macros.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/posix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/win32/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/freertosTCP/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/freertosLWIP/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/vxworks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/eCos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "arch/wec7/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc_src/conf.py"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/nodeset-compiler/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "tools/packaging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/open62541-generator-types.dir/DependInfo.cmake"
+  "CMakeFiles/open62541-generator-transport.dir/DependInfo.cmake"
+  "CMakeFiles/open62541-generator-ids-ns0.dir/DependInfo.cmake"
+  "CMakeFiles/open62541-generator-statuscode.dir/DependInfo.cmake"
+  "CMakeFiles/open62541-generator-namespace.dir/DependInfo.cmake"
+  "CMakeFiles/open62541-object.dir/DependInfo.cmake"
+  "CMakeFiles/open62541-plugins.dir/DependInfo.cmake"
+  "CMakeFiles/open62541.dir/DependInfo.cmake"
+  "CMakeFiles/clang-tidy.dir/DependInfo.cmake"
+  "CMakeFiles/cpplint.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doc_latex.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doc_pdf.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/open62541-testplugins.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-verbose.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_types_builtin.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_types_memory.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_types_range.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_types_custom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_chunking.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_utils.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_securechannel.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_timer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_accesscontrol.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_view.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_registernodes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_attributes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_read_batch.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_nodemanagement.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_callbacks.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_call.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_services_subscriptions.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_monitoreditem_filter.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_subscription_events.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_nodestore.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_typehierarchy.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_valuecache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_browsepathcache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_requesttimeout.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_session.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_jobs.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_userspace.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_node_inheritance.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_local_monitored_item.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_discovery.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_readspeed.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_speed_addnodes.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_monitoringspeed.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_sharedsampling.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_sampleonwrite.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_notificationpool.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_samplinggroups.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_server_publishencoding.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_client.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_client_securechannel.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_client_async.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_client_async_connect.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_client_subscriptions.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check_client_highlevel.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_b_wheel/src_generated/open62541/namespace0_generated.h" "/root/repo/_b_wheel/src_generated/open62541/namespace0_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/statuscodes.c" "/root/repo/_b_wheel/src_generated/open62541/statuscodes.h"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated.h" "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated_encoding_binary.h" "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated_handling.h" "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated_encoding_binary.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated_handling.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
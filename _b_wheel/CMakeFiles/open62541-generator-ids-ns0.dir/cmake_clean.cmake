@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-generator-ids-ns0"
+  "src_generated/open62541/nodeids.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/open62541-generator-ids-ns0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
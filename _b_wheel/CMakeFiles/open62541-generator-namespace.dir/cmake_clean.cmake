@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-generator-namespace"
+  "src_generated/open62541/namespace0_generated.c"
+  "src_generated/open62541/namespace0_generated.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/open62541-generator-namespace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
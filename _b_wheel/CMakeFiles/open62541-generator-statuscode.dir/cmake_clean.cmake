@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-generator-statuscode"
+  "src_generated/open62541/nodeids.h"
+  "src_generated/open62541/statuscodes.c"
+  "src_generated/open62541/statuscodes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/open62541-generator-statuscode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-generator-transport"
+  "src_generated/open62541/transport_generated.c"
+  "src_generated/open62541/transport_generated.h"
+  "src_generated/open62541/transport_generated_encoding_binary.h"
+  "src_generated/open62541/transport_generated_handling.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/open62541-generator-transport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,91 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/base64.c" "CMakeFiles/open62541-object.dir/deps/base64.c.o" "gcc" "CMakeFiles/open62541-object.dir/deps/base64.c.o.d"
+  "/root/repo/deps/libc_time.c" "CMakeFiles/open62541-object.dir/deps/libc_time.c.o" "gcc" "CMakeFiles/open62541-object.dir/deps/libc_time.c.o.d"
+  "/root/repo/deps/pcg_basic.c" "CMakeFiles/open62541-object.dir/deps/pcg_basic.c.o" "gcc" "CMakeFiles/open62541-object.dir/deps/pcg_basic.c.o.d"
+  "/root/repo/src/client/ua_client.c" "CMakeFiles/open62541-object.dir/src/client/ua_client.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client.c.o.d"
+  "/root/repo/src/client/ua_client_connect.c" "CMakeFiles/open62541-object.dir/src/client/ua_client_connect.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client_connect.c.o.d"
+  "/root/repo/src/client/ua_client_connect_async.c" "CMakeFiles/open62541-object.dir/src/client/ua_client_connect_async.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client_connect_async.c.o.d"
+  "/root/repo/src/client/ua_client_discovery.c" "CMakeFiles/open62541-object.dir/src/client/ua_client_discovery.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client_discovery.c.o.d"
+  "/root/repo/src/client/ua_client_highlevel.c" "CMakeFiles/open62541-object.dir/src/client/ua_client_highlevel.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client_highlevel.c.o.d"
+  "/root/repo/src/client/ua_client_subscriptions.c" "CMakeFiles/open62541-object.dir/src/client/ua_client_subscriptions.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client_subscriptions.c.o.d"
+  "/root/repo/src/client/ua_client_worker.c" "CMakeFiles/open62541-object.dir/src/client/ua_client_worker.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/client/ua_client_worker.c.o.d"
+  "/root/repo/src/pubsub/ua_pubsub_manager.c" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_manager.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_manager.c.o.d"
+  "/root/repo/src/pubsub/ua_pubsub_networkmessage.c" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_networkmessage.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_networkmessage.c.o.d"
+  "/root/repo/src/pubsub/ua_pubsub_ns0.c" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_ns0.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_ns0.c.o.d"
+  "/root/repo/src/pubsub/ua_pubsub_reader.c" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_reader.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_reader.c.o.d"
+  "/root/repo/src/pubsub/ua_pubsub_writer.c" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_writer.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_writer.c.o.d"
+  "/root/repo/src/server/ua_asyncmethod_manager.c" "CMakeFiles/open62541-object.dir/src/server/ua_asyncmethod_manager.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_asyncmethod_manager.c.o.d"
+  "/root/repo/src/server/ua_browsepathcache.c" "CMakeFiles/open62541-object.dir/src/server/ua_browsepathcache.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_browsepathcache.c.o.d"
+  "/root/repo/src/server/ua_discovery_manager.c" "CMakeFiles/open62541-object.dir/src/server/ua_discovery_manager.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_discovery_manager.c.o.d"
+  "/root/repo/src/server/ua_eventindex.c" "CMakeFiles/open62541-object.dir/src/server/ua_eventindex.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_eventindex.c.o.d"
+  "/root/repo/src/server/ua_nodes.c" "CMakeFiles/open62541-object.dir/src/server/ua_nodes.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_nodes.c.o.d"
+  "/root/repo/src/server/ua_securechannel_manager.c" "CMakeFiles/open62541-object.dir/src/server/ua_securechannel_manager.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_securechannel_manager.c.o.d"
+  "/root/repo/src/server/ua_server.c" "CMakeFiles/open62541-object.dir/src/server/ua_server.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server.c.o.d"
+  "/root/repo/src/server/ua_server_binary.c" "CMakeFiles/open62541-object.dir/src/server/ua_server_binary.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server_binary.c.o.d"
+  "/root/repo/src/server/ua_server_config.c" "CMakeFiles/open62541-object.dir/src/server/ua_server_config.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server_config.c.o.d"
+  "/root/repo/src/server/ua_server_discovery.c" "CMakeFiles/open62541-object.dir/src/server/ua_server_discovery.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server_discovery.c.o.d"
+  "/root/repo/src/server/ua_server_methodqueue.c" "CMakeFiles/open62541-object.dir/src/server/ua_server_methodqueue.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server_methodqueue.c.o.d"
+  "/root/repo/src/server/ua_server_ns0.c" "CMakeFiles/open62541-object.dir/src/server/ua_server_ns0.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server_ns0.c.o.d"
+  "/root/repo/src/server/ua_server_utils.c" "CMakeFiles/open62541-object.dir/src/server/ua_server_utils.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_server_utils.c.o.d"
+  "/root/repo/src/server/ua_services_attribute.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_attribute.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_attribute.c.o.d"
+  "/root/repo/src/server/ua_services_discovery.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery.c.o.d"
+  "/root/repo/src/server/ua_services_discovery_multicast.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery_multicast.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery_multicast.c.o.d"
+  "/root/repo/src/server/ua_services_method.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_method.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_method.c.o.d"
+  "/root/repo/src/server/ua_services_monitoreditem.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_monitoreditem.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_monitoreditem.c.o.d"
+  "/root/repo/src/server/ua_services_nodemanagement.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_nodemanagement.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_nodemanagement.c.o.d"
+  "/root/repo/src/server/ua_services_securechannel.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_securechannel.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_securechannel.c.o.d"
+  "/root/repo/src/server/ua_services_session.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_session.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_session.c.o.d"
+  "/root/repo/src/server/ua_services_subscription.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_subscription.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_subscription.c.o.d"
+  "/root/repo/src/server/ua_services_view.c" "CMakeFiles/open62541-object.dir/src/server/ua_services_view.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_services_view.c.o.d"
+  "/root/repo/src/server/ua_session.c" "CMakeFiles/open62541-object.dir/src/server/ua_session.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_session.c.o.d"
+  "/root/repo/src/server/ua_session_manager.c" "CMakeFiles/open62541-object.dir/src/server/ua_session_manager.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_session_manager.c.o.d"
+  "/root/repo/src/server/ua_slabpool.c" "CMakeFiles/open62541-object.dir/src/server/ua_slabpool.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_slabpool.c.o.d"
+  "/root/repo/src/server/ua_stringpool.c" "CMakeFiles/open62541-object.dir/src/server/ua_stringpool.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_stringpool.c.o.d"
+  "/root/repo/src/server/ua_subscription.c" "CMakeFiles/open62541-object.dir/src/server/ua_subscription.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_subscription.c.o.d"
+  "/root/repo/src/server/ua_subscription_datachange.c" "CMakeFiles/open62541-object.dir/src/server/ua_subscription_datachange.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_subscription_datachange.c.o.d"
+  "/root/repo/src/server/ua_subscription_events.c" "CMakeFiles/open62541-object.dir/src/server/ua_subscription_events.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_subscription_events.c.o.d"
+  "/root/repo/src/server/ua_subscription_monitoreditem.c" "CMakeFiles/open62541-object.dir/src/server/ua_subscription_monitoreditem.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_subscription_monitoreditem.c.o.d"
+  "/root/repo/src/server/ua_typehierarchy.c" "CMakeFiles/open62541-object.dir/src/server/ua_typehierarchy.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_typehierarchy.c.o.d"
+  "/root/repo/src/server/ua_valuecache.c" "CMakeFiles/open62541-object.dir/src/server/ua_valuecache.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_valuecache.c.o.d"
+  "/root/repo/src/server/ua_virtualnodes.c" "CMakeFiles/open62541-object.dir/src/server/ua_virtualnodes.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/server/ua_virtualnodes.c.o.d"
+  "/root/repo/src/ua_connection.c" "CMakeFiles/open62541-object.dir/src/ua_connection.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_connection.c.o.d"
+  "/root/repo/src/ua_securechannel.c" "CMakeFiles/open62541-object.dir/src/ua_securechannel.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_securechannel.c.o.d"
+  "/root/repo/src/ua_timer_wheel.c" "CMakeFiles/open62541-object.dir/src/ua_timer_wheel.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_timer_wheel.c.o.d"
+  "/root/repo/src/ua_types.c" "CMakeFiles/open62541-object.dir/src/ua_types.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_types.c.o.d"
+  "/root/repo/src/ua_types_encoding_binary.c" "CMakeFiles/open62541-object.dir/src/ua_types_encoding_binary.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_types_encoding_binary.c.o.d"
+  "/root/repo/src/ua_util.c" "CMakeFiles/open62541-object.dir/src/ua_util.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_util.c.o.d"
+  "/root/repo/src/ua_workqueue.c" "CMakeFiles/open62541-object.dir/src/ua_workqueue.c.o" "gcc" "CMakeFiles/open62541-object.dir/src/ua_workqueue.c.o.d"
+  "/root/repo/_b_wheel/src_generated/open62541/namespace0_generated.c" "CMakeFiles/open62541-object.dir/src_generated/open62541/namespace0_generated.c.o" "gcc" "CMakeFiles/open62541-object.dir/src_generated/open62541/namespace0_generated.c.o.d"
+  "/root/repo/_b_wheel/src_generated/open62541/statuscodes.c" "CMakeFiles/open62541-object.dir/src_generated/open62541/statuscodes.c.o" "gcc" "CMakeFiles/open62541-object.dir/src_generated/open62541/statuscodes.c.o.d"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c" "CMakeFiles/open62541-object.dir/src_generated/open62541/transport_generated.c.o" "gcc" "CMakeFiles/open62541-object.dir/src_generated/open62541/transport_generated.c.o.d"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated.c" "CMakeFiles/open62541-object.dir/src_generated/open62541/types_generated.c.o" "gcc" "CMakeFiles/open62541-object.dir/src_generated/open62541/types_generated.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_b_wheel/src_generated/open62541/namespace0_generated.h" "/root/repo/_b_wheel/src_generated/open62541/namespace0_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/statuscodes.c" "/root/repo/_b_wheel/src_generated/open62541/statuscodes.h"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated.h" "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated_encoding_binary.h" "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/transport_generated_handling.h" "/root/repo/_b_wheel/src_generated/open62541/transport_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated_encoding_binary.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated_handling.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
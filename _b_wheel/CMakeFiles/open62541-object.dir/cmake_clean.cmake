@@ -0,0 +1,140 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-object.dir/deps/base64.c.o"
+  "CMakeFiles/open62541-object.dir/deps/base64.c.o.d"
+  "CMakeFiles/open62541-object.dir/deps/libc_time.c.o"
+  "CMakeFiles/open62541-object.dir/deps/libc_time.c.o.d"
+  "CMakeFiles/open62541-object.dir/deps/pcg_basic.c.o"
+  "CMakeFiles/open62541-object.dir/deps/pcg_basic.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_connect.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_connect.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_connect_async.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_connect_async.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_discovery.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_discovery.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_highlevel.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_highlevel.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_subscriptions.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_subscriptions.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_worker.c.o"
+  "CMakeFiles/open62541-object.dir/src/client/ua_client_worker.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_manager.c.o"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_manager.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_networkmessage.c.o"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_networkmessage.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_ns0.c.o"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_ns0.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_reader.c.o"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_reader.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_writer.c.o"
+  "CMakeFiles/open62541-object.dir/src/pubsub/ua_pubsub_writer.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_asyncmethod_manager.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_asyncmethod_manager.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_browsepathcache.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_browsepathcache.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_discovery_manager.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_discovery_manager.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_eventindex.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_eventindex.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_nodes.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_nodes.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_securechannel_manager.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_securechannel_manager.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_binary.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_binary.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_config.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_config.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_discovery.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_discovery.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_methodqueue.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_methodqueue.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_ns0.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_ns0.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_utils.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_server_utils.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_attribute.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_attribute.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery_multicast.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_discovery_multicast.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_method.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_method.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_monitoreditem.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_monitoreditem.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_nodemanagement.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_nodemanagement.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_securechannel.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_securechannel.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_session.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_session.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_subscription.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_subscription.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_view.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_services_view.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_session.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_session.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_session_manager.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_session_manager.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_slabpool.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_slabpool.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_stringpool.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_stringpool.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription_datachange.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription_datachange.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription_events.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription_events.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription_monitoreditem.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_subscription_monitoreditem.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_typehierarchy.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_typehierarchy.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_valuecache.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_valuecache.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/server/ua_virtualnodes.c.o"
+  "CMakeFiles/open62541-object.dir/src/server/ua_virtualnodes.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_connection.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_connection.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_securechannel.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_securechannel.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_timer_wheel.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_timer_wheel.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_types.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_types.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_types_encoding_binary.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_types_encoding_binary.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_util.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_util.c.o.d"
+  "CMakeFiles/open62541-object.dir/src/ua_workqueue.c.o"
+  "CMakeFiles/open62541-object.dir/src/ua_workqueue.c.o.d"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/namespace0_generated.c.o"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/namespace0_generated.c.o.d"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/statuscodes.c.o"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/statuscodes.c.o.d"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/transport_generated.c.o"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/transport_generated.c.o.d"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/types_generated.c.o"
+  "CMakeFiles/open62541-object.dir/src_generated/open62541/types_generated.c.o.d"
+  "src_generated/open62541/namespace0_generated.c"
+  "src_generated/open62541/namespace0_generated.h"
+  "src_generated/open62541/nodeids.h"
+  "src_generated/open62541/statuscodes.c"
+  "src_generated/open62541/statuscodes.h"
+  "src_generated/open62541/transport_generated.c"
+  "src_generated/open62541/transport_generated.h"
+  "src_generated/open62541/transport_generated_encoding_binary.h"
+  "src_generated/open62541/transport_generated_handling.h"
+  "src_generated/open62541/types_generated.c"
+  "src_generated/open62541/types_generated.h"
+  "src_generated/open62541/types_generated_encoding_binary.h"
+  "src_generated/open62541/types_generated_handling.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/open62541-object.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/arch/network_tcp.c" "CMakeFiles/open62541-plugins.dir/arch/network_tcp.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/arch/network_tcp.c.o.d"
+  "/root/repo/arch/posix/ua_architecture_functions.c" "CMakeFiles/open62541-plugins.dir/arch/posix/ua_architecture_functions.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/arch/posix/ua_architecture_functions.c.o.d"
+  "/root/repo/arch/posix/ua_clock.c" "CMakeFiles/open62541-plugins.dir/arch/posix/ua_clock.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/arch/posix/ua_clock.c.o.d"
+  "/root/repo/plugins/securityPolicies/securitypolicy_mbedtls_common.c" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/securitypolicy_mbedtls_common.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/securitypolicy_mbedtls_common.c.o.d"
+  "/root/repo/plugins/securityPolicies/ua_securitypolicy_basic128rsa15.c" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic128rsa15.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic128rsa15.c.o.d"
+  "/root/repo/plugins/securityPolicies/ua_securitypolicy_basic256.c" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256.c.o.d"
+  "/root/repo/plugins/securityPolicies/ua_securitypolicy_basic256sha256.c" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256sha256.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256sha256.c.o.d"
+  "/root/repo/plugins/securityPolicies/ua_securitypolicy_none.c" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_none.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_none.c.o.d"
+  "/root/repo/plugins/ua_accesscontrol_default.c" "CMakeFiles/open62541-plugins.dir/plugins/ua_accesscontrol_default.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/ua_accesscontrol_default.c.o.d"
+  "/root/repo/plugins/ua_config_default.c" "CMakeFiles/open62541-plugins.dir/plugins/ua_config_default.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/ua_config_default.c.o.d"
+  "/root/repo/plugins/ua_log_stdout.c" "CMakeFiles/open62541-plugins.dir/plugins/ua_log_stdout.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/ua_log_stdout.c.o.d"
+  "/root/repo/plugins/ua_nodestore_default.c" "CMakeFiles/open62541-plugins.dir/plugins/ua_nodestore_default.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/ua_nodestore_default.c.o.d"
+  "/root/repo/plugins/ua_pki_default.c" "CMakeFiles/open62541-plugins.dir/plugins/ua_pki_default.c.o" "gcc" "CMakeFiles/open62541-plugins.dir/plugins/ua_pki_default.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_b_wheel/src_generated/open62541/statuscodes.c" "/root/repo/_b_wheel/src_generated/open62541/statuscodes.h"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated_encoding_binary.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  "/root/repo/_b_wheel/src_generated/open62541/types_generated_handling.h" "/root/repo/_b_wheel/src_generated/open62541/types_generated.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,40 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-plugins.dir/arch/network_tcp.c.o"
+  "CMakeFiles/open62541-plugins.dir/arch/network_tcp.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/arch/posix/ua_architecture_functions.c.o"
+  "CMakeFiles/open62541-plugins.dir/arch/posix/ua_architecture_functions.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/arch/posix/ua_clock.c.o"
+  "CMakeFiles/open62541-plugins.dir/arch/posix/ua_clock.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/securitypolicy_mbedtls_common.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/securitypolicy_mbedtls_common.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic128rsa15.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic128rsa15.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256sha256.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_basic256sha256.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_none.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/securityPolicies/ua_securitypolicy_none.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_accesscontrol_default.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_accesscontrol_default.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_config_default.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_config_default.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_log_stdout.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_log_stdout.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_nodestore_default.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_nodestore_default.c.o.d"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_pki_default.c.o"
+  "CMakeFiles/open62541-plugins.dir/plugins/ua_pki_default.c.o.d"
+  "src_generated/open62541/nodeids.h"
+  "src_generated/open62541/statuscodes.c"
+  "src_generated/open62541/statuscodes.h"
+  "src_generated/open62541/types_generated.c"
+  "src_generated/open62541/types_generated.h"
+  "src_generated/open62541/types_generated_encoding_binary.h"
+  "src_generated/open62541/types_generated_handling.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/open62541-plugins.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
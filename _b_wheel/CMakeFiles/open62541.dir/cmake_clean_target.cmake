@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "bin/libopen62541.a"
+)
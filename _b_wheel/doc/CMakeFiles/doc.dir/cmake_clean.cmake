@@ -0,0 +1,36 @@
+file(REMOVE_RECURSE
+  "../doc_src/client.rst"
+  "../doc_src/client_config.rst"
+  "../doc_src/client_highlevel.rst"
+  "../doc_src/client_subscriptions.rst"
+  "../doc_src/constants.rst"
+  "../doc_src/nodestore.rst"
+  "../doc_src/plugin_accesscontrol.rst"
+  "../doc_src/plugin_log.rst"
+  "../doc_src/plugin_network.rst"
+  "../doc_src/plugin_pubsub_connection.rst"
+  "../doc_src/pubsub.rst"
+  "../doc_src/server.rst"
+  "../doc_src/server_config.rst"
+  "../doc_src/services.rst"
+  "../doc_src/statuscodes.rst"
+  "../doc_src/tutorial_client_firststeps.rst"
+  "../doc_src/tutorial_datatypes.rst"
+  "../doc_src/tutorial_pubsub_publish.rst"
+  "../doc_src/tutorial_server_datasource.rst"
+  "../doc_src/tutorial_server_events.rst"
+  "../doc_src/tutorial_server_firststeps.rst"
+  "../doc_src/tutorial_server_method.rst"
+  "../doc_src/tutorial_server_monitoreditems.rst"
+  "../doc_src/tutorial_server_object.rst"
+  "../doc_src/tutorial_server_variable.rst"
+  "../doc_src/tutorial_server_variabletype.rst"
+  "../doc_src/types.rst"
+  "../doc_src/types_generated.rst"
+  "CMakeFiles/doc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/doc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
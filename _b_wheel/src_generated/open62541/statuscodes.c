@@ -0,0 +1,268 @@
+/**********************************************************
+ * Autogenerated -- do not modify
+ * Generated from /root/repo/tools/schema/StatusCode.csv with script /root/repo/tools/generate_statuscode_descriptions.py
+ *********************************************************/
+
+#include <open62541/types.h>
+
+typedef struct {
+    UA_StatusCode code;
+    const char *name;
+} UA_StatusCodeName;
+
+#ifndef UA_ENABLE_STATUSCODE_DESCRIPTIONS
+static const char * emptyStatusCodeName = "";
+const char * UA_StatusCode_name(UA_StatusCode code) {
+    return emptyStatusCodeName;
+}
+#else
+static const size_t statusCodeDescriptionsSize = 237;
+static const UA_StatusCodeName statusCodeDescriptions[237] = {
+    {UA_STATUSCODE_GOOD, "Good"},
+    {UA_STATUSCODE_BADUNEXPECTEDERROR, "BadUnexpectedError"},
+    {UA_STATUSCODE_BADINTERNALERROR, "BadInternalError"},
+    {UA_STATUSCODE_BADOUTOFMEMORY, "BadOutOfMemory"},
+    {UA_STATUSCODE_BADRESOURCEUNAVAILABLE, "BadResourceUnavailable"},
+    {UA_STATUSCODE_BADCOMMUNICATIONERROR, "BadCommunicationError"},
+    {UA_STATUSCODE_BADENCODINGERROR, "BadEncodingError"},
+    {UA_STATUSCODE_BADDECODINGERROR, "BadDecodingError"},
+    {UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED, "BadEncodingLimitsExceeded"},
+    {UA_STATUSCODE_BADREQUESTTOOLARGE, "BadRequestTooLarge"},
+    {UA_STATUSCODE_BADRESPONSETOOLARGE, "BadResponseTooLarge"},
+    {UA_STATUSCODE_BADUNKNOWNRESPONSE, "BadUnknownResponse"},
+    {UA_STATUSCODE_BADTIMEOUT, "BadTimeout"},
+    {UA_STATUSCODE_BADSERVICEUNSUPPORTED, "BadServiceUnsupported"},
+    {UA_STATUSCODE_BADSHUTDOWN, "BadShutdown"},
+    {UA_STATUSCODE_BADSERVERNOTCONNECTED, "BadServerNotConnected"},
+    {UA_STATUSCODE_BADSERVERHALTED, "BadServerHalted"},
+    {UA_STATUSCODE_BADNOTHINGTODO, "BadNothingToDo"},
+    {UA_STATUSCODE_BADTOOMANYOPERATIONS, "BadTooManyOperations"},
+    {UA_STATUSCODE_BADTOOMANYMONITOREDITEMS, "BadTooManyMonitoredItems"},
+    {UA_STATUSCODE_BADDATATYPEIDUNKNOWN, "BadDataTypeIdUnknown"},
+    {UA_STATUSCODE_BADCERTIFICATEINVALID, "BadCertificateInvalid"},
+    {UA_STATUSCODE_BADSECURITYCHECKSFAILED, "BadSecurityChecksFailed"},
+    {UA_STATUSCODE_BADCERTIFICATEPOLICYCHECKFAILED, "BadCertificatePolicyCheckFailed"},
+    {UA_STATUSCODE_BADCERTIFICATETIMEINVALID, "BadCertificateTimeInvalid"},
+    {UA_STATUSCODE_BADCERTIFICATEISSUERTIMEINVALID, "BadCertificateIssuerTimeInvalid"},
+    {UA_STATUSCODE_BADCERTIFICATEHOSTNAMEINVALID, "BadCertificateHostNameInvalid"},
+    {UA_STATUSCODE_BADCERTIFICATEURIINVALID, "BadCertificateUriInvalid"},
+    {UA_STATUSCODE_BADCERTIFICATEUSENOTALLOWED, "BadCertificateUseNotAllowed"},
+    {UA_STATUSCODE_BADCERTIFICATEISSUERUSENOTALLOWED, "BadCertificateIssuerUseNotAllowed"},
+    {UA_STATUSCODE_BADCERTIFICATEUNTRUSTED, "BadCertificateUntrusted"},
+    {UA_STATUSCODE_BADCERTIFICATEREVOCATIONUNKNOWN, "BadCertificateRevocationUnknown"},
+    {UA_STATUSCODE_BADCERTIFICATEISSUERREVOCATIONUNKNOWN, "BadCertificateIssuerRevocationUnknown"},
+    {UA_STATUSCODE_BADCERTIFICATEREVOKED, "BadCertificateRevoked"},
+    {UA_STATUSCODE_BADCERTIFICATEISSUERREVOKED, "BadCertificateIssuerRevoked"},
+    {UA_STATUSCODE_BADCERTIFICATECHAININCOMPLETE, "BadCertificateChainIncomplete"},
+    {UA_STATUSCODE_BADUSERACCESSDENIED, "BadUserAccessDenied"},
+    {UA_STATUSCODE_BADIDENTITYTOKENINVALID, "BadIdentityTokenInvalid"},
+    {UA_STATUSCODE_BADIDENTITYTOKENREJECTED, "BadIdentityTokenRejected"},
+    {UA_STATUSCODE_BADSECURECHANNELIDINVALID, "BadSecureChannelIdInvalid"},
+    {UA_STATUSCODE_BADINVALIDTIMESTAMP, "BadInvalidTimestamp"},
+    {UA_STATUSCODE_BADNONCEINVALID, "BadNonceInvalid"},
+    {UA_STATUSCODE_BADSESSIONIDINVALID, "BadSessionIdInvalid"},
+    {UA_STATUSCODE_BADSESSIONCLOSED, "BadSessionClosed"},
+    {UA_STATUSCODE_BADSESSIONNOTACTIVATED, "BadSessionNotActivated"},
+    {UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID, "BadSubscriptionIdInvalid"},
+    {UA_STATUSCODE_BADREQUESTHEADERINVALID, "BadRequestHeaderInvalid"},
+    {UA_STATUSCODE_BADTIMESTAMPSTORETURNINVALID, "BadTimestampsToReturnInvalid"},
+    {UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT, "BadRequestCancelledByClient"},
+    {UA_STATUSCODE_BADTOOMANYARGUMENTS, "BadTooManyArguments"},
+    {UA_STATUSCODE_BADLICENSEEXPIRED, "BadLicenseExpired"},
+    {UA_STATUSCODE_BADLICENSELIMITSEXCEEDED, "BadLicenseLimitsExceeded"},
+    {UA_STATUSCODE_BADLICENSENOTAVAILABLE, "BadLicenseNotAvailable"},
+    {UA_STATUSCODE_GOODSUBSCRIPTIONTRANSFERRED, "GoodSubscriptionTransferred"},
+    {UA_STATUSCODE_GOODCOMPLETESASYNCHRONOUSLY, "GoodCompletesAsynchronously"},
+    {UA_STATUSCODE_GOODOVERLOAD, "GoodOverload"},
+    {UA_STATUSCODE_GOODCLAMPED, "GoodClamped"},
+    {UA_STATUSCODE_BADNOCOMMUNICATION, "BadNoCommunication"},
+    {UA_STATUSCODE_BADWAITINGFORINITIALDATA, "BadWaitingForInitialData"},
+    {UA_STATUSCODE_BADNODEIDINVALID, "BadNodeIdInvalid"},
+    {UA_STATUSCODE_BADNODEIDUNKNOWN, "BadNodeIdUnknown"},
+    {UA_STATUSCODE_BADATTRIBUTEIDINVALID, "BadAttributeIdInvalid"},
+    {UA_STATUSCODE_BADINDEXRANGEINVALID, "BadIndexRangeInvalid"},
+    {UA_STATUSCODE_BADINDEXRANGENODATA, "BadIndexRangeNoData"},
+    {UA_STATUSCODE_BADDATAENCODINGINVALID, "BadDataEncodingInvalid"},
+    {UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED, "BadDataEncodingUnsupported"},
+    {UA_STATUSCODE_BADNOTREADABLE, "BadNotReadable"},
+    {UA_STATUSCODE_BADNOTWRITABLE, "BadNotWritable"},
+    {UA_STATUSCODE_BADOUTOFRANGE, "BadOutOfRange"},
+    {UA_STATUSCODE_BADNOTSUPPORTED, "BadNotSupported"},
+    {UA_STATUSCODE_BADNOTFOUND, "BadNotFound"},
+    {UA_STATUSCODE_BADOBJECTDELETED, "BadObjectDeleted"},
+    {UA_STATUSCODE_BADNOTIMPLEMENTED, "BadNotImplemented"},
+    {UA_STATUSCODE_BADMONITORINGMODEINVALID, "BadMonitoringModeInvalid"},
+    {UA_STATUSCODE_BADMONITOREDITEMIDINVALID, "BadMonitoredItemIdInvalid"},
+    {UA_STATUSCODE_BADMONITOREDITEMFILTERINVALID, "BadMonitoredItemFilterInvalid"},
+    {UA_STATUSCODE_BADMONITOREDITEMFILTERUNSUPPORTED, "BadMonitoredItemFilterUnsupported"},
+    {UA_STATUSCODE_BADFILTERNOTALLOWED, "BadFilterNotAllowed"},
+    {UA_STATUSCODE_BADSTRUCTUREMISSING, "BadStructureMissing"},
+    {UA_STATUSCODE_BADEVENTFILTERINVALID, "BadEventFilterInvalid"},
+    {UA_STATUSCODE_BADCONTENTFILTERINVALID, "BadContentFilterInvalid"},
+    {UA_STATUSCODE_BADFILTEROPERATORINVALID, "BadFilterOperatorInvalid"},
+    {UA_STATUSCODE_BADFILTEROPERATORUNSUPPORTED, "BadFilterOperatorUnsupported"},
+    {UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH, "BadFilterOperandCountMismatch"},
+    {UA_STATUSCODE_BADFILTEROPERANDINVALID, "BadFilterOperandInvalid"},
+    {UA_STATUSCODE_BADFILTERELEMENTINVALID, "BadFilterElementInvalid"},
+    {UA_STATUSCODE_BADFILTERLITERALINVALID, "BadFilterLiteralInvalid"},
+    {UA_STATUSCODE_BADCONTINUATIONPOINTINVALID, "BadContinuationPointInvalid"},
+    {UA_STATUSCODE_BADNOCONTINUATIONPOINTS, "BadNoContinuationPoints"},
+    {UA_STATUSCODE_BADREFERENCETYPEIDINVALID, "BadReferenceTypeIdInvalid"},
+    {UA_STATUSCODE_BADBROWSEDIRECTIONINVALID, "BadBrowseDirectionInvalid"},
+    {UA_STATUSCODE_BADNODENOTINVIEW, "BadNodeNotInView"},
+    {UA_STATUSCODE_BADNUMERICOVERFLOW, "BadNumericOverflow"},
+    {UA_STATUSCODE_BADSERVERURIINVALID, "BadServerUriInvalid"},
+    {UA_STATUSCODE_BADSERVERNAMEMISSING, "BadServerNameMissing"},
+    {UA_STATUSCODE_BADDISCOVERYURLMISSING, "BadDiscoveryUrlMissing"},
+    {UA_STATUSCODE_BADSEMPAHOREFILEMISSING, "BadSempahoreFileMissing"},
+    {UA_STATUSCODE_BADREQUESTTYPEINVALID, "BadRequestTypeInvalid"},
+    {UA_STATUSCODE_BADSECURITYMODEREJECTED, "BadSecurityModeRejected"},
+    {UA_STATUSCODE_BADSECURITYPOLICYREJECTED, "BadSecurityPolicyRejected"},
+    {UA_STATUSCODE_BADTOOMANYSESSIONS, "BadTooManySessions"},
+    {UA_STATUSCODE_BADUSERSIGNATUREINVALID, "BadUserSignatureInvalid"},
+    {UA_STATUSCODE_BADAPPLICATIONSIGNATUREINVALID, "BadApplicationSignatureInvalid"},
+    {UA_STATUSCODE_BADNOVALIDCERTIFICATES, "BadNoValidCertificates"},
+    {UA_STATUSCODE_BADIDENTITYCHANGENOTSUPPORTED, "BadIdentityChangeNotSupported"},
+    {UA_STATUSCODE_BADREQUESTCANCELLEDBYREQUEST, "BadRequestCancelledByRequest"},
+    {UA_STATUSCODE_BADPARENTNODEIDINVALID, "BadParentNodeIdInvalid"},
+    {UA_STATUSCODE_BADREFERENCENOTALLOWED, "BadReferenceNotAllowed"},
+    {UA_STATUSCODE_BADNODEIDREJECTED, "BadNodeIdRejected"},
+    {UA_STATUSCODE_BADNODEIDEXISTS, "BadNodeIdExists"},
+    {UA_STATUSCODE_BADNODECLASSINVALID, "BadNodeClassInvalid"},
+    {UA_STATUSCODE_BADBROWSENAMEINVALID, "BadBrowseNameInvalid"},
+    {UA_STATUSCODE_BADBROWSENAMEDUPLICATED, "BadBrowseNameDuplicated"},
+    {UA_STATUSCODE_BADNODEATTRIBUTESINVALID, "BadNodeAttributesInvalid"},
+    {UA_STATUSCODE_BADTYPEDEFINITIONINVALID, "BadTypeDefinitionInvalid"},
+    {UA_STATUSCODE_BADSOURCENODEIDINVALID, "BadSourceNodeIdInvalid"},
+    {UA_STATUSCODE_BADTARGETNODEIDINVALID, "BadTargetNodeIdInvalid"},
+    {UA_STATUSCODE_BADDUPLICATEREFERENCENOTALLOWED, "BadDuplicateReferenceNotAllowed"},
+    {UA_STATUSCODE_BADINVALIDSELFREFERENCE, "BadInvalidSelfReference"},
+    {UA_STATUSCODE_BADREFERENCELOCALONLY, "BadReferenceLocalOnly"},
+    {UA_STATUSCODE_BADNODELETERIGHTS, "BadNoDeleteRights"},
+    {UA_STATUSCODE_UNCERTAINREFERENCENOTDELETED, "UncertainReferenceNotDeleted"},
+    {UA_STATUSCODE_BADSERVERINDEXINVALID, "BadServerIndexInvalid"},
+    {UA_STATUSCODE_BADVIEWIDUNKNOWN, "BadViewIdUnknown"},
+    {UA_STATUSCODE_BADVIEWTIMESTAMPINVALID, "BadViewTimestampInvalid"},
+    {UA_STATUSCODE_BADVIEWPARAMETERMISMATCH, "BadViewParameterMismatch"},
+    {UA_STATUSCODE_BADVIEWVERSIONINVALID, "BadViewVersionInvalid"},
+    {UA_STATUSCODE_UNCERTAINNOTALLNODESAVAILABLE, "UncertainNotAllNodesAvailable"},
+    {UA_STATUSCODE_GOODRESULTSMAYBEINCOMPLETE, "GoodResultsMayBeIncomplete"},
+    {UA_STATUSCODE_BADNOTTYPEDEFINITION, "BadNotTypeDefinition"},
+    {UA_STATUSCODE_UNCERTAINREFERENCEOUTOFSERVER, "UncertainReferenceOutOfServer"},
+    {UA_STATUSCODE_BADTOOMANYMATCHES, "BadTooManyMatches"},
+    {UA_STATUSCODE_BADQUERYTOOCOMPLEX, "BadQueryTooComplex"},
+    {UA_STATUSCODE_BADNOMATCH, "BadNoMatch"},
+    {UA_STATUSCODE_BADMAXAGEINVALID, "BadMaxAgeInvalid"},
+    {UA_STATUSCODE_BADSECURITYMODEINSUFFICIENT, "BadSecurityModeInsufficient"},
+    {UA_STATUSCODE_BADHISTORYOPERATIONINVALID, "BadHistoryOperationInvalid"},
+    {UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED, "BadHistoryOperationUnsupported"},
+    {UA_STATUSCODE_BADINVALIDTIMESTAMPARGUMENT, "BadInvalidTimestampArgument"},
+    {UA_STATUSCODE_BADWRITENOTSUPPORTED, "BadWriteNotSupported"},
+    {UA_STATUSCODE_BADTYPEMISMATCH, "BadTypeMismatch"},
+    {UA_STATUSCODE_BADMETHODINVALID, "BadMethodInvalid"},
+    {UA_STATUSCODE_BADARGUMENTSMISSING, "BadArgumentsMissing"},
+    {UA_STATUSCODE_BADNOTEXECUTABLE, "BadNotExecutable"},
+    {UA_STATUSCODE_BADTOOMANYSUBSCRIPTIONS, "BadTooManySubscriptions"},
+    {UA_STATUSCODE_BADTOOMANYPUBLISHREQUESTS, "BadTooManyPublishRequests"},
+    {UA_STATUSCODE_BADNOSUBSCRIPTION, "BadNoSubscription"},
+    {UA_STATUSCODE_BADSEQUENCENUMBERUNKNOWN, "BadSequenceNumberUnknown"},
+    {UA_STATUSCODE_BADMESSAGENOTAVAILABLE, "BadMessageNotAvailable"},
+    {UA_STATUSCODE_BADINSUFFICIENTCLIENTPROFILE, "BadInsufficientClientProfile"},
+    {UA_STATUSCODE_BADSTATENOTACTIVE, "BadStateNotActive"},
+    {UA_STATUSCODE_BADALREADYEXISTS, "BadAlreadyExists"},
+    {UA_STATUSCODE_BADTCPSERVERTOOBUSY, "BadTcpServerTooBusy"},
+    {UA_STATUSCODE_BADTCPMESSAGETYPEINVALID, "BadTcpMessageTypeInvalid"},
+    {UA_STATUSCODE_BADTCPSECURECHANNELUNKNOWN, "BadTcpSecureChannelUnknown"},
+    {UA_STATUSCODE_BADTCPMESSAGETOOLARGE, "BadTcpMessageTooLarge"},
+    {UA_STATUSCODE_BADTCPNOTENOUGHRESOURCES, "BadTcpNotEnoughResources"},
+    {UA_STATUSCODE_BADTCPINTERNALERROR, "BadTcpInternalError"},
+    {UA_STATUSCODE_BADTCPENDPOINTURLINVALID, "BadTcpEndpointUrlInvalid"},
+    {UA_STATUSCODE_BADREQUESTINTERRUPTED, "BadRequestInterrupted"},
+    {UA_STATUSCODE_BADREQUESTTIMEOUT, "BadRequestTimeout"},
+    {UA_STATUSCODE_BADSECURECHANNELCLOSED, "BadSecureChannelClosed"},
+    {UA_STATUSCODE_BADSECURECHANNELTOKENUNKNOWN, "BadSecureChannelTokenUnknown"},
+    {UA_STATUSCODE_BADSEQUENCENUMBERINVALID, "BadSequenceNumberInvalid"},
+    {UA_STATUSCODE_BADPROTOCOLVERSIONUNSUPPORTED, "BadProtocolVersionUnsupported"},
+    {UA_STATUSCODE_BADCONFIGURATIONERROR, "BadConfigurationError"},
+    {UA_STATUSCODE_BADNOTCONNECTED, "BadNotConnected"},
+    {UA_STATUSCODE_BADDEVICEFAILURE, "BadDeviceFailure"},
+    {UA_STATUSCODE_BADSENSORFAILURE, "BadSensorFailure"},
+    {UA_STATUSCODE_BADOUTOFSERVICE, "BadOutOfService"},
+    {UA_STATUSCODE_BADDEADBANDFILTERINVALID, "BadDeadbandFilterInvalid"},
+    {UA_STATUSCODE_UNCERTAINNOCOMMUNICATIONLASTUSABLEVALUE, "UncertainNoCommunicationLastUsableValue"},
+    {UA_STATUSCODE_UNCERTAINLASTUSABLEVALUE, "UncertainLastUsableValue"},
+    {UA_STATUSCODE_UNCERTAINSUBSTITUTEVALUE, "UncertainSubstituteValue"},
+    {UA_STATUSCODE_UNCERTAININITIALVALUE, "UncertainInitialValue"},
+    {UA_STATUSCODE_UNCERTAINSENSORNOTACCURATE, "UncertainSensorNotAccurate"},
+    {UA_STATUSCODE_UNCERTAINENGINEERINGUNITSEXCEEDED, "UncertainEngineeringUnitsExceeded"},
+    {UA_STATUSCODE_UNCERTAINSUBNORMAL, "UncertainSubNormal"},
+    {UA_STATUSCODE_GOODLOCALOVERRIDE, "GoodLocalOverride"},
+    {UA_STATUSCODE_BADREFRESHINPROGRESS, "BadRefreshInProgress"},
+    {UA_STATUSCODE_BADCONDITIONALREADYDISABLED, "BadConditionAlreadyDisabled"},
+    {UA_STATUSCODE_BADCONDITIONALREADYENABLED, "BadConditionAlreadyEnabled"},
+    {UA_STATUSCODE_BADCONDITIONDISABLED, "BadConditionDisabled"},
+    {UA_STATUSCODE_BADEVENTIDUNKNOWN, "BadEventIdUnknown"},
+    {UA_STATUSCODE_BADEVENTNOTACKNOWLEDGEABLE, "BadEventNotAcknowledgeable"},
+    {UA_STATUSCODE_BADDIALOGNOTACTIVE, "BadDialogNotActive"},
+    {UA_STATUSCODE_BADDIALOGRESPONSEINVALID, "BadDialogResponseInvalid"},
+    {UA_STATUSCODE_BADCONDITIONBRANCHALREADYACKED, "BadConditionBranchAlreadyAcked"},
+    {UA_STATUSCODE_BADCONDITIONBRANCHALREADYCONFIRMED, "BadConditionBranchAlreadyConfirmed"},
+    {UA_STATUSCODE_BADCONDITIONALREADYSHELVED, "BadConditionAlreadyShelved"},
+    {UA_STATUSCODE_BADCONDITIONNOTSHELVED, "BadConditionNotShelved"},
+    {UA_STATUSCODE_BADSHELVINGTIMEOUTOFRANGE, "BadShelvingTimeOutOfRange"},
+    {UA_STATUSCODE_BADNODATA, "BadNoData"},
+    {UA_STATUSCODE_BADBOUNDNOTFOUND, "BadBoundNotFound"},
+    {UA_STATUSCODE_BADBOUNDNOTSUPPORTED, "BadBoundNotSupported"},
+    {UA_STATUSCODE_BADDATALOST, "BadDataLost"},
+    {UA_STATUSCODE_BADDATAUNAVAILABLE, "BadDataUnavailable"},
+    {UA_STATUSCODE_BADENTRYEXISTS, "BadEntryExists"},
+    {UA_STATUSCODE_BADNOENTRYEXISTS, "BadNoEntryExists"},
+    {UA_STATUSCODE_BADTIMESTAMPNOTSUPPORTED, "BadTimestampNotSupported"},
+    {UA_STATUSCODE_GOODENTRYINSERTED, "GoodEntryInserted"},
+    {UA_STATUSCODE_GOODENTRYREPLACED, "GoodEntryReplaced"},
+    {UA_STATUSCODE_UNCERTAINDATASUBNORMAL, "UncertainDataSubNormal"},
+    {UA_STATUSCODE_GOODNODATA, "GoodNoData"},
+    {UA_STATUSCODE_GOODMOREDATA, "GoodMoreData"},
+    {UA_STATUSCODE_BADAGGREGATELISTMISMATCH, "BadAggregateListMismatch"},
+    {UA_STATUSCODE_BADAGGREGATENOTSUPPORTED, "BadAggregateNotSupported"},
+    {UA_STATUSCODE_BADAGGREGATEINVALIDINPUTS, "BadAggregateInvalidInputs"},
+    {UA_STATUSCODE_BADAGGREGATECONFIGURATIONREJECTED, "BadAggregateConfigurationRejected"},
+    {UA_STATUSCODE_GOODDATAIGNORED, "GoodDataIgnored"},
+    {UA_STATUSCODE_BADREQUESTNOTALLOWED, "BadRequestNotAllowed"},
+    {UA_STATUSCODE_BADREQUESTNOTCOMPLETE, "BadRequestNotComplete"},
+    {UA_STATUSCODE_GOODEDITED, "GoodEdited"},
+    {UA_STATUSCODE_GOODPOSTACTIONFAILED, "GoodPostActionFailed"},
+    {UA_STATUSCODE_UNCERTAINDOMINANTVALUECHANGED, "UncertainDominantValueChanged"},
+    {UA_STATUSCODE_GOODDEPENDENTVALUECHANGED, "GoodDependentValueChanged"},
+    {UA_STATUSCODE_BADDOMINANTVALUECHANGED, "BadDominantValueChanged"},
+    {UA_STATUSCODE_UNCERTAINDEPENDENTVALUECHANGED, "UncertainDependentValueChanged"},
+    {UA_STATUSCODE_BADDEPENDENTVALUECHANGED, "BadDependentValueChanged"},
+    {UA_STATUSCODE_GOODCOMMUNICATIONEVENT, "GoodCommunicationEvent"},
+    {UA_STATUSCODE_GOODSHUTDOWNEVENT, "GoodShutdownEvent"},
+    {UA_STATUSCODE_GOODCALLAGAIN, "GoodCallAgain"},
+    {UA_STATUSCODE_GOODNONCRITICALTIMEOUT, "GoodNonCriticalTimeout"},
+    {UA_STATUSCODE_BADINVALIDARGUMENT, "BadInvalidArgument"},
+    {UA_STATUSCODE_BADCONNECTIONREJECTED, "BadConnectionRejected"},
+    {UA_STATUSCODE_BADDISCONNECT, "BadDisconnect"},
+    {UA_STATUSCODE_BADCONNECTIONCLOSED, "BadConnectionClosed"},
+    {UA_STATUSCODE_BADINVALIDSTATE, "BadInvalidState"},
+    {UA_STATUSCODE_BADENDOFSTREAM, "BadEndOfStream"},
+    {UA_STATUSCODE_BADNODATAAVAILABLE, "BadNoDataAvailable"},
+    {UA_STATUSCODE_BADWAITINGFORRESPONSE, "BadWaitingForResponse"},
+    {UA_STATUSCODE_BADOPERATIONABANDONED, "BadOperationAbandoned"},
+    {UA_STATUSCODE_BADEXPECTEDSTREAMTOBLOCK, "BadExpectedStreamToBlock"},
+    {UA_STATUSCODE_BADWOULDBLOCK, "BadWouldBlock"},
+    {UA_STATUSCODE_BADSYNTAXERROR, "BadSyntaxError"},
+    {UA_STATUSCODE_BADMAXCONNECTIONSREACHED, "BadMaxConnectionsReached"},
+    {0xffffffff, "Unknown StatusCode"}
+};
+
+const char * UA_StatusCode_name(UA_StatusCode code) {
+    for (size_t i = 0; i < statusCodeDescriptionsSize; ++i) {
+        if (statusCodeDescriptions[i].code == code)
+            return statusCodeDescriptions[i].name;
+    }
+    return statusCodeDescriptions[statusCodeDescriptionsSize-1].name;
+}
+
+#endif
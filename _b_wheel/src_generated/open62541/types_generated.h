@@ -0,0 +1,2459 @@
+/* Generated from Opc.Ua.Types.bsd with script /root/repo/tools/generate_datatypes.py
+ * on host vm by user root at 2026-10-18 06:02:16 */
+
+#ifndef TYPES_GENERATED_H_
+#define TYPES_GENERATED_H_
+
+#ifdef UA_ENABLE_AMALGAMATION
+#include "open62541.h"
+#else
+#include <open62541/types.h>
+
+#endif
+
+_UA_BEGIN_DECLS
+
+
+/**
+ * Every type is assigned an index in an array containing the type descriptions.
+ * These descriptions are used during type handling (copying, deletion,
+ * binary encoding, ...). */
+#define UA_TYPES_COUNT 190
+extern UA_EXPORT const UA_DataType UA_TYPES[UA_TYPES_COUNT];
+
+/**
+ * Boolean
+ * ^^^^^^^
+ */
+#define UA_TYPES_BOOLEAN 0
+
+/**
+ * SByte
+ * ^^^^^
+ */
+#define UA_TYPES_SBYTE 1
+
+/**
+ * Byte
+ * ^^^^
+ */
+#define UA_TYPES_BYTE 2
+
+/**
+ * Int16
+ * ^^^^^
+ */
+#define UA_TYPES_INT16 3
+
+/**
+ * UInt16
+ * ^^^^^^
+ */
+#define UA_TYPES_UINT16 4
+
+/**
+ * Int32
+ * ^^^^^
+ */
+#define UA_TYPES_INT32 5
+
+/**
+ * UInt32
+ * ^^^^^^
+ */
+#define UA_TYPES_UINT32 6
+
+/**
+ * Int64
+ * ^^^^^
+ */
+#define UA_TYPES_INT64 7
+
+/**
+ * UInt64
+ * ^^^^^^
+ */
+#define UA_TYPES_UINT64 8
+
+/**
+ * Float
+ * ^^^^^
+ */
+#define UA_TYPES_FLOAT 9
+
+/**
+ * Double
+ * ^^^^^^
+ */
+#define UA_TYPES_DOUBLE 10
+
+/**
+ * String
+ * ^^^^^^
+ */
+#define UA_TYPES_STRING 11
+
+/**
+ * DateTime
+ * ^^^^^^^^
+ */
+#define UA_TYPES_DATETIME 12
+
+/**
+ * Guid
+ * ^^^^
+ */
+#define UA_TYPES_GUID 13
+
+/**
+ * ByteString
+ * ^^^^^^^^^^
+ */
+#define UA_TYPES_BYTESTRING 14
+
+/**
+ * XmlElement
+ * ^^^^^^^^^^
+ */
+#define UA_TYPES_XMLELEMENT 15
+
+/**
+ * NodeId
+ * ^^^^^^
+ */
+#define UA_TYPES_NODEID 16
+
+/**
+ * ExpandedNodeId
+ * ^^^^^^^^^^^^^^
+ */
+#define UA_TYPES_EXPANDEDNODEID 17
+
+/**
+ * StatusCode
+ * ^^^^^^^^^^
+ */
+#define UA_TYPES_STATUSCODE 18
+
+/**
+ * QualifiedName
+ * ^^^^^^^^^^^^^
+ */
+#define UA_TYPES_QUALIFIEDNAME 19
+
+/**
+ * LocalizedText
+ * ^^^^^^^^^^^^^
+ */
+#define UA_TYPES_LOCALIZEDTEXT 20
+
+/**
+ * ExtensionObject
+ * ^^^^^^^^^^^^^^^
+ */
+#define UA_TYPES_EXTENSIONOBJECT 21
+
+/**
+ * DataValue
+ * ^^^^^^^^^
+ */
+#define UA_TYPES_DATAVALUE 22
+
+/**
+ * Variant
+ * ^^^^^^^
+ */
+#define UA_TYPES_VARIANT 23
+
+/**
+ * DiagnosticInfo
+ * ^^^^^^^^^^^^^^
+ */
+#define UA_TYPES_DIAGNOSTICINFO 24
+
+/**
+ * NodeClass
+ * ^^^^^^^^^
+ * A mask specifying the class of the node. */
+typedef enum {
+    UA_NODECLASS_UNSPECIFIED = 0,
+    UA_NODECLASS_OBJECT = 1,
+    UA_NODECLASS_VARIABLE = 2,
+    UA_NODECLASS_METHOD = 4,
+    UA_NODECLASS_OBJECTTYPE = 8,
+    UA_NODECLASS_VARIABLETYPE = 16,
+    UA_NODECLASS_REFERENCETYPE = 32,
+    UA_NODECLASS_DATATYPE = 64,
+    UA_NODECLASS_VIEW = 128,
+    __UA_NODECLASS_FORCE32BIT = 0x7fffffff
+} UA_NodeClass;
+UA_STATIC_ASSERT(sizeof(UA_NodeClass) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_NODECLASS 25
+
+/**
+ * StructureType
+ * ^^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_STRUCTURETYPE_STRUCTURE = 0,
+    UA_STRUCTURETYPE_STRUCTUREWITHOPTIONALFIELDS = 1,
+    UA_STRUCTURETYPE_UNION = 2,
+    __UA_STRUCTURETYPE_FORCE32BIT = 0x7fffffff
+} UA_StructureType;
+UA_STATIC_ASSERT(sizeof(UA_StructureType) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_STRUCTURETYPE 26
+
+/**
+ * StructureField
+ * ^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_String name;
+    UA_LocalizedText description;
+    UA_NodeId dataType;
+    UA_Int32 valueRank;
+    size_t arrayDimensionsSize;
+    UA_UInt32 *arrayDimensions;
+    UA_UInt32 maxStringLength;
+    UA_Boolean isOptional;
+} UA_StructureField;
+
+#define UA_TYPES_STRUCTUREFIELD 27
+
+/**
+ * StructureDefinition
+ * ^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_NodeId defaultEncodingId;
+    UA_NodeId baseDataType;
+    UA_StructureType structureType;
+    size_t fieldsSize;
+    UA_StructureField *fields;
+} UA_StructureDefinition;
+
+#define UA_TYPES_STRUCTUREDEFINITION 28
+
+/**
+ * Argument
+ * ^^^^^^^^
+ * An argument for a method. */
+typedef struct {
+    UA_String name;
+    UA_NodeId dataType;
+    UA_Int32 valueRank;
+    size_t arrayDimensionsSize;
+    UA_UInt32 *arrayDimensions;
+    UA_LocalizedText description;
+} UA_Argument;
+
+#define UA_TYPES_ARGUMENT 29
+
+/**
+ * EnumValueType
+ * ^^^^^^^^^^^^^
+ * A mapping between a value of an enumerated type and a name and description. */
+typedef struct {
+    UA_Int64 value;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+} UA_EnumValueType;
+
+#define UA_TYPES_ENUMVALUETYPE 30
+
+/**
+ * Duration
+ * ^^^^^^^^
+ * A period of time measured in milliseconds. */
+typedef UA_Double UA_Duration;
+
+#define UA_TYPES_DURATION 31
+
+/**
+ * UtcTime
+ * ^^^^^^^
+ * A date/time value specified in Universal Coordinated Time (UTC). */
+typedef UA_DateTime UA_UtcTime;
+
+#define UA_TYPES_UTCTIME 32
+
+/**
+ * LocaleId
+ * ^^^^^^^^
+ * An identifier for a user locale. */
+typedef UA_String UA_LocaleId;
+
+#define UA_TYPES_LOCALEID 33
+
+/**
+ * TimeZoneDataType
+ * ^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_Int16 offset;
+    UA_Boolean daylightSavingInOffset;
+} UA_TimeZoneDataType;
+
+#define UA_TYPES_TIMEZONEDATATYPE 34
+
+/**
+ * ApplicationType
+ * ^^^^^^^^^^^^^^^
+ * The types of applications. */
+typedef enum {
+    UA_APPLICATIONTYPE_SERVER = 0,
+    UA_APPLICATIONTYPE_CLIENT = 1,
+    UA_APPLICATIONTYPE_CLIENTANDSERVER = 2,
+    UA_APPLICATIONTYPE_DISCOVERYSERVER = 3,
+    __UA_APPLICATIONTYPE_FORCE32BIT = 0x7fffffff
+} UA_ApplicationType;
+UA_STATIC_ASSERT(sizeof(UA_ApplicationType) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_APPLICATIONTYPE 35
+
+/**
+ * ApplicationDescription
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * Describes an application and how to find it. */
+typedef struct {
+    UA_String applicationUri;
+    UA_String productUri;
+    UA_LocalizedText applicationName;
+    UA_ApplicationType applicationType;
+    UA_String gatewayServerUri;
+    UA_String discoveryProfileUri;
+    size_t discoveryUrlsSize;
+    UA_String *discoveryUrls;
+} UA_ApplicationDescription;
+
+#define UA_TYPES_APPLICATIONDESCRIPTION 36
+
+/**
+ * RequestHeader
+ * ^^^^^^^^^^^^^
+ * The header passed with every server request. */
+typedef struct {
+    UA_NodeId authenticationToken;
+    UA_DateTime timestamp;
+    UA_UInt32 requestHandle;
+    UA_UInt32 returnDiagnostics;
+    UA_String auditEntryId;
+    UA_UInt32 timeoutHint;
+    UA_ExtensionObject additionalHeader;
+} UA_RequestHeader;
+
+#define UA_TYPES_REQUESTHEADER 37
+
+/**
+ * ResponseHeader
+ * ^^^^^^^^^^^^^^
+ * The header passed with every server response. */
+typedef struct {
+    UA_DateTime timestamp;
+    UA_UInt32 requestHandle;
+    UA_StatusCode serviceResult;
+    UA_DiagnosticInfo serviceDiagnostics;
+    size_t stringTableSize;
+    UA_String *stringTable;
+    UA_ExtensionObject additionalHeader;
+} UA_ResponseHeader;
+
+#define UA_TYPES_RESPONSEHEADER 38
+
+/**
+ * ServiceFault
+ * ^^^^^^^^^^^^
+ * The response returned by all services when there is a service level error. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+} UA_ServiceFault;
+
+#define UA_TYPES_SERVICEFAULT 39
+
+/**
+ * FindServersRequest
+ * ^^^^^^^^^^^^^^^^^^
+ * Finds the servers known to the discovery server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_String endpointUrl;
+    size_t localeIdsSize;
+    UA_String *localeIds;
+    size_t serverUrisSize;
+    UA_String *serverUris;
+} UA_FindServersRequest;
+
+#define UA_TYPES_FINDSERVERSREQUEST 40
+
+/**
+ * FindServersResponse
+ * ^^^^^^^^^^^^^^^^^^^
+ * Finds the servers known to the discovery server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t serversSize;
+    UA_ApplicationDescription *servers;
+} UA_FindServersResponse;
+
+#define UA_TYPES_FINDSERVERSRESPONSE 41
+
+/**
+ * ServerOnNetwork
+ * ^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 recordId;
+    UA_String serverName;
+    UA_String discoveryUrl;
+    size_t serverCapabilitiesSize;
+    UA_String *serverCapabilities;
+} UA_ServerOnNetwork;
+
+#define UA_TYPES_SERVERONNETWORK 42
+
+/**
+ * FindServersOnNetworkRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 startingRecordId;
+    UA_UInt32 maxRecordsToReturn;
+    size_t serverCapabilityFilterSize;
+    UA_String *serverCapabilityFilter;
+} UA_FindServersOnNetworkRequest;
+
+#define UA_TYPES_FINDSERVERSONNETWORKREQUEST 43
+
+/**
+ * FindServersOnNetworkResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_DateTime lastCounterResetTime;
+    size_t serversSize;
+    UA_ServerOnNetwork *servers;
+} UA_FindServersOnNetworkResponse;
+
+#define UA_TYPES_FINDSERVERSONNETWORKRESPONSE 44
+
+/**
+ * MessageSecurityMode
+ * ^^^^^^^^^^^^^^^^^^^
+ * The type of security to use on a message. */
+typedef enum {
+    UA_MESSAGESECURITYMODE_INVALID = 0,
+    UA_MESSAGESECURITYMODE_NONE = 1,
+    UA_MESSAGESECURITYMODE_SIGN = 2,
+    UA_MESSAGESECURITYMODE_SIGNANDENCRYPT = 3,
+    __UA_MESSAGESECURITYMODE_FORCE32BIT = 0x7fffffff
+} UA_MessageSecurityMode;
+UA_STATIC_ASSERT(sizeof(UA_MessageSecurityMode) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_MESSAGESECURITYMODE 45
+
+/**
+ * UserTokenType
+ * ^^^^^^^^^^^^^
+ * The possible user token types. */
+typedef enum {
+    UA_USERTOKENTYPE_ANONYMOUS = 0,
+    UA_USERTOKENTYPE_USERNAME = 1,
+    UA_USERTOKENTYPE_CERTIFICATE = 2,
+    UA_USERTOKENTYPE_ISSUEDTOKEN = 3,
+    __UA_USERTOKENTYPE_FORCE32BIT = 0x7fffffff
+} UA_UserTokenType;
+UA_STATIC_ASSERT(sizeof(UA_UserTokenType) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_USERTOKENTYPE 46
+
+/**
+ * UserTokenPolicy
+ * ^^^^^^^^^^^^^^^
+ * Describes a user token that can be used with a server. */
+typedef struct {
+    UA_String policyId;
+    UA_UserTokenType tokenType;
+    UA_String issuedTokenType;
+    UA_String issuerEndpointUrl;
+    UA_String securityPolicyUri;
+} UA_UserTokenPolicy;
+
+#define UA_TYPES_USERTOKENPOLICY 47
+
+/**
+ * EndpointDescription
+ * ^^^^^^^^^^^^^^^^^^^
+ * The description of a endpoint that can be used to access a server. */
+typedef struct {
+    UA_String endpointUrl;
+    UA_ApplicationDescription server;
+    UA_ByteString serverCertificate;
+    UA_MessageSecurityMode securityMode;
+    UA_String securityPolicyUri;
+    size_t userIdentityTokensSize;
+    UA_UserTokenPolicy *userIdentityTokens;
+    UA_String transportProfileUri;
+    UA_Byte securityLevel;
+} UA_EndpointDescription;
+
+#define UA_TYPES_ENDPOINTDESCRIPTION 48
+
+/**
+ * GetEndpointsRequest
+ * ^^^^^^^^^^^^^^^^^^^
+ * Gets the endpoints used by the server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_String endpointUrl;
+    size_t localeIdsSize;
+    UA_String *localeIds;
+    size_t profileUrisSize;
+    UA_String *profileUris;
+} UA_GetEndpointsRequest;
+
+#define UA_TYPES_GETENDPOINTSREQUEST 49
+
+/**
+ * GetEndpointsResponse
+ * ^^^^^^^^^^^^^^^^^^^^
+ * Gets the endpoints used by the server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t endpointsSize;
+    UA_EndpointDescription *endpoints;
+} UA_GetEndpointsResponse;
+
+#define UA_TYPES_GETENDPOINTSRESPONSE 50
+
+/**
+ * RegisteredServer
+ * ^^^^^^^^^^^^^^^^
+ * The information required to register a server with a discovery server. */
+typedef struct {
+    UA_String serverUri;
+    UA_String productUri;
+    size_t serverNamesSize;
+    UA_LocalizedText *serverNames;
+    UA_ApplicationType serverType;
+    UA_String gatewayServerUri;
+    size_t discoveryUrlsSize;
+    UA_String *discoveryUrls;
+    UA_String semaphoreFilePath;
+    UA_Boolean isOnline;
+} UA_RegisteredServer;
+
+#define UA_TYPES_REGISTEREDSERVER 51
+
+/**
+ * RegisterServerRequest
+ * ^^^^^^^^^^^^^^^^^^^^^
+ * Registers a server with the discovery server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_RegisteredServer server;
+} UA_RegisterServerRequest;
+
+#define UA_TYPES_REGISTERSERVERREQUEST 52
+
+/**
+ * RegisterServerResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * Registers a server with the discovery server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+} UA_RegisterServerResponse;
+
+#define UA_TYPES_REGISTERSERVERRESPONSE 53
+
+/**
+ * DiscoveryConfiguration
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * A base type for discovery configuration information. */
+typedef void * UA_DiscoveryConfiguration;
+
+#define UA_TYPES_DISCOVERYCONFIGURATION 54
+
+/**
+ * MdnsDiscoveryConfiguration
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ * The discovery information needed for mDNS registration. */
+typedef struct {
+    UA_String mdnsServerName;
+    size_t serverCapabilitiesSize;
+    UA_String *serverCapabilities;
+} UA_MdnsDiscoveryConfiguration;
+
+#define UA_TYPES_MDNSDISCOVERYCONFIGURATION 55
+
+/**
+ * RegisterServer2Request
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_RegisteredServer server;
+    size_t discoveryConfigurationSize;
+    UA_ExtensionObject *discoveryConfiguration;
+} UA_RegisterServer2Request;
+
+#define UA_TYPES_REGISTERSERVER2REQUEST 56
+
+/**
+ * RegisterServer2Response
+ * ^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t configurationResultsSize;
+    UA_StatusCode *configurationResults;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_RegisterServer2Response;
+
+#define UA_TYPES_REGISTERSERVER2RESPONSE 57
+
+/**
+ * SecurityTokenRequestType
+ * ^^^^^^^^^^^^^^^^^^^^^^^^
+ * Indicates whether a token if being created or renewed. */
+typedef enum {
+    UA_SECURITYTOKENREQUESTTYPE_ISSUE = 0,
+    UA_SECURITYTOKENREQUESTTYPE_RENEW = 1,
+    __UA_SECURITYTOKENREQUESTTYPE_FORCE32BIT = 0x7fffffff
+} UA_SecurityTokenRequestType;
+UA_STATIC_ASSERT(sizeof(UA_SecurityTokenRequestType) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_SECURITYTOKENREQUESTTYPE 58
+
+/**
+ * ChannelSecurityToken
+ * ^^^^^^^^^^^^^^^^^^^^
+ * The token that identifies a set of keys for an active secure channel. */
+typedef struct {
+    UA_UInt32 channelId;
+    UA_UInt32 tokenId;
+    UA_DateTime createdAt;
+    UA_UInt32 revisedLifetime;
+} UA_ChannelSecurityToken;
+
+#define UA_TYPES_CHANNELSECURITYTOKEN 59
+
+/**
+ * OpenSecureChannelRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^
+ * Creates a secure channel with a server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 clientProtocolVersion;
+    UA_SecurityTokenRequestType requestType;
+    UA_MessageSecurityMode securityMode;
+    UA_ByteString clientNonce;
+    UA_UInt32 requestedLifetime;
+} UA_OpenSecureChannelRequest;
+
+#define UA_TYPES_OPENSECURECHANNELREQUEST 60
+
+/**
+ * OpenSecureChannelResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ * Creates a secure channel with a server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_UInt32 serverProtocolVersion;
+    UA_ChannelSecurityToken securityToken;
+    UA_ByteString serverNonce;
+} UA_OpenSecureChannelResponse;
+
+#define UA_TYPES_OPENSECURECHANNELRESPONSE 61
+
+/**
+ * CloseSecureChannelRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ * Closes a secure channel. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+} UA_CloseSecureChannelRequest;
+
+#define UA_TYPES_CLOSESECURECHANNELREQUEST 62
+
+/**
+ * CloseSecureChannelResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ * Closes a secure channel. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+} UA_CloseSecureChannelResponse;
+
+#define UA_TYPES_CLOSESECURECHANNELRESPONSE 63
+
+/**
+ * SignedSoftwareCertificate
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ * A software certificate with a digital signature. */
+typedef struct {
+    UA_ByteString certificateData;
+    UA_ByteString signature;
+} UA_SignedSoftwareCertificate;
+
+#define UA_TYPES_SIGNEDSOFTWARECERTIFICATE 64
+
+/**
+ * SignatureData
+ * ^^^^^^^^^^^^^
+ * A digital signature. */
+typedef struct {
+    UA_String algorithm;
+    UA_ByteString signature;
+} UA_SignatureData;
+
+#define UA_TYPES_SIGNATUREDATA 65
+
+/**
+ * CreateSessionRequest
+ * ^^^^^^^^^^^^^^^^^^^^
+ * Creates a new session with the server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_ApplicationDescription clientDescription;
+    UA_String serverUri;
+    UA_String endpointUrl;
+    UA_String sessionName;
+    UA_ByteString clientNonce;
+    UA_ByteString clientCertificate;
+    UA_Double requestedSessionTimeout;
+    UA_UInt32 maxResponseMessageSize;
+} UA_CreateSessionRequest;
+
+#define UA_TYPES_CREATESESSIONREQUEST 66
+
+/**
+ * CreateSessionResponse
+ * ^^^^^^^^^^^^^^^^^^^^^
+ * Creates a new session with the server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_NodeId sessionId;
+    UA_NodeId authenticationToken;
+    UA_Double revisedSessionTimeout;
+    UA_ByteString serverNonce;
+    UA_ByteString serverCertificate;
+    size_t serverEndpointsSize;
+    UA_EndpointDescription *serverEndpoints;
+    size_t serverSoftwareCertificatesSize;
+    UA_SignedSoftwareCertificate *serverSoftwareCertificates;
+    UA_SignatureData serverSignature;
+    UA_UInt32 maxRequestMessageSize;
+} UA_CreateSessionResponse;
+
+#define UA_TYPES_CREATESESSIONRESPONSE 67
+
+/**
+ * UserIdentityToken
+ * ^^^^^^^^^^^^^^^^^
+ * A base type for a user identity token. */
+typedef struct {
+    UA_String policyId;
+} UA_UserIdentityToken;
+
+#define UA_TYPES_USERIDENTITYTOKEN 68
+
+/**
+ * AnonymousIdentityToken
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * A token representing an anonymous user. */
+typedef struct {
+    UA_String policyId;
+} UA_AnonymousIdentityToken;
+
+#define UA_TYPES_ANONYMOUSIDENTITYTOKEN 69
+
+/**
+ * UserNameIdentityToken
+ * ^^^^^^^^^^^^^^^^^^^^^
+ * A token representing a user identified by a user name and password. */
+typedef struct {
+    UA_String policyId;
+    UA_String userName;
+    UA_ByteString password;
+    UA_String encryptionAlgorithm;
+} UA_UserNameIdentityToken;
+
+#define UA_TYPES_USERNAMEIDENTITYTOKEN 70
+
+/**
+ * X509IdentityToken
+ * ^^^^^^^^^^^^^^^^^
+ * A token representing a user identified by an X509 certificate. */
+typedef struct {
+    UA_String policyId;
+    UA_ByteString certificateData;
+} UA_X509IdentityToken;
+
+#define UA_TYPES_X509IDENTITYTOKEN 71
+
+/**
+ * IssuedIdentityToken
+ * ^^^^^^^^^^^^^^^^^^^
+ * A token representing a user identified by a WS-Security XML token. */
+typedef struct {
+    UA_String policyId;
+    UA_ByteString tokenData;
+    UA_String encryptionAlgorithm;
+} UA_IssuedIdentityToken;
+
+#define UA_TYPES_ISSUEDIDENTITYTOKEN 72
+
+/**
+ * ActivateSessionRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * Activates a session with the server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_SignatureData clientSignature;
+    size_t clientSoftwareCertificatesSize;
+    UA_SignedSoftwareCertificate *clientSoftwareCertificates;
+    size_t localeIdsSize;
+    UA_String *localeIds;
+    UA_ExtensionObject userIdentityToken;
+    UA_SignatureData userTokenSignature;
+} UA_ActivateSessionRequest;
+
+#define UA_TYPES_ACTIVATESESSIONREQUEST 73
+
+/**
+ * ActivateSessionResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^
+ * Activates a session with the server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_ByteString serverNonce;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_ActivateSessionResponse;
+
+#define UA_TYPES_ACTIVATESESSIONRESPONSE 74
+
+/**
+ * CloseSessionRequest
+ * ^^^^^^^^^^^^^^^^^^^
+ * Closes a session with the server. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_Boolean deleteSubscriptions;
+} UA_CloseSessionRequest;
+
+#define UA_TYPES_CLOSESESSIONREQUEST 75
+
+/**
+ * CloseSessionResponse
+ * ^^^^^^^^^^^^^^^^^^^^
+ * Closes a session with the server. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+} UA_CloseSessionResponse;
+
+#define UA_TYPES_CLOSESESSIONRESPONSE 76
+
+/**
+ * NodeAttributesMask
+ * ^^^^^^^^^^^^^^^^^^
+ * The bits used to specify default attributes for a new node. */
+typedef enum {
+    UA_NODEATTRIBUTESMASK_NONE = 0,
+    UA_NODEATTRIBUTESMASK_ACCESSLEVEL = 1,
+    UA_NODEATTRIBUTESMASK_ARRAYDIMENSIONS = 2,
+    UA_NODEATTRIBUTESMASK_BROWSENAME = 4,
+    UA_NODEATTRIBUTESMASK_CONTAINSNOLOOPS = 8,
+    UA_NODEATTRIBUTESMASK_DATATYPE = 16,
+    UA_NODEATTRIBUTESMASK_DESCRIPTION = 32,
+    UA_NODEATTRIBUTESMASK_DISPLAYNAME = 64,
+    UA_NODEATTRIBUTESMASK_EVENTNOTIFIER = 128,
+    UA_NODEATTRIBUTESMASK_EXECUTABLE = 256,
+    UA_NODEATTRIBUTESMASK_HISTORIZING = 512,
+    UA_NODEATTRIBUTESMASK_INVERSENAME = 1024,
+    UA_NODEATTRIBUTESMASK_ISABSTRACT = 2048,
+    UA_NODEATTRIBUTESMASK_MINIMUMSAMPLINGINTERVAL = 4096,
+    UA_NODEATTRIBUTESMASK_NODECLASS = 8192,
+    UA_NODEATTRIBUTESMASK_NODEID = 16384,
+    UA_NODEATTRIBUTESMASK_SYMMETRIC = 32768,
+    UA_NODEATTRIBUTESMASK_USERACCESSLEVEL = 65536,
+    UA_NODEATTRIBUTESMASK_USEREXECUTABLE = 131072,
+    UA_NODEATTRIBUTESMASK_USERWRITEMASK = 262144,
+    UA_NODEATTRIBUTESMASK_VALUERANK = 524288,
+    UA_NODEATTRIBUTESMASK_WRITEMASK = 1048576,
+    UA_NODEATTRIBUTESMASK_VALUE = 2097152,
+    UA_NODEATTRIBUTESMASK_DATATYPEDEFINITION = 4194304,
+    UA_NODEATTRIBUTESMASK_ROLEPERMISSIONS = 8388608,
+    UA_NODEATTRIBUTESMASK_ACCESSRESTRICTIONS = 16777216,
+    UA_NODEATTRIBUTESMASK_ALL = 33554431,
+    UA_NODEATTRIBUTESMASK_BASENODE = 26501220,
+    UA_NODEATTRIBUTESMASK_OBJECT = 26501348,
+    UA_NODEATTRIBUTESMASK_OBJECTTYPE = 26503268,
+    UA_NODEATTRIBUTESMASK_VARIABLE = 26571383,
+    UA_NODEATTRIBUTESMASK_VARIABLETYPE = 28600438,
+    UA_NODEATTRIBUTESMASK_METHOD = 26632548,
+    UA_NODEATTRIBUTESMASK_REFERENCETYPE = 26537060,
+    UA_NODEATTRIBUTESMASK_VIEW = 26501356,
+    __UA_NODEATTRIBUTESMASK_FORCE32BIT = 0x7fffffff
+} UA_NodeAttributesMask;
+UA_STATIC_ASSERT(sizeof(UA_NodeAttributesMask) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_NODEATTRIBUTESMASK 77
+
+/**
+ * NodeAttributes
+ * ^^^^^^^^^^^^^^
+ * The base attributes for all nodes. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+} UA_NodeAttributes;
+
+#define UA_TYPES_NODEATTRIBUTES 78
+
+/**
+ * ObjectAttributes
+ * ^^^^^^^^^^^^^^^^
+ * The attributes for an object node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Byte eventNotifier;
+} UA_ObjectAttributes;
+
+#define UA_TYPES_OBJECTATTRIBUTES 79
+
+/**
+ * VariableAttributes
+ * ^^^^^^^^^^^^^^^^^^
+ * The attributes for a variable node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Variant value;
+    UA_NodeId dataType;
+    UA_Int32 valueRank;
+    size_t arrayDimensionsSize;
+    UA_UInt32 *arrayDimensions;
+    UA_Byte accessLevel;
+    UA_Byte userAccessLevel;
+    UA_Double minimumSamplingInterval;
+    UA_Boolean historizing;
+} UA_VariableAttributes;
+
+#define UA_TYPES_VARIABLEATTRIBUTES 80
+
+/**
+ * MethodAttributes
+ * ^^^^^^^^^^^^^^^^
+ * The attributes for a method node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Boolean executable;
+    UA_Boolean userExecutable;
+} UA_MethodAttributes;
+
+#define UA_TYPES_METHODATTRIBUTES 81
+
+/**
+ * ObjectTypeAttributes
+ * ^^^^^^^^^^^^^^^^^^^^
+ * The attributes for an object type node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Boolean isAbstract;
+} UA_ObjectTypeAttributes;
+
+#define UA_TYPES_OBJECTTYPEATTRIBUTES 82
+
+/**
+ * VariableTypeAttributes
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * The attributes for a variable type node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Variant value;
+    UA_NodeId dataType;
+    UA_Int32 valueRank;
+    size_t arrayDimensionsSize;
+    UA_UInt32 *arrayDimensions;
+    UA_Boolean isAbstract;
+} UA_VariableTypeAttributes;
+
+#define UA_TYPES_VARIABLETYPEATTRIBUTES 83
+
+/**
+ * ReferenceTypeAttributes
+ * ^^^^^^^^^^^^^^^^^^^^^^^
+ * The attributes for a reference type node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Boolean isAbstract;
+    UA_Boolean symmetric;
+    UA_LocalizedText inverseName;
+} UA_ReferenceTypeAttributes;
+
+#define UA_TYPES_REFERENCETYPEATTRIBUTES 84
+
+/**
+ * DataTypeAttributes
+ * ^^^^^^^^^^^^^^^^^^
+ * The attributes for a data type node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Boolean isAbstract;
+} UA_DataTypeAttributes;
+
+#define UA_TYPES_DATATYPEATTRIBUTES 85
+
+/**
+ * ViewAttributes
+ * ^^^^^^^^^^^^^^
+ * The attributes for a view node. */
+typedef struct {
+    UA_UInt32 specifiedAttributes;
+    UA_LocalizedText displayName;
+    UA_LocalizedText description;
+    UA_UInt32 writeMask;
+    UA_UInt32 userWriteMask;
+    UA_Boolean containsNoLoops;
+    UA_Byte eventNotifier;
+} UA_ViewAttributes;
+
+#define UA_TYPES_VIEWATTRIBUTES 86
+
+/**
+ * AddNodesItem
+ * ^^^^^^^^^^^^
+ * A request to add a node to the server address space. */
+typedef struct {
+    UA_ExpandedNodeId parentNodeId;
+    UA_NodeId referenceTypeId;
+    UA_ExpandedNodeId requestedNewNodeId;
+    UA_QualifiedName browseName;
+    UA_NodeClass nodeClass;
+    UA_ExtensionObject nodeAttributes;
+    UA_ExpandedNodeId typeDefinition;
+} UA_AddNodesItem;
+
+#define UA_TYPES_ADDNODESITEM 87
+
+/**
+ * AddNodesResult
+ * ^^^^^^^^^^^^^^
+ * A result of an add node operation. */
+typedef struct {
+    UA_StatusCode statusCode;
+    UA_NodeId addedNodeId;
+} UA_AddNodesResult;
+
+#define UA_TYPES_ADDNODESRESULT 88
+
+/**
+ * AddNodesRequest
+ * ^^^^^^^^^^^^^^^
+ * Adds one or more nodes to the server address space. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t nodesToAddSize;
+    UA_AddNodesItem *nodesToAdd;
+} UA_AddNodesRequest;
+
+#define UA_TYPES_ADDNODESREQUEST 89
+
+/**
+ * AddNodesResponse
+ * ^^^^^^^^^^^^^^^^
+ * Adds one or more nodes to the server address space. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_AddNodesResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_AddNodesResponse;
+
+#define UA_TYPES_ADDNODESRESPONSE 90
+
+/**
+ * AddReferencesItem
+ * ^^^^^^^^^^^^^^^^^
+ * A request to add a reference to the server address space. */
+typedef struct {
+    UA_NodeId sourceNodeId;
+    UA_NodeId referenceTypeId;
+    UA_Boolean isForward;
+    UA_String targetServerUri;
+    UA_ExpandedNodeId targetNodeId;
+    UA_NodeClass targetNodeClass;
+} UA_AddReferencesItem;
+
+#define UA_TYPES_ADDREFERENCESITEM 91
+
+/**
+ * AddReferencesRequest
+ * ^^^^^^^^^^^^^^^^^^^^
+ * Adds one or more references to the server address space. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t referencesToAddSize;
+    UA_AddReferencesItem *referencesToAdd;
+} UA_AddReferencesRequest;
+
+#define UA_TYPES_ADDREFERENCESREQUEST 92
+
+/**
+ * AddReferencesResponse
+ * ^^^^^^^^^^^^^^^^^^^^^
+ * Adds one or more references to the server address space. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_AddReferencesResponse;
+
+#define UA_TYPES_ADDREFERENCESRESPONSE 93
+
+/**
+ * DeleteNodesItem
+ * ^^^^^^^^^^^^^^^
+ * A request to delete a node to the server address space. */
+typedef struct {
+    UA_NodeId nodeId;
+    UA_Boolean deleteTargetReferences;
+} UA_DeleteNodesItem;
+
+#define UA_TYPES_DELETENODESITEM 94
+
+/**
+ * DeleteNodesRequest
+ * ^^^^^^^^^^^^^^^^^^
+ * Delete one or more nodes from the server address space. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t nodesToDeleteSize;
+    UA_DeleteNodesItem *nodesToDelete;
+} UA_DeleteNodesRequest;
+
+#define UA_TYPES_DELETENODESREQUEST 95
+
+/**
+ * DeleteNodesResponse
+ * ^^^^^^^^^^^^^^^^^^^
+ * Delete one or more nodes from the server address space. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_DeleteNodesResponse;
+
+#define UA_TYPES_DELETENODESRESPONSE 96
+
+/**
+ * DeleteReferencesItem
+ * ^^^^^^^^^^^^^^^^^^^^
+ * A request to delete a node from the server address space. */
+typedef struct {
+    UA_NodeId sourceNodeId;
+    UA_NodeId referenceTypeId;
+    UA_Boolean isForward;
+    UA_ExpandedNodeId targetNodeId;
+    UA_Boolean deleteBidirectional;
+} UA_DeleteReferencesItem;
+
+#define UA_TYPES_DELETEREFERENCESITEM 97
+
+/**
+ * DeleteReferencesRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^
+ * Delete one or more references from the server address space. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t referencesToDeleteSize;
+    UA_DeleteReferencesItem *referencesToDelete;
+} UA_DeleteReferencesRequest;
+
+#define UA_TYPES_DELETEREFERENCESREQUEST 98
+
+/**
+ * DeleteReferencesResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^
+ * Delete one or more references from the server address space. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_DeleteReferencesResponse;
+
+#define UA_TYPES_DELETEREFERENCESRESPONSE 99
+
+/**
+ * BrowseDirection
+ * ^^^^^^^^^^^^^^^
+ * The directions of the references to return. */
+typedef enum {
+    UA_BROWSEDIRECTION_FORWARD = 0,
+    UA_BROWSEDIRECTION_INVERSE = 1,
+    UA_BROWSEDIRECTION_BOTH = 2,
+    UA_BROWSEDIRECTION_INVALID = 3,
+    __UA_BROWSEDIRECTION_FORCE32BIT = 0x7fffffff
+} UA_BrowseDirection;
+UA_STATIC_ASSERT(sizeof(UA_BrowseDirection) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_BROWSEDIRECTION 100
+
+/**
+ * ViewDescription
+ * ^^^^^^^^^^^^^^^
+ * The view to browse. */
+typedef struct {
+    UA_NodeId viewId;
+    UA_DateTime timestamp;
+    UA_UInt32 viewVersion;
+} UA_ViewDescription;
+
+#define UA_TYPES_VIEWDESCRIPTION 101
+
+/**
+ * BrowseDescription
+ * ^^^^^^^^^^^^^^^^^
+ * A request to browse the the references from a node. */
+typedef struct {
+    UA_NodeId nodeId;
+    UA_BrowseDirection browseDirection;
+    UA_NodeId referenceTypeId;
+    UA_Boolean includeSubtypes;
+    UA_UInt32 nodeClassMask;
+    UA_UInt32 resultMask;
+} UA_BrowseDescription;
+
+#define UA_TYPES_BROWSEDESCRIPTION 102
+
+/**
+ * BrowseResultMask
+ * ^^^^^^^^^^^^^^^^
+ * A bit mask which specifies what should be returned in a browse response. */
+typedef enum {
+    UA_BROWSERESULTMASK_NONE = 0,
+    UA_BROWSERESULTMASK_REFERENCETYPEID = 1,
+    UA_BROWSERESULTMASK_ISFORWARD = 2,
+    UA_BROWSERESULTMASK_NODECLASS = 4,
+    UA_BROWSERESULTMASK_BROWSENAME = 8,
+    UA_BROWSERESULTMASK_DISPLAYNAME = 16,
+    UA_BROWSERESULTMASK_TYPEDEFINITION = 32,
+    UA_BROWSERESULTMASK_ALL = 63,
+    UA_BROWSERESULTMASK_REFERENCETYPEINFO = 3,
+    UA_BROWSERESULTMASK_TARGETINFO = 60,
+    __UA_BROWSERESULTMASK_FORCE32BIT = 0x7fffffff
+} UA_BrowseResultMask;
+UA_STATIC_ASSERT(sizeof(UA_BrowseResultMask) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_BROWSERESULTMASK 103
+
+/**
+ * ReferenceDescription
+ * ^^^^^^^^^^^^^^^^^^^^
+ * The description of a reference. */
+typedef struct {
+    UA_NodeId referenceTypeId;
+    UA_Boolean isForward;
+    UA_ExpandedNodeId nodeId;
+    UA_QualifiedName browseName;
+    UA_LocalizedText displayName;
+    UA_NodeClass nodeClass;
+    UA_ExpandedNodeId typeDefinition;
+} UA_ReferenceDescription;
+
+#define UA_TYPES_REFERENCEDESCRIPTION 104
+
+/**
+ * BrowseResult
+ * ^^^^^^^^^^^^
+ * The result of a browse operation. */
+typedef struct {
+    UA_StatusCode statusCode;
+    UA_ByteString continuationPoint;
+    size_t referencesSize;
+    UA_ReferenceDescription *references;
+} UA_BrowseResult;
+
+#define UA_TYPES_BROWSERESULT 105
+
+/**
+ * BrowseRequest
+ * ^^^^^^^^^^^^^
+ * Browse the references for one or more nodes from the server address space. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_ViewDescription view;
+    UA_UInt32 requestedMaxReferencesPerNode;
+    size_t nodesToBrowseSize;
+    UA_BrowseDescription *nodesToBrowse;
+} UA_BrowseRequest;
+
+#define UA_TYPES_BROWSEREQUEST 106
+
+/**
+ * BrowseResponse
+ * ^^^^^^^^^^^^^^
+ * Browse the references for one or more nodes from the server address space. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_BrowseResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_BrowseResponse;
+
+#define UA_TYPES_BROWSERESPONSE 107
+
+/**
+ * BrowseNextRequest
+ * ^^^^^^^^^^^^^^^^^
+ * Continues one or more browse operations. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_Boolean releaseContinuationPoints;
+    size_t continuationPointsSize;
+    UA_ByteString *continuationPoints;
+} UA_BrowseNextRequest;
+
+#define UA_TYPES_BROWSENEXTREQUEST 108
+
+/**
+ * BrowseNextResponse
+ * ^^^^^^^^^^^^^^^^^^
+ * Continues one or more browse operations. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_BrowseResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_BrowseNextResponse;
+
+#define UA_TYPES_BROWSENEXTRESPONSE 109
+
+/**
+ * RelativePathElement
+ * ^^^^^^^^^^^^^^^^^^^
+ * An element in a relative path. */
+typedef struct {
+    UA_NodeId referenceTypeId;
+    UA_Boolean isInverse;
+    UA_Boolean includeSubtypes;
+    UA_QualifiedName targetName;
+} UA_RelativePathElement;
+
+#define UA_TYPES_RELATIVEPATHELEMENT 110
+
+/**
+ * RelativePath
+ * ^^^^^^^^^^^^
+ * A relative path constructed from reference types and browse names. */
+typedef struct {
+    size_t elementsSize;
+    UA_RelativePathElement *elements;
+} UA_RelativePath;
+
+#define UA_TYPES_RELATIVEPATH 111
+
+/**
+ * BrowsePath
+ * ^^^^^^^^^^
+ * A request to translate a path into a node id. */
+typedef struct {
+    UA_NodeId startingNode;
+    UA_RelativePath relativePath;
+} UA_BrowsePath;
+
+#define UA_TYPES_BROWSEPATH 112
+
+/**
+ * BrowsePathTarget
+ * ^^^^^^^^^^^^^^^^
+ * The target of the translated path. */
+typedef struct {
+    UA_ExpandedNodeId targetId;
+    UA_UInt32 remainingPathIndex;
+} UA_BrowsePathTarget;
+
+#define UA_TYPES_BROWSEPATHTARGET 113
+
+/**
+ * BrowsePathResult
+ * ^^^^^^^^^^^^^^^^
+ * The result of a translate opearation. */
+typedef struct {
+    UA_StatusCode statusCode;
+    size_t targetsSize;
+    UA_BrowsePathTarget *targets;
+} UA_BrowsePathResult;
+
+#define UA_TYPES_BROWSEPATHRESULT 114
+
+/**
+ * TranslateBrowsePathsToNodeIdsRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ * Translates one or more paths in the server address space. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t browsePathsSize;
+    UA_BrowsePath *browsePaths;
+} UA_TranslateBrowsePathsToNodeIdsRequest;
+
+#define UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST 115
+
+/**
+ * TranslateBrowsePathsToNodeIdsResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ * Translates one or more paths in the server address space. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_BrowsePathResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_TranslateBrowsePathsToNodeIdsResponse;
+
+#define UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE 116
+
+/**
+ * RegisterNodesRequest
+ * ^^^^^^^^^^^^^^^^^^^^
+ * Registers one or more nodes for repeated use within a session. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t nodesToRegisterSize;
+    UA_NodeId *nodesToRegister;
+} UA_RegisterNodesRequest;
+
+#define UA_TYPES_REGISTERNODESREQUEST 117
+
+/**
+ * RegisterNodesResponse
+ * ^^^^^^^^^^^^^^^^^^^^^
+ * Registers one or more nodes for repeated use within a session. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t registeredNodeIdsSize;
+    UA_NodeId *registeredNodeIds;
+} UA_RegisterNodesResponse;
+
+#define UA_TYPES_REGISTERNODESRESPONSE 118
+
+/**
+ * UnregisterNodesRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ * Unregisters one or more previously registered nodes. */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t nodesToUnregisterSize;
+    UA_NodeId *nodesToUnregister;
+} UA_UnregisterNodesRequest;
+
+#define UA_TYPES_UNREGISTERNODESREQUEST 119
+
+/**
+ * UnregisterNodesResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^
+ * Unregisters one or more previously registered nodes. */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+} UA_UnregisterNodesResponse;
+
+#define UA_TYPES_UNREGISTERNODESRESPONSE 120
+
+/**
+ * FilterOperator
+ * ^^^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_FILTEROPERATOR_EQUALS = 0,
+    UA_FILTEROPERATOR_ISNULL = 1,
+    UA_FILTEROPERATOR_GREATERTHAN = 2,
+    UA_FILTEROPERATOR_LESSTHAN = 3,
+    UA_FILTEROPERATOR_GREATERTHANOREQUAL = 4,
+    UA_FILTEROPERATOR_LESSTHANOREQUAL = 5,
+    UA_FILTEROPERATOR_LIKE = 6,
+    UA_FILTEROPERATOR_NOT = 7,
+    UA_FILTEROPERATOR_BETWEEN = 8,
+    UA_FILTEROPERATOR_INLIST = 9,
+    UA_FILTEROPERATOR_AND = 10,
+    UA_FILTEROPERATOR_OR = 11,
+    UA_FILTEROPERATOR_CAST = 12,
+    UA_FILTEROPERATOR_INVIEW = 13,
+    UA_FILTEROPERATOR_OFTYPE = 14,
+    UA_FILTEROPERATOR_RELATEDTO = 15,
+    UA_FILTEROPERATOR_BITWISEAND = 16,
+    UA_FILTEROPERATOR_BITWISEOR = 17,
+    __UA_FILTEROPERATOR_FORCE32BIT = 0x7fffffff
+} UA_FilterOperator;
+UA_STATIC_ASSERT(sizeof(UA_FilterOperator) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_FILTEROPERATOR 121
+
+/**
+ * ContentFilterElement
+ * ^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_FilterOperator filterOperator;
+    size_t filterOperandsSize;
+    UA_ExtensionObject *filterOperands;
+} UA_ContentFilterElement;
+
+#define UA_TYPES_CONTENTFILTERELEMENT 122
+
+/**
+ * ContentFilter
+ * ^^^^^^^^^^^^^
+ */
+typedef struct {
+    size_t elementsSize;
+    UA_ContentFilterElement *elements;
+} UA_ContentFilter;
+
+#define UA_TYPES_CONTENTFILTER 123
+
+/**
+ * FilterOperand
+ * ^^^^^^^^^^^^^
+ */
+typedef void * UA_FilterOperand;
+
+#define UA_TYPES_FILTEROPERAND 124
+
+/**
+ * ElementOperand
+ * ^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 index;
+} UA_ElementOperand;
+
+#define UA_TYPES_ELEMENTOPERAND 125
+
+/**
+ * LiteralOperand
+ * ^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_Variant value;
+} UA_LiteralOperand;
+
+#define UA_TYPES_LITERALOPERAND 126
+
+/**
+ * AttributeOperand
+ * ^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_NodeId nodeId;
+    UA_String alias;
+    UA_RelativePath browsePath;
+    UA_UInt32 attributeId;
+    UA_String indexRange;
+} UA_AttributeOperand;
+
+#define UA_TYPES_ATTRIBUTEOPERAND 127
+
+/**
+ * SimpleAttributeOperand
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_NodeId typeDefinitionId;
+    size_t browsePathSize;
+    UA_QualifiedName *browsePath;
+    UA_UInt32 attributeId;
+    UA_String indexRange;
+} UA_SimpleAttributeOperand;
+
+#define UA_TYPES_SIMPLEATTRIBUTEOPERAND 128
+
+/**
+ * ContentFilterElementResult
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_StatusCode statusCode;
+    size_t operandStatusCodesSize;
+    UA_StatusCode *operandStatusCodes;
+    size_t operandDiagnosticInfosSize;
+    UA_DiagnosticInfo *operandDiagnosticInfos;
+} UA_ContentFilterElementResult;
+
+#define UA_TYPES_CONTENTFILTERELEMENTRESULT 129
+
+/**
+ * ContentFilterResult
+ * ^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    size_t elementResultsSize;
+    UA_ContentFilterElementResult *elementResults;
+    size_t elementDiagnosticInfosSize;
+    UA_DiagnosticInfo *elementDiagnosticInfos;
+} UA_ContentFilterResult;
+
+#define UA_TYPES_CONTENTFILTERRESULT 130
+
+/**
+ * TimestampsToReturn
+ * ^^^^^^^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_TIMESTAMPSTORETURN_SOURCE = 0,
+    UA_TIMESTAMPSTORETURN_SERVER = 1,
+    UA_TIMESTAMPSTORETURN_BOTH = 2,
+    UA_TIMESTAMPSTORETURN_NEITHER = 3,
+    UA_TIMESTAMPSTORETURN_INVALID = 4,
+    __UA_TIMESTAMPSTORETURN_FORCE32BIT = 0x7fffffff
+} UA_TimestampsToReturn;
+UA_STATIC_ASSERT(sizeof(UA_TimestampsToReturn) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_TIMESTAMPSTORETURN 131
+
+/**
+ * ReadValueId
+ * ^^^^^^^^^^^
+ */
+typedef struct {
+    UA_NodeId nodeId;
+    UA_UInt32 attributeId;
+    UA_String indexRange;
+    UA_QualifiedName dataEncoding;
+} UA_ReadValueId;
+
+#define UA_TYPES_READVALUEID 132
+
+/**
+ * ReadRequest
+ * ^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_Double maxAge;
+    UA_TimestampsToReturn timestampsToReturn;
+    size_t nodesToReadSize;
+    UA_ReadValueId *nodesToRead;
+} UA_ReadRequest;
+
+#define UA_TYPES_READREQUEST 133
+
+/**
+ * ReadResponse
+ * ^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_DataValue *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_ReadResponse;
+
+#define UA_TYPES_READRESPONSE 134
+
+/**
+ * WriteValue
+ * ^^^^^^^^^^
+ */
+typedef struct {
+    UA_NodeId nodeId;
+    UA_UInt32 attributeId;
+    UA_String indexRange;
+    UA_DataValue value;
+} UA_WriteValue;
+
+#define UA_TYPES_WRITEVALUE 135
+
+/**
+ * WriteRequest
+ * ^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t nodesToWriteSize;
+    UA_WriteValue *nodesToWrite;
+} UA_WriteRequest;
+
+#define UA_TYPES_WRITEREQUEST 136
+
+/**
+ * WriteResponse
+ * ^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_WriteResponse;
+
+#define UA_TYPES_WRITERESPONSE 137
+
+/**
+ * CallMethodRequest
+ * ^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_NodeId objectId;
+    UA_NodeId methodId;
+    size_t inputArgumentsSize;
+    UA_Variant *inputArguments;
+} UA_CallMethodRequest;
+
+#define UA_TYPES_CALLMETHODREQUEST 138
+
+/**
+ * CallMethodResult
+ * ^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_StatusCode statusCode;
+    size_t inputArgumentResultsSize;
+    UA_StatusCode *inputArgumentResults;
+    size_t inputArgumentDiagnosticInfosSize;
+    UA_DiagnosticInfo *inputArgumentDiagnosticInfos;
+    size_t outputArgumentsSize;
+    UA_Variant *outputArguments;
+} UA_CallMethodResult;
+
+#define UA_TYPES_CALLMETHODRESULT 139
+
+/**
+ * CallRequest
+ * ^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t methodsToCallSize;
+    UA_CallMethodRequest *methodsToCall;
+} UA_CallRequest;
+
+#define UA_TYPES_CALLREQUEST 140
+
+/**
+ * CallResponse
+ * ^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_CallMethodResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_CallResponse;
+
+#define UA_TYPES_CALLRESPONSE 141
+
+/**
+ * MonitoringMode
+ * ^^^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_MONITORINGMODE_DISABLED = 0,
+    UA_MONITORINGMODE_SAMPLING = 1,
+    UA_MONITORINGMODE_REPORTING = 2,
+    __UA_MONITORINGMODE_FORCE32BIT = 0x7fffffff
+} UA_MonitoringMode;
+UA_STATIC_ASSERT(sizeof(UA_MonitoringMode) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_MONITORINGMODE 142
+
+/**
+ * DataChangeTrigger
+ * ^^^^^^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_DATACHANGETRIGGER_STATUS = 0,
+    UA_DATACHANGETRIGGER_STATUSVALUE = 1,
+    UA_DATACHANGETRIGGER_STATUSVALUETIMESTAMP = 2,
+    __UA_DATACHANGETRIGGER_FORCE32BIT = 0x7fffffff
+} UA_DataChangeTrigger;
+UA_STATIC_ASSERT(sizeof(UA_DataChangeTrigger) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_DATACHANGETRIGGER 143
+
+/**
+ * DeadbandType
+ * ^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_DEADBANDTYPE_NONE = 0,
+    UA_DEADBANDTYPE_ABSOLUTE = 1,
+    UA_DEADBANDTYPE_PERCENT = 2,
+    __UA_DEADBANDTYPE_FORCE32BIT = 0x7fffffff
+} UA_DeadbandType;
+UA_STATIC_ASSERT(sizeof(UA_DeadbandType) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_DEADBANDTYPE 144
+
+/**
+ * DataChangeFilter
+ * ^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_DataChangeTrigger trigger;
+    UA_UInt32 deadbandType;
+    UA_Double deadbandValue;
+} UA_DataChangeFilter;
+
+#define UA_TYPES_DATACHANGEFILTER 145
+
+/**
+ * EventFilter
+ * ^^^^^^^^^^^
+ */
+typedef struct {
+    size_t selectClausesSize;
+    UA_SimpleAttributeOperand *selectClauses;
+    UA_ContentFilter whereClause;
+} UA_EventFilter;
+
+#define UA_TYPES_EVENTFILTER 146
+
+/**
+ * AggregateConfiguration
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_Boolean useServerCapabilitiesDefaults;
+    UA_Boolean treatUncertainAsBad;
+    UA_Byte percentDataBad;
+    UA_Byte percentDataGood;
+    UA_Boolean useSlopedExtrapolation;
+} UA_AggregateConfiguration;
+
+#define UA_TYPES_AGGREGATECONFIGURATION 147
+
+/**
+ * AggregateFilter
+ * ^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_DateTime startTime;
+    UA_NodeId aggregateType;
+    UA_Double processingInterval;
+    UA_AggregateConfiguration aggregateConfiguration;
+} UA_AggregateFilter;
+
+#define UA_TYPES_AGGREGATEFILTER 148
+
+/**
+ * EventFilterResult
+ * ^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    size_t selectClauseResultsSize;
+    UA_StatusCode *selectClauseResults;
+    size_t selectClauseDiagnosticInfosSize;
+    UA_DiagnosticInfo *selectClauseDiagnosticInfos;
+    UA_ContentFilterResult whereClauseResult;
+} UA_EventFilterResult;
+
+#define UA_TYPES_EVENTFILTERRESULT 149
+
+/**
+ * MonitoringParameters
+ * ^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 clientHandle;
+    UA_Double samplingInterval;
+    UA_ExtensionObject filter;
+    UA_UInt32 queueSize;
+    UA_Boolean discardOldest;
+} UA_MonitoringParameters;
+
+#define UA_TYPES_MONITORINGPARAMETERS 150
+
+/**
+ * MonitoredItemCreateRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ReadValueId itemToMonitor;
+    UA_MonitoringMode monitoringMode;
+    UA_MonitoringParameters requestedParameters;
+} UA_MonitoredItemCreateRequest;
+
+#define UA_TYPES_MONITOREDITEMCREATEREQUEST 151
+
+/**
+ * MonitoredItemCreateResult
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_StatusCode statusCode;
+    UA_UInt32 monitoredItemId;
+    UA_Double revisedSamplingInterval;
+    UA_UInt32 revisedQueueSize;
+    UA_ExtensionObject filterResult;
+} UA_MonitoredItemCreateResult;
+
+#define UA_TYPES_MONITOREDITEMCREATERESULT 152
+
+/**
+ * CreateMonitoredItemsRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    UA_TimestampsToReturn timestampsToReturn;
+    size_t itemsToCreateSize;
+    UA_MonitoredItemCreateRequest *itemsToCreate;
+} UA_CreateMonitoredItemsRequest;
+
+#define UA_TYPES_CREATEMONITOREDITEMSREQUEST 153
+
+/**
+ * CreateMonitoredItemsResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_MonitoredItemCreateResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_CreateMonitoredItemsResponse;
+
+#define UA_TYPES_CREATEMONITOREDITEMSRESPONSE 154
+
+/**
+ * MonitoredItemModifyRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 monitoredItemId;
+    UA_MonitoringParameters requestedParameters;
+} UA_MonitoredItemModifyRequest;
+
+#define UA_TYPES_MONITOREDITEMMODIFYREQUEST 155
+
+/**
+ * MonitoredItemModifyResult
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_StatusCode statusCode;
+    UA_Double revisedSamplingInterval;
+    UA_UInt32 revisedQueueSize;
+    UA_ExtensionObject filterResult;
+} UA_MonitoredItemModifyResult;
+
+#define UA_TYPES_MONITOREDITEMMODIFYRESULT 156
+
+/**
+ * ModifyMonitoredItemsRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    UA_TimestampsToReturn timestampsToReturn;
+    size_t itemsToModifySize;
+    UA_MonitoredItemModifyRequest *itemsToModify;
+} UA_ModifyMonitoredItemsRequest;
+
+#define UA_TYPES_MODIFYMONITOREDITEMSREQUEST 157
+
+/**
+ * ModifyMonitoredItemsResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_MonitoredItemModifyResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_ModifyMonitoredItemsResponse;
+
+#define UA_TYPES_MODIFYMONITOREDITEMSRESPONSE 158
+
+/**
+ * SetMonitoringModeRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    UA_MonitoringMode monitoringMode;
+    size_t monitoredItemIdsSize;
+    UA_UInt32 *monitoredItemIds;
+} UA_SetMonitoringModeRequest;
+
+#define UA_TYPES_SETMONITORINGMODEREQUEST 159
+
+/**
+ * SetMonitoringModeResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_SetMonitoringModeResponse;
+
+#define UA_TYPES_SETMONITORINGMODERESPONSE 160
+
+/**
+ * SetTriggeringRequest
+ * ^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    UA_UInt32 triggeringItemId;
+    size_t linksToAddSize;
+    UA_UInt32 *linksToAdd;
+    size_t linksToRemoveSize;
+    UA_UInt32 *linksToRemove;
+} UA_SetTriggeringRequest;
+
+#define UA_TYPES_SETTRIGGERINGREQUEST 161
+
+/**
+ * SetTriggeringResponse
+ * ^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t addResultsSize;
+    UA_StatusCode *addResults;
+    size_t addDiagnosticInfosSize;
+    UA_DiagnosticInfo *addDiagnosticInfos;
+    size_t removeResultsSize;
+    UA_StatusCode *removeResults;
+    size_t removeDiagnosticInfosSize;
+    UA_DiagnosticInfo *removeDiagnosticInfos;
+} UA_SetTriggeringResponse;
+
+#define UA_TYPES_SETTRIGGERINGRESPONSE 162
+
+/**
+ * DeleteMonitoredItemsRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    size_t monitoredItemIdsSize;
+    UA_UInt32 *monitoredItemIds;
+} UA_DeleteMonitoredItemsRequest;
+
+#define UA_TYPES_DELETEMONITOREDITEMSREQUEST 163
+
+/**
+ * DeleteMonitoredItemsResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_DeleteMonitoredItemsResponse;
+
+#define UA_TYPES_DELETEMONITOREDITEMSRESPONSE 164
+
+/**
+ * CreateSubscriptionRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_Double requestedPublishingInterval;
+    UA_UInt32 requestedLifetimeCount;
+    UA_UInt32 requestedMaxKeepAliveCount;
+    UA_UInt32 maxNotificationsPerPublish;
+    UA_Boolean publishingEnabled;
+    UA_Byte priority;
+} UA_CreateSubscriptionRequest;
+
+#define UA_TYPES_CREATESUBSCRIPTIONREQUEST 165
+
+/**
+ * CreateSubscriptionResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_UInt32 subscriptionId;
+    UA_Double revisedPublishingInterval;
+    UA_UInt32 revisedLifetimeCount;
+    UA_UInt32 revisedMaxKeepAliveCount;
+} UA_CreateSubscriptionResponse;
+
+#define UA_TYPES_CREATESUBSCRIPTIONRESPONSE 166
+
+/**
+ * ModifySubscriptionRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    UA_Double requestedPublishingInterval;
+    UA_UInt32 requestedLifetimeCount;
+    UA_UInt32 requestedMaxKeepAliveCount;
+    UA_UInt32 maxNotificationsPerPublish;
+    UA_Byte priority;
+} UA_ModifySubscriptionRequest;
+
+#define UA_TYPES_MODIFYSUBSCRIPTIONREQUEST 167
+
+/**
+ * ModifySubscriptionResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_Double revisedPublishingInterval;
+    UA_UInt32 revisedLifetimeCount;
+    UA_UInt32 revisedMaxKeepAliveCount;
+} UA_ModifySubscriptionResponse;
+
+#define UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE 168
+
+/**
+ * SetPublishingModeRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_Boolean publishingEnabled;
+    size_t subscriptionIdsSize;
+    UA_UInt32 *subscriptionIds;
+} UA_SetPublishingModeRequest;
+
+#define UA_TYPES_SETPUBLISHINGMODEREQUEST 169
+
+/**
+ * SetPublishingModeResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_SetPublishingModeResponse;
+
+#define UA_TYPES_SETPUBLISHINGMODERESPONSE 170
+
+/**
+ * NotificationMessage
+ * ^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 sequenceNumber;
+    UA_DateTime publishTime;
+    size_t notificationDataSize;
+    UA_ExtensionObject *notificationData;
+} UA_NotificationMessage;
+
+#define UA_TYPES_NOTIFICATIONMESSAGE 171
+
+/**
+ * MonitoredItemNotification
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 clientHandle;
+    UA_DataValue value;
+} UA_MonitoredItemNotification;
+
+#define UA_TYPES_MONITOREDITEMNOTIFICATION 172
+
+/**
+ * EventFieldList
+ * ^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 clientHandle;
+    size_t eventFieldsSize;
+    UA_Variant *eventFields;
+} UA_EventFieldList;
+
+#define UA_TYPES_EVENTFIELDLIST 173
+
+/**
+ * StatusChangeNotification
+ * ^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_StatusCode status;
+    UA_DiagnosticInfo diagnosticInfo;
+} UA_StatusChangeNotification;
+
+#define UA_TYPES_STATUSCHANGENOTIFICATION 174
+
+/**
+ * SubscriptionAcknowledgement
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 subscriptionId;
+    UA_UInt32 sequenceNumber;
+} UA_SubscriptionAcknowledgement;
+
+#define UA_TYPES_SUBSCRIPTIONACKNOWLEDGEMENT 175
+
+/**
+ * PublishRequest
+ * ^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t subscriptionAcknowledgementsSize;
+    UA_SubscriptionAcknowledgement *subscriptionAcknowledgements;
+} UA_PublishRequest;
+
+#define UA_TYPES_PUBLISHREQUEST 176
+
+/**
+ * PublishResponse
+ * ^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_UInt32 subscriptionId;
+    size_t availableSequenceNumbersSize;
+    UA_UInt32 *availableSequenceNumbers;
+    UA_Boolean moreNotifications;
+    UA_NotificationMessage notificationMessage;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_PublishResponse;
+
+#define UA_TYPES_PUBLISHRESPONSE 177
+
+/**
+ * RepublishRequest
+ * ^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_UInt32 subscriptionId;
+    UA_UInt32 retransmitSequenceNumber;
+} UA_RepublishRequest;
+
+#define UA_TYPES_REPUBLISHREQUEST 178
+
+/**
+ * RepublishResponse
+ * ^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    UA_NotificationMessage notificationMessage;
+} UA_RepublishResponse;
+
+#define UA_TYPES_REPUBLISHRESPONSE 179
+
+/**
+ * DeleteSubscriptionsRequest
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_RequestHeader requestHeader;
+    size_t subscriptionIdsSize;
+    UA_UInt32 *subscriptionIds;
+} UA_DeleteSubscriptionsRequest;
+
+#define UA_TYPES_DELETESUBSCRIPTIONSREQUEST 180
+
+/**
+ * DeleteSubscriptionsResponse
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    UA_StatusCode *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_DeleteSubscriptionsResponse;
+
+#define UA_TYPES_DELETESUBSCRIPTIONSRESPONSE 181
+
+/**
+ * BuildInfo
+ * ^^^^^^^^^
+ */
+typedef struct {
+    UA_String productUri;
+    UA_String manufacturerName;
+    UA_String productName;
+    UA_String softwareVersion;
+    UA_String buildNumber;
+    UA_DateTime buildDate;
+} UA_BuildInfo;
+
+#define UA_TYPES_BUILDINFO 182
+
+/**
+ * RedundancySupport
+ * ^^^^^^^^^^^^^^^^^
+ */
+typedef enum {
+    UA_REDUNDANCYSUPPORT_NONE = 0,
+    UA_REDUNDANCYSUPPORT_COLD = 1,
+    UA_REDUNDANCYSUPPORT_WARM = 2,
+    UA_REDUNDANCYSUPPORT_HOT = 3,
+    UA_REDUNDANCYSUPPORT_TRANSPARENT = 4,
+    UA_REDUNDANCYSUPPORT_HOTANDMIRRORED = 5,
+    __UA_REDUNDANCYSUPPORT_FORCE32BIT = 0x7fffffff
+} UA_RedundancySupport;
+UA_STATIC_ASSERT(sizeof(UA_RedundancySupport) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_REDUNDANCYSUPPORT 183
+
+/**
+ * ServerState
+ * ^^^^^^^^^^^
+ */
+typedef enum {
+    UA_SERVERSTATE_RUNNING = 0,
+    UA_SERVERSTATE_FAILED = 1,
+    UA_SERVERSTATE_NOCONFIGURATION = 2,
+    UA_SERVERSTATE_SUSPENDED = 3,
+    UA_SERVERSTATE_SHUTDOWN = 4,
+    UA_SERVERSTATE_TEST = 5,
+    UA_SERVERSTATE_COMMUNICATIONFAULT = 6,
+    UA_SERVERSTATE_UNKNOWN = 7,
+    __UA_SERVERSTATE_FORCE32BIT = 0x7fffffff
+} UA_ServerState;
+UA_STATIC_ASSERT(sizeof(UA_ServerState) == sizeof(UA_Int32), enum_must_be_32bit);
+
+#define UA_TYPES_SERVERSTATE 184
+
+/**
+ * ServerDiagnosticsSummaryDataType
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_UInt32 serverViewCount;
+    UA_UInt32 currentSessionCount;
+    UA_UInt32 cumulatedSessionCount;
+    UA_UInt32 securityRejectedSessionCount;
+    UA_UInt32 rejectedSessionCount;
+    UA_UInt32 sessionTimeoutCount;
+    UA_UInt32 sessionAbortCount;
+    UA_UInt32 currentSubscriptionCount;
+    UA_UInt32 cumulatedSubscriptionCount;
+    UA_UInt32 publishingIntervalCount;
+    UA_UInt32 securityRejectedRequestsCount;
+    UA_UInt32 rejectedRequestsCount;
+} UA_ServerDiagnosticsSummaryDataType;
+
+#define UA_TYPES_SERVERDIAGNOSTICSSUMMARYDATATYPE 185
+
+/**
+ * ServerStatusDataType
+ * ^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    UA_DateTime startTime;
+    UA_DateTime currentTime;
+    UA_ServerState state;
+    UA_BuildInfo buildInfo;
+    UA_UInt32 secondsTillShutdown;
+    UA_LocalizedText shutdownReason;
+} UA_ServerStatusDataType;
+
+#define UA_TYPES_SERVERSTATUSDATATYPE 186
+
+/**
+ * Range
+ * ^^^^^
+ */
+typedef struct {
+    UA_Double low;
+    UA_Double high;
+} UA_Range;
+
+#define UA_TYPES_RANGE 187
+
+/**
+ * DataChangeNotification
+ * ^^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    size_t monitoredItemsSize;
+    UA_MonitoredItemNotification *monitoredItems;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} UA_DataChangeNotification;
+
+#define UA_TYPES_DATACHANGENOTIFICATION 188
+
+/**
+ * EventNotificationList
+ * ^^^^^^^^^^^^^^^^^^^^^
+ */
+typedef struct {
+    size_t eventsSize;
+    UA_EventFieldList *events;
+} UA_EventNotificationList;
+
+#define UA_TYPES_EVENTNOTIFICATIONLIST 189
+
+
+_UA_END_DECLS
+
+#endif /* TYPES_GENERATED_H_ */
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_accesscontrol"
+  "../bin/tests/check_accesscontrol.pdb"
+  "CMakeFiles/check_accesscontrol.dir/server/check_accesscontrol.c.o"
+  "CMakeFiles/check_accesscontrol.dir/server/check_accesscontrol.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_accesscontrol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
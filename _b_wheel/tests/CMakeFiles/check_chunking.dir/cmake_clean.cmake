@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_chunking"
+  "../bin/tests/check_chunking.pdb"
+  "CMakeFiles/check_chunking.dir/check_chunking.c.o"
+  "CMakeFiles/check_chunking.dir/check_chunking.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_chunking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
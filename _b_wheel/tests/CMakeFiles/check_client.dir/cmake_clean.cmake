@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_client"
+  "../bin/tests/check_client.pdb"
+  "CMakeFiles/check_client.dir/client/check_client.c.o"
+  "CMakeFiles/check_client.dir/client/check_client.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
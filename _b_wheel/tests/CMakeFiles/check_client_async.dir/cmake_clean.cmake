@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_client_async"
+  "../bin/tests/check_client_async.pdb"
+  "CMakeFiles/check_client_async.dir/client/check_client_async.c.o"
+  "CMakeFiles/check_client_async.dir/client/check_client_async.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_client_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
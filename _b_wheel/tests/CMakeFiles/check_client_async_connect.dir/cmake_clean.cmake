@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_client_async_connect"
+  "../bin/tests/check_client_async_connect.pdb"
+  "CMakeFiles/check_client_async_connect.dir/client/check_client_async_connect.c.o"
+  "CMakeFiles/check_client_async_connect.dir/client/check_client_async_connect.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_client_async_connect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_client_highlevel"
+  "../bin/tests/check_client_highlevel.pdb"
+  "CMakeFiles/check_client_highlevel.dir/client/check_client_highlevel.c.o"
+  "CMakeFiles/check_client_highlevel.dir/client/check_client_highlevel.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_client_highlevel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
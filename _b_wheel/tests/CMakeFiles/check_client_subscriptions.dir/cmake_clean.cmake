@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_client_subscriptions"
+  "../bin/tests/check_client_subscriptions.pdb"
+  "CMakeFiles/check_client_subscriptions.dir/client/check_client_subscriptions.c.o"
+  "CMakeFiles/check_client_subscriptions.dir/client/check_client_subscriptions.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_client_subscriptions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_discovery"
+  "../bin/tests/check_discovery.pdb"
+  "CMakeFiles/check_discovery.dir/server/check_discovery.c.o"
+  "CMakeFiles/check_discovery.dir/server/check_discovery.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_discovery.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_local_monitored_item"
+  "../bin/tests/check_local_monitored_item.pdb"
+  "CMakeFiles/check_local_monitored_item.dir/server/check_local_monitored_item.c.o"
+  "CMakeFiles/check_local_monitored_item.dir/server/check_local_monitored_item.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_local_monitored_item.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
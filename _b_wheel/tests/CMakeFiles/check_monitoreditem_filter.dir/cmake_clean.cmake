@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_monitoreditem_filter"
+  "../bin/tests/check_monitoreditem_filter.pdb"
+  "CMakeFiles/check_monitoreditem_filter.dir/server/check_monitoreditem_filter.c.o"
+  "CMakeFiles/check_monitoreditem_filter.dir/server/check_monitoreditem_filter.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_monitoreditem_filter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_node_inheritance"
+  "../bin/tests/check_node_inheritance.pdb"
+  "CMakeFiles/check_node_inheritance.dir/server/check_node_inheritance.c.o"
+  "CMakeFiles/check_node_inheritance.dir/server/check_node_inheritance.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_node_inheritance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
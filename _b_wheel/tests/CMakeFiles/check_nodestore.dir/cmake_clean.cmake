@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_nodestore"
+  "../bin/tests/check_nodestore.pdb"
+  "CMakeFiles/check_nodestore.dir/server/check_nodestore.c.o"
+  "CMakeFiles/check_nodestore.dir/server/check_nodestore.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_nodestore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
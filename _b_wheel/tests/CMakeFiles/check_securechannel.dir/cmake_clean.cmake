@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_securechannel"
+  "../bin/tests/check_securechannel.pdb"
+  "CMakeFiles/check_securechannel.dir/check_securechannel.c.o"
+  "CMakeFiles/check_securechannel.dir/check_securechannel.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_securechannel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
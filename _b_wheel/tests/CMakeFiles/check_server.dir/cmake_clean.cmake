@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server"
+  "../bin/tests/check_server.pdb"
+  "CMakeFiles/check_server.dir/server/check_server.c.o"
+  "CMakeFiles/check_server.dir/server/check_server.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_browsepathcache"
+  "../bin/tests/check_server_browsepathcache.pdb"
+  "CMakeFiles/check_server_browsepathcache.dir/server/check_server_browsepathcache.c.o"
+  "CMakeFiles/check_server_browsepathcache.dir/server/check_server_browsepathcache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_browsepathcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
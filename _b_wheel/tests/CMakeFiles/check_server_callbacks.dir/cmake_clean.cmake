@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_callbacks"
+  "../bin/tests/check_server_callbacks.pdb"
+  "CMakeFiles/check_server_callbacks.dir/server/check_server_callbacks.c.o"
+  "CMakeFiles/check_server_callbacks.dir/server/check_server_callbacks.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_callbacks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
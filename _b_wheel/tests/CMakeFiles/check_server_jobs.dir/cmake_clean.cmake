@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_jobs"
+  "../bin/tests/check_server_jobs.pdb"
+  "CMakeFiles/check_server_jobs.dir/server/check_server_jobs.c.o"
+  "CMakeFiles/check_server_jobs.dir/server/check_server_jobs.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_jobs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
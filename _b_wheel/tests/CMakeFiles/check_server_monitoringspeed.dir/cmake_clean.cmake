@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_monitoringspeed"
+  "../bin/tests/check_server_monitoringspeed.pdb"
+  "CMakeFiles/check_server_monitoringspeed.dir/server/check_server_monitoringspeed.c.o"
+  "CMakeFiles/check_server_monitoringspeed.dir/server/check_server_monitoringspeed.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_monitoringspeed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
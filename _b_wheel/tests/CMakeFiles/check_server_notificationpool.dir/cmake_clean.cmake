@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_notificationpool"
+  "../bin/tests/check_server_notificationpool.pdb"
+  "CMakeFiles/check_server_notificationpool.dir/server/check_server_notificationpool.c.o"
+  "CMakeFiles/check_server_notificationpool.dir/server/check_server_notificationpool.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_notificationpool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_publishencoding"
+  "../bin/tests/check_server_publishencoding.pdb"
+  "CMakeFiles/check_server_publishencoding.dir/server/check_server_publishencoding.c.o"
+  "CMakeFiles/check_server_publishencoding.dir/server/check_server_publishencoding.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_publishencoding.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
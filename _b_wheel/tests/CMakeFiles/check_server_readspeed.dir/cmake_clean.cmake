@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_readspeed"
+  "../bin/tests/check_server_readspeed.pdb"
+  "CMakeFiles/check_server_readspeed.dir/server/check_server_readspeed.c.o"
+  "CMakeFiles/check_server_readspeed.dir/server/check_server_readspeed.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_readspeed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
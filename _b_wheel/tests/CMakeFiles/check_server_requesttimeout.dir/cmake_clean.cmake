@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_requesttimeout"
+  "../bin/tests/check_server_requesttimeout.pdb"
+  "CMakeFiles/check_server_requesttimeout.dir/server/check_server_requesttimeout.c.o"
+  "CMakeFiles/check_server_requesttimeout.dir/server/check_server_requesttimeout.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_requesttimeout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
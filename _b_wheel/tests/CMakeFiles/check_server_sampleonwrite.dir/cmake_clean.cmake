@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_sampleonwrite"
+  "../bin/tests/check_server_sampleonwrite.pdb"
+  "CMakeFiles/check_server_sampleonwrite.dir/server/check_server_sampleonwrite.c.o"
+  "CMakeFiles/check_server_sampleonwrite.dir/server/check_server_sampleonwrite.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_sampleonwrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
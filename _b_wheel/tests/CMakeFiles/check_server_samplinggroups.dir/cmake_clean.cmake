@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_samplinggroups"
+  "../bin/tests/check_server_samplinggroups.pdb"
+  "CMakeFiles/check_server_samplinggroups.dir/server/check_server_samplinggroups.c.o"
+  "CMakeFiles/check_server_samplinggroups.dir/server/check_server_samplinggroups.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_samplinggroups.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
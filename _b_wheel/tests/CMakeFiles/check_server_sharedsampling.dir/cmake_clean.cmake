@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_sharedsampling"
+  "../bin/tests/check_server_sharedsampling.pdb"
+  "CMakeFiles/check_server_sharedsampling.dir/server/check_server_sharedsampling.c.o"
+  "CMakeFiles/check_server_sharedsampling.dir/server/check_server_sharedsampling.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_sharedsampling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
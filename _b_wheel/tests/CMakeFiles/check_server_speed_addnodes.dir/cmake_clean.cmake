@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_speed_addnodes"
+  "../bin/tests/check_server_speed_addnodes.pdb"
+  "CMakeFiles/check_server_speed_addnodes.dir/server/check_server_speed_addnodes.c.o"
+  "CMakeFiles/check_server_speed_addnodes.dir/server/check_server_speed_addnodes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_speed_addnodes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
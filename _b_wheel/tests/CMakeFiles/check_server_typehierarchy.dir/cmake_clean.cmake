@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_typehierarchy"
+  "../bin/tests/check_server_typehierarchy.pdb"
+  "CMakeFiles/check_server_typehierarchy.dir/server/check_server_typehierarchy.c.o"
+  "CMakeFiles/check_server_typehierarchy.dir/server/check_server_typehierarchy.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_typehierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
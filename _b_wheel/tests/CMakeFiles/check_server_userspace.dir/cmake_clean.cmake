@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_userspace"
+  "../bin/tests/check_server_userspace.pdb"
+  "CMakeFiles/check_server_userspace.dir/server/check_server_userspace.c.o"
+  "CMakeFiles/check_server_userspace.dir/server/check_server_userspace.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_userspace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_server_valuecache"
+  "../bin/tests/check_server_valuecache.pdb"
+  "CMakeFiles/check_server_valuecache.dir/server/check_server_valuecache.c.o"
+  "CMakeFiles/check_server_valuecache.dir/server/check_server_valuecache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_server_valuecache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
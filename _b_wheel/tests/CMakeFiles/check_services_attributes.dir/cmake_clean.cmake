@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_attributes"
+  "../bin/tests/check_services_attributes.pdb"
+  "CMakeFiles/check_services_attributes.dir/server/check_services_attributes.c.o"
+  "CMakeFiles/check_services_attributes.dir/server/check_services_attributes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_attributes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
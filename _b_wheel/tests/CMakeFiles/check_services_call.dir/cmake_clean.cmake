@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_call"
+  "../bin/tests/check_services_call.pdb"
+  "CMakeFiles/check_services_call.dir/server/check_services_call.c.o"
+  "CMakeFiles/check_services_call.dir/server/check_services_call.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_call.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_nodemanagement"
+  "../bin/tests/check_services_nodemanagement.pdb"
+  "CMakeFiles/check_services_nodemanagement.dir/server/check_services_nodemanagement.c.o"
+  "CMakeFiles/check_services_nodemanagement.dir/server/check_services_nodemanagement.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_nodemanagement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_read_batch"
+  "../bin/tests/check_services_read_batch.pdb"
+  "CMakeFiles/check_services_read_batch.dir/server/check_services_read_batch.c.o"
+  "CMakeFiles/check_services_read_batch.dir/server/check_services_read_batch.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_read_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
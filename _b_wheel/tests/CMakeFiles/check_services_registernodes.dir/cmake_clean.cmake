@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_registernodes"
+  "../bin/tests/check_services_registernodes.pdb"
+  "CMakeFiles/check_services_registernodes.dir/server/check_services_registernodes.c.o"
+  "CMakeFiles/check_services_registernodes.dir/server/check_services_registernodes.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_registernodes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
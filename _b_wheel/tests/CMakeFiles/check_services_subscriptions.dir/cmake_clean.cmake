@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_subscriptions"
+  "../bin/tests/check_services_subscriptions.pdb"
+  "CMakeFiles/check_services_subscriptions.dir/server/check_services_subscriptions.c.o"
+  "CMakeFiles/check_services_subscriptions.dir/server/check_services_subscriptions.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_subscriptions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
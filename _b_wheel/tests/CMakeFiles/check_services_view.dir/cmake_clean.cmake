@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_services_view"
+  "../bin/tests/check_services_view.pdb"
+  "CMakeFiles/check_services_view.dir/server/check_services_view.c.o"
+  "CMakeFiles/check_services_view.dir/server/check_services_view.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_services_view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_session"
+  "../bin/tests/check_session.pdb"
+  "CMakeFiles/check_session.dir/server/check_session.c.o"
+  "CMakeFiles/check_session.dir/server/check_session.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_session.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
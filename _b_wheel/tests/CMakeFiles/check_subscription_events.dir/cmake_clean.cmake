@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_subscription_events"
+  "../bin/tests/check_subscription_events.pdb"
+  "CMakeFiles/check_subscription_events.dir/server/check_subscription_events.c.o"
+  "CMakeFiles/check_subscription_events.dir/server/check_subscription_events.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_subscription_events.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_timer"
+  "../bin/tests/check_timer.pdb"
+  "CMakeFiles/check_timer.dir/check_timer.c.o"
+  "CMakeFiles/check_timer.dir/check_timer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_timer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_types_builtin"
+  "../bin/tests/check_types_builtin.pdb"
+  "CMakeFiles/check_types_builtin.dir/check_types_builtin.c.o"
+  "CMakeFiles/check_types_builtin.dir/check_types_builtin.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_types_builtin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
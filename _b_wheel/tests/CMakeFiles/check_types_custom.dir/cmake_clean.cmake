@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_types_custom"
+  "../bin/tests/check_types_custom.pdb"
+  "CMakeFiles/check_types_custom.dir/check_types_custom.c.o"
+  "CMakeFiles/check_types_custom.dir/check_types_custom.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_types_custom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_types_memory"
+  "../bin/tests/check_types_memory.pdb"
+  "CMakeFiles/check_types_memory.dir/check_types_memory.c.o"
+  "CMakeFiles/check_types_memory.dir/check_types_memory.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_types_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_types_range"
+  "../bin/tests/check_types_range.pdb"
+  "CMakeFiles/check_types_range.dir/check_types_range.c.o"
+  "CMakeFiles/check_types_range.dir/check_types_range.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_types_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tests/check_utils"
+  "../bin/tests/check_utils.pdb"
+  "CMakeFiles/check_utils.dir/check_utils.c.o"
+  "CMakeFiles/check_utils.dir/check_utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
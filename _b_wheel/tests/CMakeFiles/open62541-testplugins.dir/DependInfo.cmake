@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/arch/network_tcp.c" "tests/CMakeFiles/open62541-testplugins.dir/__/arch/network_tcp.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/arch/network_tcp.c.o.d"
+  "/root/repo/arch/posix/ua_architecture_functions.c" "tests/CMakeFiles/open62541-testplugins.dir/__/arch/posix/ua_architecture_functions.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/arch/posix/ua_architecture_functions.c.o.d"
+  "/root/repo/plugins/securityPolicies/ua_securitypolicy_none.c" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/securityPolicies/ua_securitypolicy_none.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/securityPolicies/ua_securitypolicy_none.c.o.d"
+  "/root/repo/plugins/ua_accesscontrol_default.c" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_accesscontrol_default.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_accesscontrol_default.c.o.d"
+  "/root/repo/plugins/ua_config_default.c" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_config_default.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_config_default.c.o.d"
+  "/root/repo/plugins/ua_log_stdout.c" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_log_stdout.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_log_stdout.c.o.d"
+  "/root/repo/plugins/ua_nodestore_default.c" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_nodestore_default.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_nodestore_default.c.o.d"
+  "/root/repo/plugins/ua_pki_default.c" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_pki_default.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/__/plugins/ua_pki_default.c.o.d"
+  "/root/repo/tests/testing-plugins/testing_clock.c" "tests/CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_clock.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_clock.c.o.d"
+  "/root/repo/tests/testing-plugins/testing_networklayers.c" "tests/CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_networklayers.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_networklayers.c.o.d"
+  "/root/repo/tests/testing-plugins/testing_policy.c" "tests/CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_policy.c.o" "gcc" "tests/CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_policy.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/open62541-testplugins.dir/__/arch/network_tcp.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/arch/network_tcp.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/arch/posix/ua_architecture_functions.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/arch/posix/ua_architecture_functions.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/securityPolicies/ua_securitypolicy_none.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/securityPolicies/ua_securitypolicy_none.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_accesscontrol_default.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_accesscontrol_default.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_config_default.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_config_default.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_log_stdout.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_log_stdout.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_nodestore_default.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_nodestore_default.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_pki_default.c.o"
+  "CMakeFiles/open62541-testplugins.dir/__/plugins/ua_pki_default.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_clock.c.o"
+  "CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_clock.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_networklayers.c.o"
+  "CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_networklayers.c.o.d"
+  "CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_policy.c.o"
+  "CMakeFiles/open62541-testplugins.dir/testing-plugins/testing_policy.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/open62541-testplugins.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
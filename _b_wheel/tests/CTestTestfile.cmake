@@ -0,0 +1,97 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_b_wheel/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(types_builtin "/root/repo/_b_wheel/bin/tests/check_types_builtin")
+set_tests_properties(types_builtin PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;128;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_memory "/root/repo/_b_wheel/bin/tests/check_types_memory")
+set_tests_properties(types_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;148;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_range "/root/repo/_b_wheel/bin/tests/check_types_range")
+set_tests_properties(types_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;152;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(types_custom "/root/repo/_b_wheel/bin/tests/check_types_custom")
+set_tests_properties(types_custom PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;156;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(chunking "/root/repo/_b_wheel/bin/tests/check_chunking")
+set_tests_properties(chunking PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;160;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(utils "/root/repo/_b_wheel/bin/tests/check_utils")
+set_tests_properties(utils PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;164;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(securechannel "/root/repo/_b_wheel/bin/tests/check_securechannel")
+set_tests_properties(securechannel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;168;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(timer "/root/repo/_b_wheel/bin/tests/check_timer")
+set_tests_properties(timer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;172;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(accesscontrol "/root/repo/_b_wheel/bin/tests/check_accesscontrol")
+set_tests_properties(accesscontrol PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;178;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_view "/root/repo/_b_wheel/bin/tests/check_services_view")
+set_tests_properties(services_view PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;182;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_registernodes "/root/repo/_b_wheel/bin/tests/check_services_registernodes")
+set_tests_properties(services_registernodes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;186;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_attributes "/root/repo/_b_wheel/bin/tests/check_services_attributes")
+set_tests_properties(services_attributes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;190;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_read_batch "/root/repo/_b_wheel/bin/tests/check_services_read_batch")
+set_tests_properties(services_read_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;200;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_nodemanagement "/root/repo/_b_wheel/bin/tests/check_services_nodemanagement")
+set_tests_properties(services_nodemanagement PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;204;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_callbacks "/root/repo/_b_wheel/bin/tests/check_server_callbacks")
+set_tests_properties(server_callbacks PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;208;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_call "/root/repo/_b_wheel/bin/tests/check_services_call")
+set_tests_properties(services_call PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;260;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(services_subscriptions "/root/repo/_b_wheel/bin/tests/check_services_subscriptions")
+set_tests_properties(services_subscriptions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;264;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(monitoreditem_filter "/root/repo/_b_wheel/bin/tests/check_monitoreditem_filter")
+set_tests_properties(monitoreditem_filter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;268;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(subscription_events "/root/repo/_b_wheel/bin/tests/check_subscription_events")
+set_tests_properties(subscription_events PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;272;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodestore "/root/repo/_b_wheel/bin/tests/check_nodestore")
+set_tests_properties(nodestore PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;276;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_typehierarchy "/root/repo/_b_wheel/bin/tests/check_server_typehierarchy")
+set_tests_properties(server_typehierarchy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;298;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_valuecache "/root/repo/_b_wheel/bin/tests/check_server_valuecache")
+set_tests_properties(server_valuecache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;302;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_browsepathcache "/root/repo/_b_wheel/bin/tests/check_server_browsepathcache")
+set_tests_properties(server_browsepathcache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;306;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_requesttimeout "/root/repo/_b_wheel/bin/tests/check_server_requesttimeout")
+set_tests_properties(server_requesttimeout PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;310;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(session "/root/repo/_b_wheel/bin/tests/check_session")
+set_tests_properties(session PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;320;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server "/root/repo/_b_wheel/bin/tests/check_server")
+set_tests_properties(server PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;324;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_jobs "/root/repo/_b_wheel/bin/tests/check_server_jobs")
+set_tests_properties(server_jobs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;328;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_userspace "/root/repo/_b_wheel/bin/tests/check_server_userspace")
+set_tests_properties(server_userspace PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;332;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(node_inheritance "/root/repo/_b_wheel/bin/tests/check_node_inheritance")
+set_tests_properties(node_inheritance PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;336;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(local_monitored_item "/root/repo/_b_wheel/bin/tests/check_local_monitored_item")
+set_tests_properties(local_monitored_item PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;340;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(discovery "/root/repo/_b_wheel/bin/tests/check_discovery")
+set_tests_properties(discovery PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;345;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_readspeed "/root/repo/_b_wheel/bin/tests/check_server_readspeed")
+set_tests_properties(server_readspeed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;395;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_speed_addnodes "/root/repo/_b_wheel/bin/tests/check_server_speed_addnodes")
+set_tests_properties(server_speed_addnodes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;399;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_monitoringspeed "/root/repo/_b_wheel/bin/tests/check_server_monitoringspeed")
+set_tests_properties(server_monitoringspeed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;404;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_sharedsampling "/root/repo/_b_wheel/bin/tests/check_server_sharedsampling")
+set_tests_properties(server_sharedsampling PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;408;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_sampleonwrite "/root/repo/_b_wheel/bin/tests/check_server_sampleonwrite")
+set_tests_properties(server_sampleonwrite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;412;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_notificationpool "/root/repo/_b_wheel/bin/tests/check_server_notificationpool")
+set_tests_properties(server_notificationpool PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;416;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_samplinggroups "/root/repo/_b_wheel/bin/tests/check_server_samplinggroups")
+set_tests_properties(server_samplinggroups PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;420;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(server_publishencoding "/root/repo/_b_wheel/bin/tests/check_server_publishencoding")
+set_tests_properties(server_publishencoding PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;424;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(client "/root/repo/_b_wheel/bin/tests/check_client")
+set_tests_properties(client PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;437;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(client_securechannel "/root/repo/_b_wheel/bin/tests/check_client_securechannel")
+set_tests_properties(client_securechannel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;441;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(client_async "/root/repo/_b_wheel/bin/tests/check_client_async")
+set_tests_properties(client_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;445;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(client_async_connect "/root/repo/_b_wheel/bin/tests/check_client_async_connect")
+set_tests_properties(client_async_connect PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;449;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(client_subscriptions "/root/repo/_b_wheel/bin/tests/check_client_subscriptions")
+set_tests_properties(client_subscriptions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;453;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+add_test(client_highlevel "/root/repo/_b_wheel/bin/tests/check_client_highlevel")
+set_tests_properties(client_highlevel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;112;add_test;/root/repo/tests/CMakeLists.txt;457;add_test_valgrind;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("nodeset-compiler")
@@ -71,6 +71,9 @@ typedef struct UA_ReferenceTarget {
     ZIP_ENTRY(UA_ReferenceTarget) zipfields;
     UA_UInt32 targetHash; /* Hash of the target nodeid */
     UA_ExpandedNodeId target;
+#ifdef UA_ENABLE_STRING_INTERNING
+    UA_Boolean interned; /* The string identifier of the target is interned */
+#endif
 } UA_ReferenceTarget;
 
 ZIP_HEAD(UA_ReferenceTargetHead, UA_ReferenceTarget);
@@ -86,6 +89,16 @@ typedef struct {
     UA_ReferenceTargetHead refTargetsTree;
 } UA_NodeReferenceKind;
 
+/* Bitmask of the standard attributes that reference interned strings. Interned
+ * strings are shared between nodes and must not be freed or modified
+ * directly. */
+#ifdef UA_ENABLE_STRING_INTERNING
+#define UA_NODE_INTERNEDSTRINGS                 \
+    UA_Byte internedStrings;
+#else
+#define UA_NODE_INTERNEDSTRINGS
+#endif
+
 #define UA_NODE_BASEATTRIBUTES                  \
     UA_NodeId nodeId;                           \
     UA_NodeClass nodeClass;                     \
@@ -98,7 +111,8 @@ typedef struct {
                                                 \
     /* Members specific to open62541 */         \
     void *context;                              \
-    UA_Boolean constructed; /* Constructors were called */
+    UA_Boolean constructed; /* Constructors were called */ \
+    UA_NODE_INTERNEDSTRINGS
 
 typedef struct {
     UA_NODE_BASEATTRIBUTES
@@ -200,6 +214,15 @@ typedef struct {
     UA_Byte accessLevel;
     UA_Double minimumSamplingInterval;
     UA_Boolean historizing;
+
+    /* Members specific to open62541 */
+    UA_DataSourceReadBatch readBatch; /* Optional for a DataSource */
+    UA_Boolean sampleOnWrite; /* MonitoredItems on the value are sampled
+                               * when the value is written */
+#if UA_MULTITHREADING >= 100
+    UA_Boolean async; /* Reads and writes of the value from clients are
+                       * processed as async operations */
+#endif
 } UA_VariableNode;
 
 /**
@@ -506,6 +529,70 @@ void
 UA_Nodestore_iterate(void *nsCtx, UA_NodestoreVisitor visitor,
                      void *visitorCtx);
 
+#ifdef UA_ENABLE_NODESTORE_SWITCH
+
+/**
+ * Nodestore Switch
+ * ----------------
+ *
+ * With the nodestore switch, the ``UA_Nodestore_*`` functions above dispatch on
+ * the namespace index of the NodeId to a backend that is registered for that
+ * namespace. Namespaces without a registered backend use the default zip-tree
+ * nodestore. So a static namespace zero, a compact store for a large read-only
+ * device model and a small dynamic namespace can be combined in one server.
+ *
+ * A backend implements the nodestore functions with its own context. The
+ * switch takes ownership of the backend and calls ``clear`` when the server is
+ * deleted. The same backend may be registered for several namespaces.
+ *
+ * Nodes created with ``UA_Nodestore_newNode`` are allocated in the default
+ * backend. The switch records the backend of the editable copies from
+ * ``UA_Nodestore_getNodeCopy``. So editable nodes are always deleted and
+ * replaced in the backend that allocated them, even if their NodeId was changed
+ * in between. ``UA_Nodestore_insertNode`` moves a node to the backend of its
+ * namespace if it was allocated elsewhere. */
+
+typedef struct {
+    void *context;
+    void (*clear)(void *nsCtx);
+
+    UA_Node * (*newNode)(void *nsCtx, UA_NodeClass nodeClass);
+    void (*deleteNode)(void *nsCtx, UA_Node *node);
+
+    const UA_Node * (*getNode)(void *nsCtx, const UA_NodeId *nodeId);
+    void (*releaseNode)(void *nsCtx, const UA_Node *node);
+    UA_StatusCode (*getNodeCopy)(void *nsCtx, const UA_NodeId *nodeId,
+                                 UA_Node **outNode);
+
+    UA_StatusCode (*insertNode)(void *nsCtx, UA_Node *node,
+                                UA_NodeId *addedNodeId);
+    UA_StatusCode (*replaceNode)(void *nsCtx, UA_Node *node);
+    UA_StatusCode (*removeNode)(void *nsCtx, const UA_NodeId *nodeId);
+
+    void (*iterate)(void *nsCtx, UA_NodestoreVisitor visitor,
+                    void *visitorCtx);
+} UA_NodestoreInterface;
+
+/* Initialize the default zip-tree nodestore as a backend for the switch */
+UA_StatusCode UA_EXPORT
+UA_Nodestore_ZipTree(UA_NodestoreInterface *ns);
+
+/* Register a backend for the namespace. The previous backend of the namespace
+ * is cleared unless it is still registered for another namespace. With a NULL
+ * backend, the namespace is reset to the default backend. Backends need to be
+ * registered before nodes are added to the namespace. The switch is not
+ * thread-safe during the registration. */
+UA_StatusCode UA_EXPORT
+UA_NodestoreSwitch_setNamespace(void *nsCtx, UA_UInt16 namespaceIndex,
+                                const UA_NodestoreInterface *backend);
+
+/* Same as above, for the nodestore of the server */
+UA_StatusCode UA_EXPORT
+UA_Server_setNamespaceNodestore(UA_Server *server, UA_UInt16 namespaceIndex,
+                                const UA_NodestoreInterface *backend);
+
+#endif /* UA_ENABLE_NODESTORE_SWITCH */
+
 /**
  * Node Handling
  * =============
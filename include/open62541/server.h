@@ -401,6 +401,16 @@ UA_Server_writeValue(UA_Server *server, const UA_NodeId nodeId,
                              &UA_TYPES[UA_TYPES_VARIANT], &value);
 }
 
+/* Writes the value of a VariableNode like UA_Server_writeValue. If the new
+ * value has the same data type and array dimensions as the current value, the
+ * type checks against the DataType, ValueRank and ArrayDimensions attributes
+ * are skipped. The current value has already passed them. Otherwise the value
+ * is fully checked. Use this for high-frequency updates from local data
+ * sources (device drivers, PubSub readers, etc.). */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_writeValueSameType(UA_Server *server, const UA_NodeId nodeId,
+                             const UA_Variant value);
+
 static UA_INLINE UA_THREADSAFE UA_StatusCode
 UA_Server_writeDataType(UA_Server *server, const UA_NodeId nodeId,
                         const UA_NodeId dataType) {
@@ -747,6 +757,29 @@ UA_StatusCode UA_EXPORT UA_THREADSAFE
 UA_Server_setNodeContext(UA_Server *server, UA_NodeId nodeId,
                          void *nodeContext);
 
+#ifdef UA_ENABLE_VIRTUAL_NODES
+/**
+ * Virtual Instance Children
+ * ^^^^^^^^^^^^^^^^^^^^^^^^^
+ *
+ * Instantiating an ObjectType copies all of its mandatory children into the
+ * information model. For large types with many instances, most of these copies
+ * are never modified. When virtual children are enabled for an ObjectType, new
+ * instances only reference their mandatory Variable and Object children. The
+ * child nodes are derived from the InstanceDeclaration of the type when they
+ * are accessed. A child is stored in the nodestore once it is written or once
+ * references are added to it.
+ *
+ * Virtual children have an opaque ByteString NodeId. They have no node context
+ * and the constructors of the child types are not called for them. The
+ * ``generateChildNodeId`` callback of the nodestore is not used. Optional
+ * children and methods are instantiated as before. Only instances created
+ * after the call are affected. */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_setVirtualInstanceChildren(UA_Server *server, const UA_NodeId typeId,
+                                     UA_Boolean enable);
+#endif
+
 /**
  * .. _datasource:
  *
@@ -830,6 +863,137 @@ UA_StatusCode UA_EXPORT UA_THREADSAFE
 UA_Server_setVariableNode_dataSource(UA_Server *server, const UA_NodeId nodeId,
                                      const UA_DataSource dataSource);
 
+/**
+ * Batched DataSource Reads
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ * A DataSource variable can additionally have a batched read callback. When a
+ * Read request contains several variables with the same batched callback, the
+ * callback is called once for all of them. This allows drivers to do a single
+ * block read on the underlying device instead of one round trip per variable.
+ * The same holds for the MonitoredItems of a sampling group (see the
+ * samplingGroups option of the server config). The read callback of the
+ * DataSource is still used for individual reads. */
+typedef struct {
+    const UA_NodeId *nodeId;
+    void *nodeContext;
+    const UA_NumericRange *range; /* Can be NULL. Same semantics as for the
+                                   * read callback of the DataSource. */
+} UA_DataSourceReadItem;
+
+/* Reads the values of several DataSource variables. The values array has the
+ * same length as the items array and is initialized. The values are set with
+ * the same semantics as for the read callback of the DataSource. Values with
+ * UA_VARIANT_DATA_NODELETE are copied right after the callback returns.
+ *
+ * @return Returns a status code for logging. If an error is returned, the
+ *         values are not released and the status code is set for all items. */
+typedef UA_StatusCode
+(*UA_DataSourceReadBatch)(UA_Server *server, const UA_NodeId *sessionId,
+                          void *sessionContext, UA_Boolean includeSourceTimeStamp,
+                          size_t itemsSize, const UA_DataSourceReadItem *items,
+                          UA_DataValue *values);
+
+/* Sets the batched read callback of a DataSource variable. Can be NULL to
+ * remove the callback. Setting a new DataSource also removes the callback. */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_setVariableNode_dataSourceReadBatch(UA_Server *server, const UA_NodeId nodeId,
+                                              const UA_DataSourceReadBatch readBatch);
+
+/**
+ * DataSource Value Cache
+ * ~~~~~~~~~~~~~~~~~~~~~~
+ * If ``valueCacheSize`` is set in the server configuration, the last value of
+ * every DataSource variable is cached. Read requests with a ``maxAge`` and the
+ * sampling of MonitoredItems take recent values from the cache instead of
+ * calling the DataSource. */
+typedef struct {
+    UA_UInt64 hits;   /* Reads answered from the cache */
+    UA_UInt64 misses; /* Reads with a maxAge that called the DataSource */
+    size_t entries;   /* Currently cached values */
+} UA_ValueCacheStatistics;
+
+void UA_EXPORT UA_THREADSAFE
+UA_Server_getValueCacheStatistics(UA_Server *server, UA_ValueCacheStatistics *stats);
+
+/**
+ * BrowsePath Cache
+ * ~~~~~~~~~~~~~~~~
+ * If ``browsePathCacheSize`` is set in the server configuration, the resolved
+ * targets of TranslateBrowsePathsToNodeIds and
+ * ``UA_Server_browseSimplifiedBrowsePath`` are cached. Changes to the nodes
+ * along a cached path remove the affected entries. */
+typedef struct {
+    UA_UInt64 hits;   /* Browse paths answered from the cache */
+    UA_UInt64 misses; /* Browse paths that were resolved in the nodestore */
+    size_t entries;   /* Currently cached browse paths */
+} UA_BrowsePathCacheStatistics;
+
+void UA_EXPORT UA_THREADSAFE
+UA_Server_getBrowsePathCacheStatistics(UA_Server *server,
+                                       UA_BrowsePathCacheStatistics *stats);
+
+/**
+ * Request Timeouts
+ * ~~~~~~~~~~~~~~~~
+ * The ``timeoutHint`` in the request header is counted from the time the
+ * first chunk of the request was received. A request that is still waiting
+ * when its deadline has passed is rejected with ``BadTimeout`` before the
+ * service runs. Read, Browse, BrowseNext and TranslateBrowsePathsToNodeIds
+ * check the deadline for every operation and abort with ``BadTimeout`` once it
+ * has passed. A ``timeoutHint`` of zero means no timeout. */
+typedef struct {
+    UA_UInt64 rejected; /* Requests timed out before the service ran */
+    UA_UInt64 aborted;  /* Requests timed out while the service ran */
+} UA_RequestTimeoutStatistics;
+
+void UA_EXPORT UA_THREADSAFE
+UA_Server_getRequestTimeoutStatistics(UA_Server *server,
+                                      UA_RequestTimeoutStatistics *stats);
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/**
+ * Notification Pools
+ * ~~~~~~~~~~~~~~~~~~
+ * If ``notificationSlabSize`` is set in the server configuration,
+ * notifications and retransmission entries are allocated from slab pools. */
+typedef struct {
+    size_t slabs;          /* Allocated slabs */
+    size_t inUse;          /* Objects currently in use */
+    size_t free;           /* Objects ready for reuse */
+    UA_UInt64 allocations; /* Objects handed out overall */
+} UA_SlabPoolStatistics;
+
+typedef struct {
+    UA_SlabPoolStatistics notifications;
+    UA_SlabPoolStatistics retransmissions;
+    UA_UInt64 bufferReuses;      /* Publish responses with a reused array */
+    UA_UInt64 bufferAllocations; /* Publish responses with a new array */
+} UA_NotificationPoolStatistics;
+
+void UA_EXPORT UA_THREADSAFE
+UA_Server_getNotificationPoolStatistics(UA_Server *server,
+                                        UA_NotificationPoolStatistics *stats);
+#endif
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+/**
+ * Event Index
+ * ~~~~~~~~~~~
+ * If ``eventIndexSize`` is set in the server configuration, the event
+ * MonitoredItems that receive the events of a source node are looked up once
+ * and then reused for the following events of that node. Adding or removing
+ * event MonitoredItems and changes to Organizes and HasComponent references
+ * reset the index. */
+typedef struct {
+    UA_UInt64 hits;   /* Events delivered with the indexed MonitoredItems */
+    UA_UInt64 misses; /* Events whose MonitoredItems were browsed */
+    size_t entries;   /* Currently indexed source nodes */
+} UA_EventIndexStatistics;
+
+void UA_EXPORT UA_THREADSAFE
+UA_Server_getEventIndexStatistics(UA_Server *server, UA_EventIndexStatistics *stats);
+#endif
+
 /**
  * .. _value-callback:
  *
@@ -931,6 +1095,35 @@ UA_Server_createDataChangeMonitoredItem(UA_Server *server,
 UA_StatusCode UA_EXPORT UA_THREADSAFE
 UA_Server_deleteMonitoredItem(UA_Server *server, UA_UInt32 monitoredItemId);
 
+/**
+ * Sampling on Write
+ * ~~~~~~~~~~~~~~~~~
+ * MonitoredItems on the value of a variable are usually sampled periodically.
+ * If the value changes only when it is written, the MonitoredItems can instead
+ * be sampled when the value is written. They have no sampling callback then.
+ * The sampling interval becomes the minimum time between two samples. Writes
+ * in between are sampled together once the interval has passed.
+ *
+ * Sampling on write can be enabled for all variables with the
+ * ``sampleOnWrite`` flag in the server config. That applies only to variables
+ * that hold their value in the node and have no ``onRead`` value callback.
+ * For an individual variable, it can be enabled with
+ * ``UA_Server_setVariableNodeSampleOnWrite``. If the variable has a
+ * DataSource, then the application has to call
+ * ``UA_Server_notifyValueChanged`` whenever the value changes. */
+
+/* Enable or disable sampling on write for the MonitoredItems on the value of
+ * the variable. Also applies to the existing MonitoredItems. */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_setVariableNodeSampleOnWrite(UA_Server *server, const UA_NodeId nodeId,
+                                       UA_Boolean sampleOnWrite);
+
+/* Samples the MonitoredItems that are sampled on write for the value of the
+ * variable. To be called when the value of a DataSource has changed. Writes
+ * of the value attribute trigger the sampling automatically. */
+void UA_EXPORT UA_THREADSAFE
+UA_Server_notifyValueChanged(UA_Server *server, const UA_NodeId nodeId);
+
 #endif
 
 /**
@@ -1265,6 +1458,33 @@ UA_Server_addMethodNode_finish(UA_Server *server, const UA_NodeId nodeId,
 
 #endif
 
+/**
+ * Bulk Node Addition
+ * ^^^^^^^^^^^^^^^^^^
+ * Loading large generated or imported information models node by node repeats
+ * the same lookups and checks for every node. ``UA_Server_addNodes`` processes
+ * a batch of nodes in three passes:
+ *
+ *  - All nodes are created and inserted into the nodestore. So the nodes in
+ *    the batch can refer to each other regardless of their order.
+ *  - The references to the parent and the type definition are added. The
+ *    reference and type checks are run once for every distinct combination
+ *    of NodeClass, parent, ReferenceType and TypeDefinition in the batch. The
+ *    inverse references are collected and added with one edit per parent and
+ *    type node.
+ *  - The children of objects and variables are instantiated and the
+ *    constructors are called (same as the _finish method). The type is
+ *    browsed for children once per combination.
+ *
+ * The ``nodeContexts`` array can be NULL. Otherwise it has one entry per item.
+ * The results array is provided by the caller with one entry per item. It
+ * contains the status and the NodeId of every added node. A node whose
+ * references or instantiation fail is removed again. */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_addNodes(UA_Server *server, size_t itemsSize,
+                   const UA_AddNodesItem *items, void **nodeContexts,
+                   UA_AddNodesResult *results);
+
 /* Deletes a node and optionally all references leading to the node. */
 UA_StatusCode UA_EXPORT UA_THREADSAFE
 UA_Server_deleteNode(UA_Server *server, const UA_NodeId nodeId,
@@ -1303,7 +1523,12 @@ UA_Server_deleteReference(UA_Server *server, const UA_NodeId sourceNodeId,
  * generated automatically and is returned through ``outEventId``. ``NULL`` can be passed if the `EventId` is not
  * needed. ``deleteEventNode`` specifies whether the node representation of the event should be deleted after invoking
  * the method. This can be useful if events with the similar attributes are triggered frequently. ``UA_TRUE`` would
- * cause the node to be deleted. */
+ * cause the node to be deleted.
+ *
+ * The method ``UA_Server_emitEvent`` emits an event without creating a node for it. The fields of the event are given
+ * as a list of names and values. The select clauses of the monitored items are resolved against the names. Only the
+ * values of direct children of the event can be selected this way. The `EventId`, `EventType`, `SourceNode` and
+ * `ReceiveTime` are set by the server. If no `Time` is given, the `ReceiveTime` is used. */
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
 
 /* The EventQueueOverflowEventType is defined as abstract, therefore we can not
@@ -1335,6 +1560,26 @@ UA_StatusCode UA_EXPORT UA_THREADSAFE
 UA_Server_triggerEvent(UA_Server *server, const UA_NodeId eventNodeId, const UA_NodeId originId,
                        UA_ByteString *outEventId, const UA_Boolean deleteEventNode);
 
+/* A field of an event that is emitted without a node representation */
+typedef struct {
+    UA_QualifiedName name; /* BrowseName of the event property */
+    UA_Variant value;
+} UA_EventField;
+
+/* Emits an event from its fields by applying EventFilters and adding the event
+ * to the appropriate queues. No node is created for the event.
+ * @param server The server object
+ * @param eventType The type of the event. Must be a subtype of BaseEventType
+ * @param originId The NodeId of the node that emits the event
+ * @param fieldsSize The number of event fields
+ * @param fields The event fields. They are copied for the notifications.
+ * @param outEventId the EventId of the new event
+ * @return The StatusCode of the UA_Server_emitEvent method */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_emitEvent(UA_Server *server, const UA_NodeId eventType, const UA_NodeId originId,
+                    size_t fieldsSize, const UA_EventField *fields,
+                    UA_ByteString *outEventId);
+
 #endif /* UA_ENABLE_SUBSCRIPTIONS_EVENTS */
 
 UA_StatusCode UA_EXPORT
@@ -1389,7 +1634,22 @@ UA_Server_AccessControl_allowHistoryUpdateDeleteRawModified(UA_Server *server,
 * - fetch MethodCall: ``UA_Server_GetNextAsyncMethod``
 * - execute Method: e.g. UA_Server_call(UA_Server*, UA_CallMethodRequest*)
 * - pass back the result: ``UA_Server_SetAsyncMethodResult``
-* - free memory used: free UA_CallMethodResult */
+* - free memory used: free UA_CallMethodResult
+*
+* Async Variables
+* ---------------
+* Reads and writes of the value attribute of variables marked as async are
+* handled in the same way. When a client reads or writes such a variable, the
+* operation is added to the queue with the type ``UA_ASYNCOPERATIONTYPE_READ``
+* or ``UA_ASYNCOPERATIONTYPE_WRITE``. The other operations of the request are
+* processed right away. The response is sent once the results of all queued
+* operations have been set with ``UA_Server_setAsyncOperationResult``. So a
+* slow device does not block the server loop.
+*
+* The access level is checked before the operation is queued. The read result
+* is returned to the client as it is set. Reads and writes with
+* ``UA_Server_read`` and ``UA_Server_write`` are never queued. They can be used
+* to process the queued operations in a worker thread. */
 
 #if UA_MULTITHREADING >= 100
 
@@ -1398,26 +1658,31 @@ UA_StatusCode UA_EXPORT
 UA_Server_setMethodNodeAsync(UA_Server *server, const UA_NodeId id,
                              UA_Boolean isAsync);
 
+/* Set the async flag in a variable node */
+UA_StatusCode UA_EXPORT UA_THREADSAFE
+UA_Server_setVariableNodeAsync(UA_Server *server, const UA_NodeId id,
+                               UA_Boolean isAsync);
+
 typedef enum {
     UA_ASYNCOPERATIONTYPE_INVALID, /* 0, the default */
-    UA_ASYNCOPERATIONTYPE_CALL
-    /* UA_ASYNCOPERATIONTYPE_READ, */
-    /* UA_ASYNCOPERATIONTYPE_WRITE, */
+    UA_ASYNCOPERATIONTYPE_CALL,
+    UA_ASYNCOPERATIONTYPE_READ,
+    UA_ASYNCOPERATIONTYPE_WRITE
 } UA_AsyncOperationType;
 
 typedef union {
     UA_CallMethodRequest callMethodRequest;
-    /* UA_ReadValueId readValueId; */
-    /* UA_WriteValue writeValue; */
+    UA_ReadValueId readValueId;
+    UA_WriteValue writeValue;
 } UA_AsyncOperationRequest;
 
 typedef union {
     UA_CallMethodResult callMethodResult;
-    /* UA_DataValue readResult; */
-    /* UA_StatusCode writeResult; */
+    UA_DataValue readResult;
+    UA_StatusCode writeResult;
 } UA_AsyncOperationResponse;
 
-/* Get and remove next Method Call Request
+/* Get and remove the next async operation
  *
  * @param server The server object
  * @param type The type of the async operation
@@ -1430,10 +1695,11 @@ UA_Server_getAsyncOperation(UA_Server *server, UA_AsyncOperationType *type,
                             const UA_AsyncOperationRequest **request,
                             void **context);
 
-/* Worker submits Method Call Response
+/* Worker submits the result of an async operation
  *
  * @param server The server object
- * @param response Pointer to the operation result
+ * @param response Pointer to the operation result of the type returned by
+ *        UA_Server_getAsyncOperation
  * @param context Pointer to the operation context */
 void UA_EXPORT
 UA_Server_setAsyncOperationResult(UA_Server *server,
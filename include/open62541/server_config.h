@@ -88,6 +88,12 @@ typedef void
 
 struct UA_ServerConfig {
     UA_UInt16 nThreads; /* only if multithreading is enabled */
+
+    /* Read, Write and Browse requests with at least this many operations are
+     * processed in parallel by the worker threads. The DataSource callbacks
+     * are then called concurrently. 0 disables the parallel processing. Only
+     * if multithreading is enabled (UA_MULTITHREADING >= 200). */
+    UA_UInt32 parallelOperationsThreshold;
     UA_Logger logger;
 
     /* Server Description */
@@ -184,6 +190,22 @@ struct UA_ServerConfig {
     /* Limits for Requests */
     UA_UInt32 maxReferencesPerNode;
 
+    /* Value Cache
+     * The last value read from a DataSource variable is kept together with
+     * the time of the read. Reads with a sufficient maxAge and the sampling of
+     * MonitoredItems are then answered from the cache without calling the
+     * DataSource. The cached values are shared between all Sessions. So the
+     * cache must not be used if DataSources return Session-specific values.
+     * 0 disables the cache. */
+    UA_UInt32 valueCacheSize; /* Maximum number of cached values */
+
+    /* BrowsePath Cache
+     * The results of TranslateBrowsePathsToNodeIds and of
+     * UA_Server_browseSimplifiedBrowsePath are cached. An entry is removed when
+     * a node that was evaluated for the result is added, deleted or changes its
+     * references or BrowseName. 0 disables the cache. */
+    UA_UInt32 browsePathCacheSize; /* Maximum number of cached browse paths */
+
     /* Limits for Subscriptions */
     UA_UInt32 maxSubscriptions;
     UA_UInt32 maxSubscriptionsPerSession;
@@ -193,8 +215,35 @@ struct UA_ServerConfig {
     UA_UInt32 maxNotificationsPerPublish;
     UA_Boolean enableRetransmissionQueue;
     UA_UInt32 maxRetransmissionQueueSize; /* 0 -> unlimited size */
+
+    /* Notification Pools
+     * Notifications and the entries of the retransmission queue are taken
+     * from pools with slabs of notificationSlabSize objects. Released objects
+     * are reused and the slabs are kept until the server is deleted. The
+     * arrays of DataChangeNotifications in the publish responses are
+     * allocated for the notificationsPerPublish of the subscription and are
+     * reused as well. The setting is taken when the first notification is
+     * created. 0 disables the pools. */
+    UA_UInt32 notificationSlabSize;
+
+    /* Encoded Notifications
+     * The notifications are encoded into the NotificationMessage as they are
+     * taken from the queue. They are not moved into the decoded structures of
+     * the publish response first. The retransmission queue keeps the encoded
+     * message. This reduces the allocations per publish response and the
+     * memory used by the retransmission queue. */
+    UA_Boolean encodeNotifications;
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
     UA_UInt32 maxEventsPerNode; /* 0 -> unlimited size */
+
+    /* Event Index
+     * The event MonitoredItems of the origin node and of its parents along
+     * Organizes and HasComponent references are browsed for the first event
+     * of an origin node and then reused. 0 disables the index. */
+    UA_UInt32 eventIndexSize; /* Maximum number of indexed origin nodes */
+
+    /* EventFilters with more elements in the where clause are rejected */
+    UA_UInt32 maxWhereClauseElements; /* 0 -> unlimited */
 #endif
 
     /* Limits for MonitoredItems */
@@ -203,6 +252,26 @@ struct UA_ServerConfig {
     UA_DurationRange samplingIntervalLimits; /* in ms (must not be less than 5) */
     UA_UInt32Range queueSizeLimits; /* Negotiated with the client */
 
+    /* Shared Sampling
+     * MonitoredItems that sample the same attribute of a node with the same
+     * sampling interval are sampled only once. The sample is read with the
+     * rights of the admin session, and the access of every session is checked
+     * separately. So DataSources see the SessionId of the admin session. */
+    UA_Boolean sharedSampling;
+
+    /* Sampling Groups
+     * MonitoredItems with the same sampling interval are sampled together from
+     * a single callback. This reduces the overhead of the timer and the locking
+     * for many MonitoredItems on different nodes. */
+    UA_Boolean samplingGroups;
+
+    /* Sampling on Write
+     * MonitoredItems on the value of variables are sampled when the value is
+     * written instead of periodically. Only for variables that hold their
+     * value in the node and have no onRead callback. See
+     * UA_Server_setVariableNodeSampleOnWrite for individual variables. */
+    UA_Boolean sampleOnWrite;
+
     /* Limits for PublishRequests */
     UA_UInt32 maxPublishReqPerSession;
 
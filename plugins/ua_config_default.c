@@ -117,6 +117,7 @@ setDefaultConfig(UA_ServerConfig *conf) {
 
     /* --> Start setting the default static config <-- */
     conf->nThreads = 1;
+    conf->parallelOperationsThreshold = 1000;
     conf->logger = UA_Log_Stdout_;
 
     conf->shutdownDelay = 0.0;
@@ -192,6 +193,7 @@ setDefaultConfig(UA_ServerConfig *conf) {
     conf->maxRetransmissionQueueSize = 0; /* unlimited */
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
     conf->maxEventsPerNode = 0; /* unlimited */
+    conf->maxWhereClauseElements = 64;
 #endif
 
     /* Limits for MonitoredItems */
@@ -122,8 +122,8 @@ cleanupEntry(NodeEntry *entry) {
 /***********************/
 
 /* Not yet inserted into the NodeMap */
-UA_Node *
-UA_Nodestore_newNode(void *nsCtx, UA_NodeClass nodeClass) {
+static UA_Node *
+zipNsNewNode(void *nsCtx, UA_NodeClass nodeClass) {
     NodeEntry *entry = newEntry(nodeClass);
     if(!entry)
         return NULL;
@@ -131,13 +131,13 @@ UA_Nodestore_newNode(void *nsCtx, UA_NodeClass nodeClass) {
 }
 
 /* Not yet inserted into the NodeMap */
-void
-UA_Nodestore_deleteNode(void *nsCtx, UA_Node *node) {
+static void
+zipNsDeleteNode(void *nsCtx, UA_Node *node) {
     deleteEntry(container_of(node, NodeEntry, nodeId));
 }
 
-const UA_Node *
-UA_Nodestore_getNode(void *nsCtx, const UA_NodeId *nodeId) {
+static const UA_Node *
+zipNsGetNode(void *nsCtx, const UA_NodeId *nodeId) {
     NodeMap *ns = (NodeMap*)nsCtx;
     BEGIN_CRITSECT(ns);
     NodeEntry dummy;
@@ -153,8 +153,8 @@ UA_Nodestore_getNode(void *nsCtx, const UA_NodeId *nodeId) {
     return (const UA_Node*)&entry->nodeId;
 }
 
-void
-UA_Nodestore_releaseNode(void *nsCtx, const UA_Node *node) {
+static void
+zipNsReleaseNode(void *nsCtx, const UA_Node *node) {
     if(!node)
         return;
 #if UA_MULTITHREADING >= 100
@@ -168,25 +168,24 @@ UA_Nodestore_releaseNode(void *nsCtx, const UA_Node *node) {
     END_CRITSECT(ns);
 }
 
-UA_StatusCode
-UA_Nodestore_getNodeCopy(void *nsCtx, const UA_NodeId *nodeId,
-                         UA_Node **outNode) {
+static UA_StatusCode
+zipNsGetNodeCopy(void *nsCtx, const UA_NodeId *nodeId, UA_Node **outNode) {
     /* Find the node */
-    const UA_Node *node = UA_Nodestore_getNode(nsCtx, nodeId);
+    const UA_Node *node = zipNsGetNode(nsCtx, nodeId);
     if(!node)
         return UA_STATUSCODE_BADNODEIDUNKNOWN;
 
     /* Create the new entry */
     NodeEntry *ne = newEntry(node->nodeClass);
     if(!ne) {
-        UA_Nodestore_releaseNode(nsCtx, node);
+        zipNsReleaseNode(nsCtx, node);
         return UA_STATUSCODE_BADOUTOFMEMORY;
     }
 
     /* Copy the node content */
     UA_Node *nnode = (UA_Node*)&ne->nodeId;
     UA_StatusCode retval = UA_Node_copy(node, nnode);
-    UA_Nodestore_releaseNode(nsCtx, node);
+    zipNsReleaseNode(nsCtx, node);
     if(retval != UA_STATUSCODE_GOOD) {
         deleteEntry(ne);
         return retval;
@@ -197,8 +196,8 @@ UA_Nodestore_getNodeCopy(void *nsCtx, const UA_NodeId *nodeId,
     return UA_STATUSCODE_GOOD;
 }
 
-UA_StatusCode
-UA_Nodestore_insertNode(void *nsCtx, UA_Node *node, UA_NodeId *addedNodeId) {
+static UA_StatusCode
+zipNsInsertNode(void *nsCtx, UA_Node *node, UA_NodeId *addedNodeId) {
     NodeEntry *entry = container_of(node, NodeEntry, nodeId);
     NodeMap *ns = (NodeMap*)nsCtx;
     BEGIN_CRITSECT(ns);
@@ -239,10 +238,10 @@ UA_Nodestore_insertNode(void *nsCtx, UA_Node *node, UA_NodeId *addedNodeId) {
     return UA_STATUSCODE_GOOD;
 }
 
-UA_StatusCode
-UA_Nodestore_replaceNode(void *nsCtx, UA_Node *node) {
+static UA_StatusCode
+zipNsReplaceNode(void *nsCtx, UA_Node *node) {
     /* Find the node */
-    const UA_Node *oldNode = UA_Nodestore_getNode(nsCtx, &node->nodeId);
+    const UA_Node *oldNode = zipNsGetNode(nsCtx, &node->nodeId);
     if(!oldNode) {
         deleteEntry(container_of(node, NodeEntry, nodeId));
         return UA_STATUSCODE_BADNODEIDUNKNOWN;
@@ -254,7 +253,7 @@ UA_Nodestore_replaceNode(void *nsCtx, UA_Node *node) {
     if(oldEntry != entry->orig) {
         /* The node was already updated since the copy was made */
         deleteEntry(entry);
-        UA_Nodestore_releaseNode(nsCtx, oldNode);
+        zipNsReleaseNode(nsCtx, oldNode);
         return UA_STATUSCODE_BADINTERNALERROR;
     }
 
@@ -267,12 +266,12 @@ UA_Nodestore_replaceNode(void *nsCtx, UA_Node *node) {
     oldEntry->deleted = true;
     END_CRITSECT(ns);
 
-    UA_Nodestore_releaseNode(nsCtx, oldNode);
+    zipNsReleaseNode(nsCtx, oldNode);
     return UA_STATUSCODE_GOOD;
 }
 
-UA_StatusCode
-UA_Nodestore_removeNode(void *nsCtx, const UA_NodeId *nodeId) {
+static UA_StatusCode
+zipNsRemoveNode(void *nsCtx, const UA_NodeId *nodeId) {
     NodeMap *ns = (NodeMap*)nsCtx;
     BEGIN_CRITSECT(ns);
     NodeEntry dummy;
@@ -301,9 +300,8 @@ nodeVisitor(NodeEntry *entry, void *data) {
     d->visitor(d->visitorContext, (UA_Node*)&entry->nodeId);
 }
 
-void
-UA_Nodestore_iterate(void *nsCtx, UA_NodestoreVisitor visitor,
-                     void *visitorCtx) {
+static void
+zipNsIterate(void *nsCtx, UA_NodestoreVisitor visitor, void *visitorCtx) {
     struct VisitorData d;
     d.visitor = visitor;
     d.visitorContext = visitorCtx;
@@ -324,8 +322,8 @@ deleteNodeVisitor(NodeEntry *entry, void *data) {
 
 const UA_Boolean inPlaceEditAllowed = true;
 
-UA_StatusCode
-UA_Nodestore_new(void **nsCtx) {
+static UA_StatusCode
+zipNsNew(void **nsCtx) {
     /* Allocate and initialize the nodemap */
     NodeMap *nodemap = (NodeMap*)UA_malloc(sizeof(NodeMap));
     if(!nodemap)
@@ -341,8 +339,8 @@ UA_Nodestore_new(void **nsCtx) {
     return UA_STATUSCODE_GOOD;
 }
 
-void
-UA_Nodestore_delete(void *nsCtx) {
+static void
+zipNsDelete(void *nsCtx) {
     if (!nsCtx)
         return;
 
@@ -354,4 +352,85 @@ UA_Nodestore_delete(void *nsCtx) {
     UA_free(ns);
 }
 
+#ifdef UA_ENABLE_NODESTORE_SWITCH
+
+/* Registered as the default backend of the nodestore switch */
+UA_StatusCode
+UA_Nodestore_ZipTree(UA_NodestoreInterface *ns) {
+    ns->clear = zipNsDelete;
+    ns->newNode = zipNsNewNode;
+    ns->deleteNode = zipNsDeleteNode;
+    ns->getNode = zipNsGetNode;
+    ns->releaseNode = zipNsReleaseNode;
+    ns->getNodeCopy = zipNsGetNodeCopy;
+    ns->insertNode = zipNsInsertNode;
+    ns->replaceNode = zipNsReplaceNode;
+    ns->removeNode = zipNsRemoveNode;
+    ns->iterate = zipNsIterate;
+    return zipNsNew(&ns->context);
+}
+
+#else
+
+/* Export as the nodestore of the server */
+
+UA_StatusCode
+UA_Nodestore_new(void **nsCtx) {
+    return zipNsNew(nsCtx);
+}
+
+void
+UA_Nodestore_delete(void *nsCtx) {
+    zipNsDelete(nsCtx);
+}
+
+UA_Node *
+UA_Nodestore_newNode(void *nsCtx, UA_NodeClass nodeClass) {
+    return zipNsNewNode(nsCtx, nodeClass);
+}
+
+void
+UA_Nodestore_deleteNode(void *nsCtx, UA_Node *node) {
+    zipNsDeleteNode(nsCtx, node);
+}
+
+const UA_Node *
+UA_Nodestore_getNode(void *nsCtx, const UA_NodeId *nodeId) {
+    return zipNsGetNode(nsCtx, nodeId);
+}
+
+void
+UA_Nodestore_releaseNode(void *nsCtx, const UA_Node *node) {
+    zipNsReleaseNode(nsCtx, node);
+}
+
+UA_StatusCode
+UA_Nodestore_getNodeCopy(void *nsCtx, const UA_NodeId *nodeId,
+                         UA_Node **outNode) {
+    return zipNsGetNodeCopy(nsCtx, nodeId, outNode);
+}
+
+UA_StatusCode
+UA_Nodestore_insertNode(void *nsCtx, UA_Node *node, UA_NodeId *addedNodeId) {
+    return zipNsInsertNode(nsCtx, node, addedNodeId);
+}
+
+UA_StatusCode
+UA_Nodestore_replaceNode(void *nsCtx, UA_Node *node) {
+    return zipNsReplaceNode(nsCtx, node);
+}
+
+UA_StatusCode
+UA_Nodestore_removeNode(void *nsCtx, const UA_NodeId *nodeId) {
+    return zipNsRemoveNode(nsCtx, nodeId);
+}
+
+void
+UA_Nodestore_iterate(void *nsCtx, UA_NodestoreVisitor visitor,
+                     void *visitorCtx) {
+    zipNsIterate(nsCtx, visitor, visitorCtx);
+}
+
+#endif /* UA_ENABLE_NODESTORE_SWITCH */
+
 #endif /* UA_ENABLE_CUSTOM_NODESTORE */
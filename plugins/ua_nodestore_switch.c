@@ -0,0 +1,314 @@
+/* This work is licensed under a Creative Commons CCZero 1.0 Universal License.
+ * See http://creativecommons.org/publicdomain/zero/1.0/ for more information.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include <open62541/plugin/nodestore.h>
+#include "ziptree.h"
+
+#ifdef UA_ENABLE_NODESTORE_SWITCH
+
+/* Editable copies made by the non-default backends. The NodeId of a copy can
+ * change before it is inserted or deleted (e.g. for the children of a new
+ * instance). So the backend that allocated the copy is recorded. Untracked
+ * nodes belong to the default backend. */
+struct NodeOrigin;
+typedef struct NodeOrigin NodeOrigin;
+
+struct NodeOrigin {
+    ZIP_ENTRY(NodeOrigin) zipfields;
+    uintptr_t node;
+    UA_NodestoreInterface store; /* Copy, the registration might change */
+};
+
+ZIP_HEAD(NodeOriginTree, NodeOrigin);
+typedef struct NodeOriginTree NodeOriginTree;
+
+static enum ZIP_CMP
+cmpNodeOrigin(const void *a, const void *b) {
+    uintptr_t aa = *(const uintptr_t*)a;
+    uintptr_t bb = *(const uintptr_t*)b;
+    if(aa < bb)
+        return ZIP_CMP_LESS;
+    if(aa > bb)
+        return ZIP_CMP_MORE;
+    return ZIP_CMP_EQ;
+}
+
+ZIP_PROTTYPE(NodeOriginTree, NodeOrigin, uintptr_t)
+ZIP_IMPL(NodeOriginTree, NodeOrigin, zipfields, uintptr_t, node, cmpNodeOrigin)
+
+typedef struct {
+    UA_NodestoreInterface defaultStore;
+    size_t storesSize;
+    UA_NodestoreInterface **stores; /* Indexed by the namespace. NULL for the
+                                     * default backend. */
+    NodeOriginTree origins;
+} NodestoreSwitch;
+
+static UA_NodestoreInterface *
+getStore(NodestoreSwitch *sw, UA_UInt16 namespaceIndex) {
+    if(namespaceIndex < sw->storesSize && sw->stores[namespaceIndex])
+        return sw->stores[namespaceIndex];
+    return &sw->defaultStore;
+}
+
+static size_t
+nodeSize(UA_NodeClass nodeClass) {
+    switch(nodeClass) {
+    case UA_NODECLASS_OBJECT: return sizeof(UA_ObjectNode);
+    case UA_NODECLASS_VARIABLE: return sizeof(UA_VariableNode);
+    case UA_NODECLASS_METHOD: return sizeof(UA_MethodNode);
+    case UA_NODECLASS_OBJECTTYPE: return sizeof(UA_ObjectTypeNode);
+    case UA_NODECLASS_VARIABLETYPE: return sizeof(UA_VariableTypeNode);
+    case UA_NODECLASS_REFERENCETYPE: return sizeof(UA_ReferenceTypeNode);
+    case UA_NODECLASS_DATATYPE: return sizeof(UA_DataTypeNode);
+    case UA_NODECLASS_VIEW: return sizeof(UA_ViewNode);
+    default: return 0;
+    }
+}
+
+static UA_StatusCode
+trackOrigin(NodestoreSwitch *sw, const UA_Node *node,
+            const UA_NodestoreInterface *store) {
+    NodeOrigin *origin = (NodeOrigin*)UA_malloc(sizeof(NodeOrigin));
+    if(!origin)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    origin->node = (uintptr_t)node;
+    origin->store = *store;
+    ZIP_INSERT(NodeOriginTree, &sw->origins, origin, ZIP_FFS32(UA_UInt32_random()));
+    return UA_STATUSCODE_GOOD;
+}
+
+/* Returns the backend that allocated the node and stops tracking it */
+static UA_NodestoreInterface
+takeOrigin(NodestoreSwitch *sw, const UA_Node *node) {
+    uintptr_t key = (uintptr_t)node;
+    NodeOrigin *origin = ZIP_FIND(NodeOriginTree, &sw->origins, &key);
+    if(!origin)
+        return sw->defaultStore;
+    UA_NodestoreInterface store = origin->store;
+    ZIP_REMOVE(NodeOriginTree, &sw->origins, origin);
+    UA_free(origin);
+    return store;
+}
+
+static void
+freeOriginVisitor(NodeOrigin *origin, void *data) {
+    UA_free(origin);
+}
+
+/* Move the node content to memory of the target backend. The members are not
+ * copied. The emptied node is deleted in the source backend. */
+static UA_Node *
+moveNode(const UA_NodestoreInterface *source,
+         const UA_NodestoreInterface *target, UA_Node *node) {
+    size_t size = nodeSize(node->nodeClass);
+    UA_Node *moved = target->newNode(target->context, node->nodeClass);
+    if(!moved || size == 0) {
+        if(moved)
+            target->deleteNode(target->context, moved);
+        source->deleteNode(source->context, node);
+        return NULL;
+    }
+    memcpy(moved, node, size);
+    UA_NodeClass nodeClass = node->nodeClass;
+    memset(node, 0, size);
+    node->nodeClass = nodeClass;
+    source->deleteNode(source->context, node);
+    return moved;
+}
+
+/***********************/
+/* Interface functions */
+/***********************/
+
+/* New nodes are allocated in the default backend until they are inserted */
+UA_Node *
+UA_Nodestore_newNode(void *nsCtx, UA_NodeClass nodeClass) {
+    NodestoreSwitch *sw = (NodestoreSwitch*)nsCtx;
+    return sw->defaultStore.newNode(sw->defaultStore.context, nodeClass);
+}
+
+void
+UA_Nodestore_deleteNode(void *nsCtx, UA_Node *node) {
+    UA_NodestoreInterface origin = takeOrigin((NodestoreSwitch*)nsCtx, node);
+    origin.deleteNode(origin.context, node);
+}
+
+const UA_Node *
+UA_Nodestore_getNode(void *nsCtx, const UA_NodeId *nodeId) {
+    UA_NodestoreInterface *store =
+        getStore((NodestoreSwitch*)nsCtx, nodeId->namespaceIndex);
+    return store->getNode(store->context, nodeId);
+}
+
+void
+UA_Nodestore_releaseNode(void *nsCtx, const UA_Node *node) {
+    if(!node)
+        return;
+    UA_NodestoreInterface *store =
+        getStore((NodestoreSwitch*)nsCtx, node->nodeId.namespaceIndex);
+    store->releaseNode(store->context, node);
+}
+
+UA_StatusCode
+UA_Nodestore_getNodeCopy(void *nsCtx, const UA_NodeId *nodeId,
+                         UA_Node **outNode) {
+    NodestoreSwitch *sw = (NodestoreSwitch*)nsCtx;
+    UA_NodestoreInterface *store = getStore(sw, nodeId->namespaceIndex);
+    UA_StatusCode retval = store->getNodeCopy(store->context, nodeId, outNode);
+    if(retval != UA_STATUSCODE_GOOD || store == &sw->defaultStore)
+        return retval;
+    retval = trackOrigin(sw, *outNode, store);
+    if(retval != UA_STATUSCODE_GOOD) {
+        store->deleteNode(store->context, *outNode);
+        *outNode = NULL;
+    }
+    return retval;
+}
+
+UA_StatusCode
+UA_Nodestore_insertNode(void *nsCtx, UA_Node *node, UA_NodeId *addedNodeId) {
+    NodestoreSwitch *sw = (NodestoreSwitch*)nsCtx;
+    UA_NodestoreInterface origin = takeOrigin(sw, node);
+    UA_NodestoreInterface *store = getStore(sw, node->nodeId.namespaceIndex);
+    if(store->context != origin.context) {
+        node = moveNode(&origin, store, node);
+        if(!node)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    return store->insertNode(store->context, node, addedNodeId);
+}
+
+/* The copy is replaced in the backend it was made from */
+UA_StatusCode
+UA_Nodestore_replaceNode(void *nsCtx, UA_Node *node) {
+    UA_NodestoreInterface origin = takeOrigin((NodestoreSwitch*)nsCtx, node);
+    return origin.replaceNode(origin.context, node);
+}
+
+UA_StatusCode
+UA_Nodestore_removeNode(void *nsCtx, const UA_NodeId *nodeId) {
+    UA_NodestoreInterface *store =
+        getStore((NodestoreSwitch*)nsCtx, nodeId->namespaceIndex);
+    return store->removeNode(store->context, nodeId);
+}
+
+/* Was the backend already seen in a lower namespace index? */
+static UA_Boolean
+isDuplicateStore(const NodestoreSwitch *sw, size_t index) {
+    for(size_t i = 0; i < index; i++) {
+        if(sw->stores[i] && sw->stores[i]->context == sw->stores[index]->context)
+            return true;
+    }
+    return (sw->stores[index]->context == sw->defaultStore.context);
+}
+
+/* Visits every backend once */
+void
+UA_Nodestore_iterate(void *nsCtx, UA_NodestoreVisitor visitor,
+                     void *visitorCtx) {
+    NodestoreSwitch *sw = (NodestoreSwitch*)nsCtx;
+    sw->defaultStore.iterate(sw->defaultStore.context, visitor, visitorCtx);
+    for(size_t i = 0; i < sw->storesSize; i++) {
+        if(!sw->stores[i] || isDuplicateStore(sw, i))
+            continue;
+        sw->stores[i]->iterate(sw->stores[i]->context, visitor, visitorCtx);
+    }
+}
+
+/*********************/
+/* Backend Selection */
+/*********************/
+
+/* Clear the backend of the namespace unless it is used elsewhere */
+static void
+releaseStore(NodestoreSwitch *sw, UA_UInt16 namespaceIndex) {
+    UA_NodestoreInterface *store = sw->stores[namespaceIndex];
+    if(!store)
+        return;
+    sw->stores[namespaceIndex] = NULL;
+    UA_Boolean used = (store->context == sw->defaultStore.context);
+    for(size_t i = 0; i < sw->storesSize && !used; i++)
+        used = (sw->stores[i] && sw->stores[i]->context == store->context);
+    if(!used)
+        store->clear(store->context);
+    UA_free(store);
+}
+
+UA_StatusCode
+UA_NodestoreSwitch_setNamespace(void *nsCtx, UA_UInt16 namespaceIndex,
+                                const UA_NodestoreInterface *backend) {
+    NodestoreSwitch *sw = (NodestoreSwitch*)nsCtx;
+    if(backend && (!backend->clear || !backend->newNode || !backend->deleteNode ||
+                   !backend->getNode || !backend->releaseNode ||
+                   !backend->getNodeCopy || !backend->insertNode ||
+                   !backend->replaceNode || !backend->removeNode ||
+                   !backend->iterate))
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+
+    /* Reset to the default backend */
+    if(!backend) {
+        if(namespaceIndex < sw->storesSize)
+            releaseStore(sw, namespaceIndex);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /* Make room for the namespace */
+    if(namespaceIndex >= sw->storesSize) {
+        UA_NodestoreInterface **stores = (UA_NodestoreInterface**)
+            UA_realloc(sw->stores, sizeof(UA_NodestoreInterface*) *
+                       ((size_t)namespaceIndex + 1));
+        if(!stores)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        for(size_t i = sw->storesSize; i <= namespaceIndex; i++)
+            stores[i] = NULL;
+        sw->stores = stores;
+        sw->storesSize = (size_t)namespaceIndex + 1;
+    }
+
+    UA_NodestoreInterface *store = (UA_NodestoreInterface*)
+        UA_malloc(sizeof(UA_NodestoreInterface));
+    if(!store)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    *store = *backend;
+    releaseStore(sw, namespaceIndex);
+    sw->stores[namespaceIndex] = store;
+    return UA_STATUSCODE_GOOD;
+}
+
+/***********************/
+/* Nodestore Lifecycle */
+/***********************/
+
+UA_StatusCode
+UA_Nodestore_new(void **nsCtx) {
+    NodestoreSwitch *sw = (NodestoreSwitch*)UA_calloc(1, sizeof(NodestoreSwitch));
+    if(!sw)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    UA_StatusCode retval = UA_Nodestore_ZipTree(&sw->defaultStore);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_free(sw);
+        return retval;
+    }
+    ZIP_INIT(&sw->origins);
+    *nsCtx = (void*)sw;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_Nodestore_delete(void *nsCtx) {
+    if(!nsCtx)
+        return;
+    NodestoreSwitch *sw = (NodestoreSwitch*)nsCtx;
+    ZIP_ITER(NodeOriginTree, &sw->origins, freeOriginVisitor, NULL);
+    for(size_t i = 0; i < sw->storesSize; i++)
+        releaseStore(sw, (UA_UInt16)i);
+    UA_free(sw->stores);
+    sw->defaultStore.clear(sw->defaultStore.context);
+    UA_free(sw);
+}
+
+#endif /* UA_ENABLE_NODESTORE_SWITCH */
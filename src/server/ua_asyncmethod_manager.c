@@ -36,7 +36,7 @@ asyncmethod_list_entry*
 UA_AsyncMethodManager_getById(UA_AsyncMethodManager *amm, const UA_UInt32 requestId, const UA_NodeId *sessionId) {
     asyncmethod_list_entry *current = NULL;
     LIST_FOREACH(current, &amm->asyncmethods, pointers) {
-        if ((current->requestId == requestId) && UA_NodeId_equal(current->sessionId, sessionId))
+        if ((current->requestId == requestId) && UA_NodeId_equal(&current->sessionId, sessionId))
             return current;
     }
     return NULL;
@@ -55,20 +55,21 @@ UA_AsyncMethodManager_createEntry(UA_AsyncMethodManager *amm, const UA_NodeId *s
 
     UA_LOG_DEBUG(&amm->server->config.logger, UA_LOGCATEGORY_SERVER,
         "UA_AsyncMethodManager_createEntry: Chan: %u. Req# %u", channelId, requestId);
-    UA_atomic_addUInt32(&amm->currentCount, 1);
     newentry->requestId = requestId;
-    newentry->sessionId = sessionId;
     newentry->requestHandle = requestHandle;
     newentry->responseType = responseType;
     newentry->nCountdown = nCountdown;
+    newentry->serviceDone = true;
     newentry->m_tDispatchTime = UA_DateTime_now();
-    UA_CallResponse_init(&newentry->response);
-    newentry->response.results = (UA_CallMethodResult*)UA_calloc(nCountdown, sizeof(UA_CallMethodResult));
-    newentry->response.resultsSize = nCountdown;
-    if (newentry->response.results == NULL)
+    UA_CallResponse_init(&newentry->response.callResponse);
+    newentry->response.callResponse.results = (UA_CallMethodResult*)UA_calloc(nCountdown, sizeof(UA_CallMethodResult));
+    newentry->response.callResponse.resultsSize = nCountdown;
+    if (newentry->response.callResponse.results == NULL ||
+        UA_NodeId_copy(sessionId, &newentry->sessionId) != UA_STATUSCODE_GOOD)
     {
         UA_LOG_ERROR(&amm->server->config.logger, UA_LOGCATEGORY_SERVER,
             "UA_AsyncMethodManager_createEntry: Mem alloc failed.");
+        UA_free(newentry->response.callResponse.results);
         UA_free(newentry);
         return UA_STATUSCODE_BADOUTOFMEMORY;
     }
@@ -76,19 +77,51 @@ UA_AsyncMethodManager_createEntry(UA_AsyncMethodManager *amm, const UA_NodeId *s
     /* Set the StatusCode to timeout by default. Will be overwritten when the
      * result is set. */
     for(size_t i = 0; i < nCountdown; i++)
-        newentry->response.results[i].statusCode = UA_STATUSCODE_BADTIMEOUT;
+        newentry->response.callResponse.results[i].statusCode = UA_STATUSCODE_BADTIMEOUT;
 
+    UA_atomic_addUInt32(&amm->currentCount, 1);
     LIST_INSERT_HEAD(&amm->asyncmethods, newentry, pointers);
     return UA_STATUSCODE_GOOD;
 }
 
+asyncmethod_list_entry *
+UA_AsyncMethodManager_createOperationEntry(UA_AsyncMethodManager *amm, const UA_NodeId *sessionId,
+    const UA_UInt32 requestId, const UA_UInt32 requestHandle, const UA_DataType *responseType,
+    void *results) {
+    asyncmethod_list_entry *newentry = (asyncmethod_list_entry*)UA_calloc(1, sizeof(asyncmethod_list_entry));
+    if(!newentry || UA_NodeId_copy(sessionId, &newentry->sessionId) != UA_STATUSCODE_GOOD) {
+        UA_LOG_ERROR(&amm->server->config.logger, UA_LOGCATEGORY_SERVER,
+            "UA_AsyncMethodManager_createOperationEntry: Mem alloc failed.");
+        UA_free(newentry);
+        return NULL;
+    }
+
+    UA_LOG_DEBUG(&amm->server->config.logger, UA_LOGCATEGORY_SERVER,
+        "UA_AsyncMethodManager_createOperationEntry: Req# %u", requestId);
+    newentry->requestId = requestId;
+    newentry->requestHandle = requestHandle;
+    newentry->responseType = responseType;
+    newentry->results = results;
+    newentry->m_tDispatchTime = UA_DateTime_now();
+    UA_init(&newentry->response, responseType);
+    UA_atomic_addUInt32(&amm->currentCount, 1);
+    LIST_INSERT_HEAD(&amm->asyncmethods, newentry, pointers);
+    return newentry;
+}
+
 /* remove entry and free all allocated data */
 UA_StatusCode
 UA_AsyncMethodManager_removeEntry(UA_AsyncMethodManager *amm, asyncmethod_list_entry *current) {
     if (current) {
         LIST_REMOVE(current, pointers);
         UA_atomic_subUInt32(&amm->currentCount, 1);
-        UA_CallResponse_deleteMembers(&current->response);
+        if(current->responseType == &UA_TYPES[UA_TYPES_READRESPONSE])
+            UA_ReadResponse_clear(&current->response.readResponse);
+        else if(current->responseType == &UA_TYPES[UA_TYPES_WRITERESPONSE])
+            UA_WriteResponse_clear(&current->response.writeResponse);
+        else
+            UA_CallResponse_deleteMembers(&current->response.callResponse);
+        UA_NodeId_clear(&current->sessionId);
         UA_free(current);
     }
     UA_LOG_DEBUG(&amm->server->config.logger, UA_LOGCATEGORY_SERVER,
@@ -107,7 +140,8 @@ UA_AsyncMethodManager_checkTimeouts(UA_Server *server, UA_AsyncMethodManager *am
         UA_DateTime diff = tNow - tReq;
 
         /* The calls are all done or the timeout has not passed */
-        if (current->nCountdown == 0 || server->config.asyncCallRequestTimeout <= 0.0 ||
+        if (current->nCountdown == 0 || !current->serviceDone ||
+            server->config.asyncCallRequestTimeout <= 0.0 ||
             diff <= server->config.asyncCallRequestTimeout * (UA_DateTime)UA_DATETIME_MSEC)
             continue;
 
@@ -118,7 +152,7 @@ UA_AsyncMethodManager_checkTimeouts(UA_Server *server, UA_AsyncMethodManager *am
 
         /* Get the session */
         UA_LOCK(server->serviceMutex);
-        UA_Session* session = UA_SessionManager_getSessionById(&amm->server->sessionManager, current->sessionId);
+        UA_Session* session = UA_SessionManager_getSessionById(&amm->server->sessionManager, &current->sessionId);
         UA_UNLOCK(server->serviceMutex);
         if(!session) {
             UA_LOG_WARNING(&amm->server->config.logger, UA_LOGCATEGORY_SERVER,
@@ -135,7 +169,7 @@ UA_AsyncMethodManager_checkTimeouts(UA_Server *server, UA_AsyncMethodManager *am
 
         /* Okay, here we go, send the UA_CallResponse */
         sendResponse(session->header.channel, current->requestId, current->requestHandle,
-                     (UA_ResponseHeader*)&current->response.responseHeader, current->responseType);
+                     (UA_ResponseHeader*)&current->response, current->responseType);
         UA_LOG_DEBUG(&server->config.logger, UA_LOGCATEGORY_SERVER,
                      "UA_Server_SendResponse: Response for Req# %u sent", current->requestId);
     remove:
@@ -28,12 +28,20 @@ _UA_BEGIN_DECLS
 typedef struct asyncmethod_list_entry {
     LIST_ENTRY(asyncmethod_list_entry) pointers;
     UA_UInt32 requestId;
-    const UA_NodeId *sessionId;
+    UA_NodeId sessionId;
     UA_UInt32 requestHandle;
     const UA_DataType *responseType;
     UA_DateTime	m_tDispatchTime;	/* Creation time */
     UA_UInt32 nCountdown;			/* Counter for open UA_CallResults */
-    UA_CallResponse response;		/* The 'collected' CallResponse for our CallMethodResponse(s) */
+    UA_Boolean serviceDone;         /* The Read/Write service has returned and
+                                     * the response is set */
+    void *results;                  /* Results array of the Read/Write response */
+    UA_TimestampsToReturn timestampsToReturn; /* Of the Read request */
+    union {
+        UA_CallResponse callResponse; /* The 'collected' CallResponse for our CallMethodResponse(s) */
+        UA_ReadResponse readResponse;
+        UA_WriteResponse writeResponse;
+    } response;
 } asyncmethod_list_entry;
 
 typedef struct UA_AsyncMethodManager {
@@ -52,6 +60,13 @@ UA_StatusCode
 UA_AsyncMethodManager_createEntry(UA_AsyncMethodManager *amm, const UA_NodeId *sessionId, const UA_UInt32 channelId,
     const UA_UInt32 requestId, const UA_UInt32 requestHandle, const UA_DataType *responseType, const UA_UInt32 nCountdown);
 
+/* Creates the entry for a Read or Write request with queued operations. The
+ * response is set when the service returns. */
+asyncmethod_list_entry *
+UA_AsyncMethodManager_createOperationEntry(UA_AsyncMethodManager *amm, const UA_NodeId *sessionId,
+    const UA_UInt32 requestId, const UA_UInt32 requestHandle, const UA_DataType *responseType,
+    void *results);
+
 UA_StatusCode
 UA_AsyncMethodManager_removeEntry(UA_AsyncMethodManager *amm, asyncmethod_list_entry *current);
 
@@ -0,0 +1,353 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_browsepathcache.h"
+#include "ua_util_internal.h"
+
+typedef struct {
+    UA_UInt32 hash;
+    UA_UInt32 nodeClassMask;
+    UA_NodeId startingNode;
+    UA_RelativePath path;
+} UA_BrowsePathCacheKey;
+
+typedef struct {
+    UA_UInt32 hash;
+    UA_NodeId nodeId;
+} UA_BrowsePathCacheDepKey;
+
+/* Connects an entry with one of the nodes it depends on */
+typedef struct UA_BrowsePathCacheLink {
+    LIST_ENTRY(UA_BrowsePathCacheLink) depEntry;
+    UA_BrowsePathCacheDep *dep;
+    UA_BrowsePathCacheEntry *entry;
+    UA_Boolean references;
+} UA_BrowsePathCacheLink;
+
+struct UA_BrowsePathCacheEntry {
+    ZIP_ENTRY(UA_BrowsePathCacheEntry) zipfields;
+    TAILQ_ENTRY(UA_BrowsePathCacheEntry) listEntry;
+    UA_BrowsePathCacheKey key;
+    UA_BrowsePathResult result;
+    size_t linksSize;
+    UA_BrowsePathCacheLink *links;
+};
+
+/* Exists as long as an entry depends on the node */
+struct UA_BrowsePathCacheDep {
+    ZIP_ENTRY(UA_BrowsePathCacheDep) zipfields;
+    UA_BrowsePathCacheDepKey key;
+    LIST_HEAD(, UA_BrowsePathCacheLink) links;
+};
+
+/* The includeSubtypes flag has no effect without a ReferenceType */
+static UA_Boolean
+includeSubtypes(const UA_RelativePathElement *elem) {
+    return elem->includeSubtypes && !UA_NodeId_isNull(&elem->referenceTypeId);
+}
+
+static UA_UInt32
+browsePathHash(const UA_NodeId *startingNode, UA_UInt32 nodeClassMask,
+               const UA_RelativePath *path) {
+    UA_UInt32 h = UA_NodeId_hash(startingNode);
+    h = UA_ByteString_hash(h, (const UA_Byte*)&nodeClassMask, sizeof(UA_UInt32));
+    for(size_t i = 0; i < path->elementsSize; i++) {
+        const UA_RelativePathElement *elem = &path->elements[i];
+        UA_UInt32 refHash = UA_NodeId_hash(&elem->referenceTypeId);
+        UA_Byte flags = (UA_Byte)(elem->isInverse | (includeSubtypes(elem) << 1));
+        h = UA_ByteString_hash(h, (const UA_Byte*)&refHash, sizeof(UA_UInt32));
+        h = UA_ByteString_hash(h, &flags, 1);
+        h = UA_ByteString_hash(h, (const UA_Byte*)&elem->targetName.namespaceIndex,
+                               sizeof(UA_UInt16));
+        h = UA_ByteString_hash(h, elem->targetName.name.data,
+                               elem->targetName.name.length);
+    }
+    return h;
+}
+
+static enum ZIP_CMP
+cmpString(const UA_String *a, const UA_String *b) {
+    if(a->length != b->length)
+        return (a->length < b->length) ? ZIP_CMP_LESS : ZIP_CMP_MORE;
+    if(a->length == 0)
+        return ZIP_CMP_EQ;
+    int cmp = memcmp(a->data, b->data, a->length);
+    if(cmp == 0)
+        return ZIP_CMP_EQ;
+    return (cmp < 0) ? ZIP_CMP_LESS : ZIP_CMP_MORE;
+}
+
+static enum ZIP_CMP
+cmpPathElement(const UA_RelativePathElement *a, const UA_RelativePathElement *b) {
+    enum ZIP_CMP o = (enum ZIP_CMP)UA_NodeId_order(&a->referenceTypeId,
+                                                   &b->referenceTypeId);
+    if(o != ZIP_CMP_EQ)
+        return o;
+    if(a->isInverse != b->isInverse)
+        return a->isInverse ? ZIP_CMP_MORE : ZIP_CMP_LESS;
+    UA_Boolean aSub = includeSubtypes(a);
+    if(aSub != includeSubtypes(b))
+        return aSub ? ZIP_CMP_MORE : ZIP_CMP_LESS;
+    if(a->targetName.namespaceIndex != b->targetName.namespaceIndex)
+        return (a->targetName.namespaceIndex < b->targetName.namespaceIndex) ?
+            ZIP_CMP_LESS : ZIP_CMP_MORE;
+    return cmpString(&a->targetName.name, &b->targetName.name);
+}
+
+static enum ZIP_CMP
+cmpBrowsePathCacheKey(const void *a, const void *b) {
+    const UA_BrowsePathCacheKey *aa = (const UA_BrowsePathCacheKey*)a;
+    const UA_BrowsePathCacheKey *bb = (const UA_BrowsePathCacheKey*)b;
+    if(aa->hash != bb->hash)
+        return (aa->hash < bb->hash) ? ZIP_CMP_LESS : ZIP_CMP_MORE;
+    if(aa->nodeClassMask != bb->nodeClassMask)
+        return (aa->nodeClassMask < bb->nodeClassMask) ? ZIP_CMP_LESS : ZIP_CMP_MORE;
+    if(aa->path.elementsSize != bb->path.elementsSize)
+        return (aa->path.elementsSize < bb->path.elementsSize) ?
+            ZIP_CMP_LESS : ZIP_CMP_MORE;
+    enum ZIP_CMP o = (enum ZIP_CMP)UA_NodeId_order(&aa->startingNode, &bb->startingNode);
+    for(size_t i = 0; o == ZIP_CMP_EQ && i < aa->path.elementsSize; i++)
+        o = cmpPathElement(&aa->path.elements[i], &bb->path.elements[i]);
+    return o;
+}
+
+static enum ZIP_CMP
+cmpBrowsePathCacheDepKey(const void *a, const void *b) {
+    const UA_BrowsePathCacheDepKey *aa = (const UA_BrowsePathCacheDepKey*)a;
+    const UA_BrowsePathCacheDepKey *bb = (const UA_BrowsePathCacheDepKey*)b;
+    if(aa->hash < bb->hash)
+        return ZIP_CMP_LESS;
+    if(aa->hash > bb->hash)
+        return ZIP_CMP_MORE;
+    return (enum ZIP_CMP)UA_NodeId_order(&aa->nodeId, &bb->nodeId);
+}
+
+ZIP_PROTTYPE(UA_BrowsePathCacheTree, UA_BrowsePathCacheEntry, UA_BrowsePathCacheKey)
+ZIP_IMPL(UA_BrowsePathCacheTree, UA_BrowsePathCacheEntry, zipfields,
+         UA_BrowsePathCacheKey, key, cmpBrowsePathCacheKey)
+
+ZIP_PROTTYPE(UA_BrowsePathCacheDepTree, UA_BrowsePathCacheDep, UA_BrowsePathCacheDepKey)
+ZIP_IMPL(UA_BrowsePathCacheDepTree, UA_BrowsePathCacheDep, zipfields,
+         UA_BrowsePathCacheDepKey, key, cmpBrowsePathCacheDepKey)
+
+static UA_BrowsePathCacheEntry *
+findEntry(UA_BrowsePathCache *cache, const UA_NodeId *startingNode,
+          UA_UInt32 nodeClassMask, const UA_RelativePath *path) {
+    UA_BrowsePathCacheKey key;
+    key.hash = browsePathHash(startingNode, nodeClassMask, path);
+    key.nodeClassMask = nodeClassMask;
+    key.startingNode = *startingNode;
+    key.path = *path;
+    return ZIP_FIND(UA_BrowsePathCacheTree, &cache->root, &key);
+}
+
+static UA_BrowsePathCacheDep *
+findDep(UA_BrowsePathCache *cache, const UA_NodeId *nodeId) {
+    UA_BrowsePathCacheDepKey key;
+    key.hash = UA_NodeId_hash(nodeId);
+    key.nodeId = *nodeId;
+    return ZIP_FIND(UA_BrowsePathCacheDepTree, &cache->deps, &key);
+}
+
+static UA_BrowsePathCacheDep *
+getDep(UA_BrowsePathCache *cache, const UA_NodeId *nodeId) {
+    UA_BrowsePathCacheDep *dep = findDep(cache, nodeId);
+    if(dep)
+        return dep;
+    dep = (UA_BrowsePathCacheDep*)UA_calloc(1, sizeof(UA_BrowsePathCacheDep));
+    if(!dep)
+        return NULL;
+    if(UA_NodeId_copy(nodeId, &dep->key.nodeId) != UA_STATUSCODE_GOOD) {
+        UA_free(dep);
+        return NULL;
+    }
+    dep->key.hash = UA_NodeId_hash(nodeId);
+    LIST_INIT(&dep->links);
+    ZIP_INSERT(UA_BrowsePathCacheDepTree, &cache->deps, dep, ZIP_FFS32(UA_UInt32_random()));
+    return dep;
+}
+
+static void
+unlinkDep(UA_BrowsePathCache *cache, UA_BrowsePathCacheLink *link) {
+    UA_BrowsePathCacheDep *dep = link->dep;
+    LIST_REMOVE(link, depEntry);
+    if(!LIST_EMPTY(&dep->links))
+        return;
+    ZIP_REMOVE(UA_BrowsePathCacheDepTree, &cache->deps, dep);
+    UA_NodeId_clear(&dep->key.nodeId);
+    UA_free(dep);
+}
+
+static void
+deleteEntry(UA_BrowsePathCache *cache, UA_BrowsePathCacheEntry *entry) {
+    for(size_t i = 0; i < entry->linksSize; i++)
+        unlinkDep(cache, &entry->links[i]);
+    UA_free(entry->links);
+    UA_NodeId_clear(&entry->key.startingNode);
+    UA_RelativePath_clear(&entry->key.path);
+    UA_BrowsePathResult_clear(&entry->result);
+    UA_free(entry);
+}
+
+static void
+removeEntry(UA_BrowsePathCache *cache, UA_BrowsePathCacheEntry *entry) {
+    ZIP_REMOVE(UA_BrowsePathCacheTree, &cache->root, entry);
+    TAILQ_REMOVE(&cache->entries, entry, listEntry);
+    cache->entriesSize--;
+    deleteEntry(cache, entry);
+}
+
+void
+UA_BrowsePathCache_init(UA_BrowsePathCache *cache) {
+    memset(cache, 0, sizeof(UA_BrowsePathCache));
+    ZIP_INIT(&cache->root);
+    ZIP_INIT(&cache->deps);
+    TAILQ_INIT(&cache->entries);
+}
+
+void
+UA_BrowsePathCache_clear(UA_BrowsePathCache *cache) {
+    UA_BrowsePathCacheEntry *entry, *entry_tmp;
+    TAILQ_FOREACH_SAFE(entry, &cache->entries, listEntry, entry_tmp)
+        removeEntry(cache, entry);
+}
+
+UA_StatusCode
+UA_BrowsePathCache_get(UA_BrowsePathCache *cache, const UA_NodeId *startingNode,
+                       UA_UInt32 nodeClassMask, const UA_RelativePath *path,
+                       UA_BrowsePathResult *result) {
+    UA_BrowsePathCacheEntry *entry = findEntry(cache, startingNode, nodeClassMask, path);
+    if(!entry) {
+        cache->misses++;
+        return UA_STATUSCODE_BADNOTFOUND;
+    }
+    cache->hits++;
+    TAILQ_REMOVE(&cache->entries, entry, listEntry);
+    TAILQ_INSERT_TAIL(&cache->entries, entry, listEntry);
+    return UA_BrowsePathResult_copy(&entry->result, result);
+}
+
+UA_StatusCode
+UA_BrowsePathCache_store(UA_BrowsePathCache *cache, size_t maxEntries,
+                         const UA_NodeId *startingNode, UA_UInt32 nodeClassMask,
+                         const UA_RelativePath *path,
+                         const UA_BrowsePathResult *result,
+                         const UA_BrowsePathDeps *deps) {
+    if(maxEntries == 0)
+        return UA_STATUSCODE_GOOD;
+    if(deps->status != UA_STATUSCODE_GOOD)
+        return deps->status;
+
+    /* Replace an existing entry */
+    UA_BrowsePathCacheEntry *entry = findEntry(cache, startingNode, nodeClassMask, path);
+    if(entry)
+        removeEntry(cache, entry);
+
+    /* Evict the least recently used entry */
+    if(cache->entriesSize >= maxEntries)
+        removeEntry(cache, TAILQ_FIRST(&cache->entries));
+
+    /* Create the entry */
+    entry = (UA_BrowsePathCacheEntry*)UA_calloc(1, sizeof(UA_BrowsePathCacheEntry));
+    if(!entry)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    UA_StatusCode retval = UA_NodeId_copy(startingNode, &entry->key.startingNode);
+    retval |= UA_RelativePath_copy(path, &entry->key.path);
+    retval |= UA_BrowsePathResult_copy(result, &entry->result);
+    if(retval != UA_STATUSCODE_GOOD) {
+        deleteEntry(cache, entry);
+        return retval;
+    }
+    entry->key.hash = browsePathHash(startingNode, nodeClassMask, path);
+    entry->key.nodeClassMask = nodeClassMask;
+
+    /* Link the entry with the nodes it depends on */
+    if(deps->depsSize > 0) {
+        entry->links = (UA_BrowsePathCacheLink*)
+            UA_calloc(deps->depsSize, sizeof(UA_BrowsePathCacheLink));
+        if(!entry->links) {
+            deleteEntry(cache, entry);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+    }
+    for(size_t i = 0; i < deps->depsSize; i++) {
+        UA_BrowsePathCacheDep *dep = getDep(cache, &deps->deps[i].nodeId);
+        if(!dep) {
+            deleteEntry(cache, entry);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        UA_BrowsePathCacheLink *link = &entry->links[i];
+        link->dep = dep;
+        link->entry = entry;
+        link->references = deps->deps[i].references;
+        LIST_INSERT_HEAD(&dep->links, link, depEntry);
+        entry->linksSize++;
+    }
+
+    ZIP_INSERT(UA_BrowsePathCacheTree, &cache->root, entry, ZIP_FFS32(UA_UInt32_random()));
+    TAILQ_INSERT_TAIL(&cache->entries, entry, listEntry);
+    cache->entriesSize++;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_BrowsePathCache_invalidate(UA_BrowsePathCache *cache, const UA_NodeId *nodeId) {
+    /* The dependency is removed together with the last entry linked to it */
+    UA_BrowsePathCacheDep *dep;
+    while((dep = findDep(cache, nodeId)))
+        removeEntry(cache, LIST_FIRST(&dep->links)->entry);
+}
+
+void
+UA_BrowsePathCache_invalidateReferences(UA_BrowsePathCache *cache,
+                                        const UA_NodeId *nodeId) {
+    /* Removing an entry can remove several links of the dependency. Start
+     * over after every removal. */
+    UA_BrowsePathCacheDep *dep;
+    while((dep = findDep(cache, nodeId))) {
+        UA_BrowsePathCacheLink *link;
+        LIST_FOREACH(link, &dep->links, depEntry) {
+            if(link->references)
+                break;
+        }
+        if(!link)
+            return;
+        removeEntry(cache, link->entry);
+    }
+}
+
+void
+UA_BrowsePathDeps_add(UA_BrowsePathDeps *deps, const UA_NodeId *nodeId,
+                      UA_Boolean references) {
+    if(deps->status != UA_STATUSCODE_GOOD)
+        return;
+    if(deps->depsSize >= deps->depsCapacity) {
+        size_t capacity = (deps->depsCapacity > 0) ? deps->depsCapacity * 2 : 8;
+        UA_BrowsePathDep *newDeps = (UA_BrowsePathDep*)
+            UA_realloc(deps->deps, capacity * sizeof(UA_BrowsePathDep));
+        if(!newDeps) {
+            deps->status = UA_STATUSCODE_BADOUTOFMEMORY;
+            return;
+        }
+        deps->deps = newDeps;
+        deps->depsCapacity = capacity;
+    }
+    UA_BrowsePathDep *dep = &deps->deps[deps->depsSize];
+    deps->status = UA_NodeId_copy(nodeId, &dep->nodeId);
+    if(deps->status != UA_STATUSCODE_GOOD)
+        return;
+    dep->references = references;
+    deps->depsSize++;
+}
+
+void
+UA_BrowsePathDeps_clear(UA_BrowsePathDeps *deps) {
+    for(size_t i = 0; i < deps->depsSize; i++)
+        UA_NodeId_clear(&deps->deps[i].nodeId);
+    UA_free(deps->deps);
+    memset(deps, 0, sizeof(UA_BrowsePathDeps));
+}
@@ -0,0 +1,113 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#ifndef UA_BROWSEPATHCACHE_H_
+#define UA_BROWSEPATHCACHE_H_
+
+#include <open62541/types.h>
+#include <open62541/types_generated_handling.h>
+#include "open62541_queue.h"
+#include "ziptree.h"
+
+_UA_BEGIN_DECLS
+
+/* The BrowsePathCache holds the results of TranslateBrowsePathsToNodeIds. The
+ * entries are keyed by the starting node, the NodeClass mask and the relative
+ * path.
+ *
+ * Every entry remembers the nodes that were evaluated to compute the result.
+ * For most nodes only the BrowseName is compared. The references are followed
+ * only for the nodes along the path. The entry is removed when one of these
+ * nodes is added or deleted, when its BrowseName changes or when the
+ * references of a node along the path change. An index from the NodeIds to
+ * the entries depending on them keeps the invalidation cheap for all other
+ * nodes.
+ *
+ * The number of entries is bounded. When the cache is full, the entry that was
+ * used least recently is evicted.
+ *
+ * The BrowsePathCache is not thread-safe. In the server, all accesses are
+ * protected by the service mutex. */
+
+struct UA_BrowsePathCacheEntry;
+typedef struct UA_BrowsePathCacheEntry UA_BrowsePathCacheEntry;
+
+struct UA_BrowsePathCacheDep;
+typedef struct UA_BrowsePathCacheDep UA_BrowsePathCacheDep;
+
+ZIP_HEAD(UA_BrowsePathCacheTree, UA_BrowsePathCacheEntry);
+typedef struct UA_BrowsePathCacheTree UA_BrowsePathCacheTree;
+
+ZIP_HEAD(UA_BrowsePathCacheDepTree, UA_BrowsePathCacheDep);
+typedef struct UA_BrowsePathCacheDepTree UA_BrowsePathCacheDepTree;
+
+typedef struct {
+    UA_BrowsePathCacheTree root;
+    UA_BrowsePathCacheDepTree deps; /* NodeId -> entries depending on it */
+    TAILQ_HEAD(, UA_BrowsePathCacheEntry) entries; /* Least recently used first */
+    size_t entriesSize;
+    UA_UInt64 hits;
+    UA_UInt64 misses;
+} UA_BrowsePathCache;
+
+/* A node evaluated while a browse path is translated */
+typedef struct {
+    UA_NodeId nodeId;
+    UA_Boolean references; /* The references of the node were followed */
+} UA_BrowsePathDep;
+
+typedef struct {
+    size_t depsSize;
+    size_t depsCapacity;
+    UA_BrowsePathDep *deps;
+    UA_StatusCode status; /* The result is not cached if not good */
+} UA_BrowsePathDeps;
+
+void
+UA_BrowsePathCache_init(UA_BrowsePathCache *cache);
+
+/* Removes all entries. Keeps the statistics. */
+void
+UA_BrowsePathCache_clear(UA_BrowsePathCache *cache);
+
+/* Copies the cached result. Returns UA_STATUSCODE_BADNOTFOUND if there is no
+ * entry for the browse path. */
+UA_StatusCode
+UA_BrowsePathCache_get(UA_BrowsePathCache *cache, const UA_NodeId *startingNode,
+                       UA_UInt32 nodeClassMask, const UA_RelativePath *path,
+                       UA_BrowsePathResult *result);
+
+/* Stores a copy of the result. The entry is invalidated when one of the
+ * recorded nodes changes. */
+UA_StatusCode
+UA_BrowsePathCache_store(UA_BrowsePathCache *cache, size_t maxEntries,
+                         const UA_NodeId *startingNode, UA_UInt32 nodeClassMask,
+                         const UA_RelativePath *path,
+                         const UA_BrowsePathResult *result,
+                         const UA_BrowsePathDeps *deps);
+
+/* Removes all entries that depend on the node. Called when the BrowseName of
+ * the node changes and when the node is added or deleted. */
+void
+UA_BrowsePathCache_invalidate(UA_BrowsePathCache *cache, const UA_NodeId *nodeId);
+
+/* Removes the entries that followed the references of the node. Called when
+ * the references of the node change. */
+void
+UA_BrowsePathCache_invalidateReferences(UA_BrowsePathCache *cache,
+                                        const UA_NodeId *nodeId);
+
+void
+UA_BrowsePathDeps_add(UA_BrowsePathDeps *deps, const UA_NodeId *nodeId,
+                      UA_Boolean references);
+
+void
+UA_BrowsePathDeps_clear(UA_BrowsePathDeps *deps);
+
+_UA_END_DECLS
+
+#endif /* UA_BROWSEPATHCACHE_H_ */
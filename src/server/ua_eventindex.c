@@ -0,0 +1,136 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_eventindex.h"
+
+typedef struct {
+    UA_UInt32 hash;
+    UA_NodeId nodeId;
+} UA_EventIndexKey;
+
+struct UA_EventIndexEntry {
+    ZIP_ENTRY(UA_EventIndexEntry) zipfields;
+    TAILQ_ENTRY(UA_EventIndexEntry) listEntry;
+    UA_EventIndexKey key;
+    size_t monitoredItemsSize;
+    struct UA_MonitoredItem **monitoredItems;
+};
+
+static enum ZIP_CMP
+cmpEventIndexKey(const void *a, const void *b) {
+    const UA_EventIndexKey *aa = (const UA_EventIndexKey*)a;
+    const UA_EventIndexKey *bb = (const UA_EventIndexKey*)b;
+    if(aa->hash < bb->hash)
+        return ZIP_CMP_LESS;
+    if(aa->hash > bb->hash)
+        return ZIP_CMP_MORE;
+    return (enum ZIP_CMP)UA_NodeId_order(&aa->nodeId, &bb->nodeId);
+}
+
+ZIP_PROTTYPE(UA_EventIndexTree, UA_EventIndexEntry, UA_EventIndexKey)
+ZIP_IMPL(UA_EventIndexTree, UA_EventIndexEntry, zipfields,
+         UA_EventIndexKey, key, cmpEventIndexKey)
+
+static UA_EventIndexEntry *
+findEntry(UA_EventIndex *index, const UA_NodeId *nodeId) {
+    UA_EventIndexKey key;
+    key.hash = UA_NodeId_hash(nodeId);
+    key.nodeId = *nodeId;
+    return ZIP_FIND(UA_EventIndexTree, &index->root, &key);
+}
+
+static void
+removeEntry(UA_EventIndex *index, UA_EventIndexEntry *entry) {
+    ZIP_REMOVE(UA_EventIndexTree, &index->root, entry);
+    TAILQ_REMOVE(&index->entries, entry, listEntry);
+    index->entriesSize--;
+    UA_NodeId_clear(&entry->key.nodeId);
+    UA_free(entry->monitoredItems);
+    UA_free(entry);
+}
+
+void
+UA_EventIndex_init(UA_EventIndex *index) {
+    memset(index, 0, sizeof(UA_EventIndex));
+    ZIP_INIT(&index->root);
+    TAILQ_INIT(&index->entries);
+}
+
+void
+UA_EventIndex_clear(UA_EventIndex *index) {
+    UA_EventIndexEntry *entry, *entry_tmp;
+    TAILQ_FOREACH_SAFE(entry, &index->entries, listEntry, entry_tmp)
+        removeEntry(index, entry);
+}
+
+UA_StatusCode
+UA_EventIndex_get(UA_EventIndex *index, const UA_NodeId *sourceNode,
+                  size_t *monitoredItemsSize,
+                  struct UA_MonitoredItem * const **monitoredItems) {
+    UA_EventIndexEntry *entry = findEntry(index, sourceNode);
+    if(!entry) {
+        index->misses++;
+        return UA_STATUSCODE_BADNOTFOUND;
+    }
+    index->hits++;
+    TAILQ_REMOVE(&index->entries, entry, listEntry);
+    TAILQ_INSERT_TAIL(&index->entries, entry, listEntry);
+    *monitoredItemsSize = entry->monitoredItemsSize;
+    *monitoredItems = entry->monitoredItems;
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode
+UA_EventIndex_store(UA_EventIndex *index, size_t maxEntries,
+                    const UA_NodeId *sourceNode, size_t monitoredItemsSize,
+                    struct UA_MonitoredItem * const *monitoredItems) {
+    if(maxEntries == 0)
+        return UA_STATUSCODE_GOOD;
+
+    /* Replace an existing entry */
+    UA_EventIndexEntry *entry = findEntry(index, sourceNode);
+    if(entry)
+        removeEntry(index, entry);
+
+    /* Evict the least recently used entry */
+    if(index->entriesSize >= maxEntries)
+        removeEntry(index, TAILQ_FIRST(&index->entries));
+
+    /* Add a new entry */
+    entry = (UA_EventIndexEntry*)UA_calloc(1, sizeof(UA_EventIndexEntry));
+    if(!entry)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    if(monitoredItemsSize > 0) {
+        entry->monitoredItems = (struct UA_MonitoredItem**)
+            UA_malloc(monitoredItemsSize * sizeof(struct UA_MonitoredItem*));
+        if(!entry->monitoredItems) {
+            UA_free(entry);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        memcpy(entry->monitoredItems, monitoredItems,
+               monitoredItemsSize * sizeof(struct UA_MonitoredItem*));
+    }
+    UA_StatusCode retval = UA_NodeId_copy(sourceNode, &entry->key.nodeId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_free(entry->monitoredItems);
+        UA_free(entry);
+        return retval;
+    }
+    entry->monitoredItemsSize = monitoredItemsSize;
+    entry->key.hash = UA_NodeId_hash(sourceNode);
+    ZIP_INSERT(UA_EventIndexTree, &index->root, entry, ZIP_FFS32(UA_UInt32_random()));
+    TAILQ_INSERT_TAIL(&index->entries, entry, listEntry);
+    index->entriesSize++;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_EventIndex_remove(UA_EventIndex *index, const UA_NodeId *sourceNode) {
+    UA_EventIndexEntry *entry = findEntry(index, sourceNode);
+    if(entry)
+        removeEntry(index, entry);
+}
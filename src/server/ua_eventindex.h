@@ -0,0 +1,76 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#ifndef UA_EVENTINDEX_H_
+#define UA_EVENTINDEX_H_
+
+#include <open62541/types.h>
+#include <open62541/types_generated_handling.h>
+#include "open62541_queue.h"
+#include "ziptree.h"
+
+_UA_BEGIN_DECLS
+
+/* The EventIndex maps the source node of events to the MonitoredItems that
+ * receive them. These are the event MonitoredItems of the source node and of
+ * all nodes above it along Organizes and HasComponent references. An entry is
+ * computed when the first event of a source node is triggered.
+ *
+ * All entries are removed when an event MonitoredItem is added or removed and
+ * when a reference changes along which events are propagated. The entry of a
+ * source node is removed when the node is deleted.
+ *
+ * The number of entries is bounded. When the index is full, the entry that was
+ * used least recently is evicted.
+ *
+ * The EventIndex is not thread-safe. In the server, all accesses are protected
+ * by the service mutex. */
+
+struct UA_MonitoredItem;
+
+struct UA_EventIndexEntry;
+typedef struct UA_EventIndexEntry UA_EventIndexEntry;
+
+ZIP_HEAD(UA_EventIndexTree, UA_EventIndexEntry);
+typedef struct UA_EventIndexTree UA_EventIndexTree;
+
+typedef struct {
+    UA_EventIndexTree root;
+    TAILQ_HEAD(, UA_EventIndexEntry) entries; /* Least recently used first */
+    size_t entriesSize;
+    UA_UInt64 hits;
+    UA_UInt64 misses;
+} UA_EventIndex;
+
+void
+UA_EventIndex_init(UA_EventIndex *index);
+
+/* Removes all entries. Keeps the statistics. */
+void
+UA_EventIndex_clear(UA_EventIndex *index);
+
+/* Returns the MonitoredItems that receive the events of the source node. The
+ * array is valid until the index is changed. Returns
+ * UA_STATUSCODE_BADNOTFOUND if the source node is not indexed. */
+UA_StatusCode
+UA_EventIndex_get(UA_EventIndex *index, const UA_NodeId *sourceNode,
+                  size_t *monitoredItemsSize,
+                  struct UA_MonitoredItem * const **monitoredItems);
+
+/* Stores a copy of the array of MonitoredItems for the source node */
+UA_StatusCode
+UA_EventIndex_store(UA_EventIndex *index, size_t maxEntries,
+                    const UA_NodeId *sourceNode, size_t monitoredItemsSize,
+                    struct UA_MonitoredItem * const *monitoredItems);
+
+/* Removes the entry of the source node */
+void
+UA_EventIndex_remove(UA_EventIndex *index, const UA_NodeId *sourceNode);
+
+_UA_END_DECLS
+
+#endif /* UA_EVENTINDEX_H_ */
@@ -31,12 +31,174 @@ cmpRefTarget(const void *a, const void *b) {
 ZIP_IMPL(UA_ReferenceTargetHead, UA_ReferenceTarget, zipfields,
          UA_ReferenceTarget, zipfields, cmpRefTarget)
 
+/********************/
+/* String Interning */
+/********************/
+
+#ifdef UA_ENABLE_STRING_INTERNING
+
+/* The bit i in node->internedStrings is set if the i-th standard attribute
+ * string is interned */
+#define UA_NODE_STANDARDSTRINGS 5
+
+static UA_String *
+standardString(const UA_Node *node, size_t i) {
+    UA_Node *n = (UA_Node*)(uintptr_t)node;
+    switch(i) {
+    case 0: return &n->browseName.name;
+    case 1: return &n->displayName.locale;
+    case 2: return &n->displayName.text;
+    case 3: return &n->description.locale;
+    default: return &n->description.text;
+    }
+}
+
+static void
+releaseStandardStrings(UA_Node *node, UA_Byte mask) {
+    for(size_t i = 0; i < UA_NODE_STANDARDSTRINGS; i++) {
+        UA_Byte bit = (UA_Byte)(1 << i);
+        if(!(node->internedStrings & mask & bit))
+            continue;
+        UA_StringPool_release(standardString(node, i));
+        node->internedStrings &= (UA_Byte)~bit;
+    }
+}
+
+static void
+internReferenceTarget(UA_StringPool *pool, UA_ReferenceTarget *target) {
+    if(target->interned ||
+       target->target.nodeId.identifierType != UA_NODEIDTYPE_STRING)
+        return;
+    if(UA_StringPool_intern(pool, &target->target.nodeId.identifier.string) ==
+       UA_STATUSCODE_GOOD)
+        target->interned = true;
+}
+
+void
+UA_Node_internStrings(UA_StringPool *pool, UA_Node *node) {
+    /* Standard attributes */
+    for(size_t i = 0; i < UA_NODE_STANDARDSTRINGS; i++) {
+        UA_Byte bit = (UA_Byte)(1 << i);
+        if(node->internedStrings & bit)
+            continue;
+        if(UA_StringPool_intern(pool, standardString(node, i)) == UA_STATUSCODE_GOOD)
+            node->internedStrings |= bit;
+    }
+
+    /* String NodeIds of the reference targets */
+    for(size_t i = 0; i < node->referencesSize; i++) {
+        UA_NodeReferenceKind *refs = &node->references[i];
+        for(size_t j = 0; j < refs->refTargetsSize; j++)
+            internReferenceTarget(pool, &refs->refTargets[j]);
+    }
+}
+
+void
+UA_Node_internReferenceTarget(UA_StringPool *pool, UA_Node *node,
+                              const UA_AddReferencesItem *item) {
+    if(item->targetNodeId.nodeId.identifierType != UA_NODEIDTYPE_STRING)
+        return;
+    for(size_t i = 0; i < node->referencesSize; ++i) {
+        UA_NodeReferenceKind *refs = &node->references[i];
+        if(refs->isInverse == item->isForward ||
+           !UA_NodeId_equal(&refs->referenceTypeId, &item->referenceTypeId))
+            continue;
+        UA_ReferenceTarget tmpTarget;
+        tmpTarget.target = item->targetNodeId;
+        tmpTarget.targetHash = UA_ExpandedNodeId_hash(&item->targetNodeId);
+        UA_ReferenceTarget *target =
+            ZIP_FIND(UA_ReferenceTargetHead, &refs->refTargetsTree, &tmpTarget);
+        if(target)
+            internReferenceTarget(pool, target);
+        return;
+    }
+}
+
+#endif /* UA_ENABLE_STRING_INTERNING */
+
+static void
+clearReferenceTarget(UA_ReferenceTarget *target) {
+#ifdef UA_ENABLE_STRING_INTERNING
+    if(target->interned) {
+        UA_StringPool_release(&target->target.nodeId.identifier.string);
+        target->interned = false;
+    }
+#endif
+    UA_ExpandedNodeId_clear(&target->target);
+}
+
+static UA_StatusCode
+copyReferenceTarget(const UA_ReferenceTarget *src, UA_ReferenceTarget *dst) {
+#ifdef UA_ENABLE_STRING_INTERNING
+    dst->interned = src->interned;
+    if(src->interned) {
+        /* Share the interned string identifier */
+        dst->target = src->target;
+        UA_StringPool_acquire(&src->target.nodeId.identifier.string,
+                              &dst->target.nodeId.identifier.string);
+        return UA_String_copy(&src->target.namespaceUri, &dst->target.namespaceUri);
+    }
+#endif
+    return UA_ExpandedNodeId_copy(&src->target, &dst->target);
+}
+
+static UA_StatusCode
+copyStandardStrings(const UA_Node *src, UA_Node *dst) {
+#ifdef UA_ENABLE_STRING_INTERNING
+    /* Interned strings are shared and not copied */
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    dst->browseName.namespaceIndex = src->browseName.namespaceIndex;
+    dst->internedStrings = 0;
+    for(size_t i = 0; i < UA_NODE_STANDARDSTRINGS; i++) {
+        UA_Byte bit = (UA_Byte)(1 << i);
+        if(src->internedStrings & bit) {
+            UA_StringPool_acquire(standardString(src, i), standardString(dst, i));
+            dst->internedStrings |= bit;
+        } else {
+            retval |= UA_String_copy(standardString(src, i), standardString(dst, i));
+        }
+    }
+    return retval;
+#else
+    UA_StatusCode retval = UA_QualifiedName_copy(&src->browseName, &dst->browseName);
+    retval |= UA_LocalizedText_copy(&src->displayName, &dst->displayName);
+    retval |= UA_LocalizedText_copy(&src->description, &dst->description);
+    return retval;
+#endif
+}
+
+void
+UA_Node_clearStringAttribute(UA_Node *node, UA_AttributeId attributeId) {
+    switch(attributeId) {
+    case UA_ATTRIBUTEID_BROWSENAME:
+#ifdef UA_ENABLE_STRING_INTERNING
+        releaseStandardStrings(node, 0x01);
+#endif
+        UA_QualifiedName_clear(&node->browseName);
+        break;
+    case UA_ATTRIBUTEID_DISPLAYNAME:
+#ifdef UA_ENABLE_STRING_INTERNING
+        releaseStandardStrings(node, 0x06);
+#endif
+        UA_LocalizedText_clear(&node->displayName);
+        break;
+    case UA_ATTRIBUTEID_DESCRIPTION:
+#ifdef UA_ENABLE_STRING_INTERNING
+        releaseStandardStrings(node, 0x18);
+#endif
+        UA_LocalizedText_clear(&node->description);
+        break;
+    default:
+        break;
+    }
+}
+
 void UA_Node_clear(UA_Node *node) {
     /* Delete standard content */
     UA_NodeId_clear(&node->nodeId);
-    UA_QualifiedName_clear(&node->browseName);
-    UA_LocalizedText_clear(&node->displayName);
-    UA_LocalizedText_clear(&node->description);
+    UA_Node_clearStringAttribute(node, UA_ATTRIBUTEID_BROWSENAME);
+    UA_Node_clearStringAttribute(node, UA_ATTRIBUTEID_DISPLAYNAME);
+    UA_Node_clearStringAttribute(node, UA_ATTRIBUTEID_DESCRIPTION);
 
     /* Delete references */
     UA_Node_deleteReferences(node);
@@ -108,6 +270,11 @@ UA_VariableNode_copy(const UA_VariableNode *src, UA_VariableNode *dst) {
     dst->accessLevel = src->accessLevel;
     dst->minimumSamplingInterval = src->minimumSamplingInterval;
     dst->historizing = src->historizing;
+    dst->readBatch = src->readBatch;
+    dst->sampleOnWrite = src->sampleOnWrite;
+#if UA_MULTITHREADING >= 100
+    dst->async = src->async;
+#endif
     return retval;
 }
 
@@ -167,9 +334,7 @@ UA_Node_copy(const UA_Node *src, UA_Node *dst) {
 
     /* Copy standard content */
     UA_StatusCode retval = UA_NodeId_copy(&src->nodeId, &dst->nodeId);
-    retval |= UA_QualifiedName_copy(&src->browseName, &dst->browseName);
-    retval |= UA_LocalizedText_copy(&src->displayName, &dst->displayName);
-    retval |= UA_LocalizedText_copy(&src->description, &dst->description);
+    retval |= copyStandardStrings(src, dst);
     dst->writeMask = src->writeMask;
     dst->context = src->context;
     dst->constructed = src->constructed;
@@ -205,20 +370,20 @@ UA_Node_copy(const UA_Node *src, UA_Node *dst) {
             }
             uintptr_t arraydiff = (uintptr_t)drefs->refTargets - (uintptr_t)srefs->refTargets;
             for(size_t j = 0; j < srefs->refTargetsSize; j++) {
-                retval |= UA_ExpandedNodeId_copy(&srefs->refTargets[j].target,
-                                                 &drefs->refTargets[j].target);
+                retval |= copyReferenceTarget(&srefs->refTargets[j],
+                                              &drefs->refTargets[j]);
                 drefs->refTargets[j].targetHash = srefs->refTargets[j].targetHash;
                 drefs->refTargets[j].zipfields.zip_right = NULL;
                 if(srefs->refTargets[j].zipfields.zip_right)
-                    *(uintptr_t*)&drefs->refTargets[j].zipfields.zip_left =
+                    *(uintptr_t*)&drefs->refTargets[j].zipfields.zip_right =
                         (uintptr_t)srefs->refTargets[j].zipfields.zip_right + arraydiff;
                 drefs->refTargets[j].zipfields.zip_left = NULL;
                 if(srefs->refTargets[j].zipfields.zip_left)
                     *(uintptr_t*)&drefs->refTargets[j].zipfields.zip_left =
                         (uintptr_t)srefs->refTargets[j].zipfields.zip_left + arraydiff;
             }
-            srefs->refTargetsTree.zip_root = NULL;
-            if(drefs->refTargetsTree.zip_root)
+            drefs->refTargetsTree.zip_root = NULL;
+            if(srefs->refTargetsTree.zip_root)
                 *(uintptr_t*)&drefs->refTargetsTree.zip_root =
                     (uintptr_t)srefs->refTargetsTree.zip_root + arraydiff;
             drefs->refTargetsSize= srefs->refTargetsSize;
@@ -492,11 +657,12 @@ UA_Node_setAttributes(UA_Node *node, const void *attributes,
 /* Manage References */
 /*********************/
 
+/* Make room for more targets. The tree pointers into the realloced array are
+ * repaired. */
 static UA_StatusCode
-addReferenceTarget(UA_NodeReferenceKind *refs, const UA_ExpandedNodeId *target,
-                   UA_UInt32 targetHash) {
+growReferenceTargets(UA_NodeReferenceKind *refs, size_t count) {
     UA_ReferenceTarget *targets = (UA_ReferenceTarget*)
-        UA_realloc(refs->refTargets, (refs->refTargetsSize + 1) * sizeof(UA_ReferenceTarget));
+        UA_realloc(refs->refTargets, (refs->refTargetsSize + count) * sizeof(UA_ReferenceTarget));
     if(!targets)
         return UA_STATUSCODE_BADOUTOFMEMORY;
 
@@ -514,17 +680,20 @@ addReferenceTarget(UA_NodeReferenceKind *refs, const UA_ExpandedNodeId *target,
     if(refs->refTargetsTree.zip_root)
         *(uintptr_t*)&refs->refTargetsTree.zip_root += arraydiff;
     refs->refTargets = targets;
+    return UA_STATUSCODE_GOOD;
+}
 
+/* The array must have room for the new target */
+static UA_StatusCode
+insertReferenceTarget(UA_NodeReferenceKind *refs, const UA_ExpandedNodeId *target,
+                      UA_UInt32 targetHash) {
     UA_ReferenceTarget *entry = &refs->refTargets[refs->refTargetsSize];
+#ifdef UA_ENABLE_STRING_INTERNING
+    entry->interned = false;
+#endif
     UA_StatusCode retval = UA_ExpandedNodeId_copy(target, &entry->target);
-    if(retval != UA_STATUSCODE_GOOD) {
-        if(refs->refTargetsSize== 0) {
-            /* We had zero references before (realloc was a malloc) */
-            UA_free(refs->refTargets);
-            refs->refTargets = NULL;
-        }
+    if(retval != UA_STATUSCODE_GOOD)
         return retval;
-    }
 
     entry->targetHash = targetHash;
     ZIP_INSERT(UA_ReferenceTargetHead, &refs->refTargetsTree,
@@ -533,6 +702,21 @@ addReferenceTarget(UA_NodeReferenceKind *refs, const UA_ExpandedNodeId *target,
     return UA_STATUSCODE_GOOD;
 }
 
+static UA_StatusCode
+addReferenceTarget(UA_NodeReferenceKind *refs, const UA_ExpandedNodeId *target,
+                   UA_UInt32 targetHash) {
+    UA_StatusCode retval = growReferenceTargets(refs, 1);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    retval = insertReferenceTarget(refs, target, targetHash);
+    if(retval != UA_STATUSCODE_GOOD && refs->refTargetsSize == 0) {
+        /* We had zero references before (realloc was a malloc) */
+        UA_free(refs->refTargets);
+        refs->refTargets = NULL;
+    }
+    return retval;
+}
+
 static UA_StatusCode
 addReferenceKind(UA_Node *node, const UA_AddReferencesItem *item) {
     UA_NodeReferenceKind *refs = (UA_NodeReferenceKind*)
@@ -562,19 +746,27 @@ addReferenceKind(UA_Node *node, const UA_AddReferencesItem *item) {
     return UA_STATUSCODE_GOOD;
 }
 
-UA_StatusCode
-UA_Node_addReference(UA_Node *node, const UA_AddReferencesItem *item) {
-    /* Find the matching refkind */
-    UA_NodeReferenceKind *existingRefs = NULL;
+static UA_NodeReferenceKind *
+findReferenceKind(UA_Node *node, const UA_AddReferencesItem *item) {
     for(size_t i = 0; i < node->referencesSize; ++i) {
         UA_NodeReferenceKind *refs = &node->references[i];
         if(refs->isInverse != item->isForward &&
-           UA_NodeId_equal(&refs->referenceTypeId, &item->referenceTypeId)) {
-            existingRefs = refs;
-            break;
-        }
+           UA_NodeId_equal(&refs->referenceTypeId, &item->referenceTypeId))
+            return refs;
     }
+    return NULL;
+}
 
+static UA_Boolean
+sameReferenceKind(const UA_AddReferencesItem *a, const UA_AddReferencesItem *b) {
+    return a->isForward == b->isForward &&
+        UA_NodeId_equal(&a->referenceTypeId, &b->referenceTypeId);
+}
+
+UA_StatusCode
+UA_Node_addReference(UA_Node *node, const UA_AddReferencesItem *item) {
+    /* Find the matching refkind */
+    UA_NodeReferenceKind *existingRefs = findReferenceKind(node, item);
     if(!existingRefs)
         return addReferenceKind(node, item);
 
@@ -589,6 +781,59 @@ UA_Node_addReference(UA_Node *node, const UA_AddReferencesItem *item) {
     return addReferenceTarget(existingRefs, &item->targetNodeId, tmpTarget.targetHash);
 }
 
+UA_StatusCode
+UA_Node_addReferences(UA_Node *node, size_t itemsSize,
+                      const UA_AddReferencesItem **items) {
+    UA_Boolean *done = (UA_Boolean*)UA_calloc(itemsSize, sizeof(UA_Boolean));
+    if(!done)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    for(size_t i = 0; i < itemsSize && retval == UA_STATUSCODE_GOOD; i++) {
+        if(done[i])
+            continue;
+
+        /* Create the reference kind with the first target */
+        size_t first = i;
+        UA_NodeReferenceKind *refs = findReferenceKind(node, items[i]);
+        if(!refs) {
+            retval = addReferenceKind(node, items[i]);
+            if(retval != UA_STATUSCODE_GOOD)
+                break;
+            refs = &node->references[node->referencesSize - 1];
+            first++;
+        }
+
+        /* Grow the target array once for all items of the reference kind */
+        size_t count = 0;
+        for(size_t j = first; j < itemsSize; j++) {
+            if(!done[j] && sameReferenceKind(items[i], items[j]))
+                count++;
+        }
+        if(count == 0)
+            continue;
+        retval = growReferenceTargets(refs, count);
+
+        /* Insert the targets. Duplicates are skipped. */
+        const UA_AddReferencesItem *kind = items[i];
+        for(size_t j = first; j < itemsSize && retval == UA_STATUSCODE_GOOD; j++) {
+            if(done[j] || !sameReferenceKind(kind, items[j]))
+                continue;
+            done[j] = true;
+            UA_ReferenceTarget tmpTarget;
+            tmpTarget.target = items[j]->targetNodeId;
+            tmpTarget.targetHash = UA_ExpandedNodeId_hash(&items[j]->targetNodeId);
+            if(ZIP_FIND(UA_ReferenceTargetHead, &refs->refTargetsTree, &tmpTarget))
+                continue;
+            retval = insertReferenceTarget(refs, &items[j]->targetNodeId,
+                                           tmpTarget.targetHash);
+        }
+    }
+
+    UA_free(done);
+    return retval;
+}
+
 UA_StatusCode
 UA_Node_deleteReference(UA_Node *node, const UA_DeleteReferencesItem *item) {
     for(size_t i = node->referencesSize; i > 0; --i) {
@@ -605,7 +850,7 @@ UA_Node_deleteReference(UA_Node *node, const UA_DeleteReferencesItem *item) {
 
             /* Ok, delete the reference */
             ZIP_REMOVE(UA_ReferenceTargetHead, &refs->refTargetsTree, target);
-            UA_ExpandedNodeId_clear(&target->target);
+            clearReferenceTarget(target);
             refs->refTargetsSize--;
 
             /* One matching target remaining */
@@ -667,7 +912,7 @@ UA_Node_deleteReferencesSubset(UA_Node *node, size_t referencesSkipSize,
 
         /* Remove references */
         for(size_t j = 0; j < refs->refTargetsSize; j++)
-            UA_ExpandedNodeId_clear(&refs->refTargets[j].target);
+            clearReferenceTarget(&refs->refTargets[j]);
         UA_free(refs->refTargets);
         UA_NodeId_clear(&refs->referenceTypeId);
         node->referencesSize--;
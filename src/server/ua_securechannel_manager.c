@@ -20,9 +20,59 @@
 #define STARTCHANNELID 1
 #define STARTTOKENID 1
 
+static enum ZIP_CMP
+cmpChannelId(const UA_UInt32 *a, const UA_UInt32 *b) {
+    if(*a < *b)
+        return ZIP_CMP_LESS;
+    if(*a == *b)
+        return ZIP_CMP_EQ;
+    return ZIP_CMP_MORE;
+}
+
+ZIP_PROTTYPE(UA_ChannelIdZip, channel_entry, UA_UInt32)
+ZIP_IMPL(UA_ChannelIdZip, channel_entry, idZipfields, UA_UInt32, channelId, cmpChannelId)
+
+/* The address of the entry breaks ties, as in the timer */
+static enum ZIP_CMP
+cmpChannelTimeout(const UA_DateTime *a, const UA_DateTime *b) {
+    if(*a < *b)
+        return ZIP_CMP_LESS;
+    if(*a > *b)
+        return ZIP_CMP_MORE;
+    if(a == b)
+        return ZIP_CMP_EQ;
+    if(a < b)
+        return ZIP_CMP_LESS;
+    return ZIP_CMP_MORE;
+}
+
+ZIP_PROTTYPE(UA_ChannelTimeoutZip, channel_entry, UA_DateTime)
+ZIP_IMPL(UA_ChannelTimeoutZip, channel_entry, timeoutZipfields, UA_DateTime,
+         timeout, cmpChannelTimeout)
+
+#define CHANNELENTRY(c) \
+    ((channel_entry*)((uintptr_t)(c) - offsetof(channel_entry, channel)))
+
+static UA_DateTime
+channelTimeout(const UA_SecureChannel *channel) {
+    return channel->securityToken.createdAt +
+        (UA_DateTime)(channel->securityToken.revisedLifetime * UA_DATETIME_MSEC);
+}
+
+/* Moves the channel in the timeout queue */
+static void
+setTimeout(UA_SecureChannelManager *cm, channel_entry *entry, UA_DateTime timeout) {
+    ZIP_REMOVE(UA_ChannelTimeoutZip, &cm->timeoutQueue, entry);
+    entry->timeout = timeout;
+    ZIP_INSERT(UA_ChannelTimeoutZip, &cm->timeoutQueue, entry,
+               ZIP_FFS32(UA_UInt32_random()));
+}
+
 UA_StatusCode
 UA_SecureChannelManager_init(UA_SecureChannelManager *cm, UA_Server *server) {
     TAILQ_INIT(&cm->channels);
+    ZIP_INIT(&cm->idIndex);
+    ZIP_INIT(&cm->timeoutQueue);
     // TODO: use an ID that is likely to be unique after a restart
     cm->lastChannelId = STARTCHANNELID;
     cm->lastTokenId = STARTTOKENID;
@@ -40,6 +90,8 @@ UA_SecureChannelManager_deleteMembers(UA_SecureChannelManager *cm) {
         UA_SecureChannel_deleteMembers(&entry->channel);
         UA_free(entry);
     }
+    ZIP_INIT(&cm->idIndex);
+    ZIP_INIT(&cm->timeoutQueue);
 }
 
 static void
@@ -53,7 +105,11 @@ removeSecureChannel(UA_SecureChannelManager *cm, channel_entry *entry) {
     UA_SecureChannel_close(&entry->channel);
 
     /* Detach the channel and make the capacity available */
+    entry->removed = true;
     TAILQ_REMOVE(&cm->channels, entry, pointers);
+    ZIP_REMOVE(UA_ChannelTimeoutZip, &cm->timeoutQueue, entry);
+    if(entry->channelId != 0)
+        ZIP_REMOVE(UA_ChannelIdZip, &cm->idIndex, entry);
     UA_atomic_subUInt32(&cm->currentChannelCount, 1);
 
     /* Add a delayed callback to remove the channel when the currently
@@ -68,8 +124,12 @@ removeSecureChannel(UA_SecureChannelManager *cm, channel_entry *entry) {
 void
 UA_SecureChannelManager_cleanupTimedOut(UA_SecureChannelManager *cm,
                                         UA_DateTime nowMonotonic) {
-    channel_entry *entry, *temp;
-    TAILQ_FOREACH_SAFE(entry, &cm->channels, pointers, temp) {
+    /* Only look at the channels that are due. Closed channels are removed
+     * right away in UA_SecureChannelManager_removeClosed. Renewed channels are
+     * due immediately to revolve the tokens. */
+    channel_entry *entry;
+    while((entry = ZIP_MIN(UA_ChannelTimeoutZip, &cm->timeoutQueue)) &&
+          entry->timeout < nowMonotonic) {
         /* The channel was closed internally */
         if(entry->channel.state == UA_SECURECHANNELSTATE_CLOSED ||
            !entry->channel.connection) {
@@ -78,10 +138,7 @@ UA_SecureChannelManager_cleanupTimedOut(UA_SecureChannelManager *cm,
         }
 
         /* The channel has timed out */
-        UA_DateTime timeout =
-            entry->channel.securityToken.createdAt +
-            (UA_DateTime)(entry->channel.securityToken.revisedLifetime * UA_DATETIME_MSEC);
-        if(timeout < nowMonotonic) {
+        if(channelTimeout(&entry->channel) < nowMonotonic) {
             UA_LOG_INFO_CHANNEL(&cm->server->config.logger, &entry->channel,
                                 "SecureChannel has timed out");
             removeSecureChannel(cm, entry);
@@ -92,6 +149,9 @@ UA_SecureChannelManager_cleanupTimedOut(UA_SecureChannelManager *cm,
         if(entry->channel.nextSecurityToken.tokenId > 0) {
             UA_SecureChannel_revolveTokens(&entry->channel);
         }
+
+        /* Check again when the (new) token times out */
+        setTimeout(cm, entry, channelTimeout(&entry->channel));
     }
 }
 
@@ -150,7 +210,12 @@ UA_SecureChannelManager_create(UA_SecureChannelManager *const cm, UA_Connection
     entry->channel.securityToken.createdAt = UA_DateTime_now();
     entry->channel.securityToken.revisedLifetime = cm->server->config.maxSecurityTokenLifetime;
 
+    entry->channelId = 0;
+    entry->removed = false;
+    entry->timeout = channelTimeout(&entry->channel);
     TAILQ_INSERT_TAIL(&cm->channels, entry, pointers);
+    ZIP_INSERT(UA_ChannelTimeoutZip, &cm->timeoutQueue, entry,
+               ZIP_FFS32(UA_UInt32_random()));
     UA_atomic_addUInt32(&cm->currentChannelCount, 1);
     UA_Connection_attachSecureChannel(connection, &entry->channel);
     return UA_STATUSCODE_GOOD;
@@ -211,6 +276,12 @@ UA_SecureChannelManager_open(UA_SecureChannelManager *cm, UA_SecureChannel *chan
     /* The channel is open */
     channel->state = UA_SECURECHANNELSTATE_OPEN;
 
+    /* Index the channel with its id */
+    channel_entry *entry = CHANNELENTRY(channel);
+    entry->channelId = channel->securityToken.channelId;
+    ZIP_INSERT(UA_ChannelIdZip, &cm->idIndex, entry, ZIP_FFS32(UA_UInt32_random()));
+    setTimeout(cm, entry, channelTimeout(channel));
+
     return UA_STATUSCODE_GOOD;
 }
 
@@ -258,29 +329,50 @@ UA_SecureChannelManager_renew(UA_SecureChannelManager *cm, UA_SecureChannel *cha
 
     /* Reset the internal creation date to the monotonic clock */
     channel->nextSecurityToken.createdAt = UA_DateTime_nowMonotonic();
+
+    /* Revolve the tokens in the next cleanup */
+    setTimeout(cm, CHANNELENTRY(channel), 0);
     return UA_STATUSCODE_GOOD;
 }
 
-UA_SecureChannel *
-UA_SecureChannelManager_get(UA_SecureChannelManager *cm, UA_UInt32 channelId) {
+static channel_entry *
+findChannel(UA_SecureChannelManager *cm, UA_UInt32 channelId) {
+    if(channelId != 0)
+        return ZIP_FIND(UA_ChannelIdZip, &cm->idIndex, &channelId);
+
+    /* Channels that are not yet open have no id */
     channel_entry *entry;
     TAILQ_FOREACH(entry, &cm->channels, pointers) {
-        if(entry->channel.securityToken.channelId == channelId)
-            return &entry->channel;
+        if(entry->channel.securityToken.channelId == 0)
+            return entry;
     }
     return NULL;
 }
 
+UA_SecureChannel *
+UA_SecureChannelManager_get(UA_SecureChannelManager *cm, UA_UInt32 channelId) {
+    channel_entry *entry = findChannel(cm, channelId);
+    if(!entry)
+        return NULL;
+    return &entry->channel;
+}
+
 UA_StatusCode
 UA_SecureChannelManager_close(UA_SecureChannelManager *cm, UA_UInt32 channelId) {
-    channel_entry *entry;
-    TAILQ_FOREACH(entry, &cm->channels, pointers) {
-        if(entry->channel.securityToken.channelId == channelId)
-            break;
-    }
+    channel_entry *entry = findChannel(cm, channelId);
     if(!entry)
         return UA_STATUSCODE_BADINTERNALERROR;
 
     removeSecureChannel(cm, entry);
     return UA_STATUSCODE_GOOD;
 }
+
+void
+UA_SecureChannelManager_removeClosed(UA_SecureChannelManager *cm,
+                                     UA_SecureChannel *channel) {
+    channel_entry *entry = CHANNELENTRY(channel);
+    if(entry->removed)
+        return;
+    if(channel->state == UA_SECURECHANNELSTATE_CLOSED || !channel->connection)
+        removeSecureChannel(cm, entry);
+}
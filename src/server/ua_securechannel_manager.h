@@ -14,6 +14,7 @@
 #include <open62541/server.h>
 
 #include "open62541_queue.h"
+#include "ziptree.h"
 #include "ua_securechannel.h"
 #include "ua_util_internal.h"
 #include "ua_workqueue.h"
@@ -23,11 +24,24 @@ _UA_BEGIN_DECLS
 typedef struct channel_entry {
     UA_DelayedCallback cleanupCallback;
     TAILQ_ENTRY(channel_entry) pointers;
+    ZIP_ENTRY(channel_entry) idZipfields;
+    ZIP_ENTRY(channel_entry) timeoutZipfields;
+    UA_UInt32 channelId; /* 0 until the channel is opened and indexed */
+    UA_DateTime timeout; /* When to check the channel next */
+    UA_Boolean removed;
     UA_SecureChannel channel;
 } channel_entry;
 
+ZIP_HEAD(UA_ChannelIdZip, channel_entry);
+typedef struct UA_ChannelIdZip UA_ChannelIdZip;
+
+ZIP_HEAD(UA_ChannelTimeoutZip, channel_entry);
+typedef struct UA_ChannelTimeoutZip UA_ChannelTimeoutZip;
+
 typedef struct {
     TAILQ_HEAD(, channel_entry) channels; // doubly-linked list of channels
+    UA_ChannelIdZip idIndex;           /* Open channels by ChannelId */
+    UA_ChannelTimeoutZip timeoutQueue; /* Channels ordered by the next check */
     UA_UInt32 currentChannelCount;
     UA_UInt32 lastChannelId;
     UA_UInt32 lastTokenId;
@@ -68,6 +82,13 @@ UA_SecureChannelManager_get(UA_SecureChannelManager *cm, UA_UInt32 channelId);
 UA_StatusCode
 UA_SecureChannelManager_close(UA_SecureChannelManager *cm, UA_UInt32 channelId);
 
+/* Removes the channel if it was closed or lost its connection. Called after
+ * the messages of a connection were processed and when the connection is
+ * removed. So the cleanup does not need to look at every channel. */
+void
+UA_SecureChannelManager_removeClosed(UA_SecureChannelManager *cm,
+                                     UA_SecureChannel *channel);
+
 _UA_END_DECLS
 
 #endif /* UA_CHANNEL_MANAGER_H_ */
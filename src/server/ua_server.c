@@ -101,6 +101,82 @@ UA_Server_getConfig(UA_Server *server)
   return &server->config;
 }
 
+void
+UA_Server_getValueCacheStatistics(UA_Server *server, UA_ValueCacheStatistics *stats) {
+    UA_LOCK(server->serviceMutex);
+    stats->hits = server->valueCache.hits;
+    stats->misses = server->valueCache.misses;
+    stats->entries = server->valueCache.entriesSize;
+    UA_UNLOCK(server->serviceMutex);
+}
+
+void
+UA_Server_getBrowsePathCacheStatistics(UA_Server *server,
+                                       UA_BrowsePathCacheStatistics *stats) {
+    UA_LOCK(server->serviceMutex);
+    stats->hits = server->browsePathCache.hits;
+    stats->misses = server->browsePathCache.misses;
+    stats->entries = server->browsePathCache.entriesSize;
+    UA_UNLOCK(server->serviceMutex);
+}
+
+void
+UA_Server_getRequestTimeoutStatistics(UA_Server *server,
+                                      UA_RequestTimeoutStatistics *stats) {
+    UA_LOCK(server->serviceMutex);
+    *stats = server->requestTimeouts;
+    UA_UNLOCK(server->serviceMutex);
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+static void
+getSlabPoolStatistics(const UA_SlabPool *pool, UA_SlabPoolStatistics *stats) {
+    stats->slabs = pool->slabsSize;
+    stats->inUse = pool->objectsInUse;
+    stats->free = pool->freeObjects;
+    stats->allocations = pool->allocations;
+}
+
+void
+UA_Server_getNotificationPoolStatistics(UA_Server *server,
+                                        UA_NotificationPoolStatistics *stats) {
+    UA_LOCK(server->serviceMutex);
+    getSlabPoolStatistics(&server->notificationPool, &stats->notifications);
+    getSlabPoolStatistics(&server->retransmissionPool, &stats->retransmissions);
+    stats->bufferReuses = server->notificationBufferReuses;
+    stats->bufferAllocations = server->notificationBufferAllocations;
+    UA_UNLOCK(server->serviceMutex);
+}
+#endif
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+void
+UA_Server_getEventIndexStatistics(UA_Server *server, UA_EventIndexStatistics *stats) {
+    UA_LOCK(server->serviceMutex);
+    stats->hits = server->eventIndex.hits;
+    stats->misses = server->eventIndex.misses;
+    stats->entries = server->eventIndex.entriesSize;
+    UA_UNLOCK(server->serviceMutex);
+}
+#endif
+
+#ifdef UA_ENABLE_NODESTORE_SWITCH
+UA_StatusCode
+UA_Server_setNamespaceNodestore(UA_Server *server, UA_UInt16 namespaceIndex,
+                                const UA_NodestoreInterface *backend) {
+    UA_LOCK(server->serviceMutex);
+    UA_StatusCode retval =
+        UA_NodestoreSwitch_setNamespace(server->nsCtx, namespaceIndex, backend);
+    /* The nodes of the previous backend are gone */
+    if(retval == UA_STATUSCODE_GOOD) {
+        UA_TypeHierarchy_invalidate(&server->typeHierarchy);
+        UA_BrowsePathCache_clear(&server->browsePathCache);
+    }
+    UA_UNLOCK(server->serviceMutex);
+    return retval;
+}
+#endif
+
 UA_StatusCode
 UA_Server_getNamespaceByName(UA_Server *server, const UA_String namespaceUri,
                              size_t* foundIndex) {
@@ -211,11 +287,30 @@ void UA_Server_delete(UA_Server *server) {
     /* Clean up the work queue */
     UA_WorkQueue_cleanup(&server->workQueue);
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /* All notifications are released with the subscriptions */
+    UA_SlabPool_clear(&server->notificationPool);
+    UA_SlabPool_clear(&server->retransmissionPool);
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    UA_EventIndex_clear(&server->eventIndex);
+#endif
+#endif
+
     /* Delete the timed work */
     UA_Timer_deleteMembers(&server->timer);
 
     /* Clean up the nodestore */
     UA_Nodestore_delete(server->nsCtx);
+    UA_TypeHierarchy_clear(&server->typeHierarchy);
+    UA_ValueCache_clear(&server->valueCache);
+    UA_BrowsePathCache_clear(&server->browsePathCache);
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    UA_Array_delete(server->virtualTypes, server->virtualTypesSize,
+                    &UA_TYPES[UA_TYPES_NODEID]);
+#endif
+#ifdef UA_ENABLE_STRING_INTERNING
+    UA_StringPool_clear(&server->stringPool);
+#endif
 
     /* Clean up the config */
     UA_ServerConfig_clean(&server->config);
@@ -300,6 +395,23 @@ UA_Server_init(UA_Server *server) {
     UA_Server_addRepeatedCallback(server, (UA_ServerCallback)UA_Server_cleanup, NULL,
                                   10000.0, NULL);
 
+#ifdef UA_ENABLE_STRING_INTERNING
+    UA_StringPool_init(&server->stringPool);
+#endif
+    UA_TypeHierarchy_init(&server->typeHierarchy);
+    UA_ValueCache_init(&server->valueCache);
+    UA_BrowsePathCache_init(&server->browsePathCache);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    ZIP_INIT(&server->samplers);
+    ZIP_INIT(&server->samplingGroups);
+    ZIP_INIT(&server->nodeMonitors);
+    UA_SlabPool_init(&server->notificationPool, sizeof(UA_Notification));
+    UA_SlabPool_init(&server->retransmissionPool, sizeof(UA_NotificationMessageEntry));
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    UA_EventIndex_init(&server->eventIndex);
+#endif
+#endif
+
     /* Initialize namespace 0*/
     UA_StatusCode retVal = UA_Nodestore_new(&server->nsCtx);
     if(retVal != UA_STATUSCODE_GOOD)
@@ -519,7 +631,7 @@ UA_Server_InsertMethodResponse(UA_Server *server, const UA_UInt32 nRequestId,
     }
 
     /* Add UA_CallMethodResult to UA_CallResponse */
-    UA_CallResponse* pResponse = &data->response;
+    UA_CallResponse* pResponse = &data->response.callResponse;
     UA_CallMethodResult_copy(response, pResponse->results + nIndex);
 
     /* Reduce the number of open results. Are we done yet with all requests? */
@@ -529,7 +641,7 @@ UA_Server_InsertMethodResponse(UA_Server *server, const UA_UInt32 nRequestId,
     
     /* Get the session */
     UA_LOCK(server->serviceMutex);
-    UA_Session* session = UA_SessionManager_getSessionById(&server->sessionManager, data->sessionId);
+    UA_Session* session = UA_SessionManager_getSessionById(&server->sessionManager, &data->sessionId);
     UA_UNLOCK(server->serviceMutex);
     if(!session) {
         UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER, "UA_Server_InsertMethodResponse: Session is gone");
@@ -547,13 +659,72 @@ UA_Server_InsertMethodResponse(UA_Server *server, const UA_UInt32 nRequestId,
 
     /* Okay, here we go, send the UA_CallResponse */
     sendResponse(channel, data->requestId, data->requestHandle,
-                 (UA_ResponseHeader*)&data->response.responseHeader, data->responseType);
+                 (UA_ResponseHeader*)&data->response, data->responseType);
     UA_LOG_DEBUG(&server->config.logger, UA_LOGCATEGORY_SERVER,
                  "UA_Server_SendResponse: Response for Req# %u sent", data->requestId);
     /* Remove this job from the UA_AsyncMethodManager */
     UA_AsyncMethodManager_removeEntry(&server->asyncMethodManager, data);
 }
 
+void
+UA_Server_InsertOperationResponse(UA_Server *server,
+                                  const struct AsyncMethodQueueElement *elem) {
+    UA_LOCK(server->serviceMutex);
+
+    /* Grab the open request */
+    asyncmethod_list_entry *data =
+        UA_AsyncMethodManager_getById(&server->asyncMethodManager,
+                                      elem->m_nRequestId, &elem->m_nSessionId);
+    if(!data || !data->results) {
+        UA_UNLOCK(server->serviceMutex);
+        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                       "UA_Server_InsertOperationResponse: can not find the request "
+                       "for Req# %u", elem->m_nRequestId);
+        return;
+    }
+
+    /* Set the operation result in the Read/Write response */
+    if(elem->m_type == UA_ASYNCOPERATIONTYPE_READ) {
+        UA_DataValue *result = &((UA_DataValue*)data->results)[elem->m_nIndex];
+        UA_DataValue_clear(result);
+        UA_StatusCode retval = UA_DataValue_copy(&elem->m_Response.readResult, result);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_DataValue_clear(result);
+            result->hasStatus = true;
+            result->status = retval;
+        } else if(result->hasValue) {
+            /* Only the value attribute is read asynchronously */
+            setReadTimestamps(result, data->timestampsToReturn, UA_ATTRIBUTEID_VALUE);
+        } else {
+            /* As for the synchronous Read, errors have no timestamps */
+            setReadTimestamps(result, UA_TIMESTAMPSTORETURN_NEITHER, UA_ATTRIBUTEID_VALUE);
+        }
+    } else {
+        ((UA_StatusCode*)data->results)[elem->m_nIndex] = elem->m_Response.writeResult;
+    }
+
+    /* Wait for more results or for the service to return */
+    data->nCountdown -= 1;
+    if(data->nCountdown > 0 || !data->serviceDone) {
+        UA_UNLOCK(server->serviceMutex);
+        return;
+    }
+
+    /* Send the response if the session and channel are still there */
+    UA_Session* session = UA_SessionManager_getSessionById(&server->sessionManager, &data->sessionId);
+    if(session && session->header.channel) {
+        sendResponse(session->header.channel, data->requestId, data->requestHandle,
+                     (UA_ResponseHeader*)&data->response, data->responseType);
+        UA_LOG_DEBUG(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                     "UA_Server_SendResponse: Response for Req# %u sent", data->requestId);
+    } else {
+        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                       "UA_Server_InsertOperationResponse: Session or channel is gone");
+    }
+    UA_AsyncMethodManager_removeEntry(&server->asyncMethodManager, data);
+    UA_UNLOCK(server->serviceMutex);
+}
+
 void
 UA_Server_CallMethodResponse(UA_Server *server, void* data) {
     /* Server fetches Result from queue */
@@ -561,8 +732,12 @@ UA_Server_CallMethodResponse(UA_Server *server, void* data) {
     while(UA_Server_GetAsyncMethodResult(server, &pResponseServer)) {
         UA_LOG_DEBUG(&server->config.logger, UA_LOGCATEGORY_SERVER,
                      "UA_Server_CallMethodResponse: Got Response: OKAY");
-        UA_Server_InsertMethodResponse(server, pResponseServer->m_nRequestId, &pResponseServer->m_nSessionId,
-                                       pResponseServer->m_nIndex, &pResponseServer->m_Response);
+        if(pResponseServer->m_type == UA_ASYNCOPERATIONTYPE_READ ||
+           pResponseServer->m_type == UA_ASYNCOPERATIONTYPE_WRITE)
+            UA_Server_InsertOperationResponse(server, pResponseServer);
+        else
+            UA_Server_InsertMethodResponse(server, pResponseServer->m_nRequestId, &pResponseServer->m_nSessionId,
+                                           pResponseServer->m_nIndex, &pResponseServer->m_Response.callMethodResult);
         UA_Server_DeleteMethodQueueElement(server, pResponseServer);
     }
 }
@@ -434,11 +434,24 @@ sendResponse(UA_SecureChannel *channel, UA_UInt32 requestId, UA_UInt32 requestHa
     return UA_MessageContext_finish(&mc);
 }
 
+/* Operations were skipped after the deadline of the request had passed */
+static void
+abortTimedOutRequest(UA_Server *server, UA_Session *session,
+                     UA_ResponseHeader *responseHeader) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    UA_LOG_DEBUG_SESSION(&server->config.logger, session,
+                         "The request timed out during processing");
+    server->requestTimeouts.aborted++;
+    session->requestTimedOut = false;
+    responseHeader->serviceResult = UA_STATUSCODE_BADTIMEOUT;
+}
+
 static UA_StatusCode
 processMSGDecoded(UA_Server *server, UA_SecureChannel *channel, UA_UInt32 requestId,
                   UA_Service service, const UA_RequestHeader *requestHeader,
                   const UA_DataType *requestType, UA_ResponseHeader *responseHeader,
-                  const UA_DataType *responseType, UA_Boolean sessionRequired) {
+                  const UA_DataType *responseType, UA_Boolean sessionRequired,
+                  UA_DateTime deadline) {
     /* CreateSession doesn't need a session */
     if(requestType == &UA_TYPES[UA_TYPES_CREATESESSIONREQUEST]) {
         UA_LOCK(server->serviceMutex);
@@ -539,6 +552,12 @@ processMSGDecoded(UA_Server *server, UA_SecureChannel *channel, UA_UInt32 reques
     /* Update the session lifetime */
     UA_Session_updateLifetime(session);
 
+    /* Long running services check the deadline */
+    UA_LOCK(server->serviceMutex);
+    session->requestDeadline = deadline;
+    session->requestTimedOut = false;
+    UA_UNLOCK(server->serviceMutex);
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     /* The publish request is not answered immediately */
     if(requestType == &UA_TYPES[UA_TYPES_PUBLISHREQUEST]) {
@@ -567,14 +586,74 @@ processMSGDecoded(UA_Server *server, UA_SecureChannel *channel, UA_UInt32 reques
                                 responseHeader, responseType);
         return UA_STATUSCODE_GOOD;
     }
+
+    /* Value reads and writes of async variables are queued. The response is
+     * sent once all queued operations are done. */
+    if(requestType == &UA_TYPES[UA_TYPES_READREQUEST] ||
+       requestType == &UA_TYPES[UA_TYPES_WRITEREQUEST]) {
+        struct AsyncOperationContextInternal context;
+        context.nRequestId = requestId;
+        context.nRequestHandle = requestHeader->requestHandle;
+        context.entry = NULL;
+        UA_LOCK(server->serviceMutex);
+        if(requestType == &UA_TYPES[UA_TYPES_READREQUEST])
+            Service_ReadAsync(server, session, &context,
+                              (const UA_ReadRequest*)requestHeader,
+                              (UA_ReadResponse*)responseHeader);
+        else
+            Service_WriteAsync(server, session, &context,
+                               (const UA_WriteRequest*)requestHeader,
+                               (UA_WriteResponse*)responseHeader);
+        if(session->requestTimedOut)
+            abortTimedOutRequest(server, session, responseHeader);
+
+        UA_StatusCode retval = UA_STATUSCODE_GOOD;
+        asyncmethod_list_entry *entry = context.entry;
+        UA_Boolean queued = (entry != NULL);
+        if(entry) {
+            /* Move the response into the entry */
+            memcpy(&entry->response, responseHeader, responseType->memSize);
+            UA_init(responseHeader, responseType);
+            entry->serviceDone = true;
+
+            /* All queued operations are already done */
+            if(entry->nCountdown == 0) {
+                retval = sendResponse(channel, requestId, requestHeader->requestHandle,
+                                      (UA_ResponseHeader*)&entry->response, responseType);
+                UA_AsyncMethodManager_removeEntry(&server->asyncMethodManager, entry);
+            }
+        } else {
+            retval = sendResponse(channel, requestId, requestHeader->requestHandle,
+                                  responseHeader, responseType);
+        }
+
+        /* The response is encoded or holds copies of the values */
+        if(session->pinnedNodesCount > 0)
+            UA_Session_releasePinnedNodes(server, session);
+        UA_UNLOCK(server->serviceMutex);
+
+        /* Notify outside of the service mutex */
+        if(queued && server->config.asyncOperationNotifyCallback)
+            server->config.asyncOperationNotifyCallback(server);
+        return retval;
+    }
 #endif
 
     /* Dispatch the synchronous service call and send the response */
     UA_LOCK(server->serviceMutex);
     service(server, session, requestHeader, responseHeader);
+    if(session->requestTimedOut)
+        abortTimedOutRequest(server, session, responseHeader);
     UA_UNLOCK(server->serviceMutex);
-    return sendResponse(channel, requestId, requestHeader->requestHandle,
-                        responseHeader, responseType);
+    UA_StatusCode retval = sendResponse(channel, requestId, requestHeader->requestHandle,
+                                        responseHeader, responseType);
+
+    /* The response is encoded. Release the nodes it pointed into. */
+    UA_LOCK(server->serviceMutex);
+    if(session->pinnedNodesCount > 0)
+        UA_Session_releasePinnedNodes(server, session);
+    UA_UNLOCK(server->serviceMutex);
+    return retval;
 }
 
 static UA_StatusCode
@@ -639,6 +718,25 @@ processMSG(UA_Server *server, UA_SecureChannel *channel,
         }
     }
 
+    /* Reject the request if the deadline from the timeoutHint has passed while
+     * it was waiting. The client has given up on the response already. */
+    UA_DateTime deadline = 0;
+    if(requestHeader->timeoutHint > 0) {
+        deadline = channel->messageReceiveTime +
+            (UA_DateTime)requestHeader->timeoutHint * UA_DATETIME_MSEC;
+        if(UA_DateTime_nowMonotonic() > deadline) {
+            UA_LOG_DEBUG_CHANNEL(&server->config.logger, channel,
+                                 "The request timed out before processing");
+            UA_LOCK(server->serviceMutex);
+            server->requestTimeouts.rejected++;
+            UA_UNLOCK(server->serviceMutex);
+            retval = sendServiceFaultWithRequest(channel, requestHeader, responseType,
+                                                 requestId, UA_STATUSCODE_BADTIMEOUT);
+            UA_clear(request, requestType);
+            return retval;
+        }
+    }
+
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     /* Set the authenticationToken from the create session request to help
      * fuzzing cover more lines */
@@ -654,7 +752,7 @@ processMSG(UA_Server *server, UA_SecureChannel *channel,
 
     /* Continue with the decoded Request */
     retval = processMSGDecoded(server, channel, requestId, service, requestHeader, requestType,
-                               responseHeader, responseType, sessionRequired);
+                               responseHeader, responseType, sessionRequired, deadline);
 
     /* Clean up */
     UA_clear(request, requestType);
@@ -835,9 +933,12 @@ UA_Server_processBinaryMessage(UA_Server *server, UA_Connection *connection,
     /* Process complete messages */
     UA_SecureChannel_processCompleteMessages(channel, server, processSecureChannelMessage);
 
-    /* Is the channel still open? */
-    if(channel->state == UA_SECURECHANNELSTATE_CLOSED)
+    /* Is the channel still open? Closed channels are removed right away
+     * instead of waiting for the next cleanup. */
+    if(channel->state == UA_SECURECHANNELSTATE_CLOSED) {
+        UA_SecureChannelManager_removeClosed(&server->secureChannelManager, channel);
         return;
+    }
 
     /* Store unused decoded chunks internally in the SecureChannel */
     UA_SecureChannel_persistIncompleteMessages(connection->channel);
@@ -852,7 +953,10 @@ deleteConnection(UA_Server *server, UA_Connection *connection) {
 
 void
 UA_Server_removeConnection(UA_Server *server, UA_Connection *connection) {
+    UA_SecureChannel *channel = connection->channel;
     UA_Connection_detachSecureChannel(connection);
+    if(channel)
+        UA_SecureChannelManager_removeClosed(&server->secureChannelManager, channel);
 #if UA_MULTITHREADING >= 200
     UA_DelayedCallback *dc = (UA_DelayedCallback*)UA_malloc(sizeof(UA_DelayedCallback));
     if(!dc)
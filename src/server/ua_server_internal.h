@@ -27,6 +27,12 @@
 #include "ua_timer.h"
 #include "ua_util_internal.h"
 #include "ua_workqueue.h"
+#include "ua_stringpool.h"
+#include "ua_typehierarchy.h"
+#include "ua_valuecache.h"
+#include "ua_browsepathcache.h"
+#include "ua_eventindex.h"
+#include "ua_slabpool.h"
 
 _UA_BEGIN_DECLS
 
@@ -64,8 +70,9 @@ typedef enum {
 
 #if UA_MULTITHREADING >= 100
 struct AsyncMethodQueueElement {
-        UA_CallMethodRequest m_Request;
-        UA_CallMethodResult	m_Response;
+        UA_AsyncOperationType m_type;
+        UA_AsyncOperationRequest m_Request;
+        UA_AsyncOperationResponse m_Response;
         UA_DateTime	m_tDispatchTime;
         UA_UInt32	m_nRequestId;
         UA_NodeId	m_nSessionId;
@@ -82,6 +89,13 @@ struct AsyncMethodQueueElement {
         const UA_CallRequest* pRequest;
         UA_SecureChannel* pChannel;
     };
+
+/* Read/Write request with operations on async variables */
+struct AsyncOperationContextInternal {
+    UA_UInt32 nRequestId;
+    UA_UInt32 nRequestHandle;
+    asyncmethod_list_entry *entry; /* Created for the first queued operation */
+};
 #endif	
 	
 struct UA_Server {
@@ -93,12 +107,35 @@ struct UA_Server {
 
     /* Nodestore */
     void *nsCtx;
+    UA_UInt64 nodestoreVersion; /* Incremented when a node is removed or
+                                 * replaced. Invalidates the cached nodes of
+                                 * the registered nodes in the sessions. */
+    UA_Boolean hasReadBatch; /* A DataSource with a batched read callback
+                              * was set. Enables the batching in the Read
+                              * service. */
+#if UA_MULTITHREADING >= 100
+    UA_Boolean hasAsyncVariables; /* A variable was marked as async. Enables
+                                   * the queueing of value writes. */
+#endif
+#ifdef UA_ENABLE_STRING_INTERNING
+    UA_StringPool stringPool; /* Shared strings of the node attributes */
+#endif
+    UA_TypeHierarchy typeHierarchy; /* Cached closure of the HasSubtype
+                                     * references */
+    UA_ValueCache valueCache; /* Last values read from DataSources */
+    UA_BrowsePathCache browsePathCache; /* Translated browse paths */
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    size_t virtualTypesSize;
+    UA_NodeId *virtualTypes; /* ObjectTypes with virtual instance children */
+#endif
 
     UA_ServerLifecycle state;
 
     /* Security */
     UA_SecureChannelManager secureChannelManager;
     UA_SessionManager sessionManager;
+    UA_RequestTimeoutStatistics requestTimeouts; /* Requests with a passed
+                                                  * timeoutHint */
 #if UA_MULTITHREADING >= 100
     UA_AsyncMethodManager asyncMethodManager;
 #endif
@@ -134,6 +171,17 @@ struct UA_Server {
     /* To be cast to UA_LocalMonitoredItem to get the callback and context */
     LIST_HEAD(LocalMonitoredItems, UA_MonitoredItem) localMonitoredItems;
     UA_UInt32 lastLocalMonitoredItemId;
+    UA_SamplerTree samplers; /* Shared sampling of MonitoredItems */
+    UA_SamplingGroupTree samplingGroups; /* Sampling grouped by the interval */
+    UA_NodeMonitorsTree nodeMonitors; /* MonitoredItems sampled on write */
+    UA_SlabPool notificationPool; /* UA_Notification */
+    UA_SlabPool retransmissionPool; /* UA_NotificationMessageEntry */
+    UA_UInt64 notificationBufferReuses;
+    UA_UInt64 notificationBufferAllocations;
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    UA_EventIndex eventIndex; /* MonitoredItems receiving the events of a
+                               * source node */
+#endif
 #endif
 
     /* Publish/Subscribe */
@@ -171,6 +219,27 @@ struct UA_Server {
 void UA_Node_deleteReferencesSubset(UA_Node *node, size_t referencesSkipSize,
                                     UA_NodeId* referencesSkip);
 
+/* Clears the BrowseName, DisplayName or Description attribute of the node.
+ * Takes care of interned strings. */
+void UA_Node_clearStringAttribute(UA_Node *node, UA_AttributeId attributeId);
+
+/* Adds many references to the node. The target array of every ReferenceType
+ * and direction grows only once. Duplicate references are skipped. */
+UA_StatusCode
+UA_Node_addReferences(UA_Node *node, size_t itemsSize,
+                      const UA_AddReferencesItem **items);
+
+#ifdef UA_ENABLE_STRING_INTERNING
+/* Replaces the standard attribute strings and the string NodeIds of the
+ * reference targets with their interned version. Strings that cannot be
+ * interned remain owned by the node. */
+void UA_Node_internStrings(UA_StringPool *pool, UA_Node *node);
+
+/* Interns the string NodeId of a newly added reference target */
+void UA_Node_internReferenceTarget(UA_StringPool *pool, UA_Node *node,
+                                   const UA_AddReferencesItem *item);
+#endif
+
 /* Calls the callback with the node retrieved from the nodestore on top of the
  * stack. Either a copy or the original node for in-situ editing. Depends on
  * multithreading and the nodestore.*/
@@ -181,6 +250,52 @@ UA_StatusCode UA_Server_editNode(UA_Server *server, UA_Session *session,
                                  UA_EditNodeCallback callback,
                                  void *data);
 
+#ifdef UA_ENABLE_VIRTUAL_NODES
+/* Instances of virtual types reference their children with virtual NodeIds.
+ * The nodes are created from the instance declaration when accessed. */
+UA_Boolean
+UA_VirtualNodes_isVirtualType(UA_Server *server, const UA_NodeId *typeId);
+
+UA_StatusCode
+UA_VirtualNodes_encodeId(const UA_NodeId *instanceId, const UA_NodeId *declarationId,
+                         UA_NodeId *outId);
+
+UA_Boolean
+UA_VirtualNodes_isVirtualNodeId(const UA_NodeId *nodeId);
+
+/* Returns the node from the nodestore or a temporary node for a virtual
+ * child. Release with UA_VirtualNodes_releaseNode. */
+const UA_Node *
+UA_VirtualNodes_getNode(UA_Server *server, const UA_NodeId *nodeId);
+
+void
+UA_VirtualNodes_releaseNode(UA_Server *server, const UA_Node *node);
+
+/* Inserts the node of a virtual child into the nodestore. Before it is
+ * written or referenced. Does nothing for other NodeIds. */
+UA_StatusCode
+UA_VirtualNodes_materialize(UA_Server *server, const UA_NodeId *nodeId);
+#endif
+
+/* Get a node for reading. Also resolves virtual children. */
+static UA_INLINE const UA_Node *
+getNodeOrVirtual(UA_Server *server, const UA_NodeId *nodeId) {
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    return UA_VirtualNodes_getNode(server, nodeId);
+#else
+    return UA_Nodestore_getNode(server->nsCtx, nodeId);
+#endif
+}
+
+static UA_INLINE void
+releaseNodeOrVirtual(UA_Server *server, const UA_Node *node) {
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    UA_VirtualNodes_releaseNode(server, node);
+#else
+    UA_Nodestore_releaseNode(server->nsCtx, node);
+#endif
+}
+
 /*********************/
 /* Utility Functions */
 /*********************/
@@ -195,12 +310,18 @@ UA_UInt16 addNamespace(UA_Server *server, const UA_String name);
 UA_Boolean
 UA_Node_hasSubTypeOrInstances(const UA_Node *node);
 
-/* Recursively searches "upwards" in the tree following specific reference types */
+/* Recursively searches "upwards" in the tree following specific reference
+ * types. Lookups in the HasSubtype hierarchy use the cached type hierarchy. */
 UA_Boolean
-isNodeInTree(void *nsCtx, const UA_NodeId *leafNode,
+isNodeInTree(UA_Server *server, const UA_NodeId *leafNode,
              const UA_NodeId *nodeToFind, const UA_NodeId *referenceTypeIds,
              size_t referenceTypeIdsSize);
 
+/* Returns the cached closure of the HasSubtype hierarchy. Rebuilds the cache
+ * if required. Returns NULL if the cache cannot be built. */
+const UA_TypeHierarchy *
+getTypeHierarchy(UA_Server *server);
+
 /* Returns an array with the hierarchy of nodes. The start nodes are returned as
  * well. The returned array starts at the leaf and continues "upwards" or
  * "downwards". Duplicate entries are removed. The parameter `walkDownwards`
@@ -236,6 +357,9 @@ void
 UA_Server_InsertMethodResponse(UA_Server *server, const UA_UInt32 nRequestId,
                                const UA_NodeId* nSessionId, const UA_UInt32 nIndex,
                                const UA_CallMethodResult* response);
+void
+UA_Server_InsertOperationResponse(UA_Server *server,
+                                  const struct AsyncMethodQueueElement *elem);
 void 
     UA_Server_CallMethodResponse(UA_Server *server, void* data);
 #endif
@@ -261,6 +385,23 @@ UA_Server_processServiceOperations(UA_Server *server, UA_Session *session,
                                    const UA_DataType *responseOperationsType)
     UA_FUNC_ATTR_WARN_UNUSED_RESULT;
 
+/* Large operation arrays are processed in parallel by the worker threads. The
+ * operations must not depend on each other. Without multithreading, this is
+ * UA_Server_processServiceOperations. */
+#if UA_MULTITHREADING >= 200
+UA_StatusCode
+UA_Server_processServiceOperationsParallel(UA_Server *server, UA_Session *session,
+                                           UA_ServiceOperation operationCallback,
+                                           const void *context,
+                                           const size_t *requestOperations,
+                                           const UA_DataType *requestOperationsType,
+                                           size_t *responseOperations,
+                                           const UA_DataType *responseOperationsType)
+    UA_FUNC_ATTR_WARN_UNUSED_RESULT;
+#else
+#define UA_Server_processServiceOperationsParallel UA_Server_processServiceOperations
+#endif
+
 UA_StatusCode
 UA_Server_processServiceOperationsAsync(UA_Server *server, UA_Session *session,
                                         UA_ServiceOperation operationCallback,
@@ -359,6 +500,49 @@ ReadWithNode(const UA_Node *node, UA_Server *server, UA_Session *session,
              UA_TimestampsToReturn timestampsToReturn,
              const UA_ReadValueId *id, UA_DataValue *v);
 
+/* Adds or removes the server and source timestamps of a read result as
+ * requested by the client */
+void
+setReadTimestamps(UA_DataValue *v, UA_TimestampsToReturn timestampsToReturn,
+                  UA_UInt32 attributeId);
+
+/* Value read by a batched DataSource callback ahead of the read operation */
+typedef struct {
+    UA_Boolean done;
+    UA_StatusCode retval;
+    UA_DataValue value;
+} UA_PrefetchedValue;
+
+/* Same as ReadWithNode. But values of DataSource variables that are not older
+ * than maxAge (in ms) are taken from the value cache. If the prefetched value
+ * is done, it is moved into the result instead of calling the DataSource. */
+void
+ReadWithNodeMaxAge(const UA_Node *node, UA_Server *server, UA_Session *session,
+                   UA_TimestampsToReturn timestampsToReturn, UA_Double maxAge,
+                   UA_PrefetchedValue *prefetched, const UA_ReadValueId *id,
+                   UA_DataValue *v);
+
+/* Reads the DataSource variables with a batched read callback ahead of the
+ * individual reads. All variables with the same callback and session are read
+ * in a single call. The ReadValueIds are read with the session at the same
+ * index of the sessions array, or with the session if the array is NULL.
+ * Values that can be taken from the value cache (see maxAge) are not read.
+ * Returns NULL if less than two variables can be read in a batch. Otherwise
+ * the array has an entry for every ReadValueId. */
+UA_PrefetchedValue *
+prefetchBatchedReads(UA_Server *server, UA_Session *session, UA_Session **sessions,
+                     size_t idsSize, const UA_ReadValueId *ids,
+                     UA_Double maxAge, UA_Boolean sourceTimeStamp);
+
+/* Clears the values that were not used and frees the array. Can be NULL. */
+void
+UA_PrefetchedValues_delete(UA_PrefetchedValue *prefetched, size_t prefetchedSize);
+
+/* Returns BadNotReadable or BadUserAccessDenied if the session cannot read the
+ * value of the node */
+UA_StatusCode
+checkValueReadAccess(UA_Server *server, UA_Session *session, const UA_Node *node);
+
 UA_StatusCode
 readValueAttribute(UA_Server *server, UA_Session *session,
                    const UA_VariableNode *vn, UA_DataValue *v);
@@ -12,6 +12,23 @@
 
 #if UA_MULTITHREADING >= 100
 
+/* Read and write operations that timed out are answered through the response
+ * queue. They are inserted into the response under the service mutex that must
+ * not be taken while the queue lock is held. */
+static void
+timeoutAsyncOperation(UA_Server *server, struct AsyncMethodQueueElement *elem) {
+    if(elem->m_type == UA_ASYNCOPERATIONTYPE_READ) {
+        UA_DataValue_clear(&elem->m_Response.readResult);
+        elem->m_Response.readResult.hasStatus = true;
+        elem->m_Response.readResult.status = UA_STATUSCODE_BADREQUESTTIMEOUT;
+    } else {
+        elem->m_Response.writeResult = UA_STATUSCODE_BADREQUESTTIMEOUT;
+    }
+    UA_LOCK(server->ua_response_queue_lock);
+    SIMPLEQ_INSERT_TAIL(&server->ua_method_response_queue, elem, next);
+    UA_UNLOCK(server->ua_response_queue_lock);
+}
+
 /* Initialize Request Queue */
 void
 UA_Server_MethodQueues_init(UA_Server *server) {
@@ -101,8 +118,13 @@ UA_Server_CheckQueueIntegrity(UA_Server *server, void *data) {
                     request_elem->m_nRequestId, server->config.asyncOperationTimeout);
                 SIMPLEQ_REMOVE_HEAD(&server->ua_method_request_queue, next);
                 server->nMQCurSize--;
+                if(request_elem->m_type == UA_ASYNCOPERATIONTYPE_READ ||
+                   request_elem->m_type == UA_ASYNCOPERATIONTYPE_WRITE) {
+                    timeoutAsyncOperation(server, request_elem);
+                    continue;
+                }
                 /* Notify that we removed this request - e.g. Bad Call Response (UA_STATUSCODE_BADREQUESTTIMEOUT) */
-                UA_CallMethodResult* result = &request_elem->m_Response;
+                UA_CallMethodResult* result = &request_elem->m_Response.callMethodResult;
                 UA_CallMethodResult_clear(result);
                 result->statusCode = UA_STATUSCODE_BADREQUESTTIMEOUT;
                 UA_Server_InsertMethodResponse(server, request_elem->m_nRequestId, &request_elem->m_nSessionId, request_elem->m_nIndex, result);
@@ -133,8 +155,13 @@ UA_Server_CheckQueueIntegrity(UA_Server *server, void *data) {
                     "UA_Server_CheckQueueIntegrity: Pending request #%u was removed due to a timeout (%f)",
                     request_elem->m_nRequestId, server->config.asyncOperationTimeout);
                 SIMPLEQ_REMOVE_HEAD(&server->ua_method_pending_list, next);
+                if(request_elem->m_type == UA_ASYNCOPERATIONTYPE_READ ||
+                   request_elem->m_type == UA_ASYNCOPERATIONTYPE_WRITE) {
+                    timeoutAsyncOperation(server, request_elem);
+                    continue;
+                }
                 /* Notify that we removed this request - e.g. Bad Call Response (UA_STATUSCODE_BADREQUESTTIMEOUT) */
-                UA_CallMethodResult* result = &request_elem->m_Response;
+                UA_CallMethodResult* result = &request_elem->m_Response.callMethodResult;
                 UA_CallMethodResult_clear(result);
                 result->statusCode = UA_STATUSCODE_BADREQUESTTIMEOUT;
                 UA_Server_InsertMethodResponse(server, request_elem->m_nRequestId, &request_elem->m_nSessionId, request_elem->m_nIndex, result);
@@ -167,8 +194,9 @@ UA_Server_SetNextAsyncMethod(UA_Server *server,
         struct AsyncMethodQueueElement* elem = (struct AsyncMethodQueueElement*)UA_calloc(1, sizeof(struct AsyncMethodQueueElement));
         if (elem)
         {
-            UA_CallMethodRequest_init(&elem->m_Request);
-            result = UA_CallMethodRequest_copy(pRequest, &elem->m_Request);
+            elem->m_type = UA_ASYNCOPERATIONTYPE_CALL;
+            UA_CallMethodRequest_init(&elem->m_Request.callMethodRequest);
+            result = UA_CallMethodRequest_copy(pRequest, &elem->m_Request.callMethodRequest);
             if (result != UA_STATUSCODE_GOOD) {
                 UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_SERVER,
                     "UA_Server_SetAsyncMethodResult: UA_CallMethodRequest_copy failed.");                
@@ -177,7 +205,7 @@ UA_Server_SetNextAsyncMethod(UA_Server *server,
             elem->m_nRequestId = nRequestId;
             elem->m_nSessionId = *nSessionId;
             elem->m_nIndex = nIndex;
-            UA_CallMethodResult_clear(&elem->m_Response);
+            UA_CallMethodResult_clear(&elem->m_Response.callMethodResult);
             elem->m_tDispatchTime = UA_DateTime_now();
             UA_LOCK(server->ua_request_queue_lock);
             SIMPLEQ_INSERT_TAIL(&server->ua_method_request_queue, elem, next);
@@ -203,6 +231,54 @@ UA_Server_SetNextAsyncMethod(UA_Server *server,
     return result;
 }
 
+/* Enqueue next read or write operation */
+UA_StatusCode
+UA_Server_SetNextAsyncOperation(UA_Server *server,
+    const UA_AsyncOperationType type,
+    const UA_UInt32 nRequestId,
+    const UA_NodeId *nSessionId,
+    const UA_UInt32 nIndex,
+    const void *pRequest) {
+    if(server->config.maxAsyncOperationQueueSize != 0 &&
+       server->nMQCurSize >= server->config.maxAsyncOperationQueueSize) {
+        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+            "UA_Server_SetNextAsyncOperation: Queue exceeds limit (%d).",
+                       (UA_UInt32)server->config.maxAsyncOperationQueueSize);
+        return UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+
+    struct AsyncMethodQueueElement* elem = (struct AsyncMethodQueueElement*)
+        UA_calloc(1, sizeof(struct AsyncMethodQueueElement));
+    if(!elem) {
+        UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_SERVER,
+            "UA_Server_SetNextAsyncOperation: Mem alloc failed.");
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+
+    UA_StatusCode result;
+    elem->m_type = type;
+    if(type == UA_ASYNCOPERATIONTYPE_READ)
+        result = UA_ReadValueId_copy((const UA_ReadValueId*)pRequest,
+                                     &elem->m_Request.readValueId);
+    else
+        result = UA_WriteValue_copy((const UA_WriteValue*)pRequest,
+                                    &elem->m_Request.writeValue);
+    if(result != UA_STATUSCODE_GOOD) {
+        UA_free(elem);
+        return result;
+    }
+
+    elem->m_nRequestId = nRequestId;
+    elem->m_nSessionId = *nSessionId;
+    elem->m_nIndex = nIndex;
+    elem->m_tDispatchTime = UA_DateTime_now();
+    UA_LOCK(server->ua_request_queue_lock);
+    SIMPLEQ_INSERT_TAIL(&server->ua_method_request_queue, elem, next);
+    server->nMQCurSize++;
+    UA_UNLOCK(server->ua_request_queue_lock);
+    return UA_STATUSCODE_GOOD;
+}
+
 /* Private API */
 /* Get next Method Call Response */
 UA_Boolean
@@ -221,8 +297,19 @@ UA_Server_GetAsyncMethodResult(UA_Server *server, struct AsyncMethodQueueElement
 /* Deep delete queue Element - only memory we did allocate */
 void
 UA_Server_DeleteMethodQueueElement(UA_Server *server, struct AsyncMethodQueueElement *pElem) {
-    UA_CallMethodRequest_clear(&pElem->m_Request);
-    UA_CallMethodResult_clear(&pElem->m_Response);
+    switch(pElem->m_type) {
+    case UA_ASYNCOPERATIONTYPE_READ:
+        UA_ReadValueId_clear(&pElem->m_Request.readValueId);
+        UA_DataValue_clear(&pElem->m_Response.readResult);
+        break;
+    case UA_ASYNCOPERATIONTYPE_WRITE:
+        UA_WriteValue_clear(&pElem->m_Request.writeValue);
+        break;
+    default:
+        UA_CallMethodRequest_clear(&pElem->m_Request.callMethodRequest);
+        UA_CallMethodResult_clear(&pElem->m_Response.callMethodResult);
+        break;
+    }
     UA_free(pElem);
 }
 
@@ -286,7 +373,7 @@ UA_Server_getAsyncOperation(UA_Server *server, UA_AsyncOperationType *type,
         SIMPLEQ_REMOVE_HEAD(&server->ua_method_request_queue, next);
         server->nMQCurSize--;
         if (elem) {
-            *request = (UA_AsyncOperationRequest*)&elem->m_Request;
+            *request = &elem->m_Request;
             *context = (void*)elem;            
             bRV = UA_TRUE;
         }
@@ -297,7 +384,7 @@ UA_Server_getAsyncOperation(UA_Server *server, UA_AsyncOperationType *type,
     }
     UA_UNLOCK(server->ua_request_queue_lock);
     if (bRV && elem) {
-        *type = UA_ASYNCOPERATIONTYPE_CALL;
+        *type = elem->m_type;
         UA_Server_AddPendingMethodCall(server, elem);
     }
     return bRV;
@@ -320,14 +407,32 @@ UA_Server_setAsyncOperationResult(UA_Server *server,
         * otherwise we can run into a deadlock */
         UA_Server_RmvPendingMethodCall(server, elem);
 
-        UA_StatusCode result = UA_CallMethodResult_copy(&response->callMethodResult,
-                                                        &elem->m_Response);
-        if (result != UA_STATUSCODE_GOOD) {
-            UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_SERVER,
-                "UA_Server_SetAsyncMethodResult: UA_CallMethodResult_copy failed.");
-            /* Add failed CallMethodResult to response queue */
-            UA_CallMethodResult_clear(&elem->m_Response);
-            elem->m_Response.statusCode = UA_STATUSCODE_BADOUTOFMEMORY;
+        UA_StatusCode result = UA_STATUSCODE_GOOD;
+        switch(elem->m_type) {
+        case UA_ASYNCOPERATIONTYPE_READ:
+            result = UA_DataValue_copy(&response->readResult, &elem->m_Response.readResult);
+            if(result != UA_STATUSCODE_GOOD) {
+                UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                    "UA_Server_SetAsyncMethodResult: UA_DataValue_copy failed.");
+                UA_DataValue_clear(&elem->m_Response.readResult);
+                elem->m_Response.readResult.hasStatus = true;
+                elem->m_Response.readResult.status = UA_STATUSCODE_BADOUTOFMEMORY;
+            }
+            break;
+        case UA_ASYNCOPERATIONTYPE_WRITE:
+            elem->m_Response.writeResult = response->writeResult;
+            break;
+        default:
+            result = UA_CallMethodResult_copy(&response->callMethodResult,
+                                              &elem->m_Response.callMethodResult);
+            if (result != UA_STATUSCODE_GOOD) {
+                UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                    "UA_Server_SetAsyncMethodResult: UA_CallMethodResult_copy failed.");
+                /* Add failed CallMethodResult to response queue */
+                UA_CallMethodResult_clear(&elem->m_Response.callMethodResult);
+                elem->m_Response.callMethodResult.statusCode = UA_STATUSCODE_BADOUTOFMEMORY;
+            }
+            break;
         }
         /* Insert response in queue */
         UA_LOCK(server->ua_response_queue_lock);
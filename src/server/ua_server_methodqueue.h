@@ -79,6 +79,26 @@ UA_StatusCode UA_Server_SetNextAsyncMethod(UA_Server *server,
     const UA_UInt32 nIndex,
     const UA_CallMethodRequest* pRequest);
 
+/* Enqueue the next read or write operation. Unlike for method calls, the
+* asyncOperationNotifyCallback is not called. The Read and Write services run
+* under the service mutex and notify once the request is processed.
+*
+* @param server The server object
+* @param type UA_ASYNCOPERATIONTYPE_READ or UA_ASYNCOPERATIONTYPE_WRITE
+* @param Pointer to UA_NodeId (pSessionIdentifier)
+* @param UA_UInt32 (unique requestId/server)
+* @param Index of the operation within the request
+* @param Pointer to UA_ReadValueId or UA_WriteValue
+* @return UA_STATUSCODE_GOOD if the operation was enqueued,
+    UA_STATUSCODE_BADUNEXPECTEDERROR if queue full
+*	UA_STATUSCODE_BADOUTOFMEMORY if no memory available */
+UA_StatusCode UA_Server_SetNextAsyncOperation(UA_Server *server,
+    const UA_AsyncOperationType type,
+    const UA_UInt32 nRequestId,
+    const UA_NodeId *nSessionId,
+    const UA_UInt32 nIndex,
+    const void *pRequest);
+
 /* Get next Method Call Response, user has to call 'UA_DeleteMethodQueueElement(...)' to cleanup memory
 *
 * @param server The server object
@@ -93,11 +93,63 @@ isNodeInTreeNoCircular(void *nsCtx, const UA_NodeId *leafNode, const UA_NodeId *
     return false;
 }
 
+typedef struct {
+    UA_TypeHierarchy *th;
+    UA_StatusCode retval;
+} AddSubtypesContext;
+
+static void
+addSubtypesVisitor(void *context, const UA_Node *node) {
+    AddSubtypesContext *ctx = (AddSubtypesContext*)context;
+    for(size_t i = 0; i < node->referencesSize; ++i) {
+        UA_NodeReferenceKind *refs = &node->references[i];
+        if(!UA_NodeId_equal(&refs->referenceTypeId, &subtypeId))
+            continue;
+        for(size_t j = 0; j < refs->refTargetsSize; ++j) {
+            const UA_NodeId *target = &refs->refTargets[j].target.nodeId;
+            UA_StatusCode res;
+            if(refs->isInverse)
+                res = UA_TypeHierarchy_addSubtype(ctx->th, target, &node->nodeId);
+            else
+                res = UA_TypeHierarchy_addSubtype(ctx->th, &node->nodeId, target);
+            if(res != UA_STATUSCODE_GOOD)
+                ctx->retval = res;
+        }
+    }
+}
+
+const UA_TypeHierarchy *
+getTypeHierarchy(UA_Server *server) {
+    UA_TypeHierarchy *th = &server->typeHierarchy;
+    if(th->valid)
+        return th;
+
+    /* Rebuild from the HasSubtype references in the nodestore */
+    UA_TypeHierarchy_invalidate(th);
+    AddSubtypesContext ctx = {th, UA_STATUSCODE_GOOD};
+    UA_Nodestore_iterate(server->nsCtx, addSubtypesVisitor, &ctx);
+    if(ctx.retval != UA_STATUSCODE_GOOD) {
+        UA_TypeHierarchy_invalidate(th);
+        return NULL;
+    }
+    if(UA_TypeHierarchy_validate(th) != UA_STATUSCODE_GOOD)
+        return NULL;
+    return th;
+}
+
 UA_Boolean
-isNodeInTree(void *nsCtx, const UA_NodeId *leafNode, const UA_NodeId *nodeToFind,
+isNodeInTree(UA_Server *server, const UA_NodeId *leafNode, const UA_NodeId *nodeToFind,
              const UA_NodeId *referenceTypeIds, size_t referenceTypeIdsSize) {
+    /* Use the cached closure of the type hierarchy */
+    if(referenceTypeIdsSize == 1 &&
+       UA_NodeId_equal(&referenceTypeIds[0], &subtypeId)) {
+        const UA_TypeHierarchy *th = getTypeHierarchy(server);
+        if(th)
+            return UA_TypeHierarchy_isSubtype(th, leafNode, nodeToFind);
+    }
+
     struct ref_history visitedRefs = {NULL, leafNode, 0};
-    return isNodeInTreeNoCircular(nsCtx, leafNode, nodeToFind, &visitedRefs,
+    return isNodeInTreeNoCircular(server->nsCtx, leafNode, nodeToFind, &visitedRefs,
                                   referenceTypeIds, referenceTypeIdsSize);
 }
 
@@ -260,6 +312,7 @@ UA_Server_editNode(UA_Server *server, UA_Session *session,
         /* Replace the node */
         retval = UA_Nodestore_replaceNode(server->nsCtx, node);
     } while(retval != UA_STATUSCODE_GOOD);
+    server->nodestoreVersion++;
     return retval;
 #endif
 }
@@ -293,6 +346,91 @@ UA_Server_processServiceOperations(UA_Server *server, UA_Session *session,
     return UA_STATUSCODE_GOOD;
 }
 
+#if UA_MULTITHREADING >= 200
+
+/* The operations are split into slices that are processed by the worker
+ * threads and the calling thread. The service mutex is taken for every
+ * operation separately. So the operations of a large request interleave with
+ * each other and with other services. */
+typedef struct {
+    UA_Session *session;
+    UA_ServiceOperation operationCallback;
+    const void *context;
+    uintptr_t reqOps;
+    uintptr_t respOps;
+    size_t reqOpSize;
+    size_t respOpSize;
+    size_t ops;
+    size_t sliceSize;
+} ParallelOperations;
+
+static void
+processOperationsSlice(UA_Server *server, ParallelOperations *po, size_t slice) {
+    size_t begin = slice * po->sliceSize;
+    size_t end = begin + po->sliceSize;
+    if(end > po->ops)
+        end = po->ops;
+    for(size_t i = begin; i < end; i++) {
+        UA_LOCK(server->serviceMutex);
+        po->operationCallback(server, po->session, po->context,
+                              (void*)(po->reqOps + (i * po->reqOpSize)),
+                              (void*)(po->respOps + (i * po->respOpSize)));
+        UA_UNLOCK(server->serviceMutex);
+    }
+}
+
+UA_StatusCode
+UA_Server_processServiceOperationsParallel(UA_Server *server, UA_Session *session,
+                                           UA_ServiceOperation operationCallback,
+                                           const void *context,
+                                           const size_t *requestOperations,
+                                           const UA_DataType *requestOperationsType,
+                                           size_t *responseOperations,
+                                           const UA_DataType *responseOperationsType) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+
+    /* Process small requests in the calling thread */
+    size_t ops = *requestOperations;
+    size_t workers = server->workQueue.workersSize;
+    if(workers == 0 || server->config.parallelOperationsThreshold == 0 ||
+       ops < server->config.parallelOperationsThreshold)
+        return UA_Server_processServiceOperations(server, session, operationCallback,
+                                                  context, requestOperations,
+                                                  requestOperationsType,
+                                                  responseOperations,
+                                                  responseOperationsType);
+
+    /* No padding after size_t */
+    void **respPos = (void**)((uintptr_t)responseOperations + sizeof(size_t));
+    *respPos = UA_Array_new(ops, responseOperationsType);
+    if(!(*respPos))
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    *responseOperations = ops;
+
+    ParallelOperations po;
+    po.session = session;
+    po.operationCallback = operationCallback;
+    po.context = context;
+    po.reqOps = *(uintptr_t*)((uintptr_t)requestOperations + sizeof(size_t));
+    po.respOps = (uintptr_t)*respPos;
+    po.reqOpSize = requestOperationsType->memSize;
+    po.respOpSize = responseOperationsType->memSize;
+    po.ops = ops;
+
+    /* Several slices per thread to balance slow DataSources */
+    size_t threads = workers + 1;
+    po.sliceSize = (ops + (threads * 4) - 1) / (threads * 4);
+    size_t slices = (ops + po.sliceSize - 1) / po.sliceSize;
+
+    UA_UNLOCK(server->serviceMutex);
+    UA_WorkQueue_processSlices(&server->workQueue, (UA_SliceCallback)processOperationsSlice,
+                               server, &po, slices);
+    UA_LOCK(server->serviceMutex);
+    return UA_STATUSCODE_GOOD;
+}
+
+#endif
+
 #if UA_MULTITHREADING >= 100
 
 /* this is a copy of the above + contest.nIndex is set :-( Any ideas for a better solution? */
@@ -315,6 +315,21 @@ void Service_Read(UA_Server *server, UA_Session *session,
 void Service_Write(UA_Server *server, UA_Session *session,
                    const UA_WriteRequest *request, UA_WriteResponse *response);
 
+#if UA_MULTITHREADING >= 100
+/* Read and Write with the value operations on async variables added to the
+ * async operation queue. If operations were queued, context->entry is set and
+ * the response must be moved into the entry. */
+struct AsyncOperationContextInternal;
+
+void Service_ReadAsync(UA_Server *server, UA_Session *session,
+                       struct AsyncOperationContextInternal *context,
+                       const UA_ReadRequest *request, UA_ReadResponse *response);
+
+void Service_WriteAsync(UA_Server *server, UA_Session *session,
+                        struct AsyncOperationContextInternal *context,
+                        const UA_WriteRequest *request, UA_WriteResponse *response);
+#endif
+
 /**
  * HistoryRead Service
  * ^^^^^^^^^^^^^^^^^^^
@@ -22,6 +22,10 @@
 #include "ua_types_encoding_binary.h"
 #include "ua_services.h"
 
+#if UA_MULTITHREADING >= 100
+#include "ua_server_methodqueue.h"
+#endif
+
 #ifdef UA_ENABLE_HISTORIZING
 #include <open62541/plugin/historydatabase.h>
 #endif
@@ -66,6 +70,23 @@ getUserAccessLevel(UA_Server *server, const UA_Session *session,
     return retval;
 }
 
+UA_StatusCode
+checkValueReadAccess(UA_Server *server, UA_Session *session, const UA_Node *node) {
+    /* VariableTypes don't have the AccessLevel concept. Always allow reading
+     * the value. */
+    if(node->nodeClass != UA_NODECLASS_VARIABLE)
+        return UA_STATUSCODE_GOOD;
+
+    /* The access to a value variable is granted via the AccessLevel and
+     * UserAccessLevel attributes */
+    const UA_VariableNode *vn = (const UA_VariableNode*)node;
+    if(!(getAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_READ))
+        return UA_STATUSCODE_BADNOTREADABLE;
+    if(!(getUserAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_READ))
+        return UA_STATUSCODE_BADUSERACCESSDENIED;
+    return UA_STATUSCODE_GOOD;
+}
+
 static UA_Boolean
 getUserExecutable(UA_Server *server, const UA_Session *session,
                   const UA_MethodNode *node) {
@@ -107,10 +128,22 @@ readIsAbstractAttribute(const UA_Node *node, UA_Variant *v) {
     return UA_Variant_setScalarCopy(v, isAbstract, &UA_TYPES[UA_TYPES_BOOLEAN]);
 }
 
+/* Options of the Read service for reading the value attribute. The other
+ * internal reads use no options. */
+typedef struct {
+    UA_Boolean mayBorrow; /* The value may point into the node */
+    UA_Boolean borrowed;  /* The value points into the node. The node must be
+                           * kept until the value is no longer used. */
+    UA_PrefetchedValue *prefetched; /* Moved into the value instead of calling
+                                  * the DataSource */
+    UA_Double maxAge; /* in ms. DataSource values up to this age are taken
+                       * from the value cache. */
+} ReadValueOptions;
+
 static UA_StatusCode
 readValueAttributeFromNode(UA_Server *server, UA_Session *session,
                            const UA_VariableNode *vn, UA_DataValue *v,
-                           UA_NumericRange *rangeptr) {
+                           UA_NumericRange *rangeptr, ReadValueOptions *options) {
     /* Update the value by the user callback */
     if(vn->value.data.callback.onRead) {
         UA_UNLOCK(server->serviceMutex);
@@ -118,7 +151,7 @@ readValueAttributeFromNode(UA_Server *server, UA_Session *session,
                                        session->sessionHandle, &vn->nodeId,
                                        vn->context, rangeptr, &vn->value.data.value);
         UA_LOCK(server->serviceMutex);
-        vn = (const UA_VariableNode*)UA_Nodestore_getNode(server->nsCtx, &vn->nodeId);
+        vn = (const UA_VariableNode*)getNodeOrVirtual(server, &vn->nodeId);
         if(!vn)
             return UA_STATUSCODE_BADNODEIDUNKNOWN;
     }
@@ -126,23 +159,29 @@ readValueAttributeFromNode(UA_Server *server, UA_Session *session,
     /* Set the result */
     if(rangeptr)
         return UA_Variant_copyRange(&vn->value.data.value.value, &v->value, *rangeptr);
+#ifdef UA_ENABLE_IMMUTABLE_NODES
+    /* Without the callback, vn is the node that the caller holds */
+    if(options && options->mayBorrow && !vn->value.data.callback.onRead) {
+        *v = vn->value.data.value;
+        v->value.storageType = UA_VARIANT_DATA_NODELETE;
+        options->borrowed = true;
+        return UA_STATUSCODE_GOOD;
+    }
+#endif
     UA_StatusCode retval = UA_DataValue_copy(&vn->value.data.value, v);
 
     /* Clean up */
     if(vn->value.data.callback.onRead)
-        UA_Nodestore_releaseNode(server->nsCtx, (const UA_Node *)vn);
+        releaseNodeOrVirtual(server, (const UA_Node *)vn);
     return retval;
 }
 
 static UA_StatusCode
-readValueAttributeFromDataSource(UA_Server *server, UA_Session *session,
-                                 const UA_VariableNode *vn, UA_DataValue *v,
-                                 UA_TimestampsToReturn timestamps,
-                                 UA_NumericRange *rangeptr) {
+callDataSourceRead(UA_Server *server, UA_Session *session,
+                   const UA_VariableNode *vn, UA_DataValue *v,
+                   UA_Boolean sourceTimeStamp, UA_NumericRange *rangeptr) {
     if(!vn->value.dataSource.read)
         return UA_STATUSCODE_BADINTERNALERROR;
-    UA_Boolean sourceTimeStamp = (timestamps == UA_TIMESTAMPSTORETURN_SOURCE ||
-                                  timestamps == UA_TIMESTAMPSTORETURN_BOTH);
     UA_DataValue v2;
     UA_DataValue_init(&v2);
     UA_UNLOCK(server->serviceMutex);
@@ -159,10 +198,51 @@ readValueAttributeFromDataSource(UA_Server *server, UA_Session *session,
     return retval;
 }
 
+static UA_StatusCode
+readValueAttributeFromDataSource(UA_Server *server, UA_Session *session,
+                                 const UA_VariableNode *vn, UA_DataValue *v,
+                                 UA_TimestampsToReturn timestamps,
+                                 UA_NumericRange *rangeptr, ReadValueOptions *options) {
+    /* Only the complete value is cached */
+    UA_Boolean useCache = (server->config.valueCacheSize > 0 && !rangeptr);
+    UA_StatusCode retval;
+
+    if(options && options->prefetched) {
+        /* The value was already read in a batch */
+        *v = options->prefetched->value;
+        UA_DataValue_init(&options->prefetched->value);
+        retval = options->prefetched->retval;
+    } else {
+        /* Take the value from the cache */
+        if(useCache && options && options->maxAge > 0.0) {
+            retval = UA_ValueCache_get(&server->valueCache, &vn->nodeId,
+                                       (UA_DateTime)(options->maxAge * UA_DATETIME_MSEC),
+                                       UA_DateTime_nowMonotonic(), v);
+            if(retval != UA_STATUSCODE_BADNOTFOUND)
+                return retval;
+        }
+
+        /* Cached values always get the source timestamp. Otherwise a later
+         * read from the cache would set the current time as the source
+         * timestamp. */
+        UA_Boolean sourceTimeStamp = (useCache ||
+                                      timestamps == UA_TIMESTAMPSTORETURN_SOURCE ||
+                                      timestamps == UA_TIMESTAMPSTORETURN_BOTH);
+        retval = callDataSourceRead(server, session, vn, v, sourceTimeStamp, rangeptr);
+    }
+
+    /* Failing to cache the value does not fail the read */
+    if(useCache && retval == UA_STATUSCODE_GOOD)
+        UA_ValueCache_store(&server->valueCache, server->config.valueCacheSize,
+                            &vn->nodeId, UA_DateTime_nowMonotonic(), v);
+    return retval;
+}
+
 static UA_StatusCode
 readValueAttributeComplete(UA_Server *server, UA_Session *session,
                            const UA_VariableNode *vn, UA_TimestampsToReturn timestamps,
-                           const UA_String *indexRange, UA_DataValue *v) {
+                           const UA_String *indexRange, UA_DataValue *v,
+                           ReadValueOptions *options) {
     /* Compute the index range */
     UA_NumericRange range;
     UA_NumericRange *rangeptr = NULL;
@@ -176,9 +256,10 @@ readValueAttributeComplete(UA_Server *server, UA_Session *session,
 
     /* Read the value */
     if(vn->valueSource == UA_VALUESOURCE_DATA)
-        retval = readValueAttributeFromNode(server, session, vn, v, rangeptr);
+        retval = readValueAttributeFromNode(server, session, vn, v, rangeptr, options);
     else
-        retval = readValueAttributeFromDataSource(server, session, vn, v, timestamps, rangeptr);
+        retval = readValueAttributeFromDataSource(server, session, vn, v, timestamps,
+                                                  rangeptr, options);
 
     /* Clean up */
     if(rangeptr)
@@ -189,7 +270,8 @@ readValueAttributeComplete(UA_Server *server, UA_Session *session,
 UA_StatusCode
 readValueAttribute(UA_Server *server, UA_Session *session,
                    const UA_VariableNode *vn, UA_DataValue *v) {
-    return readValueAttributeComplete(server, session, vn, UA_TIMESTAMPSTORETURN_NEITHER, NULL, v);
+    return readValueAttributeComplete(server, session, vn, UA_TIMESTAMPSTORETURN_NEITHER,
+                                      NULL, v, NULL);
 }
 
 static const UA_String binEncoding = {sizeof("Default Binary")-1, (UA_Byte*)"Default Binary"};
@@ -251,13 +333,39 @@ getStructureDefinition(const UA_DataType *type, UA_StructureDefinition *def) {
 }
 #endif
 
-/* Returns a datavalue that may point into the node via the
- * UA_VARIANT_DATA_NODELETE tag. Don't access the returned DataValue once the
- * node has been released! */
 void
-ReadWithNode(const UA_Node *node, UA_Server *server, UA_Session *session,
+setReadTimestamps(UA_DataValue *v, UA_TimestampsToReturn timestampsToReturn,
+                  UA_UInt32 attributeId) {
+    /* Create server timestamp */
+    if(timestampsToReturn == UA_TIMESTAMPSTORETURN_SERVER ||
+       timestampsToReturn == UA_TIMESTAMPSTORETURN_BOTH) {
+        if (!v->hasServerTimestamp) {
+            v->serverTimestamp = UA_DateTime_now();
+            v->hasServerTimestamp = true;
+        }
+    } else {
+        /* In case the ServerTimestamp has been set manually */
+        v->hasServerTimestamp = false;
+        v->hasServerPicoseconds = false;
+    }
+
+    /* Handle source time stamp */
+    if(attributeId == UA_ATTRIBUTEID_VALUE) {
+        if(timestampsToReturn == UA_TIMESTAMPSTORETURN_SERVER ||
+           timestampsToReturn == UA_TIMESTAMPSTORETURN_NEITHER) {
+            v->hasSourceTimestamp = false;
+            v->hasSourcePicoseconds = false;
+        } else if(!v->hasSourceTimestamp) {
+            v->sourceTimestamp = UA_DateTime_now();
+            v->hasSourceTimestamp = true;
+        }
+    }
+}
+
+static void
+readWithNode(const UA_Node *node, UA_Server *server, UA_Session *session,
              UA_TimestampsToReturn timestampsToReturn,
-             const UA_ReadValueId *id, UA_DataValue *v) {
+             const UA_ReadValueId *id, UA_DataValue *v, ReadValueOptions *options) {
     UA_LOG_DEBUG_SESSION(&server->config.logger, session,
                          "Read the attribute %i", id->attributeId);
 
@@ -336,24 +444,11 @@ ReadWithNode(const UA_Node *node, UA_Server *server, UA_Session *session,
         break;
     case UA_ATTRIBUTEID_VALUE: {
         CHECK_NODECLASS(UA_NODECLASS_VARIABLE | UA_NODECLASS_VARIABLETYPE);
-        /* VariableTypes don't have the AccessLevel concept. Always allow reading the value. */
-        if(node->nodeClass == UA_NODECLASS_VARIABLE) {
-            /* The access to a value variable is granted via the AccessLevel
-             * and UserAccessLevel attributes */
-            UA_Byte accessLevel = getAccessLevel(server, session, (const UA_VariableNode*)node);
-            if(!(accessLevel & (UA_ACCESSLEVELMASK_READ))) {
-                retval = UA_STATUSCODE_BADNOTREADABLE;
-                break;
-            }
-            accessLevel = getUserAccessLevel(server, session,
-                                             (const UA_VariableNode*)node);
-            if(!(accessLevel & (UA_ACCESSLEVELMASK_READ))) {
-                retval = UA_STATUSCODE_BADUSERACCESSDENIED;
-                break;
-            }
-        }
+        retval = checkValueReadAccess(server, session, node);
+        if(retval != UA_STATUSCODE_GOOD)
+            break;
         retval = readValueAttributeComplete(server, session, (const UA_VariableNode*)node,
-                                            timestampsToReturn, &id->indexRange, v);
+                                            timestampsToReturn, &id->indexRange, v, options);
         break;
     }
     case UA_ATTRIBUTEID_DATATYPE:
@@ -438,51 +533,355 @@ ReadWithNode(const UA_Node *node, UA_Server *server, UA_Session *session,
     }
 
     v->hasValue = true;
+    setReadTimestamps(v, timestampsToReturn, id->attributeId);
+}
 
-    /* Create server timestamp */
-    if(timestampsToReturn == UA_TIMESTAMPSTORETURN_SERVER ||
-       timestampsToReturn == UA_TIMESTAMPSTORETURN_BOTH) {
-        if (!v->hasServerTimestamp) {
-            v->serverTimestamp = UA_DateTime_now();
-            v->hasServerTimestamp = true;
-        }
-    } else {
-        /* In case the ServerTimestamp has been set manually */
-        v->hasServerTimestamp = false;
+/* Returns a datavalue that may point into the node via the
+ * UA_VARIANT_DATA_NODELETE tag. Don't access the returned DataValue once the
+ * node has been released! */
+void
+ReadWithNode(const UA_Node *node, UA_Server *server, UA_Session *session,
+             UA_TimestampsToReturn timestampsToReturn,
+             const UA_ReadValueId *id, UA_DataValue *v) {
+    readWithNode(node, server, session, timestampsToReturn, id, v, NULL);
+}
+
+void
+ReadWithNodeMaxAge(const UA_Node *node, UA_Server *server, UA_Session *session,
+                   UA_TimestampsToReturn timestampsToReturn, UA_Double maxAge,
+                   UA_PrefetchedValue *prefetched, const UA_ReadValueId *id,
+                   UA_DataValue *v) {
+    ReadValueOptions options;
+    memset(&options, 0, sizeof(ReadValueOptions));
+    options.maxAge = maxAge;
+    if(prefetched && prefetched->done)
+        options.prefetched = prefetched;
+    readWithNode(node, server, session, timestampsToReturn, id, v, &options);
+}
+
+/* A DataSource variable that is read in a batch */
+typedef struct {
+    const UA_VariableNode *node;
+    UA_Session *session;
+    size_t index; /* Of the ReadValueId */
+    UA_Boolean hasRange;
+    UA_NumericRange range;
+    UA_Boolean done;
+} BatchedRead;
+
+static UA_Boolean
+isBatchedRead(UA_Server *server, UA_Session *session, const UA_Node *node) {
+    if(node->nodeClass != UA_NODECLASS_VARIABLE)
+        return false;
+    const UA_VariableNode *vn = (const UA_VariableNode*)node;
+    if(vn->valueSource != UA_VALUESOURCE_DATASOURCE || !vn->readBatch)
+        return false;
+#if UA_MULTITHREADING >= 100
+    if(vn->async)
+        return false;
+#endif
+    if(!(getAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_READ))
+        return false;
+    return (getUserAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_READ);
+}
+
+/* Calls the batched read callback once for all reads with the same callback
+ * and session as reads[first] */
+static void
+readBatch(UA_Server *server, UA_Boolean sourceTimeStamp,
+          BatchedRead *reads, size_t readsSize, size_t first,
+          UA_DataSourceReadItem *items, UA_DataValue *values,
+          size_t *itemReads, UA_PrefetchedValue *prefetched) {
+    UA_DataSourceReadBatch batch = reads[first].node->readBatch;
+    UA_Session *session = reads[first].session;
+    size_t itemsSize = 0;
+    for(size_t i = first; i < readsSize; i++) {
+        BatchedRead *br = &reads[i];
+        if(br->done || br->node->readBatch != batch || br->session != session)
+            continue;
+        br->done = true;
+        items[itemsSize].nodeId = &br->node->nodeId;
+        items[itemsSize].nodeContext = br->node->context;
+        items[itemsSize].range = (br->hasRange) ? &br->range : NULL;
+        itemReads[itemsSize] = i;
+        itemsSize++;
     }
 
-    /* Handle source time stamp */
-    if(id->attributeId == UA_ATTRIBUTEID_VALUE) {
-        if(timestampsToReturn == UA_TIMESTAMPSTORETURN_SERVER ||
-           timestampsToReturn == UA_TIMESTAMPSTORETURN_NEITHER) {
-            v->hasSourceTimestamp = false;
-            v->hasSourcePicoseconds = false;
-        } else if(!v->hasSourceTimestamp) {
-            v->sourceTimestamp = UA_DateTime_now();
-            v->hasSourceTimestamp = true;
+    UA_UNLOCK(server->serviceMutex);
+    UA_StatusCode retval = batch(server, &session->sessionId, session->sessionHandle,
+                                 sourceTimeStamp, itemsSize, items, values);
+    UA_LOCK(server->serviceMutex);
+
+    for(size_t i = 0; i < itemsSize; i++) {
+        UA_PrefetchedValue *pv = &prefetched[reads[itemReads[i]].index];
+        pv->done = true;
+        pv->retval = retval;
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_DataValue_init(&values[i]); /* The values are not released */
+            continue;
         }
+        /* The memory of the DataSource can be reused in the next callback */
+        if(values[i].hasValue && values[i].value.storageType == UA_VARIANT_DATA_NODELETE)
+            pv->retval = UA_DataValue_copy(&values[i], &pv->value);
+        else
+            pv->value = values[i];
+        UA_DataValue_init(&values[i]);
     }
 }
 
+UA_PrefetchedValue *
+prefetchBatchedReads(UA_Server *server, UA_Session *session, UA_Session **sessions,
+                     size_t idsSize, const UA_ReadValueId *ids,
+                     UA_Double maxAge, UA_Boolean sourceTimeStamp) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    if(!server->hasReadBatch || idsSize < 2)
+        return NULL;
+
+    BatchedRead *reads = (BatchedRead*)UA_calloc(idsSize, sizeof(BatchedRead));
+    if(!reads)
+        return NULL;
+
+    /* Values that can be taken from the cache are not read in the batch */
+    UA_Boolean useCache = (server->config.valueCacheSize > 0 && maxAge > 0.0);
+    UA_DateTime maxAgeDt = (UA_DateTime)(maxAge * UA_DATETIME_MSEC);
+    UA_DateTime now = UA_DateTime_nowMonotonic();
+
+    /* Collect the reads */
+    size_t readsSize = 0;
+    for(size_t i = 0; i < idsSize; i++) {
+        const UA_ReadValueId *rvi = &ids[i];
+        UA_Session *s = (sessions) ? sessions[i] : session;
+        if(!s || rvi->attributeId != UA_ATTRIBUTEID_VALUE ||
+           (rvi->dataEncoding.name.length > 0 &&
+            !UA_String_equal(&binEncoding, &rvi->dataEncoding.name)))
+            continue;
+        const UA_Node *node =
+            getNodeOrVirtual(server, UA_Session_resolveNodeId(s, &rvi->nodeId));
+        if(!node)
+            continue;
+        BatchedRead *br = &reads[readsSize];
+        if(!isBatchedRead(server, s, node) ||
+           (useCache && rvi->indexRange.length == 0 &&
+            UA_ValueCache_isFresh(&server->valueCache, &node->nodeId, maxAgeDt, now))) {
+            releaseNodeOrVirtual(server, node);
+            continue;
+        }
+        if(rvi->indexRange.length > 0) {
+            if(UA_NumericRange_parseFromString(&br->range, &rvi->indexRange) !=
+               UA_STATUSCODE_GOOD) {
+                releaseNodeOrVirtual(server, node);
+                continue;
+            }
+            br->hasRange = true;
+        }
+        br->node = (const UA_VariableNode*)node;
+        br->session = s;
+        br->index = i;
+        readsSize++;
+    }
+
+    /* Call the batched callbacks */
+    UA_PrefetchedValue *prefetched = NULL;
+    UA_DataSourceReadItem *items = NULL;
+    UA_DataValue *values = NULL;
+    size_t *itemReads = NULL;
+    if(readsSize < 2)
+        goto cleanup;
+    prefetched = (UA_PrefetchedValue*)UA_calloc(idsSize, sizeof(UA_PrefetchedValue));
+    items = (UA_DataSourceReadItem*)UA_calloc(readsSize, sizeof(UA_DataSourceReadItem));
+    values = (UA_DataValue*)UA_Array_new(readsSize, &UA_TYPES[UA_TYPES_DATAVALUE]);
+    itemReads = (size_t*)UA_calloc(readsSize, sizeof(size_t));
+    if(!prefetched || !items || !values || !itemReads) {
+        UA_free(prefetched);
+        prefetched = NULL;
+        goto cleanup;
+    }
+    /* Cached values always get the source timestamp */
+    if(server->config.valueCacheSize > 0)
+        sourceTimeStamp = true;
+    for(size_t i = 0; i < readsSize; i++) {
+        if(!reads[i].done)
+            readBatch(server, sourceTimeStamp, reads, readsSize, i,
+                      items, values, itemReads, prefetched);
+    }
+
+ cleanup:
+    for(size_t i = 0; i < readsSize; i++) {
+        releaseNodeOrVirtual(server, (const UA_Node*)reads[i].node);
+        if(reads[i].hasRange)
+            UA_free(reads[i].range.dimensions);
+    }
+    UA_free(reads);
+    UA_free(items);
+    if(values)
+        UA_Array_delete(values, readsSize, &UA_TYPES[UA_TYPES_DATAVALUE]);
+    UA_free(itemReads);
+    return prefetched;
+}
+
+void
+UA_PrefetchedValues_delete(UA_PrefetchedValue *prefetched, size_t prefetchedSize) {
+    if(!prefetched)
+        return;
+    for(size_t i = 0; i < prefetchedSize; i++)
+        UA_DataValue_clear(&prefetched[i].value);
+    UA_free(prefetched);
+}
+
+typedef struct {
+    const UA_ReadRequest *request;
+    UA_PrefetchedValue *prefetched; /* NULL or one entry per operation */
+#if UA_MULTITHREADING >= 100
+    struct AsyncOperationContextInternal *async; /* NULL for internal reads */
+#endif
+} ReadServiceContext;
+
+#if UA_MULTITHREADING >= 100
+
+/* Adds the operation to the async operation queue. The entry for the response
+ * is created with the first queued operation of the request. */
+static UA_StatusCode
+queueAsyncOperation(UA_Server *server, UA_Session *session,
+                    struct AsyncOperationContextInternal *async,
+                    UA_AsyncOperationType type, const UA_DataType *responseType,
+                    const void *operation, void *results, size_t index) {
+    if(!async->entry) {
+        async->entry =
+            UA_AsyncMethodManager_createOperationEntry(&server->asyncMethodManager,
+                                                       &session->sessionId,
+                                                       async->nRequestId,
+                                                       async->nRequestHandle,
+                                                       responseType, results);
+        if(!async->entry)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    UA_StatusCode retval =
+        UA_Server_SetNextAsyncOperation(server, type, async->nRequestId,
+                                        &session->sessionId, (UA_UInt32)index,
+                                        operation);
+    if(retval == UA_STATUSCODE_GOOD)
+        async->entry->nCountdown++;
+    return retval;
+}
+
+/* Reads of the value attribute of async variables are queued if the variable
+ * is readable and the value cannot be taken from the value cache */
+static UA_Boolean
+isAsyncRead(UA_Server *server, UA_Session *session, const UA_Node *node,
+            const UA_ReadValueId *rvi, UA_Double maxAge) {
+    if(rvi->attributeId != UA_ATTRIBUTEID_VALUE ||
+       node->nodeClass != UA_NODECLASS_VARIABLE)
+        return false;
+    const UA_VariableNode *vn = (const UA_VariableNode*)node;
+    if(!vn->async)
+        return false;
+    if(!(getAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_READ) ||
+       !(getUserAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_READ))
+        return false;
+    if(server->config.valueCacheSize > 0 && maxAge > 0.0 &&
+       rvi->indexRange.length == 0 &&
+       UA_ValueCache_isFresh(&server->valueCache, &node->nodeId,
+                             (UA_DateTime)(maxAge * UA_DATETIME_MSEC),
+                             UA_DateTime_nowMonotonic()))
+        return false;
+    return true;
+}
+
+static void
+queueAsyncRead(UA_Server *server, UA_Session *session, ReadServiceContext *ctx,
+               const UA_Node *node, const UA_ReadValueId *rvi,
+               UA_DataValue *result) {
+    /* Queue with the resolved NodeId (shallow copy) */
+    UA_ReadValueId resolved = *rvi;
+    resolved.nodeId = node->nodeId;
+    size_t index = (size_t)(rvi - ctx->request->nodesToRead);
+    UA_StatusCode retval =
+        queueAsyncOperation(server, session, ctx->async, UA_ASYNCOPERATIONTYPE_READ,
+                            &UA_TYPES[UA_TYPES_READRESPONSE], &resolved,
+                            result - index, index);
+    /* The timestamps are added when the result is set */
+    if(ctx->async->entry)
+        ctx->async->entry->timestampsToReturn = ctx->request->timestampsToReturn;
+    /* Overwritten when the result is set */
+    result->hasStatus = true;
+    result->status = (retval == UA_STATUSCODE_GOOD) ? UA_STATUSCODE_BADTIMEOUT : retval;
+}
+
+#endif
+
 static void
-Operation_Read(UA_Server *server, UA_Session *session, UA_ReadRequest *request,
+Operation_Read(UA_Server *server, UA_Session *session, ReadServiceContext *ctx,
                UA_ReadValueId *rvi, UA_DataValue *result) {
-    /* Get the node */
-    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &rvi->nodeId);
+    if(UA_Session_checkDeadline(session)) {
+        result->hasStatus = true;
+        result->status = UA_STATUSCODE_BADTIMEOUT;
+        return;
+    }
 
-    /* Perform the read operation */
+    ReadValueOptions options;
+    memset(&options, 0, sizeof(ReadValueOptions));
+    options.maxAge = ctx->request->maxAge;
+    if(ctx->prefetched) {
+        UA_PrefetchedValue *pv = &ctx->prefetched[rvi - ctx->request->nodesToRead];
+        if(pv->done)
+            options.prefetched = pv;
+    }
+    UA_TimestampsToReturn timestamps = ctx->request->timestampsToReturn;
+
+    /* Registered nodes are cached in the session */
+    const UA_Node *node = UA_Session_getRegisteredNode(server, session, &rvi->nodeId);
     if(node) {
-        ReadWithNode(node, server, session, request->timestampsToReturn, rvi, result);
-        UA_Nodestore_releaseNode(server->nsCtx, node);
-    } else {
+#if UA_MULTITHREADING >= 100
+        if(ctx->async && isAsyncRead(server, session, node, rvi, options.maxAge)) {
+            queueAsyncRead(server, session, ctx, node, rvi, result);
+            return;
+        }
+#endif
+        readWithNode(node, server, session, timestamps, rvi, result, &options);
+        return;
+    }
+
+    node = getNodeOrVirtual(server, UA_Session_resolveNodeId(session, &rvi->nodeId));
+    if(!node) {
         result->hasStatus = true;
         result->status = UA_STATUSCODE_BADNODEIDUNKNOWN;
+        return;
+    }
+
+#if UA_MULTITHREADING >= 100
+    if(ctx->async && isAsyncRead(server, session, node, rvi, options.maxAge)) {
+        queueAsyncRead(server, session, ctx, node, rvi, result);
+        releaseNodeOrVirtual(server, node);
+        return;
     }
+#endif
+
+#ifdef UA_ENABLE_IMMUTABLE_NODES
+    /* Zero-copy read. The value points into the node that stays pinned in the
+     * session until the response is encoded. Nodes are replaced and not edited
+     * in place. So the pinned node is not changed by later writes. */
+    options.mayBorrow = true;
+#endif
+    readWithNode(node, server, session, timestamps, rvi, result, &options);
+    if(options.borrowed) {
+        if(UA_Session_pinNode(session, node) == UA_STATUSCODE_GOOD)
+            return; /* The session takes over the node reference */
+
+        /* Copy the value if the node cannot be pinned */
+        UA_DataValue borrowedValue = *result;
+        UA_StatusCode retval = UA_DataValue_copy(&borrowedValue, result);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_DataValue_init(result);
+            result->hasStatus = true;
+            result->status = retval;
+        }
+    }
+    releaseNodeOrVirtual(server, node);
 }
 
-void
-Service_Read(UA_Server *server, UA_Session *session,
-             const UA_ReadRequest *request, UA_ReadResponse *response) {
+static void
+readService(UA_Server *server, UA_Session *session, ReadServiceContext *ctx,
+            const UA_ReadRequest *request, UA_ReadResponse *response) {
     UA_LOG_DEBUG_SESSION(&server->config.logger, session, "Processing ReadRequest");
     UA_LOCK_ASSERT(server->serviceMutex, 1);
 
@@ -507,12 +906,61 @@ Service_Read(UA_Server *server, UA_Session *session,
 
     UA_LOCK_ASSERT(server->serviceMutex, 1);
 
+    ctx->request = request;
+    UA_Boolean sourceTimeStamp =
+        (request->timestampsToReturn == UA_TIMESTAMPSTORETURN_SOURCE ||
+         request->timestampsToReturn == UA_TIMESTAMPSTORETURN_BOTH);
+    ctx->prefetched = prefetchBatchedReads(server, session, NULL,
+                                           request->nodesToReadSize,
+                                           request->nodesToRead, request->maxAge,
+                                           sourceTimeStamp);
+
     response->responseHeader.serviceResult =
-        UA_Server_processServiceOperations(server, session, (UA_ServiceOperation)Operation_Read,
-                                           request,
-                                           &request->nodesToReadSize, &UA_TYPES[UA_TYPES_READVALUEID],
-                                           &response->resultsSize, &UA_TYPES[UA_TYPES_DATAVALUE]);
+        UA_Server_processServiceOperationsParallel(server, session, (UA_ServiceOperation)Operation_Read,
+                                                   ctx,
+                                                   &request->nodesToReadSize, &UA_TYPES[UA_TYPES_READVALUEID],
+                                                   &response->resultsSize, &UA_TYPES[UA_TYPES_DATAVALUE]);
+
+    /* Clean up the prefetched values that were not used */
+    UA_PrefetchedValues_delete(ctx->prefetched, request->nodesToReadSize);
+}
+
+void
+Service_Read(UA_Server *server, UA_Session *session,
+             const UA_ReadRequest *request, UA_ReadResponse *response) {
+    ReadServiceContext ctx;
+    memset(&ctx, 0, sizeof(ReadServiceContext));
+    readService(server, session, &ctx, request, response);
+}
+
+#if UA_MULTITHREADING >= 100
+void
+Service_ReadAsync(UA_Server *server, UA_Session *session,
+                  struct AsyncOperationContextInternal *context,
+                  const UA_ReadRequest *request, UA_ReadResponse *response) {
+    ReadServiceContext ctx;
+    memset(&ctx, 0, sizeof(ReadServiceContext));
+    ctx.async = context;
+    readService(server, session, &ctx, request, response);
+    if(!context->entry)
+        return;
+
+    /* The response is sent after the pinned nodes are released. Copy the
+     * values that point into the nodes. */
+    for(size_t i = 0; i < response->resultsSize; i++) {
+        UA_DataValue *result = &response->results[i];
+        if(!result->hasValue || result->value.storageType != UA_VARIANT_DATA_NODELETE)
+            continue;
+        UA_DataValue borrowedValue = *result;
+        UA_StatusCode retval = UA_DataValue_copy(&borrowedValue, result);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_DataValue_init(result);
+            result->hasStatus = true;
+            result->status = retval;
+        }
+    }
 }
+#endif
 
 UA_DataValue
 UA_Server_readWithSession(UA_Server *server, UA_Session *session,
@@ -521,8 +969,15 @@ UA_Server_readWithSession(UA_Server *server, UA_Session *session,
     UA_DataValue dv;
     UA_DataValue_init(&dv);
 
+    /* Registered nodes are cached in the session */
+    const UA_Node *node = UA_Session_getRegisteredNode(server, session, &item->nodeId);
+    if(node) {
+        ReadWithNode(node, server, session, timestampsToReturn, item, &dv);
+        return dv;
+    }
+
     /* Get the node */
-    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &item->nodeId);
+    node = getNodeOrVirtual(server, UA_Session_resolveNodeId(session, &item->nodeId));
     if(!node) {
         dv.hasStatus = true;
         dv.status = UA_STATUSCODE_BADNODEIDUNKNOWN;
@@ -533,7 +988,7 @@ UA_Server_readWithSession(UA_Server *server, UA_Session *session,
     ReadWithNode(node, server, session, timestampsToReturn, item, &dv);
 
     /* Release the node and return */
-    UA_Nodestore_releaseNode(server->nsCtx, node);
+    releaseNodeOrVirtual(server, node);
     return dv;
 }
 
@@ -668,12 +1123,12 @@ compatibleDataType(UA_Server *server, const UA_NodeId *dataType,
         return true;
 
     /* Is the value-type a subtype of the required type? */
-    if(isNodeInTree(server->nsCtx, dataType, constraintDataType, &subtypeId, 1))
+    if(isNodeInTree(server, dataType, constraintDataType, &subtypeId, 1))
         return true;
 
     /* Enum allows Int32 (only) */
     if(UA_NodeId_equal(dataType, &UA_TYPES[UA_TYPES_INT32].typeId) &&
-       isNodeInTree(server->nsCtx, constraintDataType, &enumNodeId, &subtypeId, 1))
+       isNodeInTree(server, constraintDataType, &enumNodeId, &subtypeId, 1))
         return true;
 
     /* More checks for the data type of real values (variants) */
@@ -685,7 +1140,7 @@ compatibleDataType(UA_Server *server, const UA_NodeId *dataType,
         if(dataType->namespaceIndex == 0 &&
            dataType->identifierType == UA_NODEIDTYPE_NUMERIC &&
            dataType->identifier.numeric <= 25 &&
-           isNodeInTree(server->nsCtx, constraintDataType,
+           isNodeInTree(server, constraintDataType,
                         dataType, &subtypeId, 1))
             return true;
     }
@@ -1068,8 +1523,45 @@ writeDataTypeAttribute(UA_Server *server, UA_Session *session,
     return UA_STATUSCODE_GOOD;
 }
 
+/* Same type and dimensions. Then the new value passes the same type checks
+ * as the current value. */
+static UA_Boolean
+sameValueShape(const UA_Variant *current, const UA_Variant *v) {
+    if(!current->type || current->type != v->type ||
+       current->arrayLength != v->arrayLength ||
+       UA_Variant_isScalar(current) != UA_Variant_isScalar(v) ||
+       current->arrayDimensionsSize != v->arrayDimensionsSize)
+        return false;
+    for(size_t i = 0; i < v->arrayDimensionsSize; i++) {
+        if(current->arrayDimensions[i] != v->arrayDimensions[i])
+            return false;
+    }
+    return true;
+}
+
 static UA_StatusCode
 writeValueAttributeWithoutRange(UA_VariableNode *node, const UA_DataValue *value) {
+    /* Overwrite a same-shaped value of a pointer-free type in place. This
+     * saves the free and malloc for high-frequency updates. */
+    UA_DataValue *current = &node->value.data.value;
+    if(value->hasValue && current->hasValue &&
+       current->value.storageType == UA_VARIANT_DATA &&
+       current->value.data > UA_EMPTY_ARRAY_SENTINEL &&
+       sameValueShape(&current->value, &value->value) &&
+       current->value.type->pointerFree) {
+        if(current->value.data != value->value.data) {
+            size_t length = current->value.arrayLength;
+            if(UA_Variant_isScalar(&current->value))
+                length = 1;
+            memcpy(current->value.data, value->value.data,
+                   length * current->value.type->memSize);
+        }
+        UA_Variant currentVariant = current->value;
+        *current = *value;
+        current->value = currentVariant;
+        return UA_STATUSCODE_GOOD;
+    }
+
     UA_DataValue new_value;
     UA_StatusCode retval = UA_DataValue_copy(value, &new_value);
     if(retval != UA_STATUSCODE_GOOD)
@@ -1122,7 +1614,7 @@ writeValueAttributeWithRange(UA_VariableNode *node, const UA_DataValue *value,
 static UA_StatusCode
 writeValueAttribute(UA_Server *server, UA_Session *session,
                     UA_VariableNode *node, const UA_DataValue *value,
-                    const UA_String *indexRange) {
+                    const UA_String *indexRange, UA_Boolean skipSameShapeCheck) {
     UA_assert(node != NULL);
 
     /* Parse the range */
@@ -1140,8 +1632,17 @@ writeValueAttribute(UA_Server *server, UA_Session *session,
      * "container". */
     UA_DataValue adjustedValue = *value;
 
+    /* The current value has already been checked against the variable. So a
+     * value with the same type and dimensions needs no check. */
+    UA_Boolean checkType = true;
+    if(skipSameShapeCheck && !rangeptr &&
+       node->valueSource == UA_VALUESOURCE_DATA &&
+       node->value.data.value.hasValue &&
+       sameValueShape(&node->value.data.value.value, &value->value))
+        checkType = false;
+
     /* Type checking. May change the type of editableValue */
-    if(value->hasValue && value->value.type) {
+    if(checkType && value->hasValue && value->value.type) {
         adjustValue(server, &adjustedValue.value, &node->dataType);
 
         /* The value may be an extension object, especially the nodeset compiler
@@ -1211,6 +1712,8 @@ writeValueAttribute(UA_Server *server, UA_Session *session,
                                                   session->sessionHandle, &node->nodeId,
                                                   node->context, rangeptr, &adjustedValue);
             UA_LOCK(server->serviceMutex);
+            /* The cached value is outdated */
+            UA_ValueCache_remove(&server->valueCache, &node->nodeId);
         } else {
             retval = UA_STATUSCODE_BADWRITENOTSUPPORTED;
         }
@@ -1305,19 +1808,20 @@ copyAttributeIntoNode(UA_Server *server, UA_Session *session,
     case UA_ATTRIBUTEID_BROWSENAME:
         CHECK_USERWRITEMASK(UA_WRITEMASK_BROWSENAME);
         CHECK_DATATYPE_SCALAR(QUALIFIEDNAME);
-        UA_QualifiedName_clear(&node->browseName);
+        UA_Node_clearStringAttribute(node, UA_ATTRIBUTEID_BROWSENAME);
         UA_QualifiedName_copy((const UA_QualifiedName *)value, &node->browseName);
+        UA_BrowsePathCache_invalidate(&server->browsePathCache, &node->nodeId);
         break;
     case UA_ATTRIBUTEID_DISPLAYNAME:
         CHECK_USERWRITEMASK(UA_WRITEMASK_DISPLAYNAME);
         CHECK_DATATYPE_SCALAR(LOCALIZEDTEXT);
-        UA_LocalizedText_clear(&node->displayName);
+        UA_Node_clearStringAttribute(node, UA_ATTRIBUTEID_DISPLAYNAME);
         UA_LocalizedText_copy((const UA_LocalizedText *)value, &node->displayName);
         break;
     case UA_ATTRIBUTEID_DESCRIPTION:
         CHECK_USERWRITEMASK(UA_WRITEMASK_DESCRIPTION);
         CHECK_DATATYPE_SCALAR(LOCALIZEDTEXT);
-        UA_LocalizedText_clear(&node->description);
+        UA_Node_clearStringAttribute(node, UA_ATTRIBUTEID_DESCRIPTION);
         UA_LocalizedText_copy((const UA_LocalizedText *)value, &node->description);
         break;
     case UA_ATTRIBUTEID_WRITEMASK:
@@ -1380,7 +1884,7 @@ copyAttributeIntoNode(UA_Server *server, UA_Session *session,
             CHECK_USERWRITEMASK(UA_WRITEMASK_VALUEFORVARIABLETYPE);
         }
         retval = writeValueAttribute(server, session, (UA_VariableNode*)node,
-                                     &wvalue->value, &wvalue->indexRange);
+                                     &wvalue->value, &wvalue->indexRange, false);
         break;
     case UA_ATTRIBUTEID_DATATYPE:
         CHECK_NODECLASS_WRITE(UA_NODECLASS_VARIABLE | UA_NODECLASS_VARIABLETYPE);
@@ -1445,17 +1949,94 @@ copyAttributeIntoNode(UA_Server *server, UA_Session *session,
     return retval;
 }
 
+static UA_StatusCode
+editNodeAttribute(UA_Server *server, UA_Session *session, const UA_WriteValue *wv) {
+#ifndef UA_ENABLE_IMMUTABLE_NODES
+    /* Edit registered nodes in-situ without a lookup */
+    const UA_Node *node = UA_Session_getRegisteredNode(server, session, &wv->nodeId);
+    if(node)
+        return copyAttributeIntoNode(server, session, (UA_Node*)(uintptr_t)node, wv);
+#endif
+
+    const UA_NodeId *nodeId = UA_Session_resolveNodeId(session, &wv->nodeId);
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    /* Virtual children become real nodes when they are written */
+    UA_StatusCode retval = UA_VirtualNodes_materialize(server, nodeId);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+#endif
+    return UA_Server_editNode(server, session, nodeId,
+                              (UA_EditNodeCallback)copyAttributeIntoNode,
+                              /* casting away const qualifier because callback uses const anyway */
+                              (UA_WriteValue *)(uintptr_t)wv);
+}
+
+static UA_StatusCode
+writeNode(UA_Server *server, UA_Session *session, const UA_WriteValue *wv) {
+    UA_StatusCode retval = editNodeAttribute(server, session, wv);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /* Sample the MonitoredItems that wait for a write of the value */
+    if(retval == UA_STATUSCODE_GOOD && wv->attributeId == UA_ATTRIBUTEID_VALUE)
+        notifyValueChanged(server, UA_Session_resolveNodeId(session, &wv->nodeId));
+#endif
+    return retval;
+}
+
+typedef struct {
+    const UA_WriteRequest *request;
+#if UA_MULTITHREADING >= 100
+    struct AsyncOperationContextInternal *async; /* NULL for internal writes */
+#endif
+} WriteServiceContext;
+
+#if UA_MULTITHREADING >= 100
+/* Writes of the value attribute of writable async variables are queued */
+static UA_Boolean
+queueAsyncWrite(UA_Server *server, UA_Session *session, WriteServiceContext *ctx,
+                const UA_WriteValue *wv, UA_StatusCode *result) {
+    if(!ctx->async || !server->hasAsyncVariables ||
+       wv->attributeId != UA_ATTRIBUTEID_VALUE)
+        return false;
+    const UA_Node *node =
+        getNodeOrVirtual(server, UA_Session_resolveNodeId(session, &wv->nodeId));
+    if(!node)
+        return false;
+    const UA_VariableNode *vn = (const UA_VariableNode*)node;
+    if(node->nodeClass != UA_NODECLASS_VARIABLE || !vn->async ||
+       !(getAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_WRITE) ||
+       !(getUserAccessLevel(server, session, vn) & UA_ACCESSLEVELMASK_WRITE)) {
+        releaseNodeOrVirtual(server, node);
+        return false;
+    }
+
+    /* Queue with the resolved NodeId (shallow copy) */
+    UA_WriteValue resolved = *wv;
+    resolved.nodeId = node->nodeId;
+    size_t index = (size_t)(wv - ctx->request->nodesToWrite);
+    UA_StatusCode retval =
+        queueAsyncOperation(server, session, ctx->async, UA_ASYNCOPERATIONTYPE_WRITE,
+                            &UA_TYPES[UA_TYPES_WRITERESPONSE], &resolved,
+                            result - index, index);
+    releaseNodeOrVirtual(server, node);
+    /* Overwritten when the result is set */
+    *result = (retval == UA_STATUSCODE_GOOD) ? UA_STATUSCODE_BADTIMEOUT : retval;
+    return true;
+}
+#endif
+
 static void
-Operation_Write(UA_Server *server, UA_Session *session, void *context,
+Operation_Write(UA_Server *server, UA_Session *session, WriteServiceContext *ctx,
                 UA_WriteValue *wv, UA_StatusCode *result) {
-    *result = UA_Server_editNode(server, session, &wv->nodeId,
-                        (UA_EditNodeCallback)copyAttributeIntoNode, wv);
+#if UA_MULTITHREADING >= 100
+    if(queueAsyncWrite(server, session, ctx, wv, result))
+        return;
+#endif
+    *result = writeNode(server, session, wv);
 }
 
-void
-Service_Write(UA_Server *server, UA_Session *session,
-              const UA_WriteRequest *request,
-              UA_WriteResponse *response) {
+static void
+writeService(UA_Server *server, UA_Session *session, WriteServiceContext *ctx,
+             const UA_WriteRequest *request, UA_WriteResponse *response) {
     UA_LOG_DEBUG_SESSION(&server->config.logger, session,
                          "Processing WriteRequest");
     UA_LOCK_ASSERT(server->serviceMutex, 1);
@@ -1468,28 +2049,66 @@ Service_Write(UA_Server *server, UA_Session *session,
 
     UA_LOCK_ASSERT(server->serviceMutex, 1);
 
+    ctx->request = request;
     response->responseHeader.serviceResult =
-        UA_Server_processServiceOperations(server, session, (UA_ServiceOperation)Operation_Write, NULL,
-                                           &request->nodesToWriteSize, &UA_TYPES[UA_TYPES_WRITEVALUE],
-                                           &response->resultsSize, &UA_TYPES[UA_TYPES_STATUSCODE]);
+        UA_Server_processServiceOperationsParallel(server, session, (UA_ServiceOperation)Operation_Write, ctx,
+                                                   &request->nodesToWriteSize, &UA_TYPES[UA_TYPES_WRITEVALUE],
+                                                   &response->resultsSize, &UA_TYPES[UA_TYPES_STATUSCODE]);
+}
+
+void
+Service_Write(UA_Server *server, UA_Session *session,
+              const UA_WriteRequest *request,
+              UA_WriteResponse *response) {
+    WriteServiceContext ctx;
+    memset(&ctx, 0, sizeof(WriteServiceContext));
+    writeService(server, session, &ctx, request, response);
+}
+
+#if UA_MULTITHREADING >= 100
+void
+Service_WriteAsync(UA_Server *server, UA_Session *session,
+                   struct AsyncOperationContextInternal *context,
+                   const UA_WriteRequest *request, UA_WriteResponse *response) {
+    WriteServiceContext ctx;
+    ctx.request = request;
+    ctx.async = context;
+    writeService(server, session, &ctx, request, response);
+}
+
+static UA_StatusCode
+setVariableNodeAsync(UA_Server *server, UA_Session *session,
+                     UA_VariableNode *node, UA_Boolean *isAsync) {
+    if(node->nodeClass != UA_NODECLASS_VARIABLE)
+        return UA_STATUSCODE_BADNODECLASSINVALID;
+    node->async = *isAsync;
+    return UA_STATUSCODE_GOOD;
 }
 
+UA_StatusCode
+UA_Server_setVariableNodeAsync(UA_Server *server, const UA_NodeId id,
+                               UA_Boolean isAsync) {
+    UA_LOCK(server->serviceMutex);
+    UA_StatusCode retval =
+        UA_Server_editNode(server, &server->adminSession, &id,
+                           (UA_EditNodeCallback)setVariableNodeAsync, &isAsync);
+    if(retval == UA_STATUSCODE_GOOD && isAsync)
+        server->hasAsyncVariables = true;
+    UA_UNLOCK(server->serviceMutex);
+    return retval;
+}
+#endif
+
 UA_StatusCode
 writeWithSession(UA_Server *server, UA_Session *session,
                            const UA_WriteValue *value) {
-    return UA_Server_editNode(server, session, &value->nodeId,
-                              (UA_EditNodeCallback)copyAttributeIntoNode,
-                              /* casting away const qualifier because callback uses const anyway */
-                              (UA_WriteValue *)(uintptr_t)value);
+    return writeNode(server, session, value);
 }
 
 UA_StatusCode
 writeAttribute(UA_Server *server, const UA_WriteValue *value) {
     UA_LOCK_ASSERT(server->serviceMutex, 1);
-    return UA_Server_editNode(server, &server->adminSession, &value->nodeId,
-                              (UA_EditNodeCallback)copyAttributeIntoNode,
-                               /* casting away const qualifier because callback uses const anyway */
-                              (UA_WriteValue *)(uintptr_t)value);
+    return writeNode(server, &server->adminSession, value);
 }
 
 UA_StatusCode
@@ -1533,6 +2152,42 @@ __UA_Server_write(UA_Server *server, const UA_NodeId *nodeId,
     return retval;
 }
 
+static UA_StatusCode
+writeValueSameTypeCallback(UA_Server *server, UA_Session *session,
+                           UA_Node *node, const UA_DataValue *value) {
+    if(node->nodeClass != UA_NODECLASS_VARIABLE)
+        return UA_STATUSCODE_BADNODECLASSINVALID;
+    UA_Byte accessLevel = getAccessLevel(server, session, (const UA_VariableNode*)node);
+    if(!(accessLevel & (UA_ACCESSLEVELMASK_WRITE)))
+        return UA_STATUSCODE_BADNOTWRITABLE;
+    return writeValueAttribute(server, session, (UA_VariableNode*)node,
+                               value, NULL, true);
+}
+
+UA_StatusCode
+UA_Server_writeValueSameType(UA_Server *server, const UA_NodeId nodeId,
+                             const UA_Variant value) {
+    UA_DataValue dv;
+    UA_DataValue_init(&dv);
+    dv.value = value;
+    dv.hasValue = true;
+
+    UA_LOCK(server->serviceMutex);
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    retval = UA_VirtualNodes_materialize(server, &nodeId);
+#endif
+    if(retval == UA_STATUSCODE_GOOD)
+        retval = UA_Server_editNode(server, &server->adminSession, &nodeId,
+                                    (UA_EditNodeCallback)writeValueSameTypeCallback, &dv);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    if(retval == UA_STATUSCODE_GOOD)
+        notifyValueChanged(server, &nodeId);
+#endif
+    UA_UNLOCK(server->serviceMutex);
+    return retval;
+}
+
 #ifdef UA_ENABLE_HISTORIZING
 void
 Service_HistoryRead(UA_Server *server, UA_Session *session,
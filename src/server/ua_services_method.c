@@ -146,7 +146,7 @@ callWithMethodAndObject(UA_Server *server, UA_Session *session,
         UA_NodeReferenceKind *rk = &object->references[i];
         if(rk->isInverse)
             continue;
-        if(!isNodeInTree(server->nsCtx, &rk->referenceTypeId,
+        if(!isNodeInTree(server, &rk->referenceTypeId,
                          &hasComponentNodeId, &hasSubTypeNodeId, 1))
             continue;
         for(size_t j = 0; j < rk->refTargetsSize; ++j) {
@@ -255,6 +255,12 @@ Operation_CallMethodAsync(UA_Server *server, UA_Session *session, void *context,
     const UA_CallMethodRequest *request, UA_CallMethodResult *result) {
     struct AsyncMethodContextInternal *pContext = (struct AsyncMethodContextInternal*)context;
 
+    /* Resolve the NodeIds from RegisterNodes (shallow copy) */
+    UA_CallMethodRequest resolved = *request;
+    resolved.objectId = *UA_Session_resolveNodeId(session, &request->objectId);
+    resolved.methodId = *UA_Session_resolveNodeId(session, &request->methodId);
+    request = &resolved;
+
     /* Get the method node */
     const UA_MethodNode *method = (const UA_MethodNode*)
         UA_Nodestore_getNode(server->nsCtx, &request->methodId);
@@ -326,6 +332,12 @@ void Service_CallAsync(UA_Server *server, UA_Session *session,
 static void
 Operation_CallMethod(UA_Server *server, UA_Session *session, void *context,
                      const UA_CallMethodRequest *request, UA_CallMethodResult *result) {
+    /* Resolve the NodeIds from RegisterNodes (shallow copy) */
+    UA_CallMethodRequest resolved = *request;
+    resolved.objectId = *UA_Session_resolveNodeId(session, &request->objectId);
+    resolved.methodId = *UA_Session_resolveNodeId(session, &request->methodId);
+    request = &resolved;
+
     /* Get the method node */
     const UA_MethodNode *method = (const UA_MethodNode*)
         UA_Nodestore_getNode(server->nsCtx, &request->methodId);
@@ -40,9 +40,23 @@ setMonitoredItemSettings(UA_Server *server, UA_MonitoredItem *mon,
             return UA_STATUSCODE_BADEVENTFILTERINVALID;
         if(params->filter.content.decoded.type != &UA_TYPES[UA_TYPES_EVENTFILTER])
             return UA_STATUSCODE_BADEVENTFILTERINVALID;
-        UA_EventFilter_clear(&mon->filter.eventFilter);
+
+        /* Compile the copied filter. The compiled operands point into it. */
+        UA_EventFilter filter;
         retval = UA_EventFilter_copy((UA_EventFilter *)params->filter.content.decoded.data,
-                                     &mon->filter.eventFilter);
+                                     &filter);
+        if(retval != UA_STATUSCODE_GOOD)
+            return retval;
+        UA_CompiledEventFilter compiled;
+        retval = UA_CompiledEventFilter_compile(server, &filter, &compiled);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_EventFilter_clear(&filter);
+            return retval;
+        }
+        UA_CompiledEventFilter_clear(&mon->compiledEventFilter);
+        UA_EventFilter_clear(&mon->filter.eventFilter);
+        mon->filter.eventFilter = filter;
+        mon->compiledEventFilter = compiled;
 #endif
     } else {
         /* DataChange MonitoredItem */
@@ -81,8 +95,8 @@ setMonitoredItemSettings(UA_Server *server, UA_MonitoredItem *mon,
     UA_MonitoredItem_unregisterSampleCallback(server, mon);
 
     /* Remove the old samples */
-    UA_ByteString_clear(&mon->lastSampledValue);
-    UA_Variant_clear(&mon->lastValue);
+    UA_DataValue_clear(&mon->lastSampledValue);
+    mon->hasLastSampledValue = false;
 
     /* ClientHandle */
     mon->clientHandle = params->clientHandle;
@@ -92,12 +106,12 @@ setMonitoredItemSettings(UA_Server *server, UA_MonitoredItem *mon,
 
     if(mon->attributeId == UA_ATTRIBUTEID_VALUE) {
         const UA_VariableNode *vn = (const UA_VariableNode *)
-            UA_Nodestore_getNode(server->nsCtx, &mon->monitoredNodeId);
+            getNodeOrVirtual(server, &mon->monitoredNodeId);
         if(vn) {
             if(vn->nodeClass == UA_NODECLASS_VARIABLE &&
                samplingInterval < vn->minimumSamplingInterval)
                 samplingInterval = vn->minimumSamplingInterval;
-            UA_Nodestore_releaseNode(server->nsCtx, (const UA_Node *)vn);
+            releaseNodeOrVirtual(server, (const UA_Node *)vn);
         }
     }
 
@@ -162,6 +176,13 @@ Operation_CreateMonitoredItem(UA_Server *server, UA_Session *session, struct cre
         return;
     }
 
+    /* The MonitoredItem uses the NodeId behind an alias from RegisterNodes.
+     * The alias can be unregistered while the MonitoredItem exists. */
+    UA_MonitoredItemCreateRequest resolved = *request; /* Shallow copy */
+    resolved.itemToMonitor.nodeId =
+        *UA_Session_resolveNodeId(session, &request->itemToMonitor.nodeId);
+    request = &resolved;
+
     /* Make an example read to get errors in the itemToMonitor. Allow return
      * codes "good" and "uncertain", as well as a list of statuscodes that might
      * be repaired inside the data source. */
@@ -236,6 +257,7 @@ Operation_CreateMonitoredItem(UA_Server *server, UA_Session *session, struct cre
             /* Insert the monitored item into the node's queue */
             UA_Server_editNode(server, NULL, &newMon->monitoredNodeId,
                                UA_Server_addMonitoredItemToNodeEditNodeCallback, newMon);
+            UA_EventIndex_clear(&server->eventIndex);
         }
 #endif
     } else {
@@ -477,12 +499,12 @@ Operation_SetMonitoringMode(UA_Server *server, UA_Session *session,
         UA_Notification *notification, *notification_tmp;
         TAILQ_FOREACH_SAFE(notification, &mon->queue, listEntry, notification_tmp) {
             UA_Notification_dequeue(server, notification);
-            UA_Notification_delete(notification);
+            UA_Notification_delete(server, notification);
         }
 
         /* Initialize lastSampledValue */
-        UA_ByteString_clear(&mon->lastSampledValue);
-        UA_Variant_clear(&mon->lastValue);
+        UA_DataValue_clear(&mon->lastSampledValue);
+        mon->hasLastSampledValue = false;
     }
 }
 
@@ -570,4 +592,66 @@ UA_Server_deleteMonitoredItem(UA_Server *server, UA_UInt32 monitoredItemId) {
     return UA_STATUSCODE_BADMONITOREDITEMIDINVALID;
 }
 
+static UA_StatusCode
+setVariableNodeSampleOnWrite(UA_Server *server, UA_Session *session,
+                             UA_VariableNode *node, UA_Boolean *sampleOnWrite) {
+    if(node->nodeClass != UA_NODECLASS_VARIABLE)
+        return UA_STATUSCODE_BADNODECLASSINVALID;
+    node->sampleOnWrite = *sampleOnWrite;
+    return UA_STATUSCODE_GOOD;
+}
+
+/* Register the sampling of the MonitoredItem again if it monitors the value */
+static void
+resetValueSampling(UA_Server *server, UA_MonitoredItem *mon, const UA_NodeId *nodeId) {
+    if(!mon->sampleCallbackIsRegistered || mon->attributeId != UA_ATTRIBUTEID_VALUE ||
+       !UA_NodeId_equal(&mon->monitoredNodeId, nodeId))
+        return;
+    UA_MonitoredItem_unregisterSampleCallback(server, mon);
+    UA_StatusCode retval = UA_MonitoredItem_registerSampleCallback(server, mon);
+    if(retval != UA_STATUSCODE_GOOD)
+        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                       "MonitoredItem %i | Could not register the sampling "
+                       "with StatusCode %s", mon->monitoredItemId,
+                       UA_StatusCode_name(retval));
+}
+
+UA_StatusCode
+UA_Server_setVariableNodeSampleOnWrite(UA_Server *server, const UA_NodeId nodeId,
+                                       UA_Boolean sampleOnWrite) {
+    UA_LOCK(server->serviceMutex);
+    UA_StatusCode retval =
+        UA_Server_editNode(server, &server->adminSession, &nodeId,
+                           (UA_EditNodeCallback)setVariableNodeSampleOnWrite,
+                           &sampleOnWrite);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_UNLOCK(server->serviceMutex);
+        return retval;
+    }
+
+    /* Apply to the existing MonitoredItems */
+    UA_MonitoredItem *mon;
+    LIST_FOREACH(mon, &server->localMonitoredItems, listEntry)
+        resetValueSampling(server, mon, &nodeId);
+    session_list_entry *current;
+    LIST_FOREACH(current, &server->sessionManager.sessions, pointers) {
+        UA_Subscription *sub;
+        LIST_FOREACH(sub, &current->session.serverSubscriptions, listEntry) {
+            LIST_FOREACH(mon, &sub->monitoredItems, listEntry)
+                resetValueSampling(server, mon, &nodeId);
+        }
+    }
+    UA_UNLOCK(server->serviceMutex);
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_Server_notifyValueChanged(UA_Server *server, const UA_NodeId nodeId) {
+    UA_LOCK(server->serviceMutex);
+    /* The cached value of a DataSource is outdated */
+    UA_ValueCache_remove(&server->valueCache, &nodeId);
+    notifyValueChanged(server, &nodeId);
+    UA_UNLOCK(server->serviceMutex);
+}
+
 #endif /* UA_ENABLE_SUBSCRIPTIONS */
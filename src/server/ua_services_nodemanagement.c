@@ -169,7 +169,7 @@ checkParentReference(UA_Server *server, UA_Session *session, UA_NodeClass nodeCl
     }
 
     /* Test if the referencetype is hierarchical */
-    if(!isNodeInTree(server->nsCtx, referenceTypeId,
+    if(!isNodeInTree(server, referenceTypeId,
                      &hierarchicalReferences, &subtypeId, 1)) {
         UA_LOG_INFO_SESSION(&server->config.logger, session,
                             "AddNodes: Reference type to the parent is not hierarchical");
@@ -432,7 +432,8 @@ copyAllChildren(UA_Server *server, UA_Session *session,
 
 static UA_StatusCode
 recursiveTypeCheckAddChildren(UA_Server *server, UA_Session *session,
-                              const UA_Node **node, const UA_Node *type);
+                              const UA_Node **node, const UA_Node *type,
+                              UA_Boolean addChildren);
 
 static void
 Operation_addReference(UA_Server *server, UA_Session *session, void *context,
@@ -535,6 +536,7 @@ copyChild(UA_Server *server, UA_Session *session, const UA_NodeId *destinationNo
         retval = UA_Nodestore_insertNode(server->nsCtx, node, &newNodeId);
         if(retval != UA_STATUSCODE_GOOD)
             return retval;
+        UA_BrowsePathCache_invalidate(&server->browsePathCache, &newNodeId);
 
         /* Add the node references */
         retval = AddNode_addRefs(server, session, &newNodeId, destinationNodeId,
@@ -553,20 +555,25 @@ copyChild(UA_Server *server, UA_Session *session, const UA_NodeId *destinationNo
     return retval;
 }
 
+static void
+initChildrenBrowse(UA_BrowseDescription *bd, const UA_NodeId *source) {
+    UA_BrowseDescription_init(bd);
+    bd->nodeId = *source;
+    bd->referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_AGGREGATES);
+    bd->includeSubtypes = true;
+    bd->browseDirection = UA_BROWSEDIRECTION_FORWARD;
+    bd->nodeClassMask = UA_NODECLASS_OBJECT | UA_NODECLASS_VARIABLE | UA_NODECLASS_METHOD;
+    bd->resultMask = UA_BROWSERESULTMASK_REFERENCETYPEID | UA_BROWSERESULTMASK_NODECLASS |
+        UA_BROWSERESULTMASK_BROWSENAME | UA_BROWSERESULTMASK_TYPEDEFINITION;
+}
+
 /* Copy any children of Node sourceNodeId to another node destinationNodeId. */
 static UA_StatusCode
 copyAllChildren(UA_Server *server, UA_Session *session,
                 const UA_NodeId *source, const UA_NodeId *destination) {
     /* Browse to get all children of the source */
     UA_BrowseDescription bd;
-    UA_BrowseDescription_init(&bd);
-    bd.nodeId = *source;
-    bd.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_AGGREGATES);
-    bd.includeSubtypes = true;
-    bd.browseDirection = UA_BROWSEDIRECTION_FORWARD;
-    bd.nodeClassMask = UA_NODECLASS_OBJECT | UA_NODECLASS_VARIABLE | UA_NODECLASS_METHOD;
-    bd.resultMask = UA_BROWSERESULTMASK_REFERENCETYPEID | UA_BROWSERESULTMASK_NODECLASS |
-        UA_BROWSERESULTMASK_BROWSENAME | UA_BROWSERESULTMASK_TYPEDEFINITION;
+    initChildrenBrowse(&bd, source);
 
     UA_BrowseResult br;
     UA_BrowseResult_init(&br);
@@ -587,6 +594,87 @@ copyAllChildren(UA_Server *server, UA_Session *session,
     return retval;
 }
 
+static UA_StatusCode
+addOneWayReference(UA_Server *server, UA_Session *session,
+                   UA_Node *node, const UA_AddReferencesItem *item);
+
+#ifdef UA_ENABLE_VIRTUAL_NODES
+static UA_Boolean
+hasBrowseName(const UA_BrowseResult *br, size_t referencesSize,
+              const UA_QualifiedName *browseName) {
+    for(size_t i = 0; i < referencesSize; i++) {
+        if(UA_QualifiedName_equal(&br->references[i].browseName, browseName))
+            return true;
+    }
+    return false;
+}
+
+/* Mandatory variables and objects become virtual children. The instance only
+ * gets a reference to them. Methods and optional children are added as for
+ * regular instances. Children with the BrowseName of an existing child (or of a
+ * child from a more specific type) are skipped. */
+static UA_StatusCode
+addVirtualChildren(UA_Server *server, UA_Session *session, const UA_Node *node,
+                   const UA_NodeId *hierarchy, size_t hierarchySize) {
+    /* Browse the children of the instance (at index 0) and of the types */
+    UA_BrowseResult *br = (UA_BrowseResult*)
+        UA_Array_new(hierarchySize + 1, &UA_TYPES[UA_TYPES_BROWSERESULT]);
+    if(!br)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    for(size_t i = 0; i <= hierarchySize && retval == UA_STATUSCODE_GOOD; i++) {
+        UA_BrowseDescription bd;
+        initChildrenBrowse(&bd, (i == 0) ? &node->nodeId : &hierarchy[i - 1]);
+        UA_UInt32 maxrefs = 0;
+        Operation_Browse(server, session, &maxrefs, &bd, &br[i]);
+        retval = br[i].statusCode;
+    }
+
+    /* Add the regular children first. Then the instance has no virtual
+     * children yet when it is browsed during the instantiation. */
+    for(size_t pass = 0; pass < 2; pass++) {
+        for(size_t i = 1; i <= hierarchySize && retval == UA_STATUSCODE_GOOD; i++) {
+            for(size_t j = 0; j < br[i].referencesSize && retval == UA_STATUSCODE_GOOD; j++) {
+                const UA_ReferenceDescription *rd = &br[i].references[j];
+                UA_Boolean exists = hasBrowseName(&br[i], j, &rd->browseName);
+                for(size_t k = 0; k < i && !exists; k++)
+                    exists = hasBrowseName(&br[k], br[k].referencesSize, &rd->browseName);
+                if(exists)
+                    continue;
+
+                UA_Boolean isVirtual =
+                    (rd->nodeClass == UA_NODECLASS_VARIABLE ||
+                     rd->nodeClass == UA_NODECLASS_OBJECT) &&
+                    isMandatoryChild(server, session, &rd->nodeId.nodeId);
+                if(!isVirtual) {
+                    if(pass == 0)
+                        retval = copyChild(server, session, &node->nodeId, rd);
+                    continue;
+                }
+                if(pass == 0)
+                    continue;
+
+                UA_AddReferencesItem item;
+                UA_AddReferencesItem_init(&item);
+                item.sourceNodeId = node->nodeId;
+                item.referenceTypeId = rd->referenceTypeId;
+                item.isForward = true;
+                retval = UA_VirtualNodes_encodeId(&node->nodeId, &rd->nodeId.nodeId,
+                                                  &item.targetNodeId.nodeId);
+                if(retval == UA_STATUSCODE_GOOD)
+                    retval = UA_Server_editNode(server, session, &node->nodeId,
+                                                (UA_EditNodeCallback)addOneWayReference,
+                                                &item);
+                UA_NodeId_clear(&item.targetNodeId.nodeId);
+            }
+        }
+    }
+
+    UA_Array_delete(br, hierarchySize + 1, &UA_TYPES[UA_TYPES_BROWSERESULT]);
+    return retval;
+}
+#endif
+
 static UA_StatusCode
 addTypeChildren(UA_Server *server, UA_Session *session,
                 const UA_Node *node, const UA_Node *type) {
@@ -599,6 +687,15 @@ addTypeChildren(UA_Server *server, UA_Session *session,
         return retval;
     UA_assert(hierarchySize < 1000);
 
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    if(node->nodeClass == UA_NODECLASS_OBJECT &&
+       UA_VirtualNodes_isVirtualType(server, &type->nodeId)) {
+        retval = addVirtualChildren(server, session, node, hierarchy, hierarchySize);
+        UA_Array_delete(hierarchy, hierarchySize, &UA_TYPES[UA_TYPES_NODEID]);
+        return retval;
+    }
+#endif
+
     /* Copy members of the type and supertypes (and instantiate them) */
     for(size_t i = 0; i < hierarchySize; ++i) {
         retval = copyAllChildren(server, session, &hierarchy[i], &node->nodeId);
@@ -610,6 +707,32 @@ addTypeChildren(UA_Server *server, UA_Session *session,
     return retval;
 }
 
+/* Does instantiating the type add children? Returns true if unsure. */
+static UA_Boolean
+hasTypeChildren(UA_Server *server, UA_Session *session, const UA_NodeId *typeId) {
+    UA_NodeId *hierarchy = NULL;
+    size_t hierarchySize = 0;
+    UA_StatusCode retval = getParentTypeAndInterfaceHierarchy(server, typeId,
+                                                              &hierarchy, &hierarchySize);
+    if(retval != UA_STATUSCODE_GOOD)
+        return true;
+
+    UA_Boolean found = false;
+    for(size_t i = 0; i < hierarchySize && !found; ++i) {
+        UA_BrowseDescription bd;
+        initChildrenBrowse(&bd, &hierarchy[i]);
+        UA_BrowseResult br;
+        UA_BrowseResult_init(&br);
+        UA_UInt32 maxrefs = 0;
+        Operation_Browse(server, session, &maxrefs, &bd, &br);
+        found = (br.statusCode != UA_STATUSCODE_GOOD || br.referencesSize > 0);
+        UA_BrowseResult_clear(&br);
+    }
+
+    UA_Array_delete(hierarchy, hierarchySize, &UA_TYPES[UA_TYPES_NODEID]);
+    return found;
+}
+
 static UA_StatusCode
 addRef(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
        const UA_NodeId *referenceTypeId, const UA_NodeId *parentNodeId,
@@ -626,16 +749,83 @@ addRef(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
     return retval;
 }
 
+/* References of a batch of new nodes. They are added in bulk to every node
+ * after all nodes of the batch are checked. */
+typedef struct {
+    size_t index; /* Position of the new node in the batch */
+    UA_AddReferencesItem ref; /* One direction. The source node is edited. */
+} DeferredReference;
+
+typedef struct {
+    size_t index; /* Position of the current node in the batch */
+    size_t refsSize;
+    size_t refsCapacity;
+    DeferredReference *refs;
+} DeferredReferences;
+
+static UA_StatusCode
+deferRef(DeferredReferences *dr, const UA_NodeId *sourceId, UA_Boolean forward,
+         const UA_NodeId *referenceTypeId, const UA_NodeId *targetId) {
+    if(dr->refsSize == dr->refsCapacity)
+        return UA_STATUSCODE_BADOUTOFMEMORY; /* Preallocated for the batch */
+    DeferredReference *d = &dr->refs[dr->refsSize];
+    UA_AddReferencesItem_init(&d->ref);
+    d->index = dr->index;
+    d->ref.isForward = forward;
+    UA_StatusCode retval = UA_NodeId_copy(sourceId, &d->ref.sourceNodeId);
+    retval |= UA_NodeId_copy(referenceTypeId, &d->ref.referenceTypeId);
+    retval |= UA_NodeId_copy(targetId, &d->ref.targetNodeId.nodeId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_AddReferencesItem_clear(&d->ref);
+        return retval;
+    }
+    dr->refsSize++;
+    return UA_STATUSCODE_GOOD;
+}
+
+/* Add the reference in both directions right away. Or add it only to the new
+ * node and defer the other direction. */
+static UA_StatusCode
+addOrDeferRef(UA_Server *server, UA_Session *session, DeferredReferences *dr,
+              const UA_NodeId *nodeId, const UA_NodeId *referenceTypeId,
+              const UA_NodeId *targetId, UA_Boolean forward) {
+    if(!dr)
+        return addRef(server, session, nodeId, referenceTypeId, targetId, forward);
+    UA_AddReferencesItem ref_item;
+    UA_AddReferencesItem_init(&ref_item);
+    ref_item.sourceNodeId = *nodeId;
+    ref_item.referenceTypeId = *referenceTypeId;
+    ref_item.isForward = forward;
+    ref_item.targetNodeId.nodeId = *targetId;
+    UA_StatusCode retval =
+        UA_Server_editNode(server, session, nodeId,
+                           (UA_EditNodeCallback)addOneWayReference, &ref_item);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    return deferRef(dr, targetId, !forward, referenceTypeId, nodeId);
+}
+
 /************/
 /* Add Node */
 /************/
 
 static const UA_NodeId hasSubtype = {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASSUBTYPE}};
 
-UA_StatusCode
-AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
-                const UA_NodeId *parentNodeId, const UA_NodeId *referenceTypeId,
-                const UA_NodeId *typeDefinitionId) {
+/* The checks depend only on the NodeClass, parent, ReferenceType and
+ * TypeDefinition. They can be skipped if the same combination was already
+ * validated. */
+static UA_StatusCode
+addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
+        const UA_NodeId *parentNodeId, const UA_NodeId *referenceTypeId,
+        const UA_NodeId *typeDefinitionId, UA_Boolean skipChecks,
+        DeferredReferences *deferred) {
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    /* Virtual children become real nodes when they get new children */
+    UA_StatusCode res = UA_VirtualNodes_materialize(server, parentNodeId);
+    if(res != UA_STATUSCODE_GOOD)
+        return UA_STATUSCODE_BADPARENTNODEIDINVALID;
+#endif
+
     /* Get the node */
     const UA_Node *type = NULL;
     const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, nodeId);
@@ -657,7 +847,7 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
         }
     }
 
-    UA_StatusCode retval;
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
     /* Make sure newly created node does not have itself as parent */
     if (UA_NodeId_equal(nodeId, parentNodeId)) {
         UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
@@ -670,8 +860,9 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
 
 
     /* Check parent reference. Objects may have no parent. */
-    retval = checkParentReference(server, session, node->nodeClass,
-                                                parentNodeId, referenceTypeId);
+    if(!skipChecks)
+        retval = checkParentReference(server, session, node->nodeClass,
+                                      parentNodeId, referenceTypeId);
     if(retval != UA_STATUSCODE_GOOD) {
         UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
                             "AddNodes: The parent reference for %.*s is invalid "
@@ -685,10 +876,11 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
     if((node->nodeClass == UA_NODECLASS_VARIABLE ||
         node->nodeClass == UA_NODECLASS_OBJECT) &&
        UA_NodeId_isNull(typeDefinitionId)) {
-        UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
-                            "AddNodes: No TypeDefinition for %.*s; Use the default "
-                            "TypeDefinition for the Variable/Object",
-                            (int)nodeIdStr.length, nodeIdStr.data));
+        if(!skipChecks) /* Was already logged for the same type of node */
+            UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
+                                "AddNodes: No TypeDefinition for %.*s; Use the default "
+                                "TypeDefinition for the Variable/Object",
+                                (int)nodeIdStr.length, nodeIdStr.data));
         if(node->nodeClass == UA_NODECLASS_VARIABLE)
             typeDefinitionId = &baseDataVariableType;
         else
@@ -708,6 +900,9 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
             goto cleanup;
         }
 
+        if(skipChecks)
+            goto addrefs;
+
         UA_Boolean typeOk = false;
         switch(node->nodeClass) {
             case UA_NODECLASS_DATATYPE:
@@ -767,9 +962,9 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
                  * object type which again is below BaseObjectType */
                 const UA_NodeId variableTypes = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE);
                 const UA_NodeId objectTypes = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE);
-                if(!isNodeInTree(server->nsCtx, parentNodeId, &variableTypes,
+                if(!isNodeInTree(server, parentNodeId, &variableTypes,
                                  parentTypeHierarchy, parentTypeHierarchySize) &&
-                   !isNodeInTree(server->nsCtx, parentNodeId, &objectTypes,
+                   !isNodeInTree(server, parentNodeId, &objectTypes,
                                  parentTypeHierarchy, parentTypeHierarchySize)) {
                     UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
                                         "AddNodes: Type of variable node %.*s must "
@@ -802,11 +997,11 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
                 /* Object node created of an abstract ObjectType. Only allowed
                  * if within BaseObjectType folder or if it's an event (subType of BaseEventType) */
                 const UA_NodeId objectTypes = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE);
-                UA_Boolean isInBaseObjectType = isNodeInTree(server->nsCtx, parentNodeId, &objectTypes,
+                UA_Boolean isInBaseObjectType = isNodeInTree(server, parentNodeId, &objectTypes,
                                                              parentTypeHierarchy, parentTypeHierarchySize);
 
                 const UA_NodeId eventTypes = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEEVENTTYPE);
-                UA_Boolean isInBaseEventType = isNodeInTree(server->nsCtx, &type->nodeId, &eventTypes, &hasSubtype, 1);
+                UA_Boolean isInBaseEventType = isNodeInTree(server, &type->nodeId, &eventTypes, &hasSubtype, 1);
 
                 if(!isInBaseObjectType && !(isInBaseEventType && UA_NodeId_isNull(parentNodeId))) {
                     UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
@@ -824,6 +1019,7 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
     }
 
     /* Add reference to the parent */
+ addrefs:
     if(!UA_NodeId_isNull(parentNodeId)) {
         if(UA_NodeId_isNull(referenceTypeId)) {
             UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
@@ -833,7 +1029,8 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
             goto cleanup;
         }
 
-        retval = addRef(server, session, &node->nodeId, referenceTypeId, parentNodeId, false);
+        retval = addOrDeferRef(server, session, deferred, &node->nodeId,
+                               referenceTypeId, parentNodeId, false);
         if(retval != UA_STATUSCODE_GOOD) {
             UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
                                 "AddNodes: Adding reference to parent of %.*s failed",
@@ -846,7 +1043,8 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
     if(node->nodeClass == UA_NODECLASS_VARIABLE ||
        node->nodeClass == UA_NODECLASS_OBJECT) {
         UA_assert(type != NULL); /* see above */
-        retval = addRef(server, session, &node->nodeId, &hasTypeDefinition, &type->nodeId, true);
+        retval = addOrDeferRef(server, session, deferred, &node->nodeId,
+                               &hasTypeDefinition, &type->nodeId, true);
         if(retval != UA_STATUSCODE_GOOD) {
             UA_LOG_NODEID_WRAP(nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
                                 "AddNodes: Adding a reference to the type "
@@ -863,6 +1061,14 @@ AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
     return retval;
 }
 
+UA_StatusCode
+AddNode_addRefs(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
+                const UA_NodeId *parentNodeId, const UA_NodeId *referenceTypeId,
+                const UA_NodeId *typeDefinitionId) {
+    return addRefs(server, session, nodeId, parentNodeId, referenceTypeId,
+                   typeDefinitionId, false, NULL);
+}
+
 /* Create the node and add it to the nodestore. But don't typecheck and add
  * references so far */
 UA_StatusCode
@@ -904,22 +1110,32 @@ AddNode_raw(UA_Server *server, UA_Session *session, void *nodeContext,
 
     /* Fill the node attributes */
     node->context = nodeContext;
-    UA_StatusCode retval = UA_NodeId_copy(&item->requestedNewNodeId.nodeId, &node->nodeId);
+    UA_StatusCode retval = UA_QualifiedName_copy(&item->browseName, &node->browseName);
     if(retval != UA_STATUSCODE_GOOD)
         goto create_error;
 
-    retval = UA_QualifiedName_copy(&item->browseName, &node->browseName);
+    retval = UA_Node_setAttributes(node, item->nodeAttributes.content.decoded.data,
+                                   item->nodeAttributes.content.decoded.type);
     if(retval != UA_STATUSCODE_GOOD)
         goto create_error;
 
-    retval = UA_Node_setAttributes(node, item->nodeAttributes.content.decoded.data,
-                                   item->nodeAttributes.content.decoded.type);
+#ifdef UA_ENABLE_STRING_INTERNING
+    /* Share the attribute strings with other nodes */
+    UA_Node_internStrings(&server->stringPool, node);
+#endif
+
+    /* Set the NodeId last. Until then, the nodestore can delete the node
+     * without knowing its namespace. */
+    retval = UA_NodeId_copy(&item->requestedNewNodeId.nodeId, &node->nodeId);
     if(retval != UA_STATUSCODE_GOOD)
         goto create_error;
 
     /* Add the node to the nodestore */
     retval = UA_Nodestore_insertNode(server->nsCtx, node, outNewNodeId);
-    if(retval != UA_STATUSCODE_GOOD)
+    if(retval == UA_STATUSCODE_GOOD)
+        UA_BrowsePathCache_invalidate(&server->browsePathCache, outNewNodeId ?
+                                      outNewNodeId : &item->requestedNewNodeId.nodeId);
+    else
         UA_LOG_INFO_SESSION(&server->config.logger, session,
                             "AddNodes: Node could not add the new node "
                             "to the nodestore with error code %s",
@@ -964,7 +1180,8 @@ Operation_addNode_begin(UA_Server *server, UA_Session *session, void *nodeContex
 
 static UA_StatusCode
 recursiveTypeCheckAddChildren(UA_Server *server, UA_Session *session,
-                              const UA_Node **nodeptr, const UA_Node *type) {
+                              const UA_Node **nodeptr, const UA_Node *type,
+                              UA_Boolean addChildren) {
     UA_assert(type != NULL);
     UA_StatusCode retval = UA_STATUSCODE_GOOD;
     const UA_Node *node = *nodeptr;
@@ -1007,8 +1224,8 @@ recursiveTypeCheckAddChildren(UA_Server *server, UA_Session *session,
     }
 
     /* Add (mandatory) child nodes from the type definition */
-    if(node->nodeClass == UA_NODECLASS_VARIABLE ||
-       node->nodeClass == UA_NODECLASS_OBJECT) {
+    if(addChildren && (node->nodeClass == UA_NODECLASS_VARIABLE ||
+                       node->nodeClass == UA_NODECLASS_OBJECT)) {
         retval = addTypeChildren(server, session, node, type);
         if(retval != UA_STATUSCODE_GOOD) {
             UA_LOG_NODEID_WRAP(&node->nodeId, UA_LOG_INFO_SESSION(&server->config.logger, session,
@@ -1228,9 +1445,11 @@ recursiveDeleteNode(UA_Server *server, UA_Session *session,
                     UA_ExpandedNodeId *hierarchicalReferences,
                     const UA_Node *node, UA_Boolean removeTargetRefs);
 
-/* Children, references, type-checking, constructors. */
-UA_StatusCode
-AddNode_finish(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId) {
+/* Children, references, type-checking, constructors. Adding the children can
+ * be skipped if the type is known to have none. */
+static UA_StatusCode
+addNodeFinish(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId,
+              UA_Boolean addChildren) {
     UA_StatusCode retval = UA_STATUSCODE_GOOD;
 
     /* Get the node */
@@ -1260,7 +1479,8 @@ AddNode_finish(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId)
         if(retval != UA_STATUSCODE_GOOD)
             goto cleanup;
 
-        retval = recursiveTypeCheckAddChildren(server, session, &node, type);
+        retval = recursiveTypeCheckAddChildren(server, session, &node, type,
+                                               addChildren);
         if(retval != UA_STATUSCODE_GOOD)
             goto cleanup;
     }
@@ -1286,6 +1506,11 @@ AddNode_finish(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId)
     return retval;
 }
 
+UA_StatusCode
+AddNode_finish(UA_Server *server, UA_Session *session, const UA_NodeId *nodeId) {
+    return addNodeFinish(server, session, nodeId, true);
+}
+
 static void
 Operation_addNode(UA_Server *server, UA_Session *session, void *nodeContext,
                   const UA_AddNodesItem *item, UA_AddNodesResult *result) {
@@ -1410,6 +1635,321 @@ UA_Server_addNode_finish(UA_Server *server, const UA_NodeId nodeId) {
     return retval;
 }
 
+/* Open addressing hash set of the items whose combination of NodeClass,
+ * parent, ReferenceType and TypeDefinition was validated. For each combination,
+ * remember whether the instantiation of the type adds children. */
+#define UA_TYPECHILDREN_UNKNOWN 0
+#define UA_TYPECHILDREN_SOME 1
+#define UA_TYPECHILDREN_NONE 2
+
+typedef struct {
+    size_t size;
+    const UA_AddNodesItem **items;
+    UA_Byte *typeChildren;
+} ValidatedItems;
+
+static UA_UInt32
+validatedItemHash(const UA_AddNodesItem *item) {
+    UA_UInt32 h = (UA_UInt32)item->nodeClass;
+    h = (h * 31) + UA_NodeId_hash(&item->parentNodeId.nodeId);
+    h = (h * 31) + UA_NodeId_hash(&item->referenceTypeId);
+    return (h * 31) + UA_NodeId_hash(&item->typeDefinition.nodeId);
+}
+
+static UA_Boolean
+validatedItemEqual(const UA_AddNodesItem *a, const UA_AddNodesItem *b) {
+    return a->nodeClass == b->nodeClass &&
+        UA_NodeId_equal(&a->parentNodeId.nodeId, &b->parentNodeId.nodeId) &&
+        UA_NodeId_equal(&a->referenceTypeId, &b->referenceTypeId) &&
+        UA_NodeId_equal(&a->typeDefinition.nodeId, &b->typeDefinition.nodeId);
+}
+
+/* Returns the slot of the item or of the empty position where it belongs */
+static const UA_AddNodesItem **
+findValidatedItem(ValidatedItems *vi, const UA_AddNodesItem *item) {
+    size_t pos = validatedItemHash(item) % vi->size;
+    while(vi->items[pos] && !validatedItemEqual(vi->items[pos], item))
+        pos = (pos + 1) % vi->size;
+    return &vi->items[pos];
+}
+
+/* Remove the cached browse paths that followed the references of the node. A
+ * new or removed HasSubtype reference between ReferenceTypes can change the
+ * references matched by any cached path. */
+static void
+invalidateBrowsePaths(UA_Server *server, const UA_Node *node,
+                      const UA_NodeId *referenceTypeId) {
+    if(node->nodeClass == UA_NODECLASS_REFERENCETYPE &&
+       UA_NodeId_equal(referenceTypeId, &subtypeId))
+        UA_BrowsePathCache_clear(&server->browsePathCache);
+    else
+        UA_BrowsePathCache_invalidateReferences(&server->browsePathCache, &node->nodeId);
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+static const UA_NodeId eventParentReferences[2] =
+    {{0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_ORGANIZES}},
+     {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASCOMPONENT}}};
+
+/* Events are propagated to the parents along Organizes and HasComponent
+ * references. The indexed MonitoredItems of any origin can change with these
+ * references and with the subtypes of the ReferenceTypes. */
+static void
+invalidateEventIndex(UA_Server *server, const UA_Node *node,
+                     const UA_NodeId *referenceTypeId) {
+    if(server->eventIndex.entriesSize == 0)
+        return;
+    if((node->nodeClass == UA_NODECLASS_REFERENCETYPE &&
+        UA_NodeId_equal(referenceTypeId, &subtypeId)) ||
+       isNodeInTree(server, referenceTypeId, &eventParentReferences[0], &subtypeId, 1) ||
+       isNodeInTree(server, referenceTypeId, &eventParentReferences[1], &subtypeId, 1))
+        UA_EventIndex_clear(&server->eventIndex);
+}
+#endif
+
+/* Remove the cached results that depend on the references of the node */
+static void
+invalidateReferenceCaches(UA_Server *server, const UA_Node *node,
+                          const UA_NodeId *referenceTypeId) {
+    invalidateBrowsePaths(server, node, referenceTypeId);
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    invalidateEventIndex(server, node, referenceTypeId);
+#endif
+}
+
+typedef struct {
+    size_t refsSize;
+    const UA_AddReferencesItem **refs;
+} DeferredReferencesRun;
+
+static UA_StatusCode
+addDeferredReferences(UA_Server *server, UA_Session *session, UA_Node *node,
+                      const DeferredReferencesRun *run) {
+    for(size_t i = 0; i < run->refsSize; i++)
+        invalidateReferenceCaches(server, node, &run->refs[i]->referenceTypeId);
+    UA_StatusCode retval = UA_Node_addReferences(node, run->refsSize, run->refs);
+#ifdef UA_ENABLE_STRING_INTERNING
+    for(size_t i = 0; i < run->refsSize && retval == UA_STATUSCODE_GOOD; i++)
+        UA_Node_internReferenceTarget(&server->stringPool, node, run->refs[i]);
+#endif
+    return retval;
+}
+
+static int
+cmpDeferredReference(const void *a, const void *b) {
+    const DeferredReference *aa = (const DeferredReference*)a;
+    const DeferredReference *bb = (const DeferredReference*)b;
+    UA_Order o = UA_NodeId_order(&aa->ref.sourceNodeId, &bb->ref.sourceNodeId);
+    if(o != UA_ORDER_EQ)
+        return (int)o;
+    /* Keep the order of the batch */
+    if(aa->index == bb->index)
+        return 0;
+    return (aa->index < bb->index) ? -1 : 1;
+}
+
+/* Group the deferred references by their source node and add them with one
+ * edit per node. If adding fails for a node, all batch items with references
+ * to add there fail. */
+static void
+flushDeferredReferences(UA_Server *server, UA_Session *session,
+                        DeferredReferences *dr, UA_AddNodesResult *results) {
+    if(dr->refsSize == 0)
+        return;
+    qsort(dr->refs, dr->refsSize, sizeof(DeferredReference), cmpDeferredReference);
+
+    const UA_AddReferencesItem **refs = (const UA_AddReferencesItem**)
+        UA_malloc(dr->refsSize * sizeof(const UA_AddReferencesItem*));
+    UA_Boolean invalidateTypes = false;
+    for(size_t i = 0; i < dr->refsSize;) {
+        size_t end = i + 1;
+        while(end < dr->refsSize &&
+              UA_NodeId_equal(&dr->refs[i].ref.sourceNodeId,
+                              &dr->refs[end].ref.sourceNodeId))
+            end++;
+
+        UA_StatusCode retval = UA_STATUSCODE_BADOUTOFMEMORY;
+        if(refs) {
+            DeferredReferencesRun run;
+            run.refsSize = end - i;
+            run.refs = refs;
+            for(size_t j = i; j < end; j++) {
+                refs[j - i] = &dr->refs[j].ref;
+                if(UA_NodeId_equal(&dr->refs[j].ref.referenceTypeId, &subtypeId))
+                    invalidateTypes = true;
+            }
+            retval = UA_Server_editNode(server, session, &dr->refs[i].ref.sourceNodeId,
+                                        (UA_EditNodeCallback)addDeferredReferences, &run);
+        }
+        for(; i < end; i++) {
+            if(retval != UA_STATUSCODE_GOOD &&
+               results[dr->refs[i].index].statusCode == UA_STATUSCODE_GOOD)
+                results[dr->refs[i].index].statusCode = retval;
+            UA_AddReferencesItem_clear(&dr->refs[i].ref);
+        }
+    }
+    UA_free(refs);
+    dr->refsSize = 0;
+
+    /* HasSubtype references are not merged incrementally in bulk */
+    if(invalidateTypes)
+        UA_TypeHierarchy_invalidate(&server->typeHierarchy);
+}
+
+static UA_Boolean
+isTypeNodeClass(UA_NodeClass nodeClass) {
+    return nodeClass == UA_NODECLASS_REFERENCETYPE ||
+        nodeClass == UA_NODECLASS_DATATYPE ||
+        nodeClass == UA_NODECLASS_OBJECTTYPE ||
+        nodeClass == UA_NODECLASS_VARIABLETYPE;
+}
+
+UA_StatusCode
+UA_Server_addNodes(UA_Server *server, size_t itemsSize,
+                   const UA_AddNodesItem *items, void **nodeContexts,
+                   UA_AddNodesResult *results) {
+    if(itemsSize == 0)
+        return UA_STATUSCODE_GOOD;
+    if(!items || !results)
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+
+    /* Without the hash set, every item is checked individually. Without the
+     * deferred references, they are added right away. */
+    ValidatedItems vi;
+    vi.size = itemsSize * 2;
+    vi.items = (const UA_AddNodesItem**)
+        UA_calloc(vi.size, sizeof(const UA_AddNodesItem*));
+    vi.typeChildren = (UA_Byte*)UA_calloc(vi.size, sizeof(UA_Byte));
+    if(!vi.items || !vi.typeChildren) {
+        UA_free(vi.items);
+        UA_free(vi.typeChildren);
+        vi.items = NULL;
+    }
+    DeferredReferences dr;
+    memset(&dr, 0, sizeof(DeferredReferences));
+    dr.refsCapacity = itemsSize * 2; /* Parent and type definition */
+    dr.refs = (DeferredReference*)
+        UA_malloc(dr.refsCapacity * sizeof(DeferredReference));
+    DeferredReferences *deferred = (dr.refs) ? &dr : NULL;
+
+    UA_LOCK(server->serviceMutex);
+    UA_Session *session = &server->adminSession;
+
+    /* Create all nodes */
+    for(size_t i = 0; i < itemsSize; i++) {
+        UA_AddNodesResult_init(&results[i]);
+        void *nodeContext = (nodeContexts) ? nodeContexts[i] : NULL;
+        results[i].statusCode = AddNode_raw(server, session, nodeContext,
+                                            &items[i], &results[i].addedNodeId);
+    }
+
+    /* Add the references of the type nodes right away. The checks of the
+     * other nodes may depend on the type hierarchy. */
+    for(size_t i = 0; i < itemsSize; i++) {
+        if(results[i].statusCode != UA_STATUSCODE_GOOD ||
+           !isTypeNodeClass(items[i].nodeClass))
+            continue;
+        results[i].statusCode =
+            addRefs(server, session, &results[i].addedNodeId,
+                    &items[i].parentNodeId.nodeId, &items[i].referenceTypeId,
+                    &items[i].typeDefinition.nodeId, false, NULL);
+        if(results[i].statusCode != UA_STATUSCODE_GOOD) {
+            deleteNode(server, results[i].addedNodeId, true);
+            UA_NodeId_clear(&results[i].addedNodeId);
+        }
+    }
+
+    /* Check the other nodes and defer their references */
+    for(size_t i = 0; i < itemsSize; i++) {
+        if(results[i].statusCode != UA_STATUSCODE_GOOD ||
+           isTypeNodeClass(items[i].nodeClass))
+            continue;
+        const UA_AddNodesItem **slot = NULL;
+        UA_Boolean validated = false;
+        if(vi.items) {
+            slot = findValidatedItem(&vi, &items[i]);
+            validated = (*slot != NULL);
+        }
+        dr.index = i;
+        UA_StatusCode retval =
+            addRefs(server, session, &results[i].addedNodeId,
+                    &items[i].parentNodeId.nodeId, &items[i].referenceTypeId,
+                    &items[i].typeDefinition.nodeId, validated, deferred);
+
+        /* The checks may depend on the deferred references, e.g. to find out
+         * whether the parent is part of a type definition. Retry after adding
+         * them. */
+        if(retval != UA_STATUSCODE_GOOD && deferred && dr.refsSize > 0) {
+            flushDeferredReferences(server, session, &dr, results);
+            retval = addRefs(server, session, &results[i].addedNodeId,
+                             &items[i].parentNodeId.nodeId, &items[i].referenceTypeId,
+                             &items[i].typeDefinition.nodeId, false, deferred);
+        }
+
+        results[i].statusCode = retval;
+        if(retval != UA_STATUSCODE_GOOD) {
+            /* Drop the references that were deferred before the failure */
+            while(dr.refsSize > 0 && dr.refs[dr.refsSize - 1].index == i) {
+                dr.refsSize--;
+                UA_AddReferencesItem_clear(&dr.refs[dr.refsSize].ref);
+            }
+            deleteNode(server, results[i].addedNodeId, true);
+            UA_NodeId_clear(&results[i].addedNodeId);
+            continue;
+        }
+        if(slot)
+            *slot = &items[i];
+    }
+    if(deferred)
+        flushDeferredReferences(server, session, &dr, results);
+
+    /* Remove the nodes whose deferred references could not be added */
+    for(size_t i = 0; i < itemsSize; i++) {
+        if(results[i].statusCode == UA_STATUSCODE_GOOD ||
+           UA_NodeId_isNull(&results[i].addedNodeId))
+            continue;
+        deleteNode(server, results[i].addedNodeId, true);
+        UA_NodeId_clear(&results[i].addedNodeId);
+    }
+
+    /* Instantiate the children and call the constructors. Browsing the type
+     * for children is done once per validated combination. */
+    for(size_t i = 0; i < itemsSize; i++) {
+        if(results[i].statusCode != UA_STATUSCODE_GOOD)
+            continue;
+        UA_Boolean addChildren = true;
+        if(vi.items && (items[i].nodeClass == UA_NODECLASS_VARIABLE ||
+                        items[i].nodeClass == UA_NODECLASS_OBJECT)) {
+            UA_Byte *tc = &vi.typeChildren[findValidatedItem(&vi, &items[i]) - vi.items];
+            if(*tc == UA_TYPECHILDREN_UNKNOWN) {
+                const UA_Node *node =
+                    UA_Nodestore_getNode(server->nsCtx, &results[i].addedNodeId);
+                const UA_Node *type = (node) ? getNodeType(server, node) : NULL;
+                if(type) {
+                    *tc = hasTypeChildren(server, session, &type->nodeId) ?
+                        UA_TYPECHILDREN_SOME : UA_TYPECHILDREN_NONE;
+                    UA_Nodestore_releaseNode(server->nsCtx, type);
+                }
+                if(node)
+                    UA_Nodestore_releaseNode(server->nsCtx, node);
+            }
+            addChildren = (*tc != UA_TYPECHILDREN_NONE);
+        }
+        results[i].statusCode =
+            addNodeFinish(server, session, &results[i].addedNodeId, addChildren);
+        if(results[i].statusCode != UA_STATUSCODE_GOOD)
+            UA_NodeId_clear(&results[i].addedNodeId);
+    }
+
+    UA_UNLOCK(server->serviceMutex);
+    if(vi.items) {
+        UA_free(vi.items);
+        UA_free(vi.typeChildren);
+    }
+    UA_free(dr.refs);
+    return UA_STATUSCODE_GOOD;
+}
+
 /****************/
 /* Delete Nodes */
 /****************/
@@ -1590,7 +2130,29 @@ recursiveDeleteNode(UA_Server *server, UA_Session *session,
     if(removeTargetRefs)
         removeIncomingReferences(server, session, node);
 
+    /* The type may remain referenced from the cached type hierarchy */
+    if(node->nodeClass == UA_NODECLASS_REFERENCETYPE ||
+       node->nodeClass == UA_NODECLASS_DATATYPE ||
+       node->nodeClass == UA_NODECLASS_OBJECTTYPE ||
+       node->nodeClass == UA_NODECLASS_VARIABLETYPE)
+        UA_TypeHierarchy_removeType(&server->typeHierarchy, &node->nodeId);
+
+    UA_ValueCache_remove(&server->valueCache, &node->nodeId);
+    UA_BrowsePathCache_invalidate(&server->browsePathCache, &node->nodeId);
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    /* The event MonitoredItems of the node are indexed for its children */
+    if(node->nodeClass == UA_NODECLASS_OBJECT &&
+       ((const UA_ObjectNode*)node)->monitoredItemQueue)
+        UA_EventIndex_clear(&server->eventIndex);
+    else
+        UA_EventIndex_remove(&server->eventIndex, &node->nodeId);
+#endif
     UA_Nodestore_removeNode(server->nsCtx, &node->nodeId);
+    server->nodestoreVersion++;
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /* The MonitoredItems that wait for a write get BadNodeIdUnknown */
+    notifyValueChanged(server, &node->nodeId);
+#endif
 }
 
 static void
@@ -1698,13 +2260,33 @@ deleteNode(UA_Server *server, const UA_NodeId nodeId,
 static UA_StatusCode
 addOneWayReference(UA_Server *server, UA_Session *session,
              UA_Node *node, const UA_AddReferencesItem *item) {
-    return UA_Node_addReference(node, item);
+    invalidateReferenceCaches(server, node, &item->referenceTypeId);
+    UA_StatusCode retval = UA_Node_addReference(node, item);
+#ifdef UA_ENABLE_STRING_INTERNING
+    if(retval == UA_STATUSCODE_GOOD)
+        UA_Node_internReferenceTarget(&server->stringPool, node, item);
+#endif
+    return retval;
 }
 
 static UA_StatusCode
 deleteOneWayReference(UA_Server *server, UA_Session *session, UA_Node *node,
                       const UA_DeleteReferencesItem *item) {
-    return UA_Node_deleteReference(node, item);
+    invalidateReferenceCaches(server, node, &item->referenceTypeId);
+    UA_StatusCode retval = UA_Node_deleteReference(node, item);
+
+    /* Update the supertypes below the removed HasSubtype reference */
+    if(retval == UA_STATUSCODE_GOOD &&
+       UA_NodeId_equal(&item->referenceTypeId, &subtypeId)) {
+        if(item->isForward)
+            UA_TypeHierarchy_removeSubtype(&server->typeHierarchy, &item->sourceNodeId,
+                                           &item->targetNodeId.nodeId);
+        else
+            UA_TypeHierarchy_removeSubtype(&server->typeHierarchy,
+                                           &item->targetNodeId.nodeId,
+                                           &item->sourceNodeId);
+    }
+    return retval;
 }
 
 static void
@@ -1729,6 +2311,15 @@ Operation_addReference(UA_Server *server, UA_Session *session, void *context,
         return;
     }
 
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    /* Virtual children become real nodes when they are referenced */
+    *retval = UA_VirtualNodes_materialize(server, &item->sourceNodeId);
+    if(*retval == UA_STATUSCODE_GOOD)
+        *retval = UA_VirtualNodes_materialize(server, &item->targetNodeId.nodeId);
+    if(*retval != UA_STATUSCODE_GOOD)
+        return;
+#endif
+
     /* Add the first direction */
     *retval = UA_Server_editNode(server, session, &item->sourceNodeId,
                                  (UA_EditNodeCallback)addOneWayReference,
@@ -1771,8 +2362,21 @@ Operation_addReference(UA_Server *server, UA_Session *session, void *context,
 
     /* Calculate common duplicate reference not allowed result and set bad result
      * if BOTH directions already existed */
-    if(firstExisted && secondExisted)
+    if(firstExisted && secondExisted) {
         *retval = UA_STATUSCODE_BADDUPLICATEREFERENCENOTALLOWED;
+        return;
+    }
+
+    /* Merge new HasSubtype references into the cached type hierarchy */
+    if(*retval == UA_STATUSCODE_GOOD && server->typeHierarchy.valid &&
+       UA_NodeId_equal(&item->referenceTypeId, &subtypeId)) {
+        if(item->isForward)
+            UA_TypeHierarchy_addSubtype(&server->typeHierarchy, &item->sourceNodeId,
+                                        &item->targetNodeId.nodeId);
+        else
+            UA_TypeHierarchy_addSubtype(&server->typeHierarchy,
+                                        &item->targetNodeId.nodeId, &item->sourceNodeId);
+    }
 }
 
 void Service_AddReferences(UA_Server *server, UA_Session *session,
@@ -1922,6 +2526,11 @@ UA_Server_setVariableNode_valueCallback(UA_Server *server,
                                               (UA_EditNodeCallback)setValueCallback,
                                               /* cast away const because callback uses const anyway */
                                               (UA_ValueCallback *)(uintptr_t) &callback);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /* The value can change without a write in the onRead callback */
+    if(retval == UA_STATUSCODE_GOOD)
+        reviewSampleOnWrite(server, &nodeId);
+#endif
     UA_UNLOCK(server->serviceMutex);
     return retval;
 }
@@ -1992,6 +2601,8 @@ setDataSource(UA_Server *server, UA_Session *session,
         UA_DataValue_clear(&node->value.data.value);
     node->value.dataSource = *dataSource;
     node->valueSource = UA_VALUESOURCE_DATASOURCE;
+    node->readBatch = NULL;
+    UA_ValueCache_remove(&server->valueCache, &node->nodeId);
     return UA_STATUSCODE_GOOD;
 }
 
@@ -1999,10 +2610,17 @@ UA_StatusCode
 setVariableNode_dataSource(UA_Server *server, const UA_NodeId nodeId,
                                      const UA_DataSource dataSource) {
     UA_LOCK_ASSERT(server->serviceMutex, 1);
-    return UA_Server_editNode(server, &server->adminSession, &nodeId,
-                              (UA_EditNodeCallback)setDataSource,
-                              /* casting away const because callback casts it back anyway */
-                              (UA_DataSource *) (uintptr_t)&dataSource);
+    UA_StatusCode retval =
+        UA_Server_editNode(server, &server->adminSession, &nodeId,
+                           (UA_EditNodeCallback)setDataSource,
+                           /* casting away const because callback casts it back anyway */
+                           (UA_DataSource *) (uintptr_t)&dataSource);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /* The value of a DataSource can change without a write */
+    if(retval == UA_STATUSCODE_GOOD)
+        reviewSampleOnWrite(server, &nodeId);
+#endif
+    return retval;
 }
 
 UA_StatusCode
@@ -2014,6 +2632,32 @@ UA_Server_setVariableNode_dataSource(UA_Server *server, const UA_NodeId nodeId,
     return retval;
 }
 
+static UA_StatusCode
+setDataSourceReadBatch(UA_Server *server, UA_Session *session,
+                       UA_VariableNode *node, UA_DataSourceReadBatch *readBatch) {
+    if(node->nodeClass != UA_NODECLASS_VARIABLE)
+        return UA_STATUSCODE_BADNODECLASSINVALID;
+    if(node->valueSource != UA_VALUESOURCE_DATASOURCE)
+        return UA_STATUSCODE_BADINTERNALERROR;
+    node->readBatch = *readBatch;
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode
+UA_Server_setVariableNode_dataSourceReadBatch(UA_Server *server, const UA_NodeId nodeId,
+                                              const UA_DataSourceReadBatch readBatch) {
+    UA_LOCK(server->serviceMutex);
+    UA_StatusCode retval =
+        UA_Server_editNode(server, &server->adminSession, &nodeId,
+                           (UA_EditNodeCallback)setDataSourceReadBatch,
+                           /* casting away const because callback casts it back anyway */
+                           (UA_DataSourceReadBatch*)(uintptr_t)&readBatch);
+    if(retval == UA_STATUSCODE_GOOD && readBatch)
+        server->hasReadBatch = true;
+    UA_UNLOCK(server->serviceMutex);
+    return retval;
+}
+
 /************************************/
 /* Special Handling of Method Nodes */
 /************************************/
@@ -250,6 +250,11 @@ referenceSubtypes(UA_Server *server, const UA_NodeId *refType,
     if(UA_NodeId_isNull(refType))
         return UA_STATUSCODE_GOOD;
 
+    /* Use the cached type hierarchy */
+    const UA_TypeHierarchy *th = getTypeHierarchy(server);
+    if(th)
+        return UA_TypeHierarchy_getSubtypes(th, refType, refTypesSize, refTypes);
+
     /* Browse recursive for the hierarchy of sub-references */
     UA_ExpandedNodeId *rt = NULL;
     size_t rtSize = 0;
@@ -479,13 +484,13 @@ browseReferences(UA_Server *server, const UA_Node *node,
             /* Get the node if it is not a remote reference */
             if(rk->refTargets[targetIndex].target.serverIndex == 0 &&
                rk->refTargets[targetIndex].target.namespaceUri.data == NULL) {
-                target = UA_Nodestore_getNode(server->nsCtx,
-                                              &rk->refTargets[targetIndex].target.nodeId);
+                target = getNodeOrVirtual(server,
+                                          &rk->refTargets[targetIndex].target.nodeId);
 
                 /* Test if the node class matches */
                 if(target && !matchClassMask(target, bd->nodeClassMask)) {
                     if(target)
-                        UA_Nodestore_releaseNode(server->nsCtx, target);
+                        releaseNodeOrVirtual(server, target);
                     continue;
                 }
             }
@@ -495,14 +500,14 @@ browseReferences(UA_Server *server, const UA_Node *node,
                 cp->referenceKindIndex = referenceKindIndex;
                 cp->targetIndex = targetIndex;
                 if(target)
-                    UA_Nodestore_releaseNode(server->nsCtx, target);
+                    releaseNodeOrVirtual(server, target);
                 return UA_STATUSCODE_GOOD;
             }
 
             /* Copy the node description. Target is on top of the stack */
             retval = addReferenceDescription(server, rr, rk, bd->resultMask,
                                              &rk->refTargets[targetIndex].target, target);
-            UA_Nodestore_releaseNode(server->nsCtx, target);
+            releaseNodeOrVirtual(server, target);
             if(retval != UA_STATUSCODE_GOOD)
                 return retval;
         }
@@ -549,7 +554,8 @@ browseWithContinuation(UA_Server *server, UA_Session *session,
         }
     }
 
-    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &descr->nodeId);
+    const UA_Node *node =
+        getNodeOrVirtual(server, UA_Session_resolveNodeId(session, &descr->nodeId));
     if(!node) {
         result->statusCode = UA_STATUSCODE_BADNODEIDUNKNOWN;
         return true;
@@ -558,14 +564,14 @@ browseWithContinuation(UA_Server *server, UA_Session *session,
     RefResult rr;
     result->statusCode = RefResult_init(&rr);
     if(result->statusCode != UA_STATUSCODE_GOOD) {
-        UA_Nodestore_releaseNode(server->nsCtx, node);
+        releaseNodeOrVirtual(server, node);
         return true;
     }
 
     /* Browse the references */
     UA_Boolean done = false;
     result->statusCode = browseReferences(server, node, cp, &rr, &done);
-    UA_Nodestore_releaseNode(server->nsCtx, node);
+    releaseNodeOrVirtual(server, node);
     if(result->statusCode != UA_STATUSCODE_GOOD) {
         RefResult_clear(&rr);
         return true;
@@ -701,6 +707,18 @@ Operation_Browse(UA_Server *server, UA_Session *session, const UA_UInt32 *maxref
     result->statusCode = retval;
 }
 
+/* Operation_Browse is also used internally, e.g. when nodes are added. Only
+ * the Browse service aborts after the deadline. */
+static void
+browseOperation(UA_Server *server, UA_Session *session, const UA_UInt32 *maxrefs,
+                const UA_BrowseDescription *descr, UA_BrowseResult *result) {
+    if(UA_Session_checkDeadline(session)) {
+        result->statusCode = UA_STATUSCODE_BADTIMEOUT;
+        return;
+    }
+    Operation_Browse(server, session, maxrefs, descr, result);
+}
+
 void Service_Browse(UA_Server *server, UA_Session *session,
                     const UA_BrowseRequest *request, UA_BrowseResponse *response) {
     UA_LOG_DEBUG_SESSION(&server->config.logger, session, "Processing BrowseRequest");
@@ -720,10 +738,11 @@ void Service_Browse(UA_Server *server, UA_Session *session,
     }
 
     response->responseHeader.serviceResult =
-        UA_Server_processServiceOperations(server, session, (UA_ServiceOperation)Operation_Browse,
-                                           &request->requestedMaxReferencesPerNode,
-                                           &request->nodesToBrowseSize, &UA_TYPES[UA_TYPES_BROWSEDESCRIPTION],
-                                           &response->resultsSize, &UA_TYPES[UA_TYPES_BROWSERESULT]);
+        UA_Server_processServiceOperationsParallel(server, session,
+                                                   (UA_ServiceOperation)browseOperation,
+                                                   &request->requestedMaxReferencesPerNode,
+                                                   &request->nodesToBrowseSize, &UA_TYPES[UA_TYPES_BROWSEDESCRIPTION],
+                                                   &response->resultsSize, &UA_TYPES[UA_TYPES_BROWSERESULT]);
 }
 
 UA_BrowseResult
@@ -761,6 +780,12 @@ Operation_BrowseNext(UA_Server *server, UA_Session *session,
         return;
     }
 
+    /* The cp is kept and can be used again */
+    if(UA_Session_checkDeadline(session)) {
+        result->statusCode = UA_STATUSCODE_BADTIMEOUT;
+        return;
+    }
+
     /* Continue browsing */
     UA_Boolean done = browseWithContinuation(server, session, cp, result);
 
@@ -858,16 +883,35 @@ walkBrowsePathElementReferenceTargets(UA_BrowsePathResult *result, size_t *targe
     }
 }
 
+/* Records a node that was evaluated for the result. Results that depend on
+ * virtual children are not cached. The children change with the instance
+ * declaration of the type. */
+static void
+addBrowsePathDep(UA_BrowsePathDeps *deps, const UA_NodeId *nodeId,
+                 UA_Boolean references) {
+    if(!deps)
+        return;
+#ifdef UA_ENABLE_VIRTUAL_NODES
+    if(UA_VirtualNodes_isVirtualNodeId(nodeId)) {
+        deps->status = UA_STATUSCODE_BADNOTSUPPORTED;
+        return;
+    }
+#endif
+    UA_BrowsePathDeps_add(deps, nodeId, references);
+}
+
 static void
 walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClassMask,
                       UA_BrowsePathResult *result, size_t *targetsSize,
                       const UA_RelativePathElement *elem, UA_UInt32 elemDepth,
                       const UA_QualifiedName *targetName,
                       const UA_NodeId *current, const size_t currentCount,
-                      UA_NodeId **next, size_t *nextSize, size_t *nextCount) {
+                      UA_NodeId **next, size_t *nextSize, size_t *nextCount,
+                      UA_BrowsePathDeps *deps) {
     /* Return all references? */
     UA_Boolean all_refs = UA_NodeId_isNull(&elem->referenceTypeId);
     if(!all_refs) {
+        addBrowsePathDep(deps, &elem->referenceTypeId, false);
         const UA_Node *rootRef = UA_Nodestore_getNode(server->nsCtx, &elem->referenceTypeId);
         if(!rootRef)
             return;
@@ -880,7 +924,8 @@ walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClas
     /* Iterate over all nodes at the current depth-level */
     for(size_t i = 0; i < currentCount; ++i) {
         /* Get the node */
-        const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &current[i]);
+        addBrowsePathDep(deps, &current[i], false);
+        const UA_Node *node = getNodeOrVirtual(server, &current[i]);
         if(!node) {
             /* If we cannot find the node at depth 0, the starting node does not exist */
             if(elemDepth == 0)
@@ -890,7 +935,7 @@ walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClas
 
         /* Test whether the node fits the class mask */
         if(!matchClassMask(node, nodeClassMask)) {
-            UA_Nodestore_releaseNode(server->nsCtx, node);
+            releaseNodeOrVirtual(server, node);
             continue;
         }
 
@@ -898,11 +943,12 @@ walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClas
          * path element */
         if(targetName && (targetName->namespaceIndex != node->browseName.namespaceIndex ||
                           !UA_String_equal(&targetName->name, &node->browseName.name))) {
-            UA_Nodestore_releaseNode(server->nsCtx, node);
+            releaseNodeOrVirtual(server, node);
             continue;
         }
 
         /* Loop over the nodes references */
+        addBrowsePathDep(deps, &current[i], true);
         for(size_t r = 0; r < node->referencesSize &&
                 result->statusCode == UA_STATUSCODE_GOOD; ++r) {
             UA_NodeReferenceKind *rk = &node->references[r];
@@ -915,7 +961,7 @@ walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClas
             if(!all_refs) {
                 if(!elem->includeSubtypes && !UA_NodeId_equal(&rk->referenceTypeId, &elem->referenceTypeId))
                     continue;
-                if(!isNodeInTree(server->nsCtx, &rk->referenceTypeId, &elem->referenceTypeId, &subtypeId, 1))
+                if(!isNodeInTree(server, &rk->referenceTypeId, &elem->referenceTypeId, &subtypeId, 1))
                     continue;
             }
 
@@ -924,7 +970,7 @@ walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClas
                                                   nextCount, elemDepth, rk);
         }
 
-        UA_Nodestore_releaseNode(server->nsCtx, node);
+        releaseNodeOrVirtual(server, node);
     }
 }
 
@@ -932,9 +978,10 @@ walkBrowsePathElement(UA_Server *server, UA_Session *session, UA_UInt32 nodeClas
 static void
 addBrowsePathTargets(UA_Server *server, UA_Session *session, UA_UInt32 nodeClassMask,
                      UA_BrowsePathResult *result, const UA_QualifiedName *targetName,
-                     UA_NodeId *current, size_t currentCount) {
+                     UA_NodeId *current, size_t currentCount, UA_BrowsePathDeps *deps) {
     for(size_t i = 0; i < currentCount; i++) {
-        const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &current[i]);
+        addBrowsePathDep(deps, &current[i], false);
+        const UA_Node *node = getNodeOrVirtual(server, &current[i]);
         if(!node) {
             UA_NodeId_clear(&current[i]);
             continue;
@@ -949,7 +996,7 @@ addBrowsePathTargets(UA_Server *server, UA_Session *session, UA_UInt32 nodeClass
            !UA_String_equal(&targetName->name, &node->browseName.name))
             skip = true;
 
-        UA_Nodestore_releaseNode(server->nsCtx, node);
+        releaseNodeOrVirtual(server, node);
 
         if(skip) {
             UA_NodeId_clear(&current[i]);
@@ -965,10 +1012,11 @@ addBrowsePathTargets(UA_Server *server, UA_Session *session, UA_UInt32 nodeClass
 }
 
 static void
-walkBrowsePath(UA_Server *server, UA_Session *session, const UA_BrowsePath *path,
+walkBrowsePath(UA_Server *server, UA_Session *session, const UA_RelativePath *path,
                UA_UInt32 nodeClassMask, UA_BrowsePathResult *result, size_t targetsSize,
                UA_NodeId **current, size_t *currentSize, size_t *currentCount,
-               UA_NodeId **next, size_t *nextSize, size_t *nextCount) {
+               UA_NodeId **next, size_t *nextSize, size_t *nextCount,
+               UA_BrowsePathDeps *deps) {
     UA_assert(*currentCount == 1);
     UA_assert(*nextCount == 0);
 
@@ -976,11 +1024,12 @@ walkBrowsePath(UA_Server *server, UA_Session *session, const UA_BrowsePath *path
     const UA_QualifiedName *targetName = NULL;
 
     /* Iterate over path elements */
-    UA_assert(path->relativePath.elementsSize > 0);
-    for(UA_UInt32 i = 0; i < path->relativePath.elementsSize; ++i) {
+    UA_assert(path->elementsSize > 0);
+    for(UA_UInt32 i = 0; i < path->elementsSize; ++i) {
         walkBrowsePathElement(server, session, nodeClassMask, result, &targetsSize,
-                              &path->relativePath.elements[i], i, targetName,
-                              *current, *currentCount, next, nextSize, nextCount);
+                              &path->elements[i], i, targetName,
+                              *current, *currentCount, next, nextSize, nextCount,
+                              deps);
 
         /* Clean members of current */
         for(size_t j = 0; j < *currentCount; j++)
@@ -1001,7 +1050,7 @@ walkBrowsePath(UA_Server *server, UA_Session *session, const UA_BrowsePath *path
         *nextSize = tSize; *nextCount = tCount; *next = tT;
 
         /* Store the target name of the previous path element */
-        targetName = &path->relativePath.elements[i].targetName;
+        targetName = &path->elements[i].targetName;
     }
 
     UA_assert(targetName != NULL);
@@ -1026,29 +1075,15 @@ walkBrowsePath(UA_Server *server, UA_Session *session, const UA_BrowsePath *path
     }
 
     /* Move the elements of current to the targets */
-    addBrowsePathTargets(server, session, nodeClassMask, result, targetName, *current, *currentCount);
+    addBrowsePathTargets(server, session, nodeClassMask, result, targetName,
+                         *current, *currentCount, deps);
     *currentCount = 0;
 }
 
 static void
-Operation_TranslateBrowsePathToNodeIds(UA_Server *server, UA_Session *session,
-                                       const UA_UInt32 *nodeClassMask, const UA_BrowsePath *path,
-                                       UA_BrowsePathResult *result) {
-    UA_LOCK_ASSERT(server->serviceMutex, 1);
-
-    if(path->relativePath.elementsSize <= 0) {
-        result->statusCode = UA_STATUSCODE_BADNOTHINGTODO;
-        return;
-    }
-
-    /* RelativePath elements must not have an empty targetName */
-    for(size_t i = 0; i < path->relativePath.elementsSize; ++i) {
-        if(UA_QualifiedName_isNull(&path->relativePath.elements[i].targetName)) {
-            result->statusCode = UA_STATUSCODE_BADBROWSENAMEINVALID;
-            return;
-        }
-    }
-
+translateBrowsePath(UA_Server *server, UA_Session *session, UA_UInt32 nodeClassMask,
+                    const UA_NodeId *startingNode, const UA_RelativePath *relativePath,
+                    UA_BrowsePathResult *result, UA_BrowsePathDeps *deps) {
     /* Allocate memory for the targets */
     size_t targetsSize = 10; /* When to realloc; the member count is stored in
                               * result->targetsSize */
@@ -1081,7 +1116,7 @@ Operation_TranslateBrowsePathToNodeIds(UA_Server *server, UA_Session *session,
     }
 
     /* Copy the starting node into current */
-    result->statusCode = UA_NodeId_copy(&path->startingNode, &current[0]);
+    result->statusCode = UA_NodeId_copy(startingNode, &current[0]);
     if(result->statusCode != UA_STATUSCODE_GOOD) {
         UA_free(result->targets);
         UA_free(current);
@@ -1091,9 +1126,9 @@ Operation_TranslateBrowsePathToNodeIds(UA_Server *server, UA_Session *session,
     currentCount = 1;
 
     /* Walk the path elements */
-    walkBrowsePath(server, session, path, *nodeClassMask, result, targetsSize,
+    walkBrowsePath(server, session, relativePath, nodeClassMask, result, targetsSize,
                    &current, &currentSize, &currentCount,
-                   &next, &nextSize, &nextCount);
+                   &next, &nextSize, &nextCount, deps);
 
     UA_assert(currentCount == 0);
     UA_assert(nextCount == 0);
@@ -1114,6 +1149,61 @@ Operation_TranslateBrowsePathToNodeIds(UA_Server *server, UA_Session *session,
     }
 }
 
+static void
+Operation_TranslateBrowsePathToNodeIds(UA_Server *server, UA_Session *session,
+                                       const UA_UInt32 *nodeClassMask, const UA_BrowsePath *path,
+                                       UA_BrowsePathResult *result) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+
+    if(UA_Session_checkDeadline(session)) {
+        result->statusCode = UA_STATUSCODE_BADTIMEOUT;
+        return;
+    }
+
+    if(path->relativePath.elementsSize <= 0) {
+        result->statusCode = UA_STATUSCODE_BADNOTHINGTODO;
+        return;
+    }
+
+    /* RelativePath elements must not have an empty targetName */
+    for(size_t i = 0; i < path->relativePath.elementsSize; ++i) {
+        if(UA_QualifiedName_isNull(&path->relativePath.elements[i].targetName)) {
+            result->statusCode = UA_STATUSCODE_BADBROWSENAMEINVALID;
+            return;
+        }
+    }
+
+    const UA_NodeId *startingNode = UA_Session_resolveNodeId(session, &path->startingNode);
+    if(server->config.browsePathCacheSize == 0) {
+        translateBrowsePath(server, session, *nodeClassMask, startingNode,
+                            &path->relativePath, result, NULL);
+        return;
+    }
+
+    /* Take the result from the cache */
+    UA_StatusCode retval =
+        UA_BrowsePathCache_get(&server->browsePathCache, startingNode, *nodeClassMask,
+                               &path->relativePath, result);
+    if(retval != UA_STATUSCODE_BADNOTFOUND) {
+        if(retval != UA_STATUSCODE_GOOD)
+            result->statusCode = retval;
+        return;
+    }
+
+    /* Translate and record the evaluated nodes for the invalidation. Only
+     * complete results are cached. */
+    UA_BrowsePathDeps deps;
+    memset(&deps, 0, sizeof(UA_BrowsePathDeps));
+    translateBrowsePath(server, session, *nodeClassMask, startingNode,
+                        &path->relativePath, result, &deps);
+    if(result->statusCode == UA_STATUSCODE_GOOD ||
+       result->statusCode == UA_STATUSCODE_BADNOMATCH)
+        UA_BrowsePathCache_store(&server->browsePathCache, server->config.browsePathCacheSize,
+                                 startingNode, *nodeClassMask, &path->relativePath,
+                                 result, &deps);
+    UA_BrowsePathDeps_clear(&deps);
+}
+
 UA_BrowsePathResult
 translateBrowsePathToNodeIds(UA_Server *server,
                                        const UA_BrowsePath *browsePath) {
@@ -1206,7 +1296,6 @@ void Service_RegisterNodes(UA_Server *server, UA_Session *session,
                          "Processing RegisterNodesRequest");
     UA_LOCK_ASSERT(server->serviceMutex, 1);
 
-    //TODO: hang the nodeids to the session if really needed
     if(request->nodesToRegisterSize == 0) {
         response->responseHeader.serviceResult = UA_STATUSCODE_BADNOTHINGTODO;
         return;
@@ -1219,11 +1308,32 @@ void Service_RegisterNodes(UA_Server *server, UA_Session *session,
         return;
     }
 
-    response->responseHeader.serviceResult =
-        UA_Array_copy(request->nodesToRegister, request->nodesToRegisterSize,
-                      (void**)&response->registeredNodeIds, &UA_TYPES[UA_TYPES_NODEID]);
-    if(response->responseHeader.serviceResult == UA_STATUSCODE_GOOD)
-        response->registeredNodeIdsSize = request->nodesToRegisterSize;
+    response->registeredNodeIds = (UA_NodeId*)
+        UA_Array_new(request->nodesToRegisterSize, &UA_TYPES[UA_TYPES_NODEID]);
+    if(!response->registeredNodeIds) {
+        response->responseHeader.serviceResult = UA_STATUSCODE_BADOUTOFMEMORY;
+        return;
+    }
+    response->registeredNodeIdsSize = request->nodesToRegisterSize;
+
+    /* Return an alias that points to the node in the session */
+    for(size_t i = 0; i < request->nodesToRegisterSize; i++) {
+        UA_StatusCode retval =
+            UA_Session_registerNode(server, session, &request->nodesToRegister[i],
+                                    &response->registeredNodeIds[i]);
+        if(retval != UA_STATUSCODE_GOOD) {
+            /* Unregister what was registered so far */
+            for(size_t j = 0; j < i; j++)
+                UA_Session_unregisterNode(server, session,
+                                          &response->registeredNodeIds[j]);
+            UA_Array_delete(response->registeredNodeIds, response->registeredNodeIdsSize,
+                            &UA_TYPES[UA_TYPES_NODEID]);
+            response->registeredNodeIds = NULL;
+            response->registeredNodeIdsSize = 0;
+            response->responseHeader.serviceResult = retval;
+            return;
+        }
+    }
 }
 
 void Service_UnregisterNodes(UA_Server *server, UA_Session *session,
@@ -1233,7 +1343,6 @@ void Service_UnregisterNodes(UA_Server *server, UA_Session *session,
                          "Processing UnRegisterNodesRequest");
     UA_LOCK_ASSERT(server->serviceMutex, 1);
 
-    //TODO: remove the nodeids from the session if really needed
     if(request->nodesToUnregisterSize == 0)
         response->responseHeader.serviceResult = UA_STATUSCODE_BADNOTHINGTODO;
 
@@ -1243,4 +1352,7 @@ void Service_UnregisterNodes(UA_Server *server, UA_Session *session,
         response->responseHeader.serviceResult = UA_STATUSCODE_BADTOOMANYOPERATIONS;
         return;
     }
+
+    for(size_t i = 0; i < request->nodesToUnregisterSize; i++)
+        UA_Session_unregisterNode(server, session, &request->nodesToUnregister[i]);
 }
@@ -7,8 +7,8 @@
  */
 
 #include "ua_session.h"
-#ifdef UA_ENABLE_SUBSCRIPTIONS
 #include "ua_server_internal.h"
+#ifdef UA_ENABLE_SUBSCRIPTIONS
 #include "ua_subscription.h"
 #endif
 
@@ -37,6 +37,20 @@ void UA_Session_deleteMembersCleanup(UA_Session *session, UA_Server* server) {
     }
     session->continuationPoints = NULL;
     session->availableContinuationPoints = UA_MAXCONTINUATIONPOINTS;
+    for(size_t i = 0; i < session->registeredNodesSize; i++) {
+        UA_RegisteredNode *rn = &session->registeredNodes[i];
+        if(rn->node)
+            UA_Nodestore_releaseNode(server->nsCtx, rn->node);
+        UA_NodeId_deleteMembers(&rn->nodeId);
+    }
+    UA_free(session->registeredNodes);
+    session->registeredNodes = NULL;
+    session->registeredNodesSize = 0;
+    session->registeredNodesCount = 0;
+    UA_Session_releasePinnedNodes(server, session);
+    UA_free(session->pinnedNodes);
+    session->pinnedNodes = NULL;
+    session->pinnedNodesSize = 0;
 }
 
 void UA_Session_attachToSecureChannel(UA_Session *session, UA_SecureChannel *channel) {
@@ -75,6 +89,169 @@ void UA_Session_updateLifetime(UA_Session *session) {
         (UA_DateTime)(session->timeout * UA_DATETIME_MSEC);
 }
 
+/********************/
+/* Registered Nodes */
+/********************/
+
+static UA_RegisteredNode *
+getRegisteredNode(const UA_Session *session, const UA_NodeId *alias) {
+    if(alias->namespaceIndex != UA_REGISTEREDNODES_NS ||
+       alias->identifierType != UA_NODEIDTYPE_NUMERIC)
+        return NULL;
+    UA_UInt32 index = alias->identifier.numeric - 1;
+    if(index >= session->registeredNodesSize)
+        return NULL;
+    UA_RegisteredNode *rn = &session->registeredNodes[index];
+    if(UA_NodeId_isNull(&rn->nodeId))
+        return NULL;
+    return rn;
+}
+
+UA_StatusCode
+UA_Session_registerNode(UA_Server *server, UA_Session *session,
+                        const UA_NodeId *nodeId, UA_NodeId *alias) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+
+    /* Only existing nodes get an alias. Registering an alias once more returns
+     * the alias. */
+    const UA_Node *node = getNodeOrVirtual(server, nodeId);
+    if(!node)
+        return UA_NodeId_copy(nodeId, alias);
+    releaseNodeOrVirtual(server, node);
+
+    /* The node is already registered */
+    size_t index = session->registeredNodesSize;
+    for(size_t i = 0; i < session->registeredNodesSize; i++) {
+        UA_RegisteredNode *rn = &session->registeredNodes[i];
+        if(UA_NodeId_equal(&rn->nodeId, nodeId)) {
+            rn->registrations++;
+            *alias = UA_NODEID_NUMERIC(UA_REGISTEREDNODES_NS, (UA_UInt32)i + 1);
+            return UA_STATUSCODE_GOOD;
+        }
+        if(index == session->registeredNodesSize && UA_NodeId_isNull(&rn->nodeId))
+            index = i;
+    }
+
+    /* Too many registered nodes. Fall back to the original NodeId. */
+    if(session->registeredNodesCount >= UA_MAXREGISTEREDNODES)
+        return UA_NodeId_copy(nodeId, alias);
+
+    /* Grow the array */
+    if(index == session->registeredNodesSize) {
+        size_t newSize = session->registeredNodesSize * 2;
+        if(newSize == 0)
+            newSize = 8;
+        UA_RegisteredNode *rns = (UA_RegisteredNode*)
+            UA_realloc(session->registeredNodes, sizeof(UA_RegisteredNode) * newSize);
+        if(!rns)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        memset(&rns[session->registeredNodesSize], 0,
+               sizeof(UA_RegisteredNode) * (newSize - session->registeredNodesSize));
+        session->registeredNodes = rns;
+        session->registeredNodesSize = newSize;
+    }
+
+    UA_RegisteredNode *rn = &session->registeredNodes[index];
+    UA_StatusCode retval = UA_NodeId_copy(nodeId, &rn->nodeId);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    rn->registrations = 1;
+    session->registeredNodesCount++;
+    *alias = UA_NODEID_NUMERIC(UA_REGISTEREDNODES_NS, (UA_UInt32)index + 1);
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_Session_unregisterNode(UA_Server *server, UA_Session *session,
+                          const UA_NodeId *alias) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    UA_RegisteredNode *rn = getRegisteredNode(session, alias);
+    if(!rn)
+        return;
+    rn->registrations--;
+    if(rn->registrations > 0)
+        return;
+    if(rn->node)
+        UA_Nodestore_releaseNode(server->nsCtx, rn->node);
+    UA_NodeId_deleteMembers(&rn->nodeId);
+    memset(rn, 0, sizeof(UA_RegisteredNode));
+    session->registeredNodesCount--;
+}
+
+const UA_NodeId *
+UA_Session_resolveNodeId(const UA_Session *session, const UA_NodeId *nodeId) {
+    if(!session)
+        return nodeId;
+    UA_RegisteredNode *rn = getRegisteredNode(session, nodeId);
+    return (rn) ? &rn->nodeId : nodeId;
+}
+
+const UA_Node *
+UA_Session_getRegisteredNode(UA_Server *server, UA_Session *session,
+                             const UA_NodeId *nodeId) {
+#ifdef UA_ENABLE_NODESTORE_SWITCH
+    /* The cached nodes could outlive the backend of their namespace */
+    return NULL;
+#else
+    if(!session)
+        return NULL;
+    UA_RegisteredNode *rn = getRegisteredNode(session, nodeId);
+    if(!rn)
+        return NULL;
+
+    /* The cached node is current if no node was removed or replaced since */
+    if(rn->node && rn->nodestoreVersion == server->nodestoreVersion)
+        return rn->node;
+
+    /* Look up the node again. The reference is kept for the cache. */
+    if(rn->node)
+        UA_Nodestore_releaseNode(server->nsCtx, rn->node);
+    rn->node = UA_Nodestore_getNode(server->nsCtx, &rn->nodeId);
+    rn->nodestoreVersion = server->nodestoreVersion;
+    return rn->node;
+#endif
+}
+
+UA_StatusCode
+UA_Session_pinNode(UA_Session *session, const UA_Node *node) {
+    if(session->pinnedNodesCount >= session->pinnedNodesSize) {
+        if(session->pinnedNodesSize >= UA_MAXPINNEDNODES)
+            return UA_STATUSCODE_BADRESOURCEUNAVAILABLE;
+        size_t newSize = session->pinnedNodesSize * 2;
+        if(newSize == 0)
+            newSize = 16;
+        const UA_Node **newPinned = (const UA_Node**)
+            UA_realloc((void*)session->pinnedNodes, sizeof(const UA_Node*) * newSize);
+        if(!newPinned)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        session->pinnedNodes = newPinned;
+        session->pinnedNodesSize = newSize;
+    }
+    session->pinnedNodes[session->pinnedNodesCount] = node;
+    session->pinnedNodesCount++;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_Session_releasePinnedNodes(UA_Server *server, UA_Session *session) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    /* Keep the array for the next request */
+    for(size_t i = 0; i < session->pinnedNodesCount; i++)
+        releaseNodeOrVirtual(server, session->pinnedNodes[i]);
+    session->pinnedNodesCount = 0;
+}
+
+UA_Boolean
+UA_Session_checkDeadline(UA_Session *session) {
+    if(session->requestTimedOut)
+        return true;
+    if(session->requestDeadline == 0 ||
+       UA_DateTime_nowMonotonic() <= session->requestDeadline)
+        return false;
+    session->requestTimedOut = true;
+    return true;
+}
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
 void UA_Session_addSubscription(UA_Server *server, UA_Session *session, UA_Subscription *newSubscription) {
@@ -9,12 +9,18 @@
 #define UA_SESSION_H_
 
 #include <open62541/util.h>
+#include <open62541/plugin/nodestore.h>
 
 #include "ua_securechannel.h"
 
 _UA_BEGIN_DECLS
 
 #define UA_MAXCONTINUATIONPOINTS 5
+#define UA_MAXREGISTEREDNODES 4096
+#define UA_MAXPINNEDNODES 16384
+
+/* Namespace index of the alias NodeIds returned by RegisterNodes */
+#define UA_REGISTEREDNODES_NS 0xFFFF
 
 struct ContinuationPoint;
 typedef struct ContinuationPoint ContinuationPoint;
@@ -34,6 +40,13 @@ typedef struct UA_PublishResponseEntry {
 } UA_PublishResponseEntry;
 #endif
 
+typedef struct {
+    UA_NodeId nodeId;          /* Null if the entry is unused */
+    UA_UInt32 registrations;
+    const UA_Node *node;       /* Cached node (holds a nodestore reference) */
+    UA_UInt64 nodestoreVersion;
+} UA_RegisteredNode;
+
 typedef struct {
     UA_SessionHeader  header;
     UA_ApplicationDescription clientDescription;
@@ -48,6 +61,15 @@ typedef struct {
     UA_ByteString     serverNonce;
     UA_UInt16 availableContinuationPoints;
     ContinuationPoint *continuationPoints;
+    size_t registeredNodesSize;
+    size_t registeredNodesCount; /* Used entries */
+    UA_RegisteredNode *registeredNodes; /* The alias is the index + 1 */
+    size_t pinnedNodesSize;
+    size_t pinnedNodesCount;
+    const UA_Node **pinnedNodes; /* Referenced by the response in processing */
+    UA_DateTime requestDeadline; /* Of the request in processing. Monotonic time.
+                                  * 0 if the request has no timeoutHint. */
+    UA_Boolean requestTimedOut;  /* Operations were skipped after the deadline */
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     UA_UInt32 lastSubscriptionId;
     UA_UInt32 lastSeenSubscriptionId;
@@ -72,6 +94,66 @@ UA_StatusCode UA_Session_generateNonce(UA_Session *session);
 /* If any activity on a session happens, the timeout is extended */
 void UA_Session_updateLifetime(UA_Session *session);
 
+/**
+ * Registered Nodes
+ * ----------------
+ * RegisterNodes returns numeric alias NodeIds in the namespace
+ * UA_REGISTEREDNODES_NS. The alias is only valid within the session. */
+
+/* Returns the alias for the NodeId. The alias is the NodeId itself if the node
+ * cannot be registered. */
+UA_StatusCode
+UA_Session_registerNode(UA_Server *server, UA_Session *session,
+                        const UA_NodeId *nodeId, UA_NodeId *alias);
+
+void
+UA_Session_unregisterNode(UA_Server *server, UA_Session *session,
+                          const UA_NodeId *alias);
+
+/* Returns the registered NodeId behind an alias. Otherwise the argument is
+ * returned. */
+const UA_NodeId *
+UA_Session_resolveNodeId(const UA_Session *session, const UA_NodeId *nodeId);
+
+/* Returns the cached node behind an alias without a nodestore lookup. The node
+ * is owned by the session and must not be released. Returns NULL if the
+ * NodeId is no alias or if the node is not cached. Then the node has to be
+ * looked up for the NodeId from UA_Session_resolveNodeId. */
+const UA_Node *
+UA_Session_getRegisteredNode(UA_Server *server, UA_Session *session,
+                             const UA_NodeId *nodeId);
+
+/**
+ * Pinned Nodes
+ * ------------
+ * The Read service can return values that point into the node
+ * (UA_VARIANT_DATA_NODELETE) instead of copying them. The nodes are pinned in
+ * the session with their nodestore reference until the response is encoded.
+ * This is only safe with UA_ENABLE_IMMUTABLE_NODES where nodes are replaced
+ * instead of edited in place. */
+
+/* Takes over the nodestore reference of the node. Fails if too many nodes are
+ * pinned already. */
+UA_StatusCode
+UA_Session_pinNode(UA_Session *session, const UA_Node *node);
+
+/* Releases the pinned nodes. Call this once the response has been encoded. */
+void
+UA_Session_releasePinnedNodes(UA_Server *server, UA_Session *session);
+
+/**
+ * Request Deadline
+ * ----------------
+ * The deadline of a request follows from its timeoutHint and the time it was
+ * received. Services with many operations that only read from the information
+ * model check the deadline for every operation. Once it has passed, they skip
+ * the remaining operations and the request fails with BadTimeout. */
+
+/* Returns true if the deadline of the request in processing has passed. Marks
+ * the request as timed out then. */
+UA_Boolean
+UA_Session_checkDeadline(UA_Session *session);
+
 /**
  * Subscription handling
  * --------------------- */
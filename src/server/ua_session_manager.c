@@ -13,9 +13,44 @@
 #include "ua_server_internal.h"
 #include "ua_subscription.h"
 
+static enum ZIP_CMP
+cmpSessionNodeId(const UA_NodeId *a, const UA_NodeId *b) {
+    return (enum ZIP_CMP)UA_NodeId_order(a, b);
+}
+
+ZIP_PROTTYPE(UA_SessionTokenZip, session_list_entry, UA_NodeId)
+ZIP_IMPL(UA_SessionTokenZip, session_list_entry, tokenZipfields, UA_NodeId,
+         session.header.authenticationToken, cmpSessionNodeId)
+
+ZIP_PROTTYPE(UA_SessionIdZip, session_list_entry, UA_NodeId)
+ZIP_IMPL(UA_SessionIdZip, session_list_entry, idZipfields, UA_NodeId,
+         session.sessionId, cmpSessionNodeId)
+
+/* Several sessions can have the same timeout. The address of the entry breaks
+ * ties, as in the timer. So the timeout cannot be used to look up entries. */
+static enum ZIP_CMP
+cmpSessionTimeout(const UA_DateTime *a, const UA_DateTime *b) {
+    if(*a < *b)
+        return ZIP_CMP_LESS;
+    if(*a > *b)
+        return ZIP_CMP_MORE;
+    if(a == b)
+        return ZIP_CMP_EQ;
+    if(a < b)
+        return ZIP_CMP_LESS;
+    return ZIP_CMP_MORE;
+}
+
+ZIP_PROTTYPE(UA_SessionTimeoutZip, session_list_entry, UA_DateTime)
+ZIP_IMPL(UA_SessionTimeoutZip, session_list_entry, timeoutZipfields, UA_DateTime,
+         timeout, cmpSessionTimeout)
+
 UA_StatusCode
 UA_SessionManager_init(UA_SessionManager *sm, UA_Server *server) {
     LIST_INIT(&sm->sessions);
+    ZIP_INIT(&sm->tokenIndex);
+    ZIP_INIT(&sm->idIndex);
+    ZIP_INIT(&sm->timeoutQueue);
     sm->currentSessionCount = 0;
     sm->server = server;
     return UA_STATUSCODE_GOOD;
@@ -67,6 +102,9 @@ removeSession(UA_SessionManager *sm, session_list_entry *sentry) {
     /* Detach the session from the session manager and make the capacity
      * available */
     LIST_REMOVE(sentry, pointers);
+    ZIP_REMOVE(UA_SessionTokenZip, &sm->tokenIndex, sentry);
+    ZIP_REMOVE(UA_SessionIdZip, &sm->idIndex, sentry);
+    ZIP_REMOVE(UA_SessionTimeoutZip, &sm->timeoutQueue, sentry);
     UA_atomic_subUInt32(&sm->currentSessionCount, 1);
 
     /* Add a delayed callback to remove the session when the currently
@@ -89,14 +127,23 @@ void
 UA_SessionManager_cleanupTimedOut(UA_SessionManager *sm,
                                   UA_DateTime nowMonotonic) {
     UA_LOCK_ASSERT(sm->server->serviceMutex, 1);
-    session_list_entry *sentry, *temp;
-    LIST_FOREACH_SAFE(sentry, &sm->sessions, pointers, temp) {
+    /* Only look at the sessions that were due for a check. The lifetime of
+     * the sessions is extended with every request. Sessions that were used in
+     * the meantime are queued again with their current timeout. */
+    session_list_entry *sentry;
+    while((sentry = ZIP_MIN(UA_SessionTimeoutZip, &sm->timeoutQueue)) &&
+          sentry->timeout < nowMonotonic) {
         /* Session has timed out? */
-        if(sentry->session.validTill >= nowMonotonic)
+        if(sentry->session.validTill < nowMonotonic) {
+            UA_LOG_INFO_SESSION(&sm->server->config.logger, &sentry->session,
+                                "Session has timed out");
+            removeSession(sm, sentry);
             continue;
-        UA_LOG_INFO_SESSION(&sm->server->config.logger, &sentry->session,
-                            "Session has timed out");
-        removeSession(sm, sentry);
+        }
+        ZIP_REMOVE(UA_SessionTimeoutZip, &sm->timeoutQueue, sentry);
+        sentry->timeout = sentry->session.validTill;
+        ZIP_INSERT(UA_SessionTimeoutZip, &sm->timeoutQueue, sentry,
+                   ZIP_FFS32(UA_UInt32_random()));
     }
 }
 
@@ -104,12 +151,8 @@ UA_Session *
 UA_SessionManager_getSessionByToken(UA_SessionManager *sm, const UA_NodeId *token) {
     UA_LOCK_ASSERT(sm->server->serviceMutex, 1);
 
-    session_list_entry *current = NULL;
-    LIST_FOREACH(current, &sm->sessions, pointers) {
-        /* Token does not match */
-        if(!UA_NodeId_equal(&current->session.header.authenticationToken, token))
-            continue;
-
+    session_list_entry *current = ZIP_FIND(UA_SessionTokenZip, &sm->tokenIndex, token);
+    if(current) {
         /* Session has timed out */
         if(UA_DateTime_nowMonotonic() > current->session.validTill) {
             UA_LOG_INFO_SESSION(&sm->server->config.logger, &current->session,
@@ -137,12 +180,8 @@ UA_Session *
 UA_SessionManager_getSessionById(UA_SessionManager *sm, const UA_NodeId *sessionId) {
     UA_LOCK_ASSERT(sm->server->serviceMutex, 1);
 
-    session_list_entry *current = NULL;
-    LIST_FOREACH(current, &sm->sessions, pointers) {
-        /* Token does not match */
-        if(!UA_NodeId_equal(&current->session.sessionId, sessionId))
-            continue;
-
+    session_list_entry *current = ZIP_FIND(UA_SessionIdZip, &sm->idIndex, sessionId);
+    if(current) {
         /* Session has timed out */
         if(UA_DateTime_nowMonotonic() > current->session.validTill) {
             UA_LOG_INFO_SESSION(&sm->server->config.logger, &current->session,
@@ -189,7 +228,12 @@ UA_SessionManager_createSession(UA_SessionManager *sm, UA_SecureChannel *channel
         newentry->session.timeout = sm->server->config.maxSessionTimeout;
 
     UA_Session_updateLifetime(&newentry->session);
+    newentry->timeout = newentry->session.validTill;
     LIST_INSERT_HEAD(&sm->sessions, newentry, pointers);
+    ZIP_INSERT(UA_SessionTokenZip, &sm->tokenIndex, newentry, ZIP_FFS32(UA_UInt32_random()));
+    ZIP_INSERT(UA_SessionIdZip, &sm->idIndex, newentry, ZIP_FFS32(UA_UInt32_random()));
+    ZIP_INSERT(UA_SessionTimeoutZip, &sm->timeoutQueue, newentry,
+               ZIP_FFS32(UA_UInt32_random()));
     *session = &newentry->session;
     return UA_STATUSCODE_GOOD;
 }
@@ -198,11 +242,7 @@ UA_StatusCode
 UA_SessionManager_removeSession(UA_SessionManager *sm, const UA_NodeId *token) {
     UA_LOCK_ASSERT(sm->server->serviceMutex, 1);
 
-    session_list_entry *current;
-    LIST_FOREACH(current, &sm->sessions, pointers) {
-        if(UA_NodeId_equal(&current->session.header.authenticationToken, token))
-            break;
-    }
+    session_list_entry *current = ZIP_FIND(UA_SessionTokenZip, &sm->tokenIndex, token);
     if(!current)
         return UA_STATUSCODE_BADSESSIONIDINVALID;
 
@@ -15,6 +15,7 @@
 #include <open62541/server.h>
 
 #include "open62541_queue.h"
+#include "ziptree.h"
 #include "ua_session.h"
 #include "ua_util_internal.h"
 #include "ua_workqueue.h"
@@ -24,11 +25,29 @@ _UA_BEGIN_DECLS
 typedef struct session_list_entry {
     UA_DelayedCallback cleanupCallback;
     LIST_ENTRY(session_list_entry) pointers;
+    ZIP_ENTRY(session_list_entry) tokenZipfields;
+    ZIP_ENTRY(session_list_entry) idZipfields;
+    ZIP_ENTRY(session_list_entry) timeoutZipfields;
+    UA_DateTime timeout; /* When to check the session for a timeout next. Not
+                          * updated with every request. So it can be earlier
+                          * than the validTill of the session. */
     UA_Session session;
 } session_list_entry;
 
+ZIP_HEAD(UA_SessionTokenZip, session_list_entry);
+typedef struct UA_SessionTokenZip UA_SessionTokenZip;
+
+ZIP_HEAD(UA_SessionIdZip, session_list_entry);
+typedef struct UA_SessionIdZip UA_SessionIdZip;
+
+ZIP_HEAD(UA_SessionTimeoutZip, session_list_entry);
+typedef struct UA_SessionTimeoutZip UA_SessionTimeoutZip;
+
 typedef struct UA_SessionManager {
     LIST_HEAD(session_list, session_list_entry) sessions; // doubly-linked list of sessions
+    UA_SessionTokenZip tokenIndex;     /* Sessions by authentication token */
+    UA_SessionIdZip idIndex;           /* Sessions by SessionId */
+    UA_SessionTimeoutZip timeoutQueue; /* Sessions ordered by the next timeout check */
     UA_UInt32 currentSessionCount;
     UA_Server *server;
 } UA_SessionManager;
@@ -0,0 +1,114 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_slabpool.h"
+
+/* The objects are placed directly behind the slab header */
+struct UA_Slab {
+    UA_Slab *next;
+};
+
+/* A released object is reused as the free list entry */
+struct UA_SlabObject {
+    UA_SlabObject *next;
+};
+
+typedef union {
+    void *p;
+    UA_UInt64 u;
+    UA_Double d;
+} UA_SlabAlignment;
+
+#define UA_SLAB_ALIGN(size) \
+    (((size) + sizeof(UA_SlabAlignment) - 1) & ~(sizeof(UA_SlabAlignment) - 1))
+
+void
+UA_SlabPool_init(UA_SlabPool *pool, size_t objectSize) {
+    memset(pool, 0, sizeof(UA_SlabPool));
+    if(objectSize < sizeof(UA_SlabObject))
+        objectSize = sizeof(UA_SlabObject);
+    pool->objectSize = UA_SLAB_ALIGN(objectSize);
+}
+
+void
+UA_SlabPool_clear(UA_SlabPool *pool) {
+    UA_assert(pool->objectsInUse == 0);
+    UA_Slab *slab = pool->slabs;
+    while(slab) {
+        UA_Slab *next = slab->next;
+        UA_free(slab);
+        slab = next;
+    }
+    pool->slabs = NULL;
+    pool->freeList = NULL;
+    pool->slabsSize = 0;
+    pool->freeObjects = 0;
+    pool->configured = false;
+}
+
+/* Cut the objects of a new slab into the free list */
+static UA_StatusCode
+addSlab(UA_SlabPool *pool) {
+    size_t headerSize = UA_SLAB_ALIGN(sizeof(UA_Slab));
+    UA_Slab *slab = (UA_Slab*)UA_malloc(headerSize + pool->objectSize * pool->slabSize);
+    if(!slab)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->slabsSize++;
+
+    uintptr_t objects = (uintptr_t)slab + headerSize;
+    for(size_t i = pool->slabSize; i > 0; i--) {
+        UA_SlabObject *o = (UA_SlabObject*)(objects + (i - 1) * pool->objectSize);
+        o->next = pool->freeList;
+        pool->freeList = o;
+    }
+    pool->freeObjects += pool->slabSize;
+    return UA_STATUSCODE_GOOD;
+}
+
+void *
+UA_SlabPool_alloc(UA_SlabPool *pool, size_t slabSize) {
+    if(!pool->configured) {
+        pool->slabSize = slabSize;
+        pool->configured = true;
+    }
+
+    void *p;
+    if(pool->slabSize == 0) {
+        p = UA_malloc(pool->objectSize);
+    } else {
+        if(!pool->freeList && addSlab(pool) != UA_STATUSCODE_GOOD)
+            return NULL;
+        UA_SlabObject *o = pool->freeList;
+        pool->freeList = o->next;
+        pool->freeObjects--;
+        p = o;
+    }
+
+    if(p) {
+        pool->objectsInUse++;
+        pool->allocations++;
+    }
+    return p;
+}
+
+void
+UA_SlabPool_free(UA_SlabPool *pool, void *p) {
+    if(!p)
+        return;
+    UA_assert(pool->objectsInUse > 0);
+    pool->objectsInUse--;
+    if(pool->slabSize == 0) {
+        UA_free(p);
+        return;
+    }
+    UA_SlabObject *o = (UA_SlabObject*)p;
+    o->next = pool->freeList;
+    pool->freeList = o;
+    pool->freeObjects++;
+}
@@ -0,0 +1,62 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#ifndef UA_SLABPOOL_H_
+#define UA_SLABPOOL_H_
+
+#include <open62541/types.h>
+
+_UA_BEGIN_DECLS
+
+/* The SlabPool hands out objects of a fixed size. The objects are cut from
+ * slabs that hold several objects each. Released objects are kept in a free
+ * list and reused for the next allocation. The slabs are only freed when the
+ * pool is cleared. So the memory of the pool stays at the peak usage.
+ *
+ * The number of objects per slab is taken with the first allocation. If it is
+ * zero, the pool falls back to malloc and free for every object.
+ *
+ * The SlabPool is not thread-safe. In the server, all accesses are protected
+ * by the service mutex. */
+
+struct UA_Slab;
+typedef struct UA_Slab UA_Slab;
+
+struct UA_SlabObject;
+typedef struct UA_SlabObject UA_SlabObject;
+
+typedef struct {
+    size_t objectSize;     /* Rounded up for the alignment */
+    size_t slabSize;       /* Objects per slab. 0 -> malloc and free */
+    UA_Boolean configured; /* The slabSize is fixed after the first allocation */
+    UA_Slab *slabs;
+    UA_SlabObject *freeList;
+
+    /* Statistics */
+    size_t slabsSize;
+    size_t objectsInUse;
+    size_t freeObjects;
+    UA_UInt64 allocations;
+} UA_SlabPool;
+
+void
+UA_SlabPool_init(UA_SlabPool *pool, size_t objectSize);
+
+/* Frees all slabs. All objects must have been released before. */
+void
+UA_SlabPool_clear(UA_SlabPool *pool);
+
+/* Returns uninitialized memory for one object or NULL */
+void *
+UA_SlabPool_alloc(UA_SlabPool *pool, size_t slabSize);
+
+void
+UA_SlabPool_free(UA_SlabPool *pool, void *p);
+
+_UA_END_DECLS
+
+#endif /* UA_SLABPOOL_H_ */
@@ -0,0 +1,142 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_stringpool.h"
+#include "ua_util_internal.h"
+
+#ifdef UA_ENABLE_STRING_INTERNING
+
+typedef struct {
+    UA_UInt32 hash;
+    UA_String string;
+} UA_PooledStringKey;
+
+/* The string content is allocated directly behind the entry */
+struct UA_PooledString {
+    ZIP_ENTRY(UA_PooledString) zipfields;
+    UA_StringPool *pool;
+    size_t refCount;
+    UA_PooledStringKey key;
+};
+
+#define POOLEDSTRING(s) \
+    ((UA_PooledString*)((uintptr_t)(s)->data - sizeof(UA_PooledString)))
+
+static UA_UInt32
+pooledStringHash(const UA_String *s) {
+    return UA_ByteString_hash(2166136261u, s->data, s->length);
+}
+
+static enum ZIP_CMP
+cmpPooledString(const void *a, const void *b) {
+    const UA_PooledStringKey *aa = (const UA_PooledStringKey*)a;
+    const UA_PooledStringKey *bb = (const UA_PooledStringKey*)b;
+    if(aa->hash < bb->hash)
+        return ZIP_CMP_LESS;
+    if(aa->hash > bb->hash)
+        return ZIP_CMP_MORE;
+    if(aa->string.length < bb->string.length)
+        return ZIP_CMP_LESS;
+    if(aa->string.length > bb->string.length)
+        return ZIP_CMP_MORE;
+    int cmp = memcmp(aa->string.data, bb->string.data, aa->string.length);
+    if(cmp < 0)
+        return ZIP_CMP_LESS;
+    if(cmp > 0)
+        return ZIP_CMP_MORE;
+    return ZIP_CMP_EQ;
+}
+
+ZIP_PROTTYPE(UA_PooledStringTree, UA_PooledString, UA_PooledStringKey)
+ZIP_IMPL(UA_PooledStringTree, UA_PooledString, zipfields,
+         UA_PooledStringKey, key, cmpPooledString)
+
+void
+UA_StringPool_init(UA_StringPool *pool) {
+    memset(pool, 0, sizeof(UA_StringPool));
+    ZIP_INIT(&pool->root);
+}
+
+static void
+freePooledString(UA_PooledString *ps, void *_) {
+    UA_free(ps);
+}
+
+void
+UA_StringPool_clear(UA_StringPool *pool) {
+    ZIP_ITER(UA_PooledStringTree, &pool->root, freePooledString, NULL);
+    UA_StringPool_init(pool);
+}
+
+UA_StatusCode
+UA_StringPool_intern(UA_StringPool *pool, UA_String *s) {
+    /* Empty strings are not interned */
+    if(s->length == 0)
+        return UA_STATUSCODE_GOOD;
+
+    /* Already in the pool? */
+    UA_PooledStringKey key;
+    key.hash = pooledStringHash(s);
+    key.string = *s;
+    UA_PooledString *ps = ZIP_FIND(UA_PooledStringTree, &pool->root, &key);
+    if(ps) {
+        ps->refCount++;
+        UA_String_clear(s);
+        *s = ps->key.string;
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /* Add a new entry. The string content is placed behind the entry. */
+    ps = (UA_PooledString*)UA_malloc(sizeof(UA_PooledString) + s->length);
+    if(!ps)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    ps->pool = pool;
+    ps->refCount = 1;
+    ps->key.hash = key.hash;
+    ps->key.string.length = s->length;
+    ps->key.string.data = (UA_Byte*)&ps[1];
+    memcpy(ps->key.string.data, s->data, s->length);
+    ZIP_INSERT(UA_PooledStringTree, &pool->root, ps, ZIP_FFS32(UA_UInt32_random()));
+    pool->stringsSize++;
+    pool->bytesSize += s->length;
+
+    UA_String_clear(s);
+    *s = ps->key.string;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_StringPool_acquire(const UA_String *src, UA_String *dst) {
+    *dst = *src;
+    if(src->length == 0)
+        return;
+    POOLEDSTRING(src)->refCount++;
+}
+
+void
+UA_StringPool_release(UA_String *s) {
+    if(s->length == 0) {
+        /* Was not interned */
+        UA_String_clear(s);
+        return;
+    }
+
+    UA_PooledString *ps = POOLEDSTRING(s);
+    UA_String_init(s);
+    UA_assert(ps->refCount > 0);
+    ps->refCount--;
+    if(ps->refCount > 0)
+        return;
+
+    UA_StringPool *pool = ps->pool;
+    ZIP_REMOVE(UA_PooledStringTree, &pool->root, ps);
+    pool->stringsSize--;
+    pool->bytesSize -= ps->key.string.length;
+    UA_free(ps);
+}
+
+#endif /* UA_ENABLE_STRING_INTERNING */
@@ -0,0 +1,69 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#ifndef UA_STRINGPOOL_H_
+#define UA_STRINGPOOL_H_
+
+#include <open62541/types.h>
+#include <open62541/types_generated_handling.h>
+#include "ziptree.h"
+
+_UA_BEGIN_DECLS
+
+#ifdef UA_ENABLE_STRING_INTERNING
+
+/* The StringPool holds immutable, reference-counted strings that are shared
+ * between nodes. Instances of the same ObjectType usually carry identical
+ * BrowseNames, DisplayNames and Descriptions. With interning they point to the
+ * same memory instead of keeping a separate heap allocation each.
+ *
+ * An interned UA_String points into the pool. It must never be freed with
+ * UA_String_clear or modified in-place. Use UA_StringPool_release instead.
+ *
+ * The StringPool is not thread-safe. In the server, all accesses are protected
+ * by the service mutex. */
+
+struct UA_PooledString;
+typedef struct UA_PooledString UA_PooledString;
+
+ZIP_HEAD(UA_PooledStringTree, UA_PooledString);
+typedef struct UA_PooledStringTree UA_PooledStringTree;
+
+typedef struct {
+    UA_PooledStringTree root;
+    size_t stringsSize; /* Number of distinct strings in the pool */
+    size_t bytesSize;   /* Sum of the string lengths in the pool */
+} UA_StringPool;
+
+void
+UA_StringPool_init(UA_StringPool *pool);
+
+/* Frees all strings remaining in the pool. All interned strings must have been
+ * released before. */
+void
+UA_StringPool_clear(UA_StringPool *pool);
+
+/* Replaces the (owned) string with the interned copy. The original string
+ * content is freed. Empty strings are not interned and remain unchanged. */
+UA_StatusCode
+UA_StringPool_intern(UA_StringPool *pool, UA_String *s);
+
+/* Increase the reference count of an interned string. The result is a shallow
+ * copy that shares the memory with the source. */
+void
+UA_StringPool_acquire(const UA_String *src, UA_String *dst);
+
+/* Decrease the reference count of an interned string. The string is removed
+ * from the pool and freed when the reference count drops to zero. */
+void
+UA_StringPool_release(UA_String *s);
+
+#endif /* UA_ENABLE_STRING_INTERNING */
+
+_UA_END_DECLS
+
+#endif /* UA_STRINGPOOL_H_ */
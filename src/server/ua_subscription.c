@@ -18,6 +18,7 @@
 
 #include "ua_server_internal.h"
 #include "ua_subscription.h"
+#include "ua_types_encoding_binary.h"
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS /* conditional compilation */
 
@@ -41,6 +42,87 @@ UA_Subscription_new(UA_Session *session, UA_UInt32 subscriptionId) {
     return newSub;
 }
 
+/* The arrays for the DataChangeNotifications are allocated for the
+ * notificationsPerPublish of the subscription. So every publish response fits
+ * into a reused array. */
+#define UA_SUBSCRIPTION_MAXNOTIFICATIONBUFFERS 2
+
+static void
+clearNotificationBuffers(UA_Subscription *sub) {
+    while(sub->notificationBuffers) {
+        UA_NotificationBuffer *next = sub->notificationBuffers->next;
+        UA_free(sub->notificationBuffers);
+        sub->notificationBuffers = next;
+    }
+    sub->notificationBuffersSize = 0;
+}
+
+/* Returns an array for at least capacity DataChangeNotifications */
+static UA_MonitoredItemNotification *
+getNotificationBuffer(UA_Server *server, UA_Subscription *sub, size_t capacity) {
+    if(sub->notificationBufferCapacity != capacity) {
+        clearNotificationBuffers(sub);
+        sub->notificationBufferCapacity = capacity;
+    }
+    UA_NotificationBuffer *buf = sub->notificationBuffers;
+    if(buf) {
+        sub->notificationBuffers = buf->next;
+        sub->notificationBuffersSize--;
+        server->notificationBufferReuses++;
+        return (UA_MonitoredItemNotification*)buf;
+    }
+    server->notificationBufferAllocations++;
+    return (UA_MonitoredItemNotification*)
+        UA_malloc(capacity * sizeof(UA_MonitoredItemNotification));
+}
+
+/* Takes the array with the cleared DataChangeNotifications back. Frees the
+ * array if it has an outdated capacity or if enough arrays are kept. */
+static void
+putNotificationBuffer(UA_Subscription *sub, UA_MonitoredItemNotification *array,
+                      size_t capacity) {
+    if(capacity != sub->notificationBufferCapacity ||
+       sub->notificationBuffersSize >= UA_SUBSCRIPTION_MAXNOTIFICATIONBUFFERS) {
+        UA_free(array);
+        return;
+    }
+    UA_NotificationBuffer *buf = (UA_NotificationBuffer*)array;
+    buf->next = sub->notificationBuffers;
+    sub->notificationBuffers = buf;
+    sub->notificationBuffersSize++;
+}
+
+/* Clears the notification message. If bufferCapacity is set, the array of
+ * DataChangeNotifications is kept for the next publish response. */
+static void
+releaseNotificationMessage(UA_Subscription *sub, UA_NotificationMessage *message,
+                           size_t bufferCapacity) {
+    for(size_t i = 0; bufferCapacity > 0 && i < message->notificationDataSize; i++) {
+        UA_ExtensionObject *eo = &message->notificationData[i];
+        if(eo->encoding != UA_EXTENSIONOBJECT_DECODED ||
+           eo->content.decoded.type != &UA_TYPES[UA_TYPES_DATACHANGENOTIFICATION])
+            continue;
+        UA_DataChangeNotification *dcn =
+            (UA_DataChangeNotification*)eo->content.decoded.data;
+        if(!dcn->monitoredItems)
+            break;
+        for(size_t j = 0; j < dcn->monitoredItemsSize; j++)
+            UA_MonitoredItemNotification_clear(&dcn->monitoredItems[j]);
+        putNotificationBuffer(sub, dcn->monitoredItems, bufferCapacity);
+        dcn->monitoredItems = NULL;
+        dcn->monitoredItemsSize = 0;
+        break;
+    }
+    UA_NotificationMessage_clear(message);
+}
+
+static void
+deleteRetransmissionMessage(UA_Server *server, UA_Subscription *sub,
+                            UA_NotificationMessageEntry *entry) {
+    releaseNotificationMessage(sub, &entry->message, entry->bufferCapacity);
+    UA_SlabPool_free(&server->retransmissionPool, entry);
+}
+
 void
 UA_Subscription_deleteMembers(UA_Server *server, UA_Subscription *sub) {
     UA_LOCK_ASSERT(server->serviceMutex, 1);
@@ -65,12 +147,12 @@ UA_Subscription_deleteMembers(UA_Server *server, UA_Subscription *sub) {
     UA_NotificationMessageEntry *nme, *nme_tmp;
     TAILQ_FOREACH_SAFE(nme, &sub->retransmissionQueue, listEntry, nme_tmp) {
         TAILQ_REMOVE(&sub->retransmissionQueue, nme, listEntry);
-        UA_NotificationMessage_clear(&nme->message);
-        UA_free(nme);
+        deleteRetransmissionMessage(server, sub, nme);
         --sub->session->totalRetransmissionQueueSize;
         --sub->retransmissionQueueSize;
     }
     UA_assert(sub->retransmissionQueueSize == 0);
+    clearNotificationBuffers(sub);
 
     UA_LOG_INFO_SESSION(&server->config.logger, sub->session,
                         "Subscription %u | Deleted the Subscription",
@@ -127,7 +209,7 @@ UA_Subscription_addMonitoredItem(UA_Server *server, UA_Subscription *sub, UA_Mon
 }
 
 static void
-removeOldestRetransmissionMessage(UA_Session *session) {
+removeOldestRetransmissionMessage(UA_Server *server, UA_Session *session) {
     UA_NotificationMessageEntry *oldestEntry = NULL;
     UA_Subscription *oldestSub = NULL;
 
@@ -146,8 +228,7 @@ removeOldestRetransmissionMessage(UA_Session *session) {
     UA_assert(oldestSub);
 
     TAILQ_REMOVE(&oldestSub->retransmissionQueue, oldestEntry, listEntry);
-    UA_NotificationMessage_clear(&oldestEntry->message);
-    UA_free(oldestEntry);
+    deleteRetransmissionMessage(server, oldestSub, oldestEntry);
     --session->totalRetransmissionQueueSize;
     --oldestSub->retransmissionQueueSize;
 }
@@ -160,7 +241,7 @@ UA_Subscription_addRetransmissionMessage(UA_Server *server, UA_Subscription *sub
        sub->session->totalRetransmissionQueueSize >= server->config.maxRetransmissionQueueSize) {
         UA_LOG_WARNING_SESSION(&server->config.logger, sub->session, "Subscription %u | "
                                "Retransmission queue overflow", sub->subscriptionId);
-        removeOldestRetransmissionMessage(sub->session);
+        removeOldestRetransmissionMessage(server, sub->session);
     }
 
     /* Add entry */
@@ -170,7 +251,8 @@ UA_Subscription_addRetransmissionMessage(UA_Server *server, UA_Subscription *sub
 }
 
 UA_StatusCode
-UA_Subscription_removeRetransmissionMessage(UA_Subscription *sub, UA_UInt32 sequenceNumber) {
+UA_Subscription_removeRetransmissionMessage(UA_Server *server, UA_Subscription *sub,
+                                            UA_UInt32 sequenceNumber) {
     /* Find the retransmission message */
     UA_NotificationMessageEntry *entry;
     TAILQ_FOREACH(entry, &sub->retransmissionQueue, listEntry) {
@@ -184,15 +266,18 @@ UA_Subscription_removeRetransmissionMessage(UA_Subscription *sub, UA_UInt32 sequ
     TAILQ_REMOVE(&sub->retransmissionQueue, entry, listEntry);
     --sub->session->totalRetransmissionQueueSize;
     --sub->retransmissionQueueSize;
-    UA_NotificationMessage_clear(&entry->message);
-    UA_free(entry);
+    deleteRetransmissionMessage(server, sub, entry);
     return UA_STATUSCODE_GOOD;
 }
 
+/* If the notification pools are enabled, the array for the
+ * DataChangeNotifications can be reused. Then bufferCapacity is set. */
 static UA_StatusCode
 prepareNotificationMessage(UA_Server *server, UA_Subscription *sub,
-                           UA_NotificationMessage *message, size_t notifications) {
+                           UA_NotificationMessage *message, size_t notifications,
+                           size_t *bufferCapacity) {
     UA_assert(notifications > 0);
+    *bufferCapacity = 0;
 
     /* Allocate an ExtensionObject for events and data */
     message->notificationData = (UA_ExtensionObject*)
@@ -217,13 +302,23 @@ prepareNotificationMessage(UA_Server *server, UA_Subscription *sub,
         size_t dcnSize = sub->dataChangeNotifications;
         if(dcnSize > notifications)
             dcnSize = notifications;
-        dcn->monitoredItems = (UA_MonitoredItemNotification*)
-            UA_Array_new(dcnSize, &UA_TYPES[UA_TYPES_MONITOREDITEMNOTIFICATION]);
+        if(server->config.notificationSlabSize > 0) {
+            dcn->monitoredItems =
+                getNotificationBuffer(server, sub, sub->notificationsPerPublish);
+            if(dcn->monitoredItems)
+                *bufferCapacity = sub->notificationsPerPublish;
+        } else {
+            dcn->monitoredItems = (UA_MonitoredItemNotification*)
+                UA_Array_new(dcnSize, &UA_TYPES[UA_TYPES_MONITOREDITEMNOTIFICATION]);
+        }
         if(!dcn->monitoredItems) {
             UA_NotificationMessage_clear(message);
             return UA_STATUSCODE_BADOUTOFMEMORY;
         }
-        dcn->monitoredItemsSize = dcnSize;
+        /* A reused array is not initialized. The size is set when the
+         * notifications have been moved into the array. */
+        if(*bufferCapacity == 0)
+            dcn->monitoredItemsSize = dcnSize;
         notificationDataIdx++;
     }
 
@@ -310,7 +405,7 @@ prepareNotificationMessage(UA_Server *server, UA_Subscription *sub,
             dcnPos++;
         }
 
-        UA_Notification_delete(notification);
+        UA_Notification_delete(server, notification);
         totalNotifications++;
     }
 
@@ -318,8 +413,12 @@ prepareNotificationMessage(UA_Server *server, UA_Subscription *sub,
     if(dcn) {
         dcn->monitoredItemsSize = dcnPos;
         if(dcnPos == 0) {
-            UA_free(dcn->monitoredItems);
+            if(*bufferCapacity > 0)
+                putNotificationBuffer(sub, dcn->monitoredItems, *bufferCapacity);
+            else
+                UA_free(dcn->monitoredItems);
             dcn->monitoredItems = NULL;
+            *bufferCapacity = 0;
         }
     }
 
@@ -336,6 +435,149 @@ prepareNotificationMessage(UA_Server *server, UA_Subscription *sub,
     return UA_STATUSCODE_GOOD;
 }
 
+/* Prepares an ExtensionObject with an encoded body of the given size */
+static UA_StatusCode
+allocEncodedNotification(UA_ExtensionObject *eo, const UA_DataType *type, size_t size) {
+    UA_StatusCode retval = UA_ByteString_allocBuffer(&eo->content.encoded.body, size);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    eo->encoding = UA_EXTENSIONOBJECT_ENCODED_BYTESTRING;
+    eo->content.encoded.typeId = UA_NODEID_NUMERIC(0, type->binaryEncodingId);
+    return UA_STATUSCODE_GOOD;
+}
+
+/* Encodes the notifications into the body of the ExtensionObjects while they
+ * are taken from the queue. The bodies have the binary layout of the
+ * DataChangeNotification and the EventNotificationList. So the message is the
+ * same on the wire. But the values are not moved into decoded arrays and the
+ * retransmission queue only keeps the encoded bytes. */
+static UA_StatusCode
+encodeNotificationMessage(UA_Server *server, UA_Subscription *sub,
+                          UA_NotificationMessage *message, size_t notifications) {
+    UA_assert(notifications > 0);
+
+    /* Compute the size of the bodies. Both begin with the length of the
+     * array. The DataChangeNotification ends with the (empty) array of
+     * DiagnosticInfos. */
+    UA_Int32 dcnCount = 0;
+    size_t dcnSize = 2 * sizeof(UA_Int32);
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    UA_Int32 enlCount = 0;
+    size_t enlSize = sizeof(UA_Int32);
+#endif
+    size_t count = 0;
+    UA_Notification *notification, *notification_tmp;
+    TAILQ_FOREACH(notification, &sub->notificationQueue, globalEntry) {
+        if(count >= notifications)
+            break;
+        count++;
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+        if(notification->mon->attributeId == UA_ATTRIBUTEID_EVENTNOTIFIER) {
+            enlCount++;
+            enlSize += UA_calcSizeBinary(&notification->data.event.fields,
+                                         &UA_TYPES[UA_TYPES_EVENTFIELDLIST]);
+            continue;
+        }
+#endif
+        dcnCount++;
+        dcnSize += sizeof(UA_UInt32) + /* ClientHandle */
+            UA_calcSizeBinary(&notification->data.value, &UA_TYPES[UA_TYPES_DATAVALUE]);
+    }
+
+    /* Allocate the ExtensionObjects with the buffers for the bodies */
+    size_t eoSize = (dcnCount > 0) ? 1 : 0;
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    if(enlCount > 0)
+        eoSize++;
+#endif
+    message->notificationData = (UA_ExtensionObject*)
+        UA_Array_new(eoSize, &UA_TYPES[UA_TYPES_EXTENSIONOBJECT]);
+    if(!message->notificationData)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    message->notificationDataSize = eoSize;
+
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    UA_Byte *dcnPos = NULL;
+    const UA_Byte *dcnEnd = NULL;
+    size_t eoPos = 0;
+    if(dcnCount > 0) {
+        UA_ExtensionObject *eo = &message->notificationData[eoPos++];
+        retval = allocEncodedNotification(eo, &UA_TYPES[UA_TYPES_DATACHANGENOTIFICATION],
+                                          dcnSize);
+        if(retval == UA_STATUSCODE_GOOD) {
+            dcnPos = eo->content.encoded.body.data;
+            dcnEnd = dcnPos + dcnSize;
+        }
+    }
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    UA_Byte *enlPos = NULL;
+    const UA_Byte *enlEnd = NULL;
+    if(enlCount > 0 && retval == UA_STATUSCODE_GOOD) {
+        UA_ExtensionObject *eo = &message->notificationData[eoPos++];
+        retval = allocEncodedNotification(eo, &UA_TYPES[UA_TYPES_EVENTNOTIFICATIONLIST],
+                                          enlSize);
+        if(retval == UA_STATUSCODE_GOOD) {
+            enlPos = eo->content.encoded.body.data;
+            enlEnd = enlPos + enlSize;
+        }
+    }
+#endif
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_NotificationMessage_clear(message);
+        return retval;
+    }
+
+    /* <-- The point of no return --> */
+
+    /* Encode the array lengths */
+    if(dcnPos)
+        retval |= UA_encodeBinary(&dcnCount, &UA_TYPES[UA_TYPES_INT32],
+                                  &dcnPos, &dcnEnd, NULL, NULL);
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    if(enlPos)
+        retval |= UA_encodeBinary(&enlCount, &UA_TYPES[UA_TYPES_INT32],
+                                  &enlPos, &enlEnd, NULL, NULL);
+#endif
+
+    /* Encode and delete the notifications */
+    count = 0;
+    TAILQ_FOREACH_SAFE(notification, &sub->notificationQueue, globalEntry, notification_tmp) {
+        if(count >= notifications)
+            break;
+        count++;
+
+        UA_MonitoredItem *mon = notification->mon;
+        UA_Notification_dequeue(server, notification);
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+        if(mon->attributeId == UA_ATTRIBUTEID_EVENTNOTIFIER) {
+            notification->data.event.fields.clientHandle = mon->clientHandle;
+            retval |= UA_encodeBinary(&notification->data.event.fields,
+                                      &UA_TYPES[UA_TYPES_EVENTFIELDLIST],
+                                      &enlPos, &enlEnd, NULL, NULL);
+        } else
+#endif
+        {
+            retval |= UA_encodeBinary(&mon->clientHandle, &UA_TYPES[UA_TYPES_UINT32],
+                                      &dcnPos, &dcnEnd, NULL, NULL);
+            retval |= UA_encodeBinary(&notification->data.value, &UA_TYPES[UA_TYPES_DATAVALUE],
+                                      &dcnPos, &dcnEnd, NULL, NULL);
+        }
+        UA_Notification_delete(server, notification);
+    }
+
+    /* No DiagnosticInfos */
+    if(dcnPos) {
+        UA_Int32 noDiagnosticInfos = -1;
+        retval |= UA_encodeBinary(&noDiagnosticInfos, &UA_TYPES[UA_TYPES_INT32],
+                                  &dcnPos, &dcnEnd, NULL, NULL);
+    }
+
+    /* The notifications are lost if the size was not computed correctly */
+    if(retval != UA_STATUSCODE_GOOD)
+        UA_NotificationMessage_clear(message);
+    return retval;
+}
+
 /* According to OPC Unified Architecture, Part 4 5.13.1.1 i) The value 0 is
  * never used for the sequence number */
 static UA_UInt32
@@ -424,10 +666,13 @@ UA_Subscription_publish(UA_Server *server, UA_Subscription *sub) {
     UA_PublishResponse *response = &pre->response;
     UA_NotificationMessage *message = &response->notificationMessage;
     UA_NotificationMessageEntry *retransmission = NULL;
+    size_t bufferCapacity = 0;
     if(notifications > 0) {
         if(server->config.enableRetransmissionQueue) {
             /* Allocate the retransmission entry */
-            retransmission = (UA_NotificationMessageEntry*)UA_malloc(sizeof(UA_NotificationMessageEntry));
+            retransmission = (UA_NotificationMessageEntry*)
+                UA_SlabPool_alloc(&server->retransmissionPool,
+                                  server->config.notificationSlabSize);
             if(!retransmission) {
                 UA_LOG_WARNING_SESSION(&server->config.logger, sub->session,
                                        "Subscription %u | Could not allocate memory for retransmission. "
@@ -439,14 +684,18 @@ UA_Subscription_publish(UA_Server *server, UA_Subscription *sub) {
         }
 
         /* Prepare the response */
-        UA_StatusCode retval = prepareNotificationMessage(server, sub, message, notifications);
+        UA_StatusCode retval;
+        if(server->config.encodeNotifications)
+            retval = encodeNotificationMessage(server, sub, message, notifications);
+        else
+            retval = prepareNotificationMessage(server, sub, message,
+                                                notifications, &bufferCapacity);
         if(retval != UA_STATUSCODE_GOOD) {
             UA_LOG_WARNING_SESSION(&server->config.logger, sub->session,
                                    "Subscription %u | Could not prepare the notification message. "
                                    "The subscription is late.", sub->subscriptionId);
             /* If the retransmission queue is enabled a retransmission message is allocated */
-            if(retransmission)
-                UA_free(retransmission);
+            UA_SlabPool_free(&server->retransmissionPool, retransmission);
             sub->state = UA_SUBSCRIPTIONSTATE_LATE;
             UA_Session_queuePublishReq(sub->session, pre, true); /* Re-enqueue */
             return;
@@ -477,6 +726,7 @@ UA_Subscription_publish(UA_Server *server, UA_Subscription *sub) {
              * needs to be done here, so that the message itself is included in the
              * available sequence numbers for acknowledgement. */
             retransmission->message = response->notificationMessage;
+            retransmission->bufferCapacity = bufferCapacity;
             UA_Subscription_addRetransmissionMessage(server, sub, retransmission);
         }
         /* Only if a notification was created, the sequence number must be increased.
@@ -511,7 +761,10 @@ UA_Subscription_publish(UA_Server *server, UA_Subscription *sub) {
     sub->state = UA_SUBSCRIPTIONSTATE_NORMAL;
     sub->currentKeepAliveCount = 0;
 
-    /* Free the response */
+    /* Free the response. The notification message is owned by the
+     * retransmission queue if it is enabled. */
+    if(!retransmission)
+        releaseNotificationMessage(sub, message, bufferCapacity);
     UA_Array_delete(response->results, response->resultsSize, &UA_TYPES[UA_TYPES_UINT32]);
     UA_free(pre); /* No need for UA_PublishResponse_clear */
 
@@ -21,6 +21,7 @@
 #include "ua_session.h"
 #include "ua_util_internal.h"
 #include "ua_workqueue.h"
+#include "ziptree.h"
 
 _UA_BEGIN_DECLS
 
@@ -55,12 +56,79 @@ _UA_BEGIN_DECLS
 struct UA_MonitoredItem;
 typedef struct UA_MonitoredItem UA_MonitoredItem;
 
+struct UA_Sampler;
+typedef struct UA_Sampler UA_Sampler;
+
+struct UA_SamplingGroup;
+typedef struct UA_SamplingGroup UA_SamplingGroup;
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
 typedef struct UA_EventNotification {
     UA_EventFieldList fields;
     /* EventFilterResult currently isn't being used
     UA_EventFilterResult result; */
 } UA_EventNotification;
+
+/* The EventFilter of a MonitoredItem is compiled when it is set. The operands
+ * point into the EventFilter of the MonitoredItem. What does not depend on the
+ * event is resolved only once. */
+
+typedef enum {
+    UA_EVENTFIELD_OTHER = 0, /* Looked up by name in in-memory events */
+    UA_EVENTFIELD_EVENTID,
+    UA_EVENTFIELD_EVENTTYPE,
+    UA_EVENTFIELD_SOURCENODE,
+    UA_EVENTFIELD_RECEIVETIME,
+    UA_EVENTFIELD_TIME
+} UA_EventFieldKind;
+
+/* Compiled SimpleAttributeOperand */
+typedef struct {
+    const UA_SimpleAttributeOperand *sao;
+    UA_UInt32 hash; /* Identifies equal operands across MonitoredItems */
+    UA_EventFieldKind kind;
+    UA_Boolean checkEventType; /* The TypeDefinition is not BaseEventType */
+    UA_Boolean conditionType;  /* The TypeDefinition is ConditionType */
+    UA_Boolean hasIndexRange;
+    UA_NumericRange indexRange;
+} UA_EventFieldOperand;
+
+typedef enum {
+    UA_EVENTOPERAND_LITERAL,
+    UA_EVENTOPERAND_ELEMENT,
+    UA_EVENTOPERAND_ATTRIBUTE
+} UA_EventOperandType;
+
+typedef struct {
+    UA_EventOperandType type;
+    union {
+        const UA_Variant *literal;
+        size_t element; /* Always points to a later element */
+        UA_EventFieldOperand attribute;
+    } operand;
+} UA_EventOperand;
+
+typedef struct {
+    UA_FilterOperator filterOperator;
+    size_t operandsSize;
+    UA_EventOperand *operands;
+} UA_EventFilterElement;
+
+typedef struct {
+    size_t selectClausesSize;
+    UA_EventFieldOperand *selectClauses;
+    size_t whereClauseSize; /* No filtering if empty */
+    UA_EventFilterElement *whereClause;
+} UA_CompiledEventFilter;
+
+/* Validates the EventFilter. Cast, InView and RelatedTo are not supported in
+ * the where clause. The number of elements is limited by the server config. */
+UA_StatusCode
+UA_CompiledEventFilter_compile(UA_Server *server, const UA_EventFilter *filter,
+                               UA_CompiledEventFilter *cf);
+
+void
+UA_CompiledEventFilter_clear(UA_CompiledEventFilter *cf);
 #endif
 
 typedef struct UA_Notification {
@@ -88,7 +156,9 @@ void UA_Notification_enqueue(UA_Server *server, UA_Subscription *sub,
 void UA_Notification_dequeue(UA_Server *server, UA_Notification *n);
 
 /* Delete the notification. Must be dequeued first. */
-void UA_Notification_delete(UA_Notification *n);
+/* Notifications are allocated from the notification pool of the server */
+UA_Notification * UA_Notification_new(UA_Server *server);
+void UA_Notification_delete(UA_Server *server, UA_Notification *n);
 
 typedef TAILQ_HEAD(NotificationQueue, UA_Notification) NotificationQueue;
 
@@ -115,13 +185,28 @@ struct UA_MonitoredItem {
 #endif
         UA_DataChangeFilter dataChangeFilter;
     } filter;
-    UA_Variant lastValue;
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    UA_CompiledEventFilter compiledEventFilter; /* Points into the eventFilter */
+#endif
     // TODO: dataEncoding is hardcoded to UA binary
 
     /* Sample Callback */
     UA_UInt64 sampleCallbackId;
-    UA_ByteString lastSampledValue;
+    UA_DataValue lastSampledValue; /* With the filter applied */
+    UA_Boolean hasLastSampledValue;
     UA_Boolean sampleCallbackIsRegistered;
+    UA_Sampler *sampler; /* Set if the sampling is shared */
+    LIST_ENTRY(UA_MonitoredItem) samplerEntry;
+    UA_SamplingGroup *samplingGroup; /* Set if sampled in a group */
+    size_t samplingGroupIndex;
+
+    /* Sampling on write. The sampling interval is the minimum time between
+     * two samples. */
+    UA_Boolean sampleOnWrite;
+    LIST_ENTRY(UA_MonitoredItem) nodeEntry;
+    UA_DateTime lastSampleTime; /* Monotonic */
+    UA_Boolean delayedSampleIsRegistered;
+    UA_UInt64 delayedSampleCallbackId;
 
     /* Notification Queue */
     NotificationQueue queue;
@@ -134,10 +219,6 @@ struct UA_MonitoredItem {
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
     UA_MonitoredItem *next;
 #endif
-
-#ifdef UA_ENABLE_DA
-    UA_StatusCode lastStatus;
-#endif
 };
 
 void UA_MonitoredItem_init(UA_MonitoredItem *mon, UA_Subscription *sub);
@@ -153,6 +234,109 @@ UA_StatusCode UA_MonitoredItem_ensureQueueSpace(UA_Server *server, UA_MonitoredI
 UA_StatusCode UA_MonitoredItem_removeNodeEventCallback(UA_Server *server, UA_Session *session,
                                                        UA_Node *node, void *data);
 
+/***********/
+/* Sampler */
+/***********/
+
+/* With sharedSampling enabled in the server config, MonitoredItems with the
+ * same node, attribute, index range, sampling interval and timestamps to
+ * return share a Sampler. The Sampler has a single repeated callback. It reads
+ * the attribute once and hands the sample to all of its MonitoredItems. Every
+ * MonitoredItem then applies its own filter and queue.
+ *
+ * The sample is read with the rights of the admin session. The access rights
+ * of the session are checked for each MonitoredItem. Attributes that depend on
+ * the user (e.g. UserAccessLevel) are not shared. */
+
+typedef struct {
+    UA_NodeId nodeId;
+    UA_UInt32 attributeId;
+    UA_String indexRange;
+    UA_Double samplingInterval;
+    UA_TimestampsToReturn timestampsToReturn;
+} UA_SamplerKey;
+
+struct UA_Sampler {
+    UA_DelayedCallback delayedFreePointers;
+    ZIP_ENTRY(UA_Sampler) zipfields;
+    UA_SamplerKey key;
+    UA_UInt64 sampleCallbackId;
+    UA_SamplingGroup *samplingGroup; /* Set if sampled in a group */
+    size_t samplingGroupIndex;
+    LIST_HEAD(, UA_MonitoredItem) monitoredItems;
+};
+
+ZIP_HEAD(UA_SamplerTree, UA_Sampler);
+typedef struct UA_SamplerTree UA_SamplerTree;
+
+void UA_Sampler_sampleCallback(UA_Server *server, UA_Sampler *sampler);
+
+/******************/
+/* Sampling Group */
+/******************/
+
+/* With samplingGroups enabled in the server config, all MonitoredItems with
+ * the same sampling interval are sampled from a single repeated callback. The
+ * callback takes the service lock once and samples the members sorted by their
+ * NodeId. Consecutive members on the same node share the node lookup. With
+ * sharedSampling, the Samplers are the members of the group instead of the
+ * individual MonitoredItems.
+ *
+ * Removed members leave a gap in the array. The gaps are closed and the
+ * members are sorted again before the next sample. */
+
+typedef struct {
+    const UA_NodeId *nodeId; /* Points into the MonitoredItem or Sampler.
+                              * NULL if the member was removed. */
+    UA_MonitoredItem *mon;
+    UA_Sampler *sampler;
+} UA_SamplingGroupMember;
+
+struct UA_SamplingGroup {
+    UA_DelayedCallback delayedFreePointers;
+    ZIP_ENTRY(UA_SamplingGroup) zipfields;
+    UA_Double samplingInterval;
+    UA_UInt64 sampleCallbackId;
+    UA_SamplingGroupMember *members;
+    size_t membersSize;
+    size_t membersCapacity;
+    size_t liveMembers;
+    UA_Boolean sorted;
+    UA_UInt32 processing; /* Don't reorder the members while sampling */
+};
+
+ZIP_HEAD(UA_SamplingGroupTree, UA_SamplingGroup);
+typedef struct UA_SamplingGroupTree UA_SamplingGroupTree;
+
+void UA_SamplingGroup_sort(UA_SamplingGroup *group);
+void UA_SamplingGroup_sampleCallback(UA_Server *server, UA_SamplingGroup *group);
+
+/*******************/
+/* Sample on Write */
+/*******************/
+
+/* The MonitoredItems that are sampled when the value of the node is written.
+ * The entries are kept in a tree keyed by the NodeId. */
+
+typedef struct UA_NodeMonitors {
+    ZIP_ENTRY(UA_NodeMonitors) zipfields;
+    UA_NodeId nodeId;
+    LIST_HEAD(, UA_MonitoredItem) monitoredItems;
+} UA_NodeMonitors;
+
+ZIP_HEAD(UA_NodeMonitorsTree, UA_NodeMonitors);
+typedef struct UA_NodeMonitorsTree UA_NodeMonitorsTree;
+ZIP_PROTTYPE(UA_NodeMonitorsTree, UA_NodeMonitors, UA_NodeId)
+
+/* Samples the MonitoredItems of the node that are sampled on write. Samples
+ * are delayed until the sampling interval has passed since the last sample. */
+void notifyValueChanged(UA_Server *server, const UA_NodeId *nodeId);
+
+/* The value source of the node has changed. The MonitoredItems that are
+ * sampled on write go back to sampling with their interval if the value can
+ * now change without a write. */
+void reviewSampleOnWrite(UA_Server *server, const UA_NodeId *nodeId);
+
 /****************/
 /* Subscription */
 /****************/
@@ -160,8 +344,16 @@ UA_StatusCode UA_MonitoredItem_removeNodeEventCallback(UA_Server *server, UA_Ses
 typedef struct UA_NotificationMessageEntry {
     TAILQ_ENTRY(UA_NotificationMessageEntry) listEntry;
     UA_NotificationMessage message;
+    size_t bufferCapacity; /* Capacity of the DataChangeNotification array if
+                            * it can be reused. Otherwise 0. */
 } UA_NotificationMessageEntry;
 
+/* A free array for the DataChangeNotifications of a publish response. Linked
+ * through the memory of the first element. */
+typedef struct UA_NotificationBuffer {
+    struct UA_NotificationBuffer *next;
+} UA_NotificationBuffer;
+
 /* We use only a subset of the states defined in the standard */
 typedef enum {
     /* UA_SUBSCRIPTIONSTATE_CLOSED */
@@ -218,6 +410,12 @@ struct UA_Subscription {
     /* Retransmission Queue */
     ListOfNotificationMessages retransmissionQueue;
     size_t retransmissionQueueSize;
+
+    /* Arrays for the DataChangeNotifications with the capacity for
+     * notificationsPerPublish. Reused when the message is released. */
+    UA_NotificationBuffer *notificationBuffers;
+    size_t notificationBuffersSize;
+    size_t notificationBufferCapacity;
 };
 
 UA_Subscription * UA_Subscription_new(UA_Session *session, UA_UInt32 subscriptionId);
@@ -232,7 +430,8 @@ UA_Subscription_deleteMonitoredItem(UA_Server *server, UA_Subscription *sub,
                                     UA_UInt32 monitoredItemId);
 
 void UA_Subscription_publish(UA_Server *server, UA_Subscription *sub);
-UA_StatusCode UA_Subscription_removeRetransmissionMessage(UA_Subscription *sub,
+UA_StatusCode UA_Subscription_removeRetransmissionMessage(UA_Server *server,
+                                                          UA_Subscription *sub,
                                                           UA_UInt32 sequenceNumber);
 void UA_Subscription_answerPublishRequestsNoSubscription(UA_Server *server, UA_Session *session);
 UA_Boolean UA_Subscription_reachedPublishReqLimit(UA_Server *server,  UA_Session *session);
@@ -11,7 +11,6 @@
 
 #include "ua_server_internal.h"
 #include "ua_subscription.h"
-#include "ua_types_encoding_binary.h"
 
 #ifdef UA_ENABLE_DA
 #include <math.h> // fabs
@@ -19,8 +18,6 @@
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS /* conditional compilation */
 
-#define UA_VALUENCODING_MAXSTACK 512
-
 #define ABS_SUBTRACT_TYPE_INDEPENDENT(a,b) ((a)>(b)?(a)-(b):(b)-(a))
 
 static UA_Boolean
@@ -88,134 +85,90 @@ updateNeededForFilteredValue(const UA_Variant *value, const UA_Variant *oldValue
 #ifdef UA_ENABLE_DA
 static UA_Boolean
 updateNeededForStatusCode(const UA_DataValue *value, const UA_MonitoredItem *mon) {
-    if(UA_Variant_isScalar(&value->value) && value->status != mon->lastStatus)
+    if(UA_Variant_isScalar(&value->value) && value->status != mon->lastSampledValue.status)
         return true;
     return false;
 }
 #endif
 
+/* Is the filtered value outside the deadband from the last sample? */
+static UA_Boolean
+outOfDeadbandFilter(UA_Server *server, UA_Session *session, UA_MonitoredItem *mon,
+                    const UA_DataValue *value) {
+    if(!UA_DataType_isNumeric(value->value.type) ||
+       (mon->filter.dataChangeFilter.trigger != UA_DATACHANGETRIGGER_STATUSVALUE &&
+        mon->filter.dataChangeFilter.trigger != UA_DATACHANGETRIGGER_STATUSVALUETIMESTAMP))
+        return true;
 
-/* When a change is detected, encoding contains the heap-allocated binary
- * encoded value. The default for changed is false. */
-static UA_StatusCode
-detectValueChangeWithFilter(UA_Server *server, UA_Session *session, UA_MonitoredItem *mon,
-                            UA_DataValue *value, UA_ByteString *encoding, UA_Boolean *changed) {
-    if(UA_DataType_isNumeric(value->value.type) &&
-       (mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUSVALUE ||
-        mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUSVALUETIMESTAMP)) {
-        if(mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_ABSOLUTE) {
-            if(!updateNeededForFilteredValue(&value->value, &mon->lastValue,
-                                             mon->filter.dataChangeFilter.deadbandValue))
-                return UA_STATUSCODE_GOOD;
-        }
-#ifdef UA_ENABLE_DA
-        else if(mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_PERCENT) {
-            /* Browse for the percent range */
-            UA_QualifiedName qn = UA_QUALIFIEDNAME(0, "EURange");
-            UA_BrowsePathResult bpr = browseSimplifiedBrowsePath(server, mon->monitoredNodeId, 1, &qn);
-            if(bpr.statusCode != UA_STATUSCODE_GOOD || bpr.targetsSize < 1) {
-                  UA_BrowsePathResult_clear(&bpr);
-                  return UA_STATUSCODE_GOOD;
-            }
-
-            /* Read the range */
-            UA_ReadValueId rvi;
-            UA_ReadValueId_init(&rvi);
-            rvi.nodeId = bpr.targets->targetId.nodeId;
-            rvi.attributeId = UA_ATTRIBUTEID_VALUE;
-            UA_DataValue rangeVal = UA_Server_readWithSession(server, session, &rvi, UA_TIMESTAMPSTORETURN_NEITHER);
-            if(!UA_Variant_isScalar(&rangeVal.value) || rangeVal.value.type != &UA_TYPES[UA_TYPES_RANGE]) {
-                UA_DataValue_clear(&rangeVal);
-                return UA_STATUSCODE_GOOD;
-            }
-
-            /* Compute the max change */
-            UA_Range* euRange = (UA_Range*)rangeVal.value.data;
-            UA_Double maxDist = (mon->filter.dataChangeFilter.deadbandValue/100.0) * (euRange->high - euRange->low);
-            UA_DataValue_clear(&rangeVal);
+    if(mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_ABSOLUTE)
+        return updateNeededForFilteredValue(&value->value, &mon->lastSampledValue.value,
+                                            mon->filter.dataChangeFilter.deadbandValue);
 
-            /* Relevant change? */
-            if(!updateNeededForFilteredValue(&value->value, &mon->lastValue, maxDist) &&
-               !updateNeededForStatusCode(value, mon))
-                return UA_STATUSCODE_GOOD;
+#ifdef UA_ENABLE_DA
+    if(mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_PERCENT) {
+        /* Browse for the percent range */
+        UA_QualifiedName qn = UA_QUALIFIEDNAME(0, "EURange");
+        UA_BrowsePathResult bpr = browseSimplifiedBrowsePath(server, mon->monitoredNodeId, 1, &qn);
+        if(bpr.statusCode != UA_STATUSCODE_GOOD || bpr.targetsSize < 1) {
+            UA_BrowsePathResult_clear(&bpr);
+            return false;
         }
-#endif
-    }
 
-    /* Stack-allocate some memory for the value encoding. We might heap-allocate
-     * more memory if needed. This is just enough for scalars and small
-     * structures. */
-    UA_STACKARRAY(UA_Byte, stackValueEncoding, UA_VALUENCODING_MAXSTACK);
-    UA_ByteString valueEncoding;
-    valueEncoding.data = stackValueEncoding;
-    valueEncoding.length = UA_VALUENCODING_MAXSTACK;
-
-    /* Encode the value */
-    UA_Byte *bufPos = valueEncoding.data;
-    const UA_Byte *bufEnd = &valueEncoding.data[valueEncoding.length];
-    UA_StatusCode retval = UA_encodeBinary(value, &UA_TYPES[UA_TYPES_DATAVALUE],
-                                           &bufPos, &bufEnd, NULL, NULL);
-    if(retval == UA_STATUSCODE_BADENCODINGERROR) {
-        size_t binsize = UA_calcSizeBinary(value, &UA_TYPES[UA_TYPES_DATAVALUE]);
-        if(binsize == 0)
-            return UA_STATUSCODE_BADENCODINGERROR;
-
-        if(binsize > UA_VALUENCODING_MAXSTACK) {
-            retval = UA_ByteString_allocBuffer(&valueEncoding, binsize);
-            if(retval == UA_STATUSCODE_GOOD) {
-                bufPos = valueEncoding.data;
-                bufEnd = &valueEncoding.data[valueEncoding.length];
-                retval = UA_encodeBinary(value, &UA_TYPES[UA_TYPES_DATAVALUE],
-                                         &bufPos, &bufEnd, NULL, NULL);
-            }
+        /* Read the range */
+        UA_ReadValueId rvi;
+        UA_ReadValueId_init(&rvi);
+        rvi.nodeId = bpr.targets->targetId.nodeId;
+        rvi.attributeId = UA_ATTRIBUTEID_VALUE;
+        UA_DataValue rangeVal = UA_Server_readWithSession(server, session, &rvi, UA_TIMESTAMPSTORETURN_NEITHER);
+        UA_BrowsePathResult_clear(&bpr);
+        if(!UA_Variant_isScalar(&rangeVal.value) || rangeVal.value.type != &UA_TYPES[UA_TYPES_RANGE]) {
+            UA_DataValue_clear(&rangeVal);
+            return false;
         }
-    }
-    if(retval != UA_STATUSCODE_GOOD) {
-        if(valueEncoding.data != stackValueEncoding)
-            UA_ByteString_clear(&valueEncoding);
-        return retval;
-    }
 
-    /* Has the value changed? */
-    valueEncoding.length = (uintptr_t)bufPos - (uintptr_t)valueEncoding.data;
-    *changed = (!mon->lastSampledValue.data ||
-                !UA_String_equal(&valueEncoding, &mon->lastSampledValue));
+        /* Compute the max change */
+        UA_Range* euRange = (UA_Range*)rangeVal.value.data;
+        UA_Double maxDist = (mon->filter.dataChangeFilter.deadbandValue/100.0) * (euRange->high - euRange->low);
+        UA_DataValue_clear(&rangeVal);
 
-    /* No change */
-    if(!(*changed)) {
-        if(valueEncoding.data != stackValueEncoding)
-            UA_ByteString_clear(&valueEncoding);
-        return UA_STATUSCODE_GOOD;
+        /* Relevant change? */
+        return (updateNeededForFilteredValue(&value->value, &mon->lastSampledValue.value, maxDist) ||
+                updateNeededForStatusCode(value, mon));
     }
+#endif
 
-    /* Change detected. Copy encoding on the heap if necessary. */
-    if(valueEncoding.data == stackValueEncoding)
-        return UA_ByteString_copy(&valueEncoding, encoding);
-
-    *encoding = valueEncoding;
-    return UA_STATUSCODE_GOOD;
+    return true;
 }
 
-/* Has this sample changed from the last one? The method may allocate additional
- * space for the encoding buffer. Detect the change in encoding->data. */
-static UA_StatusCode
-    detectValueChange(UA_Server *server, UA_Session *session, UA_MonitoredItem *mon,
-                  UA_DataValue value, UA_ByteString *encoding, UA_Boolean *changed) {
+/* Has this sample changed from the last one? The filtered sample is a shallow
+ * copy of the value. The fields that are not relevant for the trigger are
+ * removed. The comparison is done on the typed value, without encoding it. */
+static UA_Boolean
+detectValueChange(UA_Server *server, UA_Session *session, UA_MonitoredItem *mon,
+                  const UA_DataValue *value, UA_DataValue *filtered) {
     UA_LOCK_ASSERT(server->serviceMutex, 1);
 
     /* Apply Filter */
-    if(mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUS)
-        value.hasValue = false;
+    *filtered = *value;
+    if(mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUS) {
+        filtered->hasValue = false;
+        UA_Variant_init(&filtered->value);
+    }
 
-    value.hasServerTimestamp = false;
-    value.hasServerPicoseconds = false;
+    filtered->hasServerTimestamp = false;
+    filtered->hasServerPicoseconds = false;
     if(mon->filter.dataChangeFilter.trigger < UA_DATACHANGETRIGGER_STATUSVALUETIMESTAMP) {
-        value.hasSourceTimestamp = false;
-        value.hasSourcePicoseconds = false;
+        filtered->hasSourceTimestamp = false;
+        filtered->hasSourcePicoseconds = false;
     }
 
+    /* Check the deadband */
+    if(!outOfDeadbandFilter(server, session, mon, filtered))
+        return false;
+
     /* Detect the value change */
-    return detectValueChangeWithFilter(server, session, mon, &value, encoding, changed);
+    return (!mon->hasLastSampledValue ||
+            !UA_equal(filtered, &mon->lastSampledValue, &UA_TYPES[UA_TYPES_DATAVALUE]));
 }
 
 /* movedValue returns whether the sample was moved to the notification. The
@@ -226,34 +179,35 @@ sampleCallbackWithValue(UA_Server *server, UA_Session *session,
                         UA_DataValue *value, UA_Boolean *movedValue) {
     UA_assert(mon->attributeId != UA_ATTRIBUTEID_EVENTNOTIFIER);
 
-    /* Contains heap-allocated binary encoding of the value if a change was detected */
-    UA_ByteString binValueEncoding = UA_BYTESTRING_NULL;
+    /* Has the value changed? The filtered sample points into the value. */
+    UA_DataValue filtered;
+    UA_Boolean changed = detectValueChange(server, session, mon, value, &filtered);
+    if(!changed) {
+        UA_LOG_DEBUG_SESSION(&server->config.logger, session, "Subscription %u | "
+                             "MonitoredItem %i | The value has not changed",
+                             sub ? sub->subscriptionId : 0, mon->monitoredItemId);
+        return UA_STATUSCODE_GOOD;
+    }
 
-    /* Has the value changed? Allocates memory in binValueEncoding if necessary.
-     * value is edited internally so we make a shallow copy. */
-    UA_Boolean changed = false;
-    UA_StatusCode retval = detectValueChange(server, session, mon, *value, &binValueEncoding, &changed);
+    /* Retain a copy of the filtered sample for the next comparison. Copy
+     * before the value is moved to the notification. */
+    UA_DataValue lastSampledValue;
+    UA_StatusCode retval = UA_DataValue_copy(&filtered, &lastSampledValue);
     if(retval != UA_STATUSCODE_GOOD) {
         UA_LOG_WARNING_SESSION(&server->config.logger, session, "Subscription %u | "
-                               "MonitoredItem %i | Value change detection failed with StatusCode %s",
+                               "MonitoredItem %i | Retaining the sample failed with StatusCode %s",
                                sub ? sub->subscriptionId : 0, mon->monitoredItemId,
                                UA_StatusCode_name(retval));
         return retval;
     }
-    if(!changed) {
-        UA_LOG_DEBUG_SESSION(&server->config.logger, session, "Subscription %u | "
-                             "MonitoredItem %i | The value has not changed",
-                             sub ? sub->subscriptionId : 0, mon->monitoredItemId);
-        return UA_STATUSCODE_GOOD;
-    }
 
     /* The MonitoredItem is attached to a subscription (not server-local).
      * Prepare a notification and enqueue it. */
     if(sub) {
         /* Allocate a new notification */
-        UA_Notification *newNotification = (UA_Notification *)UA_malloc(sizeof(UA_Notification));
+        UA_Notification *newNotification = UA_Notification_new(server);
         if(!newNotification) {
-            UA_ByteString_clear(&binValueEncoding);
+            UA_DataValue_clear(&lastSampledValue);
             return UA_STATUSCODE_BADOUTOFMEMORY;
         }
 
@@ -263,8 +217,8 @@ sampleCallbackWithValue(UA_Server *server, UA_Session *session,
         } else { /* => (value->value.storageType == UA_VARIANT_DATA_NODELETE) */
             retval = UA_DataValue_copy(value, &newNotification->data.value);
             if(retval != UA_STATUSCODE_GOOD) {
-                UA_ByteString_clear(&binValueEncoding);
-                UA_free(newNotification);
+                UA_DataValue_clear(&lastSampledValue);
+                UA_SlabPool_free(&server->notificationPool, newNotification);
                 return retval;
             }
         }
@@ -279,27 +233,10 @@ sampleCallbackWithValue(UA_Server *server, UA_Session *session,
         UA_Notification_enqueue(server, sub, mon, newNotification);
     }
 
-    /* Store the encoding for comparison */
-    UA_ByteString_clear(&mon->lastSampledValue);
-    mon->lastSampledValue = binValueEncoding;
-
-    /* Store the value for filter comparison (we don't want to decode
-     * lastSampledValue in every iteration). Don't test the return code here. If
-     * this fails, lastValue is empty and a notification will be forced for the
-     * next deadband comparison. */
-    if((mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_NONE ||
-        mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_ABSOLUTE ||
-        mon->filter.dataChangeFilter.deadbandType == UA_DEADBANDTYPE_PERCENT) &&
-       (mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUS ||
-        mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUSVALUE ||
-        mon->filter.dataChangeFilter.trigger == UA_DATACHANGETRIGGER_STATUSVALUETIMESTAMP)) {
-        UA_Variant_clear(&mon->lastValue);
-        UA_Variant_copy(&value->value, &mon->lastValue);
-#ifdef UA_ENABLE_DA
-        UA_StatusCode_clear(&mon->lastStatus);
-        UA_StatusCode_copy(&value->status, &mon->lastStatus);
-#endif
-    }
+    /* Store the sample for the comparison and for the deadband filter */
+    UA_DataValue_clear(&mon->lastSampledValue);
+    mon->lastSampledValue = lastSampledValue;
+    mon->hasLastSampledValue = true;
 
     /* Call the local callback if the MonitoredItem is not attached to a
      * subscription. Do this at the very end. Because the callback might delete
@@ -328,10 +265,11 @@ UA_MonitoredItem_sampleCallback(UA_Server *server, UA_MonitoredItem *monitoredIt
     UA_UNLOCK(server->serviceMutex)
 }
 
-void
-monitoredItem_sampleCallback(UA_Server *server, UA_MonitoredItem *monitoredItem) {
-    UA_LOCK_ASSERT(server->serviceMutex, 1);
-
+/* The node can be NULL if it does not exist. The prefetched value can be
+ * NULL. */
+static void
+sampleMonitoredItem(UA_Server *server, UA_MonitoredItem *monitoredItem,
+                    const UA_Node *node, UA_PrefetchedValue *prefetched) {
     UA_Subscription *sub = monitoredItem->subscription;
     UA_Session *session = &server->adminSession;
     if(sub)
@@ -342,9 +280,8 @@ monitoredItem_sampleCallback(UA_Server *server, UA_MonitoredItem *monitoredItem)
                          sub ? sub->subscriptionId : 0, monitoredItem->monitoredItemId);
 
     UA_assert(monitoredItem->attributeId != UA_ATTRIBUTEID_EVENTNOTIFIER);
-
-    /* Get the node */
-    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &monitoredItem->monitoredNodeId);
+    if(monitoredItem->sampleOnWrite)
+        monitoredItem->lastSampleTime = UA_DateTime_nowMonotonic();
 
     /* Sample the value. The sample can still point into the node. */
     UA_DataValue value;
@@ -355,7 +292,12 @@ monitoredItem_sampleCallback(UA_Server *server, UA_MonitoredItem *monitoredItem)
         rvid.nodeId = monitoredItem->monitoredNodeId;
         rvid.attributeId = monitoredItem->attributeId;
         rvid.indexRange = monitoredItem->indexRange;
-        ReadWithNode(node, server, session, monitoredItem->timestampsToReturn, &rvid, &value);
+        /* Share recent DataSource values with other MonitoredItems and
+         * Reads. Not older than half the sampling interval, so that the own
+         * previous sample is not reused. */
+        ReadWithNodeMaxAge(node, server, session, monitoredItem->timestampsToReturn,
+                           monitoredItem->samplingInterval / 2.0, prefetched,
+                           &rvid, &value);
     } else {
         value.hasStatus = true;
         value.status = UA_STATUSCODE_BADNODEIDUNKNOWN;
@@ -374,8 +316,283 @@ monitoredItem_sampleCallback(UA_Server *server, UA_MonitoredItem *monitoredItem)
     /* Delete the sample if it was not moved to the notification. */
     if(!movedValue)
         UA_DataValue_clear(&value); /* Does nothing for UA_VARIANT_DATA_NODELETE */
+}
+
+void
+monitoredItem_sampleCallback(UA_Server *server, UA_MonitoredItem *monitoredItem) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    const UA_Node *node = getNodeOrVirtual(server, &monitoredItem->monitoredNodeId);
+    sampleMonitoredItem(server, monitoredItem, node, NULL);
+    if(node)
+        releaseNodeOrVirtual(server, node);
+}
+
+/* The node can be NULL if it does not exist. The prefetched value can be
+ * NULL. */
+static void
+sampleSampler(UA_Server *server, UA_Sampler *sampler, const UA_Node *node,
+              UA_PrefetchedValue *prefetched) {
+    /* Sample the value once with all access rights */
+    UA_DataValue value;
+    UA_DataValue_init(&value);
+    if(node) {
+        UA_ReadValueId rvid;
+        UA_ReadValueId_init(&rvid);
+        rvid.nodeId = sampler->key.nodeId;
+        rvid.attributeId = sampler->key.attributeId;
+        rvid.indexRange = sampler->key.indexRange;
+        ReadWithNodeMaxAge(node, server, &server->adminSession,
+                           sampler->key.timestampsToReturn,
+                           sampler->key.samplingInterval / 2.0, prefetched,
+                           &rvid, &value);
+    } else {
+        value.hasStatus = true;
+        value.status = UA_STATUSCODE_BADNODEIDUNKNOWN;
+    }
+
+    /* The MonitoredItems get a shallow copy of the sample. So the value is
+     * only copied into the notifications. */
+    UA_DataValue sample = value;
+    sample.value.storageType = UA_VARIANT_DATA_NODELETE;
+
+    UA_MonitoredItem *mon, *mon_tmp;
+    LIST_FOREACH_SAFE(mon, &sampler->monitoredItems, samplerEntry, mon_tmp) {
+        UA_Subscription *sub = mon->subscription;
+        UA_Session *session = &server->adminSession;
+        if(sub)
+            session = sub->session;
+
+        /* Check the access rights of the session */
+        UA_DataValue denied;
+        UA_DataValue *v = &sample;
+        if(node && session && session != &server->adminSession &&
+           sampler->key.attributeId == UA_ATTRIBUTEID_VALUE) {
+            UA_StatusCode access = checkValueReadAccess(server, session, node);
+            if(access != UA_STATUSCODE_GOOD) {
+                UA_DataValue_init(&denied);
+                denied.hasStatus = true;
+                denied.status = access;
+                v = &denied;
+            }
+        }
+
+        UA_Boolean movedValue = false;
+        UA_StatusCode retval = sampleCallbackWithValue(server, session, sub, mon, v, &movedValue);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_LOG_WARNING_SESSION(&server->config.logger, session, "Subscription %u | "
+                                   "MonitoredItem %i | Sampling returned the statuscode %s",
+                                   sub ? sub->subscriptionId : 0, mon->monitoredItemId,
+                                   UA_StatusCode_name(retval));
+        }
+    }
+
+    /* The notifications hold copies of the shared sample. Free the original. */
+    UA_DataValue_clear(&value);
+}
+
+static void
+sampler_sampleCallback(UA_Server *server, UA_Sampler *sampler) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+
+    /* The last MonitoredItem was removed. The Sampler is freed with a delay. */
+    if(LIST_EMPTY(&sampler->monitoredItems))
+        return;
+
+    const UA_Node *node = getNodeOrVirtual(server, &sampler->key.nodeId);
+    sampleSampler(server, sampler, node, NULL);
     if(node)
-        UA_Nodestore_releaseNode(server->nsCtx, node);
+        releaseNodeOrVirtual(server, node);
+}
+
+void
+UA_Sampler_sampleCallback(UA_Server *server, UA_Sampler *sampler) {
+    UA_LOCK(server->serviceMutex);
+    sampler_sampleCallback(server, sampler);
+    UA_UNLOCK(server->serviceMutex)
+}
+
+/* Reads from a DataSource or with an onRead callback release the service
+ * mutex. The node can be replaced or deleted in the meantime. */
+static UA_Boolean
+readReleasesLock(const UA_Node *node) {
+    if(!node || node->nodeClass != UA_NODECLASS_VARIABLE)
+        return false;
+    const UA_VariableNode *vn = (const UA_VariableNode*)node;
+    if(vn->valueSource == UA_VALUESOURCE_DATASOURCE)
+        return true;
+    return (vn->value.data.callback.onRead != NULL);
+}
+
+/* Batched reads of the group members. MonitoredItems read with the rights of
+ * their session, Samplers with the admin session. */
+static UA_PrefetchedValue *
+prefetchSamplingGroup(UA_Server *server, UA_SamplingGroup *group) {
+    if(!server->hasReadBatch || group->liveMembers < 2)
+        return NULL;
+
+    size_t membersSize = group->membersSize;
+    UA_ReadValueId *ids = (UA_ReadValueId*)
+        UA_calloc(membersSize, sizeof(UA_ReadValueId));
+    UA_Session **sessions = (UA_Session**)UA_calloc(membersSize, sizeof(UA_Session*));
+    if(!ids || !sessions) {
+        UA_free(ids);
+        UA_free(sessions);
+        return NULL;
+    }
+
+    /* Shallow copies of the ReadValueIds. Removed members have no attribute
+     * and are skipped. */
+    UA_Boolean sourceTimeStamp = false;
+    for(size_t i = 0; i < membersSize; i++) {
+        UA_SamplingGroupMember *member = &group->members[i];
+        if(!member->nodeId)
+            continue;
+        UA_TimestampsToReturn timestamps;
+        if(member->mon) {
+            UA_MonitoredItem *mon = member->mon;
+            ids[i].nodeId = mon->monitoredNodeId;
+            ids[i].attributeId = mon->attributeId;
+            ids[i].indexRange = mon->indexRange;
+            sessions[i] = (mon->subscription) ?
+                mon->subscription->session : &server->adminSession;
+            timestamps = mon->timestampsToReturn;
+        } else {
+            UA_Sampler *sampler = member->sampler;
+            ids[i].nodeId = sampler->key.nodeId;
+            ids[i].attributeId = sampler->key.attributeId;
+            ids[i].indexRange = sampler->key.indexRange;
+            sessions[i] = &server->adminSession;
+            timestamps = sampler->key.timestampsToReturn;
+        }
+        if(timestamps == UA_TIMESTAMPSTORETURN_SOURCE ||
+           timestamps == UA_TIMESTAMPSTORETURN_BOTH)
+            sourceTimeStamp = true;
+    }
+
+    UA_PrefetchedValue *prefetched =
+        prefetchBatchedReads(server, NULL, sessions, membersSize, ids,
+                             group->samplingInterval / 2.0, sourceTimeStamp);
+    UA_free(ids);
+    UA_free(sessions);
+    return prefetched;
+}
+
+static void
+samplingGroup_sampleCallback(UA_Server *server, UA_SamplingGroup *group) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+
+    /* The last member was removed. The group is freed with a delay. */
+    if(group->liveMembers == 0)
+        return;
+
+    /* Don't reorder the members while another thread is in the loop below */
+    if(group->processing == 0)
+        UA_SamplingGroup_sort(group);
+    group->processing++;
+
+    /* Read the DataSources with a batched read callback ahead of the loop.
+     * The prefetched values have the index of the member. Members that are
+     * appended in the loop read their DataSource individually. */
+    size_t prefetchedSize = group->membersSize;
+    UA_PrefetchedValue *prefetched = prefetchSamplingGroup(server, group);
+
+    /* Members can be added and removed while the lock is released for the
+     * callbacks of local MonitoredItems and for reads from DataSources or with
+     * an onRead callback. Removed members leave a gap and new members are
+     * appended. So the loop re-reads the array in every step. */
+    const UA_NodeId *nodeId = NULL; /* Set if the node is cached */
+    const UA_Node *node = NULL;
+    for(size_t i = 0; i < group->membersSize; i++) {
+        UA_SamplingGroupMember member = group->members[i];
+        if(!member.nodeId)
+            continue; /* Removed */
+
+        /* Look up the node if it differs from the previous member */
+        if(!nodeId || !UA_NodeId_equal(nodeId, member.nodeId)) {
+            if(node)
+                releaseNodeOrVirtual(server, node);
+            node = getNodeOrVirtual(server, member.nodeId);
+            nodeId = member.nodeId;
+        }
+
+        /* Local MonitoredItems call out with the lock released. The member can
+         * be removed in the callback. Then the cached NodeId is no longer
+         * valid. Samplers can contain local MonitoredItems. The read itself
+         * can release the lock as well. Then the node is looked up again for
+         * the next member, as it may have been replaced or deleted. */
+        UA_Boolean releasesLock = (!member.mon || !member.mon->subscription ||
+                                   readReleasesLock(node));
+        UA_PrefetchedValue *pv = (prefetched && i < prefetchedSize) ?
+            &prefetched[i] : NULL;
+        if(member.mon)
+            sampleMonitoredItem(server, member.mon, node, pv);
+        else
+            sampleSampler(server, member.sampler, node, pv);
+
+        if(releasesLock) {
+            if(node)
+                releaseNodeOrVirtual(server, node);
+            node = NULL;
+            nodeId = NULL;
+        }
+    }
+    if(node)
+        releaseNodeOrVirtual(server, node);
+
+    /* Members removed in the loop leave their prefetched value behind */
+    UA_PrefetchedValues_delete(prefetched, prefetchedSize);
+    group->processing--;
+}
+
+void
+UA_SamplingGroup_sampleCallback(UA_Server *server, UA_SamplingGroup *group) {
+    UA_LOCK(server->serviceMutex);
+    samplingGroup_sampleCallback(server, group);
+    UA_UNLOCK(server->serviceMutex)
+}
+
+static void
+delayedSampleCallback(UA_Server *server, UA_MonitoredItem *mon) {
+    UA_LOCK(server->serviceMutex);
+    mon->delayedSampleIsRegistered = false;
+    if(mon->sampleOnWrite)
+        monitoredItem_sampleCallback(server, mon);
+    UA_UNLOCK(server->serviceMutex);
+}
+
+static void
+sampleOnWrite(UA_Server *server, UA_MonitoredItem *mon) {
+    /* The delayed sample will take the latest value */
+    if(mon->delayedSampleIsRegistered)
+        return;
+
+    /* Sample right away if the sampling interval has passed */
+    UA_DateTime next = mon->lastSampleTime +
+        (UA_DateTime)(mon->samplingInterval * UA_DATETIME_MSEC);
+    if(UA_DateTime_nowMonotonic() >= next) {
+        monitoredItem_sampleCallback(server, mon);
+        return;
+    }
+
+    /* Delay the sample */
+    UA_StatusCode retval =
+        UA_Timer_addTimedCallback(&server->timer, (UA_ApplicationCallback)delayedSampleCallback,
+                                  server, mon, next, &mon->delayedSampleCallbackId);
+    if(retval == UA_STATUSCODE_GOOD)
+        mon->delayedSampleIsRegistered = true;
+    else
+        monitoredItem_sampleCallback(server, mon);
+}
+
+void
+notifyValueChanged(UA_Server *server, const UA_NodeId *nodeId) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    UA_NodeMonitors *nm = ZIP_FIND(UA_NodeMonitorsTree, &server->nodeMonitors, nodeId);
+    if(!nm)
+        return;
+    UA_MonitoredItem *mon, *mon_tmp;
+    LIST_FOREACH_SAFE(mon, &nm->monitoredItems, nodeEntry, mon_tmp)
+        sampleOnWrite(server, mon);
 }
 
 #endif /* UA_ENABLE_SUBSCRIPTIONS */
@@ -69,7 +69,7 @@ UA_Server_createEvent(UA_Server *server, const UA_NodeId eventType,
     /* Make sure the eventType is a subtype of BaseEventType */
     UA_NodeId hasSubtypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASSUBTYPE);
     UA_NodeId baseEventTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEEVENTTYPE);
-    if(!isNodeInTree(server->nsCtx, &eventType, &baseEventTypeId, &hasSubtypeId, 1)) {
+    if(!isNodeInTree(server, &eventType, &baseEventTypeId, &hasSubtypeId, 1)) {
         UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_USERLAND,
                      "Event type must be a subtype of BaseEventType!");
         UA_UNLOCK(server->serviceMutex);
@@ -128,62 +128,172 @@ UA_Server_createEvent(UA_Server *server, const UA_NodeId eventType,
     return UA_STATUSCODE_GOOD;
 }
 
-static UA_Boolean
-isValidEvent(UA_Server *server, const UA_NodeId *validEventParent,
-             const UA_NodeId *eventId) {
+/* The event is either represented by a node or given by its fields in memory.
+ * The standard fields of in-memory events are set by the server. The fields
+ * resolved for one MonitoredItem are kept for the other MonitoredItems. The
+ * key is copied, as the service mutex is released during the resolution and
+ * the MonitoredItem or its session can be removed in the meantime. */
+typedef struct {
+    UA_SimpleAttributeOperand sao;
+    UA_UInt32 hash;
+    UA_NodeId sessionId; /* The value is read with the rights of the session */
+    UA_StatusCode status;
+    UA_Variant value;
+} UA_ResolvedEventField;
+
+typedef struct {
+    const UA_NodeId *eventNode; /* NULL for in-memory events */
+    const UA_NodeId *eventType;
+    const UA_NodeId *sourceNode;
+    const UA_ByteString *eventId;
+    UA_DateTime receiveTime;
+    size_t fieldsSize;
+    const UA_EventField *fields;
+
+    /* Resolved while the event is added to the MonitoredItems */
+    UA_Boolean eventTypeResolved;
+    UA_Boolean validityChecked;
+    UA_Boolean validEventType;
+    UA_NodeId eventNodeType; /* Read from the event node */
+    size_t resolvedSize;
+    UA_ResolvedEventField *resolved;
+} UA_EventSource;
+
+static void
+UA_EventSource_clear(UA_EventSource *source) {
+    for(size_t i = 0; i < source->resolvedSize; i++) {
+        UA_SimpleAttributeOperand_clear(&source->resolved[i].sao);
+        UA_NodeId_clear(&source->resolved[i].sessionId);
+        UA_Variant_clear(&source->resolved[i].value);
+    }
+    UA_free(source->resolved);
+    source->resolved = NULL;
+    source->resolvedSize = 0;
+    UA_NodeId_clear(&source->eventNodeType);
+}
+
+static const UA_NodeId hasSubtypeId = {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASSUBTYPE}};
+static const UA_NodeId baseEventTypeId = {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_BASEEVENTTYPE}};
+static const UA_NodeId conditionTypeId = {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_CONDITIONTYPE}};
+
+/* Returns NULL if the EventType of the event node cannot be read */
+static const UA_NodeId *
+getEventType(UA_Server *server, UA_EventSource *source) {
+    /* The type of in-memory events is known */
+    if(!source->eventNode)
+        return source->eventType;
+    if(source->eventTypeResolved)
+        return source->eventType;
+    source->eventTypeResolved = true;
+
     /* find the eventType variableNode */
     UA_QualifiedName findName = UA_QUALIFIEDNAME(0, "EventType");
-    UA_BrowsePathResult bpr = browseSimplifiedBrowsePath(server, *eventId, 1, &findName);
+    UA_BrowsePathResult bpr =
+        browseSimplifiedBrowsePath(server, *source->eventNode, 1, &findName);
     if(bpr.statusCode != UA_STATUSCODE_GOOD || bpr.targetsSize < 1) {
         UA_BrowsePathResult_clear(&bpr);
-        return false;
+        return NULL;
     }
-    
-    /* Get the EventType Property Node */
-    UA_Variant tOutVariant;
-    UA_Variant_init(&tOutVariant);
 
     /* Read the Value of EventType Property Node (the Value should be a NodeId) */
+    UA_Variant tOutVariant;
+    UA_Variant_init(&tOutVariant);
     UA_StatusCode retval =
-            readWithReadValue(server, &bpr.targets[0].targetId.nodeId, UA_ATTRIBUTEID_VALUE, &tOutVariant);
+        readWithReadValue(server, &bpr.targets[0].targetId.nodeId,
+                          UA_ATTRIBUTEID_VALUE, &tOutVariant);
+    UA_BrowsePathResult_clear(&bpr);
     if(retval != UA_STATUSCODE_GOOD ||
        !UA_Variant_hasScalarType(&tOutVariant, &UA_TYPES[UA_TYPES_NODEID])) {
-        UA_BrowsePathResult_clear(&bpr);
-        return false;
+        UA_Variant_clear(&tOutVariant);
+        return NULL;
+    }
+
+    /* Move the NodeId out of the variant */
+    source->eventNodeType = *(UA_NodeId*)tOutVariant.data;
+    UA_free(tOutVariant.data);
+    source->eventType = &source->eventNodeType;
+    return source->eventType;
+}
+
+/* Alarms and Conditions (Part 9) are not supported yet. Other events must be
+ * of a subtype of BaseEventType. */
+static UA_Boolean
+isValidEvent(UA_Server *server, UA_EventSource *source) {
+    if(source->validityChecked)
+        return source->validEventType;
+    source->validityChecked = true;
+    const UA_NodeId *eventType = getEventType(server, source);
+    source->validEventType = eventType &&
+        !isNodeInTree(server, eventType, &conditionTypeId, &hasSubtypeId, 1) &&
+        isNodeInTree(server, eventType, &baseEventTypeId, &hasSubtypeId, 1);
+    return source->validEventType;
+}
+
+/* Look up a field of an in-memory event. The standard fields set by the server
+ * take precedence. The Time is the ReceiveTime, unless it is given. The
+ * variant is only used to point to the standard fields. */
+static const UA_Variant *
+getEventField(const UA_EventSource *source, const UA_EventFieldOperand *op,
+              UA_Variant *standardField) {
+    switch(op->kind) {
+    case UA_EVENTFIELD_EVENTID:
+        UA_Variant_setScalar(standardField, (void*)(uintptr_t)source->eventId,
+                             &UA_TYPES[UA_TYPES_BYTESTRING]);
+        return standardField;
+    case UA_EVENTFIELD_EVENTTYPE:
+        UA_Variant_setScalar(standardField, (void*)(uintptr_t)source->eventType,
+                             &UA_TYPES[UA_TYPES_NODEID]);
+        return standardField;
+    case UA_EVENTFIELD_SOURCENODE:
+        UA_Variant_setScalar(standardField, (void*)(uintptr_t)source->sourceNode,
+                             &UA_TYPES[UA_TYPES_NODEID]);
+        return standardField;
+    case UA_EVENTFIELD_RECEIVETIME:
+        UA_Variant_setScalar(standardField, (void*)(uintptr_t)&source->receiveTime,
+                             &UA_TYPES[UA_TYPES_DATETIME]);
+        return standardField;
+    default:
+        break;
     }
 
-    const UA_NodeId *tEventType = (UA_NodeId*)tOutVariant.data;
+    const UA_QualifiedName *name = &op->sao->browsePath[0];
+    for(size_t i = 0; i < source->fieldsSize; i++) {
+        if(UA_QualifiedName_equal(&source->fields[i].name, name))
+            return &source->fields[i].value;
+    }
 
-    /* Make sure the EventType is not a Subtype of CondtionType
-     * First check for filter set using UaExpert
-     * (ConditionId Clause won't be present in Events, which are not Conditions)
-     * Second check for Events which are Conditions or Alarms (Part 9 not supported yet) */
-    UA_NodeId conditionTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_CONDITIONTYPE);
-    UA_NodeId hasSubtypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASSUBTYPE);
-    if(UA_NodeId_equal(validEventParent, &conditionTypeId) ||
-       isNodeInTree(server->nsCtx, tEventType, &conditionTypeId, &hasSubtypeId, 1)) {
-        UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_USERLAND,
-                     "Alarms and Conditions are not supported yet!");
-        UA_BrowsePathResult_clear(&bpr);
-        UA_Variant_clear(&tOutVariant);
-        return false;
+    if(op->kind == UA_EVENTFIELD_TIME) {
+        UA_Variant_setScalar(standardField, (void*)(uintptr_t)&source->receiveTime,
+                             &UA_TYPES[UA_TYPES_DATETIME]);
+        return standardField;
     }
+    return NULL;
+}
 
-    /* check whether Valid Event other than Conditions */
-    UA_NodeId baseEventTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEEVENTTYPE);
-    UA_Boolean isSubtypeOfBaseEvent = isNodeInTree(server->nsCtx, tEventType,
-                                                   &baseEventTypeId, &hasSubtypeId, 1);
+/* The fields of in-memory events are properties of the event. So only the
+ * value attribute of a direct child can be selected. */
+static UA_StatusCode
+readEventField(const UA_EventSource *source, const UA_EventFieldOperand *op,
+               UA_Variant *value) {
+    const UA_SimpleAttributeOperand *sao = op->sao;
+    if(sao->browsePathSize != 1 || sao->attributeId != UA_ATTRIBUTEID_VALUE)
+        return UA_STATUSCODE_BADNOTFOUND;
 
-    UA_BrowsePathResult_clear(&bpr);
-    UA_Variant_clear(&tOutVariant);
-    return isSubtypeOfBaseEvent;
+    UA_Variant standardField;
+    const UA_Variant *field = getEventField(source, op, &standardField);
+    if(!field)
+        return UA_STATUSCODE_BADNOTFOUND;
+    if(!op->hasIndexRange)
+        return UA_Variant_copy(field, value);
+    return UA_Variant_copyRange(field, value, op->indexRange);
 }
 
 /* Part 4: 7.4.4.5 SimpleAttributeOperand
  * The clause can point to any attribute of nodes. Either a child of the event
  * node and also the event type. */
 static UA_StatusCode
-resolveSimpleAttributeOperand(UA_Server *server, UA_Session *session, const UA_NodeId *origin,
+resolveSimpleAttributeOperand(UA_Server *server, UA_Session *session,
+                              const UA_EventSource *source,
                               const UA_SimpleAttributeOperand *sao, UA_Variant *value) {
     /* Prepare the ReadValueId */
     UA_ReadValueId rvi;
@@ -204,8 +314,8 @@ resolveSimpleAttributeOperand(UA_Server *server, UA_Session *session, const UA_N
 
     /* Resolve the browse path */
     UA_BrowsePathResult bpr =
-        browseSimplifiedBrowsePath(server, *origin, sao->browsePathSize,
-                                             sao->browsePath);
+        browseSimplifiedBrowsePath(server, *source->eventNode, sao->browsePathSize,
+                                   sao->browsePath);
     if(bpr.targetsSize == 0 && bpr.statusCode == UA_STATUSCODE_GOOD)
         bpr.statusCode = UA_STATUSCODE_BADNOTFOUND;
     if(bpr.statusCode != UA_STATUSCODE_GOOD) {
@@ -225,57 +335,739 @@ resolveSimpleAttributeOperand(UA_Server *server, UA_Session *session, const UA_N
     return v.status;
 }
 
-/* Filters the given event with the given filter and writes the results into a
- * notification */
+/* Resolve an operand of the event and return a copy of the value. Operands of
+ * event nodes and of the TypeDefinition are resolved once for all
+ * MonitoredItems of the same session. */
 static UA_StatusCode
-UA_Server_filterEvent(UA_Server *server, UA_Session *session,
-                      const UA_NodeId *eventNode, UA_EventFilter *filter,
-                      UA_EventNotification *notification) {
-    if (filter->selectClausesSize == 0)
-        return UA_STATUSCODE_BADEVENTFILTERINVALID;
+resolveEventField(UA_Server *server, UA_Session *session, UA_EventSource *source,
+                  const UA_EventFieldOperand *op, UA_Variant *value) {
+    /* The TypeDefinition is not checked for BaseEventType */
+    if(op->checkEventType && (op->conditionType || !isValidEvent(server, source)))
+        return UA_STATUSCODE_BADTYPEDEFINITIONINVALID;
 
-    UA_EventFieldList_init(&notification->fields);
-    /* EventFilterResult isn't being used currently
-    UA_EventFilterResult_init(&notification->result); */
+    /* The fields of in-memory events are looked up by name */
+    if(!source->eventNode && op->sao->browsePathSize > 0)
+        return readEventField(source, op, value);
 
-    notification->fields.eventFields = (UA_Variant *)
-        UA_Array_new(filter->selectClausesSize, &UA_TYPES[UA_TYPES_VARIANT]);
-    if(!notification->fields.eventFields) {
-        /* EventFilterResult currently isn't being used
-        UA_EventFiterResult_clear(&notification->result); */
+    /* Already resolved for another MonitoredItem? */
+    for(size_t i = 0; i < source->resolvedSize; i++) {
+        UA_ResolvedEventField *rf = &source->resolved[i];
+        if(rf->hash != op->hash || !UA_NodeId_equal(&rf->sessionId, &session->sessionId) ||
+           !UA_equal(&rf->sao, op->sao, &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND]))
+            continue;
+        if(rf->status != UA_STATUSCODE_GOOD)
+            return rf->status;
+        return UA_Variant_copy(&rf->value, value);
+    }
+
+    UA_ResolvedEventField *resolved = (UA_ResolvedEventField*)
+        UA_realloc(source->resolved, (source->resolvedSize + 1) *
+                   sizeof(UA_ResolvedEventField));
+    if(!resolved)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    source->resolved = resolved;
+    UA_ResolvedEventField *rf = &resolved[source->resolvedSize];
+    memset(rf, 0, sizeof(UA_ResolvedEventField));
+    UA_StatusCode retval = UA_SimpleAttributeOperand_copy(op->sao, &rf->sao);
+    retval |= UA_NodeId_copy(&session->sessionId, &rf->sessionId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_SimpleAttributeOperand_clear(&rf->sao);
+        UA_NodeId_clear(&rf->sessionId);
+        return retval;
+    }
+    source->resolvedSize++;
+    rf->hash = op->hash;
+
+    /* Resolve from the copied operand. The MonitoredItem may be removed while
+     * the value is read. */
+    rf->status = resolveSimpleAttributeOperand(server, session, source,
+                                               &rf->sao, &rf->value);
+    if(rf->status != UA_STATUSCODE_GOOD)
+        return rf->status;
+    return UA_Variant_copy(&rf->value, value);
+}
+
+/**********************/
+/* Compile the Filter */
+/**********************/
+
+static UA_StatusCode
+compileFieldOperand(UA_Server *server, const UA_SimpleAttributeOperand *sao,
+                    UA_EventFieldOperand *op) {
+    memset(op, 0, sizeof(UA_EventFieldOperand));
+    op->sao = sao;
+
+    UA_UInt32 h = UA_NodeId_hash(&sao->typeDefinitionId);
+    for(size_t i = 0; i < sao->browsePathSize; i++) {
+        h = UA_ByteString_hash(h, (const UA_Byte*)&sao->browsePath[i].namespaceIndex,
+                               sizeof(UA_UInt16));
+        h = UA_ByteString_hash(h, sao->browsePath[i].name.data,
+                               sao->browsePath[i].name.length);
+    }
+    h = UA_ByteString_hash(h, (const UA_Byte*)&sao->attributeId, sizeof(UA_UInt32));
+    op->hash = UA_ByteString_hash(h, sao->indexRange.data, sao->indexRange.length);
+
+    op->checkEventType = !UA_NodeId_equal(&sao->typeDefinitionId, &baseEventTypeId);
+    op->conditionType = UA_NodeId_equal(&sao->typeDefinitionId, &conditionTypeId);
+    if(op->conditionType)
+        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                       "Events: Alarms and Conditions are not supported yet. "
+                       "Operands of the ConditionType remain empty.");
+
+    /* The standard fields of in-memory events */
+    if(sao->browsePathSize == 1 && sao->browsePath[0].namespaceIndex == 0) {
+        static const UA_String eventIdName = UA_STRING_STATIC("EventId");
+        static const UA_String eventTypeName = UA_STRING_STATIC("EventType");
+        static const UA_String sourceNodeName = UA_STRING_STATIC("SourceNode");
+        static const UA_String receiveTimeName = UA_STRING_STATIC("ReceiveTime");
+        static const UA_String timeName = UA_STRING_STATIC("Time");
+        const UA_String *name = &sao->browsePath[0].name;
+        if(UA_String_equal(name, &eventIdName))
+            op->kind = UA_EVENTFIELD_EVENTID;
+        else if(UA_String_equal(name, &eventTypeName))
+            op->kind = UA_EVENTFIELD_EVENTTYPE;
+        else if(UA_String_equal(name, &sourceNodeName))
+            op->kind = UA_EVENTFIELD_SOURCENODE;
+        else if(UA_String_equal(name, &receiveTimeName))
+            op->kind = UA_EVENTFIELD_RECEIVETIME;
+        else if(UA_String_equal(name, &timeName))
+            op->kind = UA_EVENTFIELD_TIME;
+    }
+
+    if(sao->indexRange.length == 0)
+        return UA_STATUSCODE_GOOD;
+    UA_StatusCode retval = UA_NumericRange_parseFromString(&op->indexRange, &sao->indexRange);
+    if(retval != UA_STATUSCODE_GOOD)
+        return UA_STATUSCODE_BADINDEXRANGEINVALID;
+    op->hasIndexRange = true;
+    return UA_STATUSCODE_GOOD;
+}
+
+static UA_StatusCode
+checkOperandsSize(const UA_ContentFilterElement *elm) {
+    size_t size = elm->filterOperandsSize;
+    switch(elm->filterOperator) {
+    case UA_FILTEROPERATOR_ISNULL:
+    case UA_FILTEROPERATOR_NOT:
+    case UA_FILTEROPERATOR_OFTYPE:
+        return (size == 1) ? UA_STATUSCODE_GOOD : UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH;
+    case UA_FILTEROPERATOR_EQUALS:
+    case UA_FILTEROPERATOR_GREATERTHAN:
+    case UA_FILTEROPERATOR_LESSTHAN:
+    case UA_FILTEROPERATOR_GREATERTHANOREQUAL:
+    case UA_FILTEROPERATOR_LESSTHANOREQUAL:
+    case UA_FILTEROPERATOR_LIKE:
+    case UA_FILTEROPERATOR_AND:
+    case UA_FILTEROPERATOR_OR:
+    case UA_FILTEROPERATOR_BITWISEAND:
+    case UA_FILTEROPERATOR_BITWISEOR:
+        return (size == 2) ? UA_STATUSCODE_GOOD : UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH;
+    case UA_FILTEROPERATOR_BETWEEN:
+        return (size == 3) ? UA_STATUSCODE_GOOD : UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH;
+    case UA_FILTEROPERATOR_INLIST:
+        return (size >= 2) ? UA_STATUSCODE_GOOD : UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH;
+    default:
+        return UA_STATUSCODE_BADFILTEROPERATORUNSUPPORTED;
+    }
+}
+
+static UA_StatusCode
+compileOperand(UA_Server *server, const UA_ContentFilter *where, size_t elementIndex,
+               const UA_ExtensionObject *eo, UA_EventOperand *op) {
+    if(eo->encoding != UA_EXTENSIONOBJECT_DECODED &&
+       eo->encoding != UA_EXTENSIONOBJECT_DECODED_NODELETE)
+        return UA_STATUSCODE_BADFILTEROPERANDINVALID;
+
+    if(eo->content.decoded.type == &UA_TYPES[UA_TYPES_LITERALOPERAND]) {
+        op->type = UA_EVENTOPERAND_LITERAL;
+        op->operand.literal = &((const UA_LiteralOperand*)eo->content.decoded.data)->value;
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /* Only references to later elements. The elements are evaluated once,
+     * from the last to the first. */
+    if(eo->content.decoded.type == &UA_TYPES[UA_TYPES_ELEMENTOPERAND]) {
+        UA_UInt32 index = ((const UA_ElementOperand*)eo->content.decoded.data)->index;
+        if(index <= elementIndex || index >= where->elementsSize)
+            return UA_STATUSCODE_BADFILTEROPERANDINVALID;
+        op->type = UA_EVENTOPERAND_ELEMENT;
+        op->operand.element = index;
+        return UA_STATUSCODE_GOOD;
+    }
+
+    if(eo->content.decoded.type == &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND]) {
+        op->type = UA_EVENTOPERAND_ATTRIBUTE;
+        return compileFieldOperand(server, (const UA_SimpleAttributeOperand*)
+                                   eo->content.decoded.data, &op->operand.attribute);
+    }
+
+    /* The AttributeOperand is not allowed in EventFilters */
+    return UA_STATUSCODE_BADFILTEROPERANDINVALID;
+}
+
+static UA_StatusCode
+compileWhereClause(UA_Server *server, const UA_ContentFilter *where,
+                   UA_CompiledEventFilter *cf) {
+    if(where->elementsSize == 0)
+        return UA_STATUSCODE_GOOD;
+    if(server->config.maxWhereClauseElements != 0 &&
+       where->elementsSize > server->config.maxWhereClauseElements)
+        return UA_STATUSCODE_BADTOOMANYOPERATIONS;
+    cf->whereClause = (UA_EventFilterElement*)
+        UA_calloc(where->elementsSize, sizeof(UA_EventFilterElement));
+    if(!cf->whereClause)
         return UA_STATUSCODE_BADOUTOFMEMORY;
+    cf->whereClauseSize = where->elementsSize;
+
+    for(size_t i = 0; i < where->elementsSize; i++) {
+        const UA_ContentFilterElement *elm = &where->elements[i];
+        UA_StatusCode retval = checkOperandsSize(elm);
+        if(retval != UA_STATUSCODE_GOOD)
+            return retval;
+        UA_EventFilterElement *ce = &cf->whereClause[i];
+        ce->filterOperator = elm->filterOperator;
+        ce->operands = (UA_EventOperand*)
+            UA_calloc(elm->filterOperandsSize, sizeof(UA_EventOperand));
+        if(!ce->operands)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        ce->operandsSize = elm->filterOperandsSize;
+        for(size_t j = 0; j < elm->filterOperandsSize; j++) {
+            retval = compileOperand(server, where, i, &elm->filterOperands[j],
+                                    &ce->operands[j]);
+            if(retval != UA_STATUSCODE_GOOD)
+                return retval;
+        }
+
+        /* The type for OfType is a literal NodeId */
+        if(ce->filterOperator == UA_FILTEROPERATOR_OFTYPE &&
+           (ce->operands[0].type != UA_EVENTOPERAND_LITERAL ||
+            !UA_Variant_hasScalarType(ce->operands[0].operand.literal,
+                                      &UA_TYPES[UA_TYPES_NODEID])))
+            return UA_STATUSCODE_BADFILTEROPERANDINVALID;
     }
-    notification->fields.eventFieldsSize = filter->selectClausesSize;
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode
+UA_CompiledEventFilter_compile(UA_Server *server, const UA_EventFilter *filter,
+                               UA_CompiledEventFilter *cf) {
+    memset(cf, 0, sizeof(UA_CompiledEventFilter));
+    if(filter->selectClausesSize == 0)
+        return UA_STATUSCODE_BADEVENTFILTERINVALID;
 
-    /* EventFilterResult currently isn't being used
-    notification->result.selectClauseResultsSize = filter->selectClausesSize;
-    notification->result.selectClauseResults = (UA_StatusCode *)
-        UA_Array_new(filter->selectClausesSize, &UA_TYPES[UA_TYPES_STATUSCODE]);
-    if(!notification->result->selectClauseResults) {
-        UA_EventFieldList_clear(&notification->fields);
-        UA_EventFilterResult_clear(&notification->result);
+    cf->selectClauses = (UA_EventFieldOperand*)
+        UA_calloc(filter->selectClausesSize, sizeof(UA_EventFieldOperand));
+    if(!cf->selectClauses)
         return UA_STATUSCODE_BADOUTOFMEMORY;
+    cf->selectClausesSize = filter->selectClausesSize;
+
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    for(size_t i = 0; i < filter->selectClausesSize && retval == UA_STATUSCODE_GOOD; i++)
+        retval = compileFieldOperand(server, &filter->selectClauses[i],
+                                     &cf->selectClauses[i]);
+    if(retval == UA_STATUSCODE_GOOD)
+        retval = compileWhereClause(server, &filter->whereClause, cf);
+    if(retval != UA_STATUSCODE_GOOD)
+        UA_CompiledEventFilter_clear(cf);
+    return retval;
+}
+
+static void
+clearFieldOperand(UA_EventFieldOperand *op) {
+    if(op->hasIndexRange)
+        UA_free(op->indexRange.dimensions);
+}
+
+void
+UA_CompiledEventFilter_clear(UA_CompiledEventFilter *cf) {
+    for(size_t i = 0; i < cf->selectClausesSize; i++)
+        clearFieldOperand(&cf->selectClauses[i]);
+    UA_free(cf->selectClauses);
+    for(size_t i = 0; i < cf->whereClauseSize; i++) {
+        UA_EventFilterElement *ce = &cf->whereClause[i];
+        for(size_t j = 0; j < ce->operandsSize; j++) {
+            if(ce->operands[j].type == UA_EVENTOPERAND_ATTRIBUTE)
+                clearFieldOperand(&ce->operands[j].operand.attribute);
+        }
+        UA_free(ce->operands);
     }
-    */
+    UA_free(cf->whereClause);
+    memset(cf, 0, sizeof(UA_CompiledEventFilter));
+}
 
-    /* Apply the filter */
+/***************************/
+/* Evaluate the WhereClause */
+/***************************/
 
-    /* Check if the browsePath is BaseEventType, in which case nothing more
-     * needs to be checked */
-    UA_NodeId baseEventTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEEVENTTYPE);
-    for(size_t i = 0; i < filter->selectClausesSize; i++) {
-        if(!UA_NodeId_equal(&filter->selectClauses[i].typeDefinitionId, &baseEventTypeId) &&
-           !isValidEvent(server, &filter->selectClauses[i].typeDefinitionId, eventNode)) {
-            UA_Variant_init(&notification->fields.eventFields[i]);
-            /* EventFilterResult currently isn't being used
-            notification->result.selectClauseResults[i] = UA_STATUSCODE_BADTYPEDEFINITIONINVALID; */
+/* Part 4: 7.4.3 ContentFilter
+ * The result of an element is a value or NULL (an empty variant). The logical
+ * operators treat NULL as unknown. Values of different numeric types are
+ * compared by their value. Other values are only compared with values of the
+ * same type. */
+
+typedef struct {
+    UA_Server *server;
+    UA_Session *session;
+    UA_EventSource *source;
+    const UA_CompiledEventFilter *cf;
+    UA_Variant *results; /* Of the elements after the current element */
+} UA_FilterContext;
+
+static const UA_Boolean trueValue = true;
+static const UA_Boolean falseValue = false;
+
+static void
+setBoolean(UA_Variant *v, UA_Boolean b) {
+    UA_Variant_setScalar(v, (void*)(uintptr_t)(b ? &trueValue : &falseValue),
+                         &UA_TYPES[UA_TYPES_BOOLEAN]);
+    v->storageType = UA_VARIANT_DATA_NODELETE;
+}
+
+/* Returns 1 for true, 0 for false and -1 for NULL */
+static int
+getBoolean(const UA_Variant *v) {
+    if(!UA_Variant_hasScalarType(v, &UA_TYPES[UA_TYPES_BOOLEAN]))
+        return -1;
+    return *(const UA_Boolean*)v->data ? 1 : 0;
+}
+
+static UA_Boolean
+isIntegerKind(UA_UInt32 kind) {
+    return kind <= UA_DATATYPEKIND_UINT64 || kind == UA_DATATYPEKIND_ENUM;
+}
+
+/* Integers are represented with the sign and the magnitude */
+static void
+getInteger(const UA_Variant *v, UA_Boolean *negative, UA_UInt64 *magnitude) {
+    UA_Int64 s = 0;
+    UA_UInt64 u = 0;
+    UA_Boolean isSigned = true;
+    switch(v->type->typeKind) {
+    case UA_DATATYPEKIND_BOOLEAN: s = *(const UA_Boolean*)v->data; break;
+    case UA_DATATYPEKIND_SBYTE: s = *(const UA_SByte*)v->data; break;
+    case UA_DATATYPEKIND_BYTE: s = *(const UA_Byte*)v->data; break;
+    case UA_DATATYPEKIND_INT16: s = *(const UA_Int16*)v->data; break;
+    case UA_DATATYPEKIND_UINT16: s = *(const UA_UInt16*)v->data; break;
+    case UA_DATATYPEKIND_INT32:
+    case UA_DATATYPEKIND_ENUM: s = *(const UA_Int32*)v->data; break;
+    case UA_DATATYPEKIND_UINT32: s = *(const UA_UInt32*)v->data; break;
+    case UA_DATATYPEKIND_INT64: s = *(const UA_Int64*)v->data; break;
+    default: u = *(const UA_UInt64*)v->data; isSigned = false; break;
+    }
+    if(isSigned) {
+        *negative = (s < 0);
+        *magnitude = (s < 0) ? (UA_UInt64)0 - (UA_UInt64)s : (UA_UInt64)s;
+    } else {
+        *negative = false;
+        *magnitude = u;
+    }
+}
+
+static UA_Double
+getDouble(const UA_Variant *v) {
+    if(v->type->typeKind == UA_DATATYPEKIND_FLOAT)
+        return *(const UA_Float*)v->data;
+    if(v->type->typeKind == UA_DATATYPEKIND_DOUBLE)
+        return *(const UA_Double*)v->data;
+    UA_Boolean negative;
+    UA_UInt64 magnitude;
+    getInteger(v, &negative, &magnitude);
+    return negative ? -(UA_Double)magnitude : (UA_Double)magnitude;
+}
+
+static UA_Order
+orderBytes(const UA_String *a, const UA_String *b) {
+    size_t len = (a->length < b->length) ? a->length : b->length;
+    int cmp = (len > 0) ? memcmp(a->data, b->data, len) : 0;
+    if(cmp == 0 && a->length != b->length)
+        cmp = (a->length < b->length) ? -1 : 1;
+    return (cmp < 0) ? UA_ORDER_LESS : ((cmp > 0) ? UA_ORDER_MORE : UA_ORDER_EQ);
+}
+
+typedef enum {
+    UA_COMPARE_LESS = -1,
+    UA_COMPARE_EQ = 0,
+    UA_COMPARE_MORE = 1,
+    UA_COMPARE_UNEQUAL, /* Not ordered, but different */
+    UA_COMPARE_NONE     /* Not comparable */
+} UA_CompareResult;
+
+static UA_CompareResult
+compareValues(const UA_Variant *a, const UA_Variant *b) {
+    if(!UA_Variant_isScalar(a) || !UA_Variant_isScalar(b))
+        return UA_COMPARE_NONE;
+    UA_UInt32 ka = a->type->typeKind;
+    UA_UInt32 kb = b->type->typeKind;
+
+    /* Numeric values */
+    UA_Boolean na = isIntegerKind(ka) || ka == UA_DATATYPEKIND_FLOAT ||
+        ka == UA_DATATYPEKIND_DOUBLE;
+    UA_Boolean nb = isIntegerKind(kb) || kb == UA_DATATYPEKIND_FLOAT ||
+        kb == UA_DATATYPEKIND_DOUBLE;
+    if(na && nb) {
+        if(isIntegerKind(ka) && isIntegerKind(kb)) {
+            UA_Boolean negA, negB;
+            UA_UInt64 magA, magB;
+            getInteger(a, &negA, &magA);
+            getInteger(b, &negB, &magB);
+            if(negA != negB)
+                return negA ? UA_COMPARE_LESS : UA_COMPARE_MORE;
+            if(magA == magB)
+                return UA_COMPARE_EQ;
+            return ((magA < magB) != negA) ? UA_COMPARE_LESS : UA_COMPARE_MORE;
+        }
+        UA_Double da = getDouble(a);
+        UA_Double db = getDouble(b);
+        if(da != da || db != db) /* NaN */
+            return UA_COMPARE_NONE;
+        if(da < db)
+            return UA_COMPARE_LESS;
+        return (da > db) ? UA_COMPARE_MORE : UA_COMPARE_EQ;
+    }
+
+    if(a->type != b->type)
+        return UA_COMPARE_NONE;
+
+    switch(ka) {
+    case UA_DATATYPEKIND_DATETIME: {
+        UA_DateTime ta = *(const UA_DateTime*)a->data;
+        UA_DateTime tb = *(const UA_DateTime*)b->data;
+        if(ta == tb)
+            return UA_COMPARE_EQ;
+        return (ta < tb) ? UA_COMPARE_LESS : UA_COMPARE_MORE;
+    }
+    case UA_DATATYPEKIND_STRING:
+    case UA_DATATYPEKIND_BYTESTRING:
+    case UA_DATATYPEKIND_XMLELEMENT:
+        return (UA_CompareResult)orderBytes((const UA_String*)a->data,
+                                            (const UA_String*)b->data);
+    case UA_DATATYPEKIND_LOCALIZEDTEXT:
+        return (UA_CompareResult)orderBytes(&((const UA_LocalizedText*)a->data)->text,
+                                            &((const UA_LocalizedText*)b->data)->text);
+    case UA_DATATYPEKIND_NODEID:
+        return (UA_CompareResult)UA_NodeId_order((const UA_NodeId*)a->data,
+                                                 (const UA_NodeId*)b->data);
+    case UA_DATATYPEKIND_EXPANDEDNODEID:
+        return (UA_CompareResult)UA_ExpandedNodeId_order((const UA_ExpandedNodeId*)a->data,
+                                                         (const UA_ExpandedNodeId*)b->data);
+    default:
+        return UA_equal(a->data, b->data, a->type) ? UA_COMPARE_EQ : UA_COMPARE_UNEQUAL;
+    }
+}
+
+/* Part 4: Table 117. The wildcards are % (any string), _ (any character) and
+ * [] (any character of a list or range). [^] excludes the list. \ escapes the
+ * next character. */
+static UA_Boolean
+matchCharacter(const UA_String *pattern, size_t *pos, UA_Byte c) {
+    size_t p = *pos;
+    if(pattern->data[p] == '_') {
+        *pos = p + 1;
+        return true;
+    }
+    if(pattern->data[p] == '\\' && p + 1 < pattern->length) {
+        *pos = p + 2;
+        return pattern->data[p + 1] == c;
+    }
+    if(pattern->data[p] != '[') {
+        *pos = p + 1;
+        return pattern->data[p] == c;
+    }
+
+    /* Character list */
+    p++;
+    UA_Boolean negate = (p < pattern->length && pattern->data[p] == '^');
+    if(negate)
+        p++;
+    UA_Boolean found = false;
+    for(; p < pattern->length && pattern->data[p] != ']'; p++) {
+        UA_Byte lower = pattern->data[p];
+        UA_Byte upper = lower;
+        if(p + 2 < pattern->length && pattern->data[p + 1] == '-' &&
+           pattern->data[p + 2] != ']') {
+            upper = pattern->data[p + 2];
+            p += 2;
+        }
+        if(c >= lower && c <= upper)
+            found = true;
+    }
+    *pos = (p < pattern->length) ? p + 1 : p;
+    return found != negate;
+}
+
+static UA_Boolean
+matchLike(const UA_String *str, const UA_String *pattern) {
+    size_t s = 0, p = 0;
+    UA_Boolean star = false;
+    size_t starP = 0, starS = 0; /* Backtracking position after the last % */
+    while(s < str->length) {
+        if(p < pattern->length && pattern->data[p] == '%') {
+            star = true;
+            starP = ++p;
+            starS = s;
+            continue;
+        }
+        size_t next = p;
+        if(p < pattern->length && matchCharacter(pattern, &next, str->data[s])) {
+            p = next;
+            s++;
             continue;
         }
+        /* Let the last % match one more character */
+        if(!star)
+            return false;
+        p = starP;
+        s = ++starS;
+    }
+    while(p < pattern->length && pattern->data[p] == '%')
+        p++;
+    return p == pattern->length;
+}
+
+static const UA_String *
+getText(const UA_Variant *v) {
+    if(UA_Variant_hasScalarType(v, &UA_TYPES[UA_TYPES_STRING]))
+        return (const UA_String*)v->data;
+    if(UA_Variant_hasScalarType(v, &UA_TYPES[UA_TYPES_LOCALIZEDTEXT]))
+        return &((const UA_LocalizedText*)v->data)->text;
+    return NULL;
+}
 
+/* The result has the type of the larger integer operand */
+static UA_StatusCode
+bitwiseOperation(UA_FilterOperator op, const UA_Variant *a, const UA_Variant *b,
+                 UA_Variant *result) {
+    if(!UA_Variant_isScalar(a) || !UA_Variant_isScalar(b) ||
+       !isIntegerKind(a->type->typeKind) || !isIntegerKind(b->type->typeKind) ||
+       a->type->typeKind == UA_DATATYPEKIND_BOOLEAN ||
+       b->type->typeKind == UA_DATATYPEKIND_BOOLEAN)
+        return UA_STATUSCODE_GOOD; /* NULL */
+    UA_Boolean negA, negB;
+    UA_UInt64 magA, magB;
+    getInteger(a, &negA, &magA);
+    getInteger(b, &negB, &magB);
+    UA_UInt64 bitsA = negA ? (UA_UInt64)0 - magA : magA;
+    UA_UInt64 bitsB = negB ? (UA_UInt64)0 - magB : magB;
+    UA_UInt64 bits = (op == UA_FILTEROPERATOR_BITWISEAND) ? (bitsA & bitsB) : (bitsA | bitsB);
+
+    const UA_DataType *type = (b->type->memSize > a->type->memSize) ? b->type : a->type;
+    void *data = UA_new(type);
+    if(!data)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    switch(type->memSize) {
+    case 1: *(UA_Byte*)data = (UA_Byte)bits; break;
+    case 2: *(UA_UInt16*)data = (UA_UInt16)bits; break;
+    case 4: *(UA_UInt32*)data = (UA_UInt32)bits; break;
+    default: *(UA_UInt64*)data = bits; break;
+    }
+    UA_Variant_setScalar(result, data, type);
+    return UA_STATUSCODE_GOOD;
+}
+
+/* The result may point into the filter or to the result of a later element.
+ * It is cleared in any case. */
+static UA_StatusCode
+evaluateOperand(UA_FilterContext *ctx, const UA_EventOperand *op, UA_Variant *result) {
+    UA_Variant_init(result);
+    switch(op->type) {
+    case UA_EVENTOPERAND_LITERAL:
+        *result = *op->operand.literal;
+        result->storageType = UA_VARIANT_DATA_NODELETE;
+        return UA_STATUSCODE_GOOD;
+    case UA_EVENTOPERAND_ELEMENT:
+        *result = ctx->results[op->operand.element];
+        result->storageType = UA_VARIANT_DATA_NODELETE;
+        return UA_STATUSCODE_GOOD;
+    default: {
+        /* Operands that cannot be resolved are NULL */
+        UA_StatusCode retval =
+            resolveEventField(ctx->server, ctx->session, ctx->source,
+                              &op->operand.attribute, result);
+        if(retval == UA_STATUSCODE_BADOUTOFMEMORY)
+            return retval;
+        if(retval != UA_STATUSCODE_GOOD)
+            UA_Variant_clear(result);
+        return UA_STATUSCODE_GOOD;
+    }
+    }
+}
+
+static UA_StatusCode
+evaluateElement(UA_FilterContext *ctx, size_t index, UA_Variant *result) {
+    const UA_EventFilterElement *elm = &ctx->cf->whereClause[index];
+    UA_Variant_init(result);
+
+    /* OfType checks the type of the event */
+    if(elm->filterOperator == UA_FILTEROPERATOR_OFTYPE) {
+        const UA_NodeId *typeId = (const UA_NodeId*)elm->operands[0].operand.literal->data;
+        const UA_NodeId *eventType = getEventType(ctx->server, ctx->source);
+        if(eventType)
+            setBoolean(result, UA_NodeId_equal(eventType, typeId) ||
+                       isNodeInTree(ctx->server, eventType, typeId, &hasSubtypeId, 1));
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /* Evaluate the first operand */
+    UA_Variant first;
+    UA_StatusCode retval = evaluateOperand(ctx, &elm->operands[0], &first);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+
+    /* Short-circuit the logical operators */
+    int b = getBoolean(&first);
+    if((elm->filterOperator == UA_FILTEROPERATOR_AND && b == 0) ||
+       (elm->filterOperator == UA_FILTEROPERATOR_OR && b == 1)) {
+        setBoolean(result, b == 1);
+        UA_Variant_clear(&first);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    switch(elm->filterOperator) {
+    case UA_FILTEROPERATOR_ISNULL:
+        setBoolean(result, UA_Variant_isEmpty(&first));
+        break;
+    case UA_FILTEROPERATOR_NOT:
+        if(b >= 0)
+            setBoolean(result, b == 0);
+        break;
+    case UA_FILTEROPERATOR_INLIST:
+    case UA_FILTEROPERATOR_BETWEEN: {
+        /* InList matches any of the other operands. Between is inclusive. */
+        UA_Boolean match = (elm->filterOperator == UA_FILTEROPERATOR_BETWEEN);
+        UA_Boolean isNull = false;
+        for(size_t i = 1; i < elm->operandsSize; i++) {
+            UA_Variant other;
+            retval = evaluateOperand(ctx, &elm->operands[i], &other);
+            if(retval != UA_STATUSCODE_GOOD)
+                break;
+            UA_CompareResult cmp = compareValues(&first, &other);
+            UA_Variant_clear(&other);
+            if(elm->filterOperator == UA_FILTEROPERATOR_INLIST) {
+                if(cmp == UA_COMPARE_EQ) {
+                    match = true;
+                    break;
+                }
+                continue;
+            }
+            if(cmp == UA_COMPARE_NONE || cmp == UA_COMPARE_UNEQUAL) {
+                isNull = true;
+                break;
+            }
+            if((i == 1 && cmp == UA_COMPARE_LESS) || (i == 2 && cmp == UA_COMPARE_MORE))
+                match = false;
+        }
+        if(retval == UA_STATUSCODE_GOOD && !isNull)
+            setBoolean(result, match);
+        break;
+    }
+    default: {
+        /* Operators with two operands */
+        UA_Variant second;
+        retval = evaluateOperand(ctx, &elm->operands[1], &second);
+        if(retval != UA_STATUSCODE_GOOD)
+            break;
+        UA_CompareResult cmp = UA_COMPARE_NONE;
+        if(elm->filterOperator <= UA_FILTEROPERATOR_LESSTHANOREQUAL)
+            cmp = compareValues(&first, &second);
+        switch(elm->filterOperator) {
+        case UA_FILTEROPERATOR_EQUALS:
+            if(cmp != UA_COMPARE_NONE)
+                setBoolean(result, cmp == UA_COMPARE_EQ);
+            break;
+        case UA_FILTEROPERATOR_GREATERTHAN:
+        case UA_FILTEROPERATOR_LESSTHAN:
+        case UA_FILTEROPERATOR_GREATERTHANOREQUAL:
+        case UA_FILTEROPERATOR_LESSTHANOREQUAL:
+            if(cmp == UA_COMPARE_NONE || cmp == UA_COMPARE_UNEQUAL)
+                break;
+            if(elm->filterOperator == UA_FILTEROPERATOR_GREATERTHAN)
+                setBoolean(result, cmp == UA_COMPARE_MORE);
+            else if(elm->filterOperator == UA_FILTEROPERATOR_LESSTHAN)
+                setBoolean(result, cmp == UA_COMPARE_LESS);
+            else if(elm->filterOperator == UA_FILTEROPERATOR_GREATERTHANOREQUAL)
+                setBoolean(result, cmp != UA_COMPARE_LESS);
+            else
+                setBoolean(result, cmp != UA_COMPARE_MORE);
+            break;
+        case UA_FILTEROPERATOR_LIKE: {
+            const UA_String *str = getText(&first);
+            const UA_String *pattern = getText(&second);
+            if(str && pattern)
+                setBoolean(result, matchLike(str, pattern));
+            break;
+        }
+        case UA_FILTEROPERATOR_AND:
+        case UA_FILTEROPERATOR_OR: {
+            /* The first operand is true for And and false for Or or NULL */
+            int b2 = getBoolean(&second);
+            if(elm->filterOperator == UA_FILTEROPERATOR_AND && b2 == 0)
+                setBoolean(result, false);
+            else if(elm->filterOperator == UA_FILTEROPERATOR_OR && b2 == 1)
+                setBoolean(result, true);
+            else if(b >= 0 && b2 >= 0)
+                setBoolean(result, b2 == 1);
+            break;
+        }
+        default: /* BitwiseAnd, BitwiseOr */
+            retval = bitwiseOperation(elm->filterOperator, &first, &second, result);
+            break;
+        }
+        UA_Variant_clear(&second);
+        break;
+    }
+    }
+
+    UA_Variant_clear(&first);
+    return retval;
+}
+
+/* Filters the given event with the given filter and writes the results into a
+ * notification. Returns UA_STATUSCODE_BADNOMATCH if the where clause does not
+ * evaluate to true. */
+static UA_StatusCode
+UA_Server_filterEvent(UA_Server *server, UA_Session *session,
+                      UA_EventSource *source, const UA_CompiledEventFilter *cf,
+                      UA_EventNotification *notification) {
+    /* Evaluate the where clause. Element operands only point to later
+     * elements. So every element is evaluated once, from the last to the
+     * first. The result of the first element decides. */
+    if(cf->whereClauseSize > 0) {
+        UA_Variant *results = (UA_Variant*)
+            UA_Array_new(cf->whereClauseSize, &UA_TYPES[UA_TYPES_VARIANT]);
+        if(!results)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        UA_FilterContext ctx = {server, session, source, cf, results};
+        UA_StatusCode retval = UA_STATUSCODE_GOOD;
+        for(size_t i = cf->whereClauseSize; i > 0 && retval == UA_STATUSCODE_GOOD; i--)
+            retval = evaluateElement(&ctx, i - 1, &results[i - 1]);
+        int match = getBoolean(&results[0]);
+        UA_Array_delete(results, cf->whereClauseSize, &UA_TYPES[UA_TYPES_VARIANT]);
+        if(retval != UA_STATUSCODE_GOOD)
+            return retval;
+        if(match != 1)
+            return UA_STATUSCODE_BADNOMATCH;
+    }
+
+    UA_EventFieldList_init(&notification->fields);
+    /* EventFilterResult isn't being used currently
+    UA_EventFilterResult_init(&notification->result); */
+
+    notification->fields.eventFields = (UA_Variant *)
+        UA_Array_new(cf->selectClausesSize, &UA_TYPES[UA_TYPES_VARIANT]);
+    if(!notification->fields.eventFields)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    notification->fields.eventFieldsSize = cf->selectClausesSize;
+
+    /* Fields of events that are not of the TypeDefinition remain empty */
+    for(size_t i = 0; i < cf->selectClausesSize; i++) {
         /* TODO: Put the result into the selectClausResults */
-        resolveSimpleAttributeOperand(server, session, eventNode,
-                                      &filter->selectClauses[i],
-                                      &notification->fields.eventFields[i]);
+        UA_StatusCode retval =
+            resolveEventField(server, session, source, &cf->selectClauses[i],
+                              &notification->fields.eventFields[i]);
+        if(retval == UA_STATUSCODE_BADOUTOFMEMORY) {
+            UA_EventFieldList_clear(&notification->fields);
+            return retval;
+        }
     }
 
     return UA_STATUSCODE_GOOD;
@@ -351,9 +1143,9 @@ eventSetStandardFields(UA_Server *server, const UA_NodeId *event,
 /* Filters an event according to the filter specified by mon and then adds it to
  * mons notification queue */
 static UA_StatusCode
-UA_Event_addEventToMonitoredItem(UA_Server *server, const UA_NodeId *event,
+UA_Event_addEventToMonitoredItem(UA_Server *server, UA_EventSource *source,
                                  UA_MonitoredItem *mon) {
-    UA_Notification *notification = (UA_Notification *) UA_malloc(sizeof(UA_Notification));
+    UA_Notification *notification = UA_Notification_new(server);
     if(!notification)
         return UA_STATUSCODE_BADOUTOFMEMORY;
 
@@ -362,12 +1154,12 @@ UA_Event_addEventToMonitoredItem(UA_Server *server, const UA_NodeId *event,
     UA_Session *session = sub->session;
 
     /* Apply the filter */
-    UA_StatusCode retval = UA_Server_filterEvent(server, session, event,
-                                                 &mon->filter.eventFilter,
+    UA_StatusCode retval = UA_Server_filterEvent(server, session, source,
+                                                 &mon->compiledEventFilter,
                                                  &notification->data.event);
     if(retval != UA_STATUSCODE_GOOD) {
-        UA_free(notification);
-        return retval;
+        UA_SlabPool_free(&server->notificationPool, notification);
+        return (retval == UA_STATUSCODE_BADNOMATCH) ? UA_STATUSCODE_GOOD : retval;
     }
 
     /* Enqueue the notification */
@@ -381,52 +1173,47 @@ static const UA_NodeId parentReferences_events[2] =
     {{0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_ORGANIZES}},
      {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASCOMPONENT}}};
 
-UA_StatusCode
-UA_Server_triggerEvent(UA_Server *server, const UA_NodeId eventNodeId, const UA_NodeId origin,
-                       UA_ByteString *outEventId, const UA_Boolean deleteEventNode) {
-    UA_LOCK(server->serviceMutex);
-    /* Check that the origin node exists */
-    const UA_Node *originNode = UA_Nodestore_getNode(server->nsCtx, &origin);
+/* Check that the origin node exists and is in the ObjectsFolder */
+static UA_StatusCode
+checkEventOrigin(UA_Server *server, const UA_NodeId *origin) {
+    const UA_Node *originNode = UA_Nodestore_getNode(server->nsCtx, origin);
     if(!originNode) {
         UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_USERLAND,
                      "Origin node for event does not exist.");
-        UA_UNLOCK(server->serviceMutex);
         return UA_STATUSCODE_BADNOTFOUND;
     }
     UA_Nodestore_releaseNode(server->nsCtx, originNode);
 
-    /* Make sure the origin is in the ObjectsFolder (TODO: or in the ViewsFolder) */
-    if(!isNodeInTree(server->nsCtx, &origin, &objectsFolderId,
+    /* TODO: or in the ViewsFolder */
+    if(!isNodeInTree(server, origin, &objectsFolderId,
                      parentReferences_events, 2)) {
         UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_USERLAND,
                      "Node for event must be in ObjectsFolder!");
-        UA_UNLOCK(server->serviceMutex);
         return UA_STATUSCODE_BADINVALIDARGUMENT;
     }
+    return UA_STATUSCODE_GOOD;
+}
 
-    UA_StatusCode retval = eventSetStandardFields(server, &eventNodeId, &origin, outEventId);
-    if(retval != UA_STATUSCODE_GOOD) {
-        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
-                       "Events: Could not set the standard event fields with StatusCode %s",
-                       UA_StatusCode_name(retval));
-        UA_UNLOCK(server->serviceMutex);
-        return retval;
-    }
-
+/* Collect the event MonitoredItems of the origin and all its parents */
+static UA_StatusCode
+browseEventListeners(UA_Server *server, const UA_NodeId *origin,
+                     size_t *monsSize, UA_MonitoredItem ***mons) {
     /* Get the parents */
     UA_ExpandedNodeId *parents = NULL;
     size_t parentsSize = 0;
-    retval = browseRecursive(server, 1, &origin, 2, parentReferences_events,
-                             UA_BROWSEDIRECTION_INVERSE, true, &parentsSize, &parents);
+    UA_StatusCode retval =
+        browseRecursive(server, 1, origin, 2, parentReferences_events,
+                        UA_BROWSEDIRECTION_INVERSE, true, &parentsSize, &parents);
     if(retval != UA_STATUSCODE_GOOD) {
         UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
                        "Events: Could not create the list of nodes listening on the "
                        "event with StatusCode %s", UA_StatusCode_name(retval));
-        UA_UNLOCK(server->serviceMutex);
         return retval;
     }
 
-    /* Add the event to each node's monitored items */
+    /* Append the monitored items of each node */
+    size_t size = 0;
+    UA_MonitoredItem **list = NULL;
     for(size_t i = 0; i < parentsSize; i++) {
         const UA_ObjectNode *node = (const UA_ObjectNode*)
             UA_Nodestore_getNode(server->nsCtx, &parents[i].nodeId);
@@ -438,15 +1225,104 @@ UA_Server_triggerEvent(UA_Server *server, const UA_NodeId eventNodeId, const UA_
         }
         UA_MonitoredItem *monIter = node->monitoredItemQueue;
         for(; monIter != NULL; monIter = monIter->next) {
-            retval = UA_Event_addEventToMonitoredItem(server, &eventNodeId, monIter);
-            if(retval != UA_STATUSCODE_GOOD)
-                UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
-                               "Events: Could not add the event to a listening node with StatusCode %s",
-                               UA_StatusCode_name(retval));
+            UA_MonitoredItem **newList = (UA_MonitoredItem**)
+                UA_realloc(list, (size + 1) * sizeof(UA_MonitoredItem*));
+            if(!newList) {
+                retval = UA_STATUSCODE_BADOUTOFMEMORY;
+                break;
+            }
+            list = newList;
+            list[size++] = monIter;
         }
         UA_Nodestore_releaseNode(server->nsCtx, (const UA_Node*)node);
+        if(retval != UA_STATUSCODE_GOOD)
+            break;
+    }
+    UA_Array_delete(parents, parentsSize, &UA_TYPES[UA_TYPES_EXPANDEDNODEID]);
+
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_free(list);
+        return retval;
+    }
+    *monsSize = size;
+    *mons = list;
+    return UA_STATUSCODE_GOOD;
+}
+
+/* Get the MonitoredItems of the origin and all its parents. The check of the
+ * origin and the browsing of the parents are skipped if the origin is in the
+ * EventIndex. The returned array is a copy. User callbacks that run while the
+ * event is added may change the index. */
+static UA_StatusCode
+getEventListeners(UA_Server *server, const UA_NodeId *origin,
+                  size_t *monsSize, UA_MonitoredItem ***mons) {
+    size_t indexedSize = 0;
+    UA_MonitoredItem * const *indexed = NULL;
+    if(server->config.eventIndexSize > 0 &&
+       UA_EventIndex_get(&server->eventIndex, origin,
+                         &indexedSize, &indexed) == UA_STATUSCODE_GOOD) {
+        *monsSize = indexedSize;
+        *mons = NULL;
+        if(indexedSize == 0)
+            return UA_STATUSCODE_GOOD;
+        *mons = (UA_MonitoredItem**)UA_malloc(indexedSize * sizeof(UA_MonitoredItem*));
+        if(!*mons)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        memcpy(*mons, indexed, indexedSize * sizeof(UA_MonitoredItem*));
+        return UA_STATUSCODE_GOOD;
+    }
+
+    UA_StatusCode retval = checkEventOrigin(server, origin);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    retval = browseEventListeners(server, origin, monsSize, mons);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    UA_EventIndex_store(&server->eventIndex, server->config.eventIndexSize,
+                        origin, *monsSize, *mons);
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+addEventToListeners(UA_Server *server, UA_EventSource *source,
+                    size_t monsSize, UA_MonitoredItem **mons) {
+    for(size_t i = 0; i < monsSize; i++) {
+        UA_StatusCode retval = UA_Event_addEventToMonitoredItem(server, source, mons[i]);
+        if(retval != UA_STATUSCODE_GOOD)
+            UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                           "Events: Could not add the event to a listening node with StatusCode %s",
+                           UA_StatusCode_name(retval));
+    }
+}
+
+UA_StatusCode
+UA_Server_triggerEvent(UA_Server *server, const UA_NodeId eventNodeId, const UA_NodeId origin,
+                       UA_ByteString *outEventId, const UA_Boolean deleteEventNode) {
+    UA_LOCK(server->serviceMutex);
+    size_t monsSize = 0;
+    UA_MonitoredItem **mons = NULL;
+    UA_StatusCode retval = getEventListeners(server, &origin, &monsSize, &mons);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_UNLOCK(server->serviceMutex);
+        return retval;
+    }
+
+    retval = eventSetStandardFields(server, &eventNodeId, &origin, outEventId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                       "Events: Could not set the standard event fields with StatusCode %s",
+                       UA_StatusCode_name(retval));
+        UA_free(mons);
+        UA_UNLOCK(server->serviceMutex);
+        return retval;
     }
-    UA_Array_delete(parents, parentsSize, &UA_TYPES[UA_TYPES_NODEID]);
+
+    UA_EventSource source;
+    memset(&source, 0, sizeof(UA_EventSource));
+    source.eventNode = &eventNodeId;
+    addEventToListeners(server, &source, monsSize, mons);
+    UA_EventSource_clear(&source);
+    UA_free(mons);
 
     /* Delete the node representation of the event */
     if(deleteEventNode) {
@@ -463,4 +1339,57 @@ UA_Server_triggerEvent(UA_Server *server, const UA_NodeId eventNodeId, const UA_
     return UA_STATUSCODE_GOOD;
 }
 
+UA_StatusCode
+UA_Server_emitEvent(UA_Server *server, const UA_NodeId eventType, const UA_NodeId originId,
+                    size_t fieldsSize, const UA_EventField *fields,
+                    UA_ByteString *outEventId) {
+    UA_LOCK(server->serviceMutex);
+
+    /* Make sure the eventType is a subtype of BaseEventType */
+    if(!isNodeInTree(server, &eventType, &baseEventTypeId, &hasSubtypeId, 1)) {
+        UA_LOG_ERROR(&server->config.logger, UA_LOGCATEGORY_USERLAND,
+                     "Event type must be a subtype of BaseEventType!");
+        UA_UNLOCK(server->serviceMutex);
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+
+    size_t monsSize = 0;
+    UA_MonitoredItem **mons = NULL;
+    UA_StatusCode retval = getEventListeners(server, &originId, &monsSize, &mons);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_UNLOCK(server->serviceMutex);
+        return retval;
+    }
+
+    /* The event only exists in memory. The select clauses of the
+     * MonitoredItems are resolved against the fields. */
+    UA_ByteString eventId = UA_BYTESTRING_NULL;
+    retval = generateEventId(&eventId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_free(mons);
+        UA_UNLOCK(server->serviceMutex);
+        return retval;
+    }
+
+    UA_EventSource source;
+    memset(&source, 0, sizeof(UA_EventSource));
+    source.eventType = &eventType;
+    source.sourceNode = &originId;
+    source.eventId = &eventId;
+    source.receiveTime = UA_DateTime_now();
+    source.fieldsSize = fieldsSize;
+    source.fields = fields;
+    addEventToListeners(server, &source, monsSize, mons);
+    UA_EventSource_clear(&source);
+    UA_free(mons);
+    UA_UNLOCK(server->serviceMutex);
+
+    /* Return the EventId */
+    if(outEventId)
+        *outEventId = eventId;
+    else
+        UA_ByteString_clear(&eventId);
+    return UA_STATUSCODE_GOOD;
+}
+
 #endif /* UA_ENABLE_SUBSCRIPTIONS_EVENTS */
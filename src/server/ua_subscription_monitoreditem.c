@@ -34,7 +34,7 @@ UA_Notification_isOverflowEvent(UA_Server *server, UA_Notification *n) {
     UA_EventFieldList *efl = &n->data.event.fields;
     if(efl->eventFieldsSize >= 1 &&
        efl->eventFields[0].type == &UA_TYPES[UA_TYPES_NODEID] &&
-       isNodeInTree(server->nsCtx, (const UA_NodeId *)efl->eventFields[0].data,
+       isNodeInTree(server, (const UA_NodeId *)efl->eventFields[0].data,
                     &overflowEventType, &subtypeId, 1)) {
         return true;
     }
@@ -57,8 +57,7 @@ createEventOverflowNotification(UA_Server *server, UA_Subscription *sub,
      * possible overflows. */
 
     /* Allocate the notification */
-    UA_Notification *overflowNotification = (UA_Notification *)
-        UA_malloc(sizeof(UA_Notification));
+    UA_Notification *overflowNotification = UA_Notification_new(server);
     if(!overflowNotification)
         return UA_STATUSCODE_BADOUTOFMEMORY;;
 
@@ -67,7 +66,7 @@ createEventOverflowNotification(UA_Server *server, UA_Subscription *sub,
     UA_EventFieldList_init(&overflowNotification->data.event.fields);
     overflowNotification->data.event.fields.eventFields = UA_Variant_new();
     if(!overflowNotification->data.event.fields.eventFields) {
-        UA_free(overflowNotification);
+        UA_Notification_delete(server, overflowNotification);
         return UA_STATUSCODE_BADOUTOFMEMORY;;
     }
     overflowNotification->data.event.fields.eventFieldsSize = 1;
@@ -75,8 +74,7 @@ createEventOverflowNotification(UA_Server *server, UA_Subscription *sub,
         UA_Variant_setScalarCopy(overflowNotification->data.event.fields.eventFields,
                                  &simpleOverflowEventType, &UA_TYPES[UA_TYPES_NODEID]);
     if(retval != UA_STATUSCODE_GOOD) {
-        UA_EventFieldList_clear(&overflowNotification->data.event.fields);
-        UA_free(overflowNotification);
+        UA_Notification_delete(server, overflowNotification);
         return retval;
     }
 
@@ -163,8 +161,14 @@ UA_Notification_dequeue(UA_Server *server, UA_Notification *n) {
     }
 }
 
+UA_Notification *
+UA_Notification_new(UA_Server *server) {
+    return (UA_Notification*)
+        UA_SlabPool_alloc(&server->notificationPool, server->config.notificationSlabSize);
+}
+
 void
-UA_Notification_delete(UA_Notification *n) {
+UA_Notification_delete(UA_Server *server, UA_Notification *n) {
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
     UA_MonitoredItem *mon = n->mon;
     if(mon->attributeId == UA_ATTRIBUTEID_EVENTNOTIFIER) {
@@ -176,7 +180,7 @@ UA_Notification_delete(UA_Notification *n) {
     {
         UA_DataValue_clear(&n->data.value);
     }
-    UA_free(n);
+    UA_SlabPool_free(&server->notificationPool, n);
 }
 
 /*****************/
@@ -205,7 +209,7 @@ UA_MonitoredItem_delete(UA_Server *server, UA_MonitoredItem *monitoredItem) {
                            listEntry, notification_tmp) {
             /* Remove the item from the queues and free the memory */
             UA_Notification_dequeue(server, notification);
-            UA_Notification_delete(notification);
+            UA_Notification_delete(server, notification);
         }
     }
 
@@ -214,6 +218,8 @@ UA_MonitoredItem_delete(UA_Server *server, UA_MonitoredItem *monitoredItem) {
         /* Remove the monitored item from the node queue */
         UA_Server_editNode(server, NULL, &monitoredItem->monitoredNodeId,
                            UA_MonitoredItem_removeNodeEventCallback, monitoredItem);
+        UA_EventIndex_clear(&server->eventIndex);
+        UA_CompiledEventFilter_clear(&monitoredItem->compiledEventFilter);
         UA_EventFilter_clear(&monitoredItem->filter.eventFilter);
     } else
 #endif
@@ -248,8 +254,7 @@ UA_MonitoredItem_delete(UA_Server *server, UA_MonitoredItem *monitoredItem) {
     if(monitoredItem->listEntry.le_prev != NULL)
         LIST_REMOVE(monitoredItem, listEntry);
     UA_String_clear(&monitoredItem->indexRange);
-    UA_ByteString_clear(&monitoredItem->lastSampledValue);
-    UA_Variant_clear(&monitoredItem->lastValue);
+    UA_DataValue_clear(&monitoredItem->lastSampledValue);
     UA_NodeId_clear(&monitoredItem->monitoredNodeId);
 
     /* No actual callback, just remove the structure */
@@ -316,7 +321,7 @@ UA_MonitoredItem_ensureQueueSpace(UA_Server *server, UA_MonitoredItem *mon) {
 
         /* Delete the notification */
         UA_Notification_dequeue(server, del);
-        UA_Notification_delete(del);
+        UA_Notification_delete(server, del);
     }
 
     /* Get the element where the overflow shall be announced (infobits or
@@ -346,6 +351,351 @@ UA_MonitoredItem_ensureQueueSpace(UA_Server *server, UA_MonitoredItem *mon) {
     return UA_STATUSCODE_GOOD;
 }
 
+/******************/
+/* Sampling Group */
+/******************/
+
+static enum ZIP_CMP
+cmpSamplingInterval(const void *a, const void *b) {
+    const UA_Double *aa = (const UA_Double*)a;
+    const UA_Double *bb = (const UA_Double*)b;
+    if(*aa < *bb)
+        return ZIP_CMP_LESS;
+    if(*aa > *bb)
+        return ZIP_CMP_MORE;
+    return ZIP_CMP_EQ;
+}
+
+ZIP_PROTTYPE(UA_SamplingGroupTree, UA_SamplingGroup, UA_Double)
+ZIP_IMPL(UA_SamplingGroupTree, UA_SamplingGroup, zipfields,
+         UA_Double, samplingInterval, cmpSamplingInterval)
+
+static int
+cmpSamplingGroupMember(const void *a, const void *b) {
+    const UA_SamplingGroupMember *aa = (const UA_SamplingGroupMember*)a;
+    const UA_SamplingGroupMember *bb = (const UA_SamplingGroupMember*)b;
+    return (int)UA_NodeId_order(aa->nodeId, bb->nodeId);
+}
+
+void
+UA_SamplingGroup_sort(UA_SamplingGroup *group) {
+    if(group->sorted)
+        return;
+
+    /* Close the gaps of the removed members */
+    size_t size = 0;
+    for(size_t i = 0; i < group->membersSize; i++) {
+        if(group->members[i].nodeId)
+            group->members[size++] = group->members[i];
+    }
+    group->membersSize = size;
+
+    /* Sort by the NodeId and update the back-references */
+    qsort(group->members, group->membersSize,
+          sizeof(UA_SamplingGroupMember), cmpSamplingGroupMember);
+    for(size_t i = 0; i < group->membersSize; i++) {
+        UA_SamplingGroupMember *member = &group->members[i];
+        if(member->mon)
+            member->mon->samplingGroupIndex = i;
+        else
+            member->sampler->samplingGroupIndex = i;
+    }
+    group->sorted = true;
+}
+
+static void
+freeSamplingGroupMembers(void *application, void *data) {
+    UA_free(data);
+}
+
+static void
+removeSamplingGroup(UA_Server *server, UA_SamplingGroup *group) {
+    removeCallback(server, group->sampleCallbackId);
+    ZIP_REMOVE(UA_SamplingGroupTree, &server->samplingGroups, group);
+
+    /* The sample callback can still be running in a worker thread. A group
+     * without members is skipped there. The members array is freed together
+     * with the group. */
+    group->delayedFreePointers.callback = freeSamplingGroupMembers;
+    group->delayedFreePointers.application = NULL;
+    group->delayedFreePointers.data = group->members;
+    UA_WorkQueue_enqueueDelayed(&server->workQueue, &group->delayedFreePointers);
+}
+
+/* Either the MonitoredItem or the Sampler is added */
+static UA_StatusCode
+addToSamplingGroup(UA_Server *server, UA_Double samplingInterval,
+                   UA_MonitoredItem *mon, UA_Sampler *sampler) {
+    UA_SamplingGroup *group =
+        ZIP_FIND(UA_SamplingGroupTree, &server->samplingGroups, &samplingInterval);
+
+    /* Create a new group */
+    if(!group) {
+        group = (UA_SamplingGroup*)UA_calloc(1, sizeof(UA_SamplingGroup));
+        if(!group)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        group->samplingInterval = samplingInterval;
+        UA_StatusCode retval =
+            addRepeatedCallback(server, (UA_ServerCallback)UA_SamplingGroup_sampleCallback,
+                                group, samplingInterval, &group->sampleCallbackId);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_free(group);
+            return retval;
+        }
+        ZIP_INSERT(UA_SamplingGroupTree, &server->samplingGroups, group,
+                   ZIP_FFS32(UA_UInt32_random()));
+    }
+
+    /* Grow the members array */
+    if(group->membersSize == group->membersCapacity) {
+        size_t capacity = (group->membersCapacity > 0) ? group->membersCapacity * 2 : 8;
+        UA_SamplingGroupMember *members = (UA_SamplingGroupMember*)
+            UA_realloc(group->members, capacity * sizeof(UA_SamplingGroupMember));
+        if(!members) {
+            if(group->liveMembers == 0)
+                removeSamplingGroup(server, group);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        group->members = members;
+        group->membersCapacity = capacity;
+    }
+
+    /* Append the member. The group is sorted before the next sample. */
+    size_t index = group->membersSize++;
+    UA_SamplingGroupMember *member = &group->members[index];
+    member->mon = mon;
+    member->sampler = sampler;
+    if(mon) {
+        member->nodeId = &mon->monitoredNodeId;
+        mon->samplingGroup = group;
+        mon->samplingGroupIndex = index;
+    } else {
+        member->nodeId = &sampler->key.nodeId;
+        sampler->samplingGroup = group;
+        sampler->samplingGroupIndex = index;
+    }
+    group->liveMembers++;
+    group->sorted = false;
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+removeFromSamplingGroup(UA_Server *server, UA_SamplingGroup *group, size_t index) {
+    UA_SamplingGroupMember *member = &group->members[index];
+    member->nodeId = NULL;
+    member->mon = NULL;
+    member->sampler = NULL;
+    group->liveMembers--;
+    group->sorted = false;
+
+    /* Remove the group with the last member */
+    if(group->liveMembers == 0)
+        removeSamplingGroup(server, group);
+}
+
+/***********/
+/* Sampler */
+/***********/
+
+static enum ZIP_CMP
+cmpSamplerKey(const void *a, const void *b) {
+    const UA_SamplerKey *aa = (const UA_SamplerKey*)a;
+    const UA_SamplerKey *bb = (const UA_SamplerKey*)b;
+    if(aa->attributeId != bb->attributeId)
+        return (aa->attributeId < bb->attributeId) ? ZIP_CMP_LESS : ZIP_CMP_MORE;
+    if(aa->samplingInterval < bb->samplingInterval)
+        return ZIP_CMP_LESS;
+    if(aa->samplingInterval > bb->samplingInterval)
+        return ZIP_CMP_MORE;
+    if(aa->timestampsToReturn != bb->timestampsToReturn)
+        return (aa->timestampsToReturn < bb->timestampsToReturn) ?
+            ZIP_CMP_LESS : ZIP_CMP_MORE;
+    if(aa->indexRange.length != bb->indexRange.length)
+        return (aa->indexRange.length < bb->indexRange.length) ?
+            ZIP_CMP_LESS : ZIP_CMP_MORE;
+    if(aa->indexRange.length > 0) {
+        int cmp = memcmp(aa->indexRange.data, bb->indexRange.data,
+                         aa->indexRange.length);
+        if(cmp != 0)
+            return (cmp < 0) ? ZIP_CMP_LESS : ZIP_CMP_MORE;
+    }
+    return (enum ZIP_CMP)UA_NodeId_order(&aa->nodeId, &bb->nodeId);
+}
+
+ZIP_PROTTYPE(UA_SamplerTree, UA_Sampler, UA_SamplerKey)
+ZIP_IMPL(UA_SamplerTree, UA_Sampler, zipfields, UA_SamplerKey, key, cmpSamplerKey)
+
+/* The value of these attributes depends on the session */
+static UA_Boolean
+isUserAttribute(UA_UInt32 attributeId) {
+    return (attributeId == UA_ATTRIBUTEID_USERWRITEMASK ||
+            attributeId == UA_ATTRIBUTEID_USERACCESSLEVEL ||
+            attributeId == UA_ATTRIBUTEID_USEREXECUTABLE);
+}
+
+static UA_StatusCode
+addToSampler(UA_Server *server, UA_MonitoredItem *mon) {
+    /* Find the Sampler with the same settings */
+    UA_SamplerKey key;
+    key.nodeId = mon->monitoredNodeId;
+    key.attributeId = mon->attributeId;
+    key.indexRange = mon->indexRange;
+    key.samplingInterval = mon->samplingInterval;
+    key.timestampsToReturn = mon->timestampsToReturn;
+    UA_Sampler *sampler = ZIP_FIND(UA_SamplerTree, &server->samplers, &key);
+
+    /* Create a new Sampler */
+    if(!sampler) {
+        sampler = (UA_Sampler*)UA_calloc(1, sizeof(UA_Sampler));
+        if(!sampler)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        sampler->key = key;
+        UA_StatusCode retval = UA_NodeId_copy(&key.nodeId, &sampler->key.nodeId);
+        retval |= UA_String_copy(&key.indexRange, &sampler->key.indexRange);
+        if(retval == UA_STATUSCODE_GOOD) {
+            if(server->config.samplingGroups)
+                retval = addToSamplingGroup(server, key.samplingInterval, NULL, sampler);
+            else
+                retval = addRepeatedCallback(server,
+                                             (UA_ServerCallback)UA_Sampler_sampleCallback,
+                                             sampler, key.samplingInterval,
+                                             &sampler->sampleCallbackId);
+        }
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_NodeId_clear(&sampler->key.nodeId);
+            UA_String_clear(&sampler->key.indexRange);
+            UA_free(sampler);
+            return retval;
+        }
+        LIST_INIT(&sampler->monitoredItems);
+        ZIP_INSERT(UA_SamplerTree, &server->samplers, sampler,
+                   ZIP_FFS32(UA_UInt32_random()));
+    }
+
+    LIST_INSERT_HEAD(&sampler->monitoredItems, mon, samplerEntry);
+    mon->sampler = sampler;
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+removeFromSampler(UA_Server *server, UA_MonitoredItem *mon) {
+    UA_Sampler *sampler = mon->sampler;
+    LIST_REMOVE(mon, samplerEntry);
+    mon->sampler = NULL;
+    if(!LIST_EMPTY(&sampler->monitoredItems))
+        return;
+
+    /* Remove the Sampler with the last MonitoredItem */
+    if(sampler->samplingGroup)
+        removeFromSamplingGroup(server, sampler->samplingGroup, sampler->samplingGroupIndex);
+    else
+        removeCallback(server, sampler->sampleCallbackId);
+    ZIP_REMOVE(UA_SamplerTree, &server->samplers, sampler);
+    UA_NodeId_clear(&sampler->key.nodeId);
+    UA_String_clear(&sampler->key.indexRange);
+
+    /* The sample callback can still be running in a worker thread. An empty
+     * Sampler is skipped there. */
+    sampler->delayedFreePointers.callback = NULL;
+    UA_WorkQueue_enqueueDelayed(&server->workQueue, &sampler->delayedFreePointers);
+}
+
+/*******************/
+/* Sample on Write */
+/*******************/
+
+static enum ZIP_CMP
+cmpNodeMonitors(const void *a, const void *b) {
+    return (enum ZIP_CMP)UA_NodeId_order((const UA_NodeId*)a, (const UA_NodeId*)b);
+}
+
+ZIP_IMPL(UA_NodeMonitorsTree, UA_NodeMonitors, zipfields,
+         UA_NodeId, nodeId, cmpNodeMonitors)
+
+static UA_Boolean
+isSampledOnWrite(UA_Server *server, const UA_MonitoredItem *mon) {
+    if(mon->attributeId != UA_ATTRIBUTEID_VALUE)
+        return false;
+    const UA_Node *node = getNodeOrVirtual(server, &mon->monitoredNodeId);
+    if(!node)
+        return false;
+    UA_Boolean sampleOnWrite = false;
+    if(node->nodeClass == UA_NODECLASS_VARIABLE) {
+        const UA_VariableNode *vn = (const UA_VariableNode*)node;
+        /* The server-wide setting only applies to values that cannot change
+         * without a write */
+        sampleOnWrite = vn->sampleOnWrite ||
+            (server->config.sampleOnWrite &&
+             vn->valueSource == UA_VALUESOURCE_DATA &&
+             !vn->value.data.callback.onRead);
+    }
+    releaseNodeOrVirtual(server, node);
+    return sampleOnWrite;
+}
+
+static UA_StatusCode
+addToNodeMonitors(UA_Server *server, UA_MonitoredItem *mon) {
+    UA_NodeMonitors *nm =
+        ZIP_FIND(UA_NodeMonitorsTree, &server->nodeMonitors, &mon->monitoredNodeId);
+    if(!nm) {
+        nm = (UA_NodeMonitors*)UA_calloc(1, sizeof(UA_NodeMonitors));
+        if(!nm)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        UA_StatusCode retval = UA_NodeId_copy(&mon->monitoredNodeId, &nm->nodeId);
+        if(retval != UA_STATUSCODE_GOOD) {
+            UA_free(nm);
+            return retval;
+        }
+        LIST_INIT(&nm->monitoredItems);
+        ZIP_INSERT(UA_NodeMonitorsTree, &server->nodeMonitors, nm,
+                   ZIP_FFS32(UA_UInt32_random()));
+    }
+    LIST_INSERT_HEAD(&nm->monitoredItems, mon, nodeEntry);
+    mon->sampleOnWrite = true;
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+removeFromNodeMonitors(UA_Server *server, UA_MonitoredItem *mon) {
+    if(mon->delayedSampleIsRegistered) {
+        removeCallback(server, mon->delayedSampleCallbackId);
+        mon->delayedSampleIsRegistered = false;
+    }
+    LIST_REMOVE(mon, nodeEntry);
+    mon->sampleOnWrite = false;
+
+    /* Remove the entry with the last MonitoredItem */
+    UA_NodeMonitors *nm =
+        ZIP_FIND(UA_NodeMonitorsTree, &server->nodeMonitors, &mon->monitoredNodeId);
+    if(!nm || !LIST_EMPTY(&nm->monitoredItems))
+        return;
+    ZIP_REMOVE(UA_NodeMonitorsTree, &server->nodeMonitors, nm);
+    UA_NodeId_clear(&nm->nodeId);
+    UA_free(nm);
+}
+
+void
+reviewSampleOnWrite(UA_Server *server, const UA_NodeId *nodeId) {
+    UA_LOCK_ASSERT(server->serviceMutex, 1);
+    UA_NodeMonitors *nm = ZIP_FIND(UA_NodeMonitorsTree, &server->nodeMonitors, nodeId);
+    if(!nm)
+        return;
+
+    /* The entry is freed with the last MonitoredItem */
+    UA_MonitoredItem *mon, *mon_tmp;
+    LIST_FOREACH_SAFE(mon, &nm->monitoredItems, nodeEntry, mon_tmp) {
+        if(isSampledOnWrite(server, mon))
+            continue;
+        UA_MonitoredItem_unregisterSampleCallback(server, mon);
+        UA_StatusCode retval = UA_MonitoredItem_registerSampleCallback(server, mon);
+        if(retval != UA_STATUSCODE_GOOD)
+            UA_LOG_WARNING(&server->config.logger, UA_LOGCATEGORY_SERVER,
+                           "MonitoredItem %i | Could not register the sampling "
+                           "with StatusCode %s", mon->monitoredItemId,
+                           UA_StatusCode_name(retval));
+    }
+}
+
 UA_StatusCode
 UA_MonitoredItem_registerSampleCallback(UA_Server *server, UA_MonitoredItem *mon) {
     UA_LOCK_ASSERT(server->serviceMutex, 1);
@@ -356,7 +706,29 @@ UA_MonitoredItem_registerSampleCallback(UA_Server *server, UA_MonitoredItem *mon
     if(mon->attributeId == UA_ATTRIBUTEID_EVENTNOTIFIER)
         return UA_STATUSCODE_GOOD;
 
-    UA_StatusCode retval =
+    UA_StatusCode retval;
+    if(isSampledOnWrite(server, mon)) {
+        retval = addToNodeMonitors(server, mon);
+        if(retval == UA_STATUSCODE_GOOD)
+            mon->sampleCallbackIsRegistered = true;
+        return retval;
+    }
+
+    if(server->config.sharedSampling && !isUserAttribute(mon->attributeId)) {
+        retval = addToSampler(server, mon);
+        if(retval == UA_STATUSCODE_GOOD)
+            mon->sampleCallbackIsRegistered = true;
+        return retval;
+    }
+
+    if(server->config.samplingGroups) {
+        retval = addToSamplingGroup(server, mon->samplingInterval, mon, NULL);
+        if(retval == UA_STATUSCODE_GOOD)
+            mon->sampleCallbackIsRegistered = true;
+        return retval;
+    }
+
+    retval =
         addRepeatedCallback(server, (UA_ServerCallback)UA_MonitoredItem_sampleCallback,
                             mon, mon->samplingInterval, &mon->sampleCallbackId);
     if(retval == UA_STATUSCODE_GOOD)
@@ -369,7 +741,15 @@ UA_MonitoredItem_unregisterSampleCallback(UA_Server *server, UA_MonitoredItem *m
     UA_LOCK_ASSERT(server->serviceMutex, 1);
     if(!mon->sampleCallbackIsRegistered)
         return;
-    removeCallback(server, mon->sampleCallbackId);
+    if(mon->sampleOnWrite)
+        removeFromNodeMonitors(server, mon);
+    else if(mon->sampler)
+        removeFromSampler(server, mon);
+    else if(mon->samplingGroup) {
+        removeFromSamplingGroup(server, mon->samplingGroup, mon->samplingGroupIndex);
+        mon->samplingGroup = NULL;
+    } else
+        removeCallback(server, mon->sampleCallbackId);
     mon->sampleCallbackIsRegistered = false;
 }
 
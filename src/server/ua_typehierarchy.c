@@ -0,0 +1,486 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_typehierarchy.h"
+
+typedef struct {
+    UA_UInt32 hash;
+    UA_NodeId nodeId;
+} UA_TypeHierarchyKey;
+
+typedef struct {
+    size_t size;
+    size_t capacity;
+    UA_TypeHierarchyEntry **entries;
+} UA_TypeList;
+
+struct UA_TypeHierarchyEntry {
+    ZIP_ENTRY(UA_TypeHierarchyEntry) zipfields;
+    LIST_ENTRY(UA_TypeHierarchyEntry) listEntry;
+    UA_TypeHierarchyKey key;
+    UA_TypeList supertypes; /* Direct supertypes */
+    UA_TypeList subtypes;   /* Direct subtypes */
+    UA_TypeList ancestors;  /* All supertypes without the type itself */
+    UA_Boolean visited;     /* Marker while the subtree is collected */
+    UA_Boolean dirty;       /* The ancestors are recomputed */
+    size_t pending;         /* Dirty supertypes that are not yet recomputed */
+};
+
+static enum ZIP_CMP
+cmpTypeHierarchyKey(const void *a, const void *b) {
+    const UA_TypeHierarchyKey *aa = (const UA_TypeHierarchyKey*)a;
+    const UA_TypeHierarchyKey *bb = (const UA_TypeHierarchyKey*)b;
+    if(aa->hash < bb->hash)
+        return ZIP_CMP_LESS;
+    if(aa->hash > bb->hash)
+        return ZIP_CMP_MORE;
+    return (enum ZIP_CMP)UA_NodeId_order(&aa->nodeId, &bb->nodeId);
+}
+
+ZIP_PROTTYPE(UA_TypeHierarchyTree, UA_TypeHierarchyEntry, UA_TypeHierarchyKey)
+ZIP_IMPL(UA_TypeHierarchyTree, UA_TypeHierarchyEntry, zipfields,
+         UA_TypeHierarchyKey, key, cmpTypeHierarchyKey)
+
+/*************/
+/* Type List */
+/*************/
+
+static UA_Boolean
+typeList_contains(const UA_TypeList *list, const UA_TypeHierarchyEntry *entry) {
+    for(size_t i = 0; i < list->size; i++) {
+        if(list->entries[i] == entry)
+            return true;
+    }
+    return false;
+}
+
+static UA_StatusCode
+typeList_append(UA_TypeList *list, UA_TypeHierarchyEntry *entry) {
+    if(list->size == list->capacity) {
+        size_t newCapacity = (list->capacity > 0) ? list->capacity * 2 : 4;
+        UA_TypeHierarchyEntry **entries = (UA_TypeHierarchyEntry**)
+            UA_realloc(list->entries, newCapacity * sizeof(UA_TypeHierarchyEntry*));
+        if(!entries)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        list->entries = entries;
+        list->capacity = newCapacity;
+    }
+    list->entries[list->size] = entry;
+    list->size++;
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+typeList_remove(UA_TypeList *list, const UA_TypeHierarchyEntry *entry) {
+    for(size_t i = 0; i < list->size; i++) {
+        if(list->entries[i] != entry)
+            continue;
+        list->size--;
+        list->entries[i] = list->entries[list->size];
+        return;
+    }
+}
+
+static void
+typeList_clear(UA_TypeList *list) {
+    UA_free(list->entries);
+    memset(list, 0, sizeof(UA_TypeList));
+}
+
+/***********/
+/* Entries */
+/***********/
+
+static UA_TypeHierarchyEntry *
+findEntry(const UA_TypeHierarchy *th, const UA_NodeId *nodeId) {
+    UA_TypeHierarchyKey key;
+    key.hash = UA_NodeId_hash(nodeId);
+    key.nodeId = *nodeId;
+    return ZIP_FIND(UA_TypeHierarchyTree,
+                    (UA_TypeHierarchyTree*)(uintptr_t)&th->root, &key);
+}
+
+static UA_TypeHierarchyEntry *
+getOrAddEntry(UA_TypeHierarchy *th, const UA_NodeId *nodeId) {
+    UA_TypeHierarchyEntry *entry = findEntry(th, nodeId);
+    if(entry)
+        return entry;
+    entry = (UA_TypeHierarchyEntry*)UA_calloc(1, sizeof(UA_TypeHierarchyEntry));
+    if(!entry)
+        return NULL;
+    if(UA_NodeId_copy(nodeId, &entry->key.nodeId) != UA_STATUSCODE_GOOD) {
+        UA_free(entry);
+        return NULL;
+    }
+    entry->key.hash = UA_NodeId_hash(nodeId);
+    ZIP_INSERT(UA_TypeHierarchyTree, &th->root, entry, ZIP_FFS32(UA_UInt32_random()));
+    LIST_INSERT_HEAD(&th->entries, entry, listEntry);
+    th->entriesSize++;
+    return entry;
+}
+
+static void
+removeEntry(UA_TypeHierarchy *th, UA_TypeHierarchyEntry *entry) {
+    ZIP_REMOVE(UA_TypeHierarchyTree, &th->root, entry);
+    LIST_REMOVE(entry, listEntry);
+    th->entriesSize--;
+    UA_NodeId_clear(&entry->key.nodeId);
+    typeList_clear(&entry->supertypes);
+    typeList_clear(&entry->subtypes);
+    typeList_clear(&entry->ancestors);
+    UA_free(entry);
+}
+
+/* Collect the entry and its (recursive) subtypes. The list doubles as the
+ * worklist of the breadth-first traversal. */
+static UA_StatusCode
+collectSubtree(UA_TypeHierarchyEntry *entry, UA_TypeList *subtree) {
+    UA_StatusCode retval = typeList_append(subtree, entry);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    entry->visited = true;
+    for(size_t i = 0; i < subtree->size && retval == UA_STATUSCODE_GOOD; i++) {
+        UA_TypeList *subtypes = &subtree->entries[i]->subtypes;
+        for(size_t j = 0; j < subtypes->size; j++) {
+            UA_TypeHierarchyEntry *sub = subtypes->entries[j];
+            if(sub->visited)
+                continue;
+            retval = typeList_append(subtree, sub);
+            if(retval != UA_STATUSCODE_GOOD)
+                break;
+            sub->visited = true;
+        }
+    }
+    for(size_t i = 0; i < subtree->size; i++)
+        subtree->entries[i]->visited = false;
+    return retval;
+}
+
+static int
+cmpEntryAddress(const void *a, const void *b) {
+    uintptr_t aa = (uintptr_t)*(UA_TypeHierarchyEntry* const*)a;
+    uintptr_t bb = (uintptr_t)*(UA_TypeHierarchyEntry* const*)b;
+    if(aa < bb)
+        return -1;
+    return (aa > bb) ? 1 : 0;
+}
+
+/* The ancestors are sorted by the address of the entries for a binary search */
+static UA_Boolean
+ancestorsContain(const UA_TypeList *ancestors, const UA_TypeHierarchyEntry *entry) {
+    size_t lo = 0;
+    size_t hi = ancestors->size;
+    while(lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+        if(ancestors->entries[mid] == entry)
+            return true;
+        if((uintptr_t)ancestors->entries[mid] < (uintptr_t)entry)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return false;
+}
+
+static UA_StatusCode
+computeAncestors(UA_TypeHierarchyEntry *entry) {
+    /* Collect the supertypes and their ancestors */
+    UA_TypeList *ancestors = &entry->ancestors;
+    ancestors->size = 0;
+    for(size_t i = 0; i < entry->supertypes.size; i++) {
+        UA_TypeHierarchyEntry *super = entry->supertypes.entries[i];
+        UA_StatusCode retval = typeList_append(ancestors, super);
+        for(size_t j = 0; j < super->ancestors.size &&
+                retval == UA_STATUSCODE_GOOD; j++)
+            retval = typeList_append(ancestors, super->ancestors.entries[j]);
+        if(retval != UA_STATUSCODE_GOOD)
+            return retval;
+    }
+
+    /* Sort and remove duplicates and the entry itself (from cycles) */
+    qsort(ancestors->entries, ancestors->size,
+          sizeof(UA_TypeHierarchyEntry*), cmpEntryAddress);
+    size_t unique = 0;
+    for(size_t i = 0; i < ancestors->size; i++) {
+        UA_TypeHierarchyEntry *a = ancestors->entries[i];
+        if(a == entry || (unique > 0 && ancestors->entries[unique - 1] == a))
+            continue;
+        ancestors->entries[unique++] = a;
+    }
+    ancestors->size = unique;
+    return UA_STATUSCODE_GOOD;
+}
+
+/* Recompute the ancestors of the dirty entries. The ancestors of all other
+ * entries must be up to date. The dirty entries are processed in topological
+ * order, so that the supertypes are always done first. Cycles in the (invalid)
+ * hierarchy are broken up at an arbitrary entry. */
+static UA_StatusCode
+updateAncestors(UA_TypeHierarchyEntry **dirty, size_t dirtySize) {
+    if(dirtySize == 0)
+        return UA_STATUSCODE_GOOD;
+    UA_TypeHierarchyEntry **queue = (UA_TypeHierarchyEntry**)
+        UA_malloc(dirtySize * sizeof(UA_TypeHierarchyEntry*));
+    if(!queue)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+
+    for(size_t i = 0; i < dirtySize; i++)
+        dirty[i]->dirty = true;
+
+    /* Start with the entries without dirty supertypes */
+    size_t queueSize = 0;
+    for(size_t i = 0; i < dirtySize; i++) {
+        UA_TypeHierarchyEntry *entry = dirty[i];
+        entry->pending = 0;
+        for(size_t j = 0; j < entry->supertypes.size; j++) {
+            if(entry->supertypes.entries[j]->dirty)
+                entry->pending++;
+        }
+        if(entry->pending == 0)
+            queue[queueSize++] = entry;
+    }
+
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    size_t next = 0;
+    size_t scan = 0;
+    while(retval == UA_STATUSCODE_GOOD) {
+        UA_TypeHierarchyEntry *entry = NULL;
+        if(next < queueSize) {
+            entry = queue[next++];
+        } else {
+            /* Only cycles remain */
+            while(scan < dirtySize && !dirty[scan]->dirty)
+                scan++;
+            if(scan == dirtySize)
+                break;
+            entry = dirty[scan];
+        }
+        if(!entry->dirty)
+            continue;
+
+        retval = computeAncestors(entry);
+        entry->dirty = false;
+
+        /* Release the subtypes whose supertypes are done */
+        for(size_t i = 0; i < entry->subtypes.size; i++) {
+            UA_TypeHierarchyEntry *sub = entry->subtypes.entries[i];
+            if(!sub->dirty || sub->pending == 0)
+                continue;
+            sub->pending--;
+            if(sub->pending == 0)
+                queue[queueSize++] = sub;
+        }
+    }
+
+    for(size_t i = 0; i < dirtySize; i++)
+        dirty[i]->dirty = false;
+    UA_free(queue);
+    return retval;
+}
+
+/* Recompute the ancestors of the entry and its subtypes */
+static UA_StatusCode
+updateSubtree(UA_TypeHierarchyEntry *entry) {
+    UA_TypeList subtree;
+    memset(&subtree, 0, sizeof(UA_TypeList));
+    UA_StatusCode retval = collectSubtree(entry, &subtree);
+    if(retval == UA_STATUSCODE_GOOD)
+        retval = updateAncestors(subtree.entries, subtree.size);
+    typeList_clear(&subtree);
+    return retval;
+}
+
+/******************/
+/* Type Hierarchy */
+/******************/
+
+void
+UA_TypeHierarchy_init(UA_TypeHierarchy *th) {
+    memset(th, 0, sizeof(UA_TypeHierarchy));
+    ZIP_INIT(&th->root);
+    LIST_INIT(&th->entries);
+}
+
+void
+UA_TypeHierarchy_clear(UA_TypeHierarchy *th) {
+    UA_TypeHierarchyEntry *entry, *entry_tmp;
+    LIST_FOREACH_SAFE(entry, &th->entries, listEntry, entry_tmp)
+        removeEntry(th, entry);
+    UA_TypeHierarchy_init(th);
+}
+
+void
+UA_TypeHierarchy_invalidate(UA_TypeHierarchy *th) {
+    UA_TypeHierarchy_clear(th);
+}
+
+UA_StatusCode
+UA_TypeHierarchy_addSubtype(UA_TypeHierarchy *th, const UA_NodeId *supertype,
+                            const UA_NodeId *subtype) {
+    if(UA_NodeId_equal(supertype, subtype))
+        return UA_STATUSCODE_GOOD;
+
+    UA_StatusCode retval = UA_STATUSCODE_BADOUTOFMEMORY;
+    UA_TypeHierarchyEntry *super = getOrAddEntry(th, supertype);
+    UA_TypeHierarchyEntry *sub = getOrAddEntry(th, subtype);
+    if(!super || !sub)
+        goto error;
+
+    /* Already known */
+    if(typeList_contains(&sub->supertypes, super))
+        return UA_STATUSCODE_GOOD;
+
+    retval = typeList_append(&sub->supertypes, super);
+    if(retval != UA_STATUSCODE_GOOD)
+        goto error;
+    retval = typeList_append(&super->subtypes, sub);
+    if(retval != UA_STATUSCODE_GOOD) {
+        typeList_remove(&sub->supertypes, super);
+        goto error;
+    }
+
+    /* The ancestors are computed at once in _validate */
+    if(!th->valid)
+        return UA_STATUSCODE_GOOD;
+
+    /* The subtype and its subtypes inherit the supertypes of the new parent */
+    retval = updateSubtree(sub);
+    if(retval != UA_STATUSCODE_GOOD)
+        goto error;
+    return UA_STATUSCODE_GOOD;
+
+ error:
+    if(th->valid)
+        UA_TypeHierarchy_invalidate(th);
+    return retval;
+}
+
+UA_StatusCode
+UA_TypeHierarchy_validate(UA_TypeHierarchy *th) {
+    UA_TypeHierarchyEntry **entries = (UA_TypeHierarchyEntry**)
+        UA_malloc((th->entriesSize + 1) * sizeof(UA_TypeHierarchyEntry*));
+    if(!entries) {
+        UA_TypeHierarchy_invalidate(th);
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    size_t i = 0;
+    UA_TypeHierarchyEntry *entry;
+    LIST_FOREACH(entry, &th->entries, listEntry)
+        entries[i++] = entry;
+    UA_StatusCode retval = updateAncestors(entries, i);
+    UA_free(entries);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_TypeHierarchy_invalidate(th);
+        return retval;
+    }
+    th->valid = true;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_TypeHierarchy_removeSubtype(UA_TypeHierarchy *th, const UA_NodeId *supertype,
+                               const UA_NodeId *subtype) {
+    if(!th->valid)
+        return;
+    UA_TypeHierarchyEntry *super = findEntry(th, supertype);
+    UA_TypeHierarchyEntry *sub = findEntry(th, subtype);
+    if(!super || !sub || !typeList_contains(&sub->supertypes, super))
+        return;
+
+    typeList_remove(&sub->supertypes, super);
+    typeList_remove(&super->subtypes, sub);
+    if(updateSubtree(sub) != UA_STATUSCODE_GOOD)
+        UA_TypeHierarchy_invalidate(th);
+}
+
+void
+UA_TypeHierarchy_removeType(UA_TypeHierarchy *th, const UA_NodeId *type) {
+    if(!th->valid)
+        return;
+    UA_TypeHierarchyEntry *entry = findEntry(th, type);
+    if(!entry)
+        return;
+
+    /* The subtree starts with the entry itself */
+    UA_TypeList subtree;
+    memset(&subtree, 0, sizeof(UA_TypeList));
+    UA_StatusCode retval = collectSubtree(entry, &subtree);
+
+    /* Unlink from the supertypes and subtypes */
+    for(size_t i = 0; i < entry->supertypes.size; i++)
+        typeList_remove(&entry->supertypes.entries[i]->subtypes, entry);
+    for(size_t i = 0; i < entry->subtypes.size; i++)
+        typeList_remove(&entry->subtypes.entries[i]->supertypes, entry);
+    removeEntry(th, entry);
+
+    if(retval == UA_STATUSCODE_GOOD)
+        retval = updateAncestors(&subtree.entries[1], subtree.size - 1);
+    typeList_clear(&subtree);
+    if(retval != UA_STATUSCODE_GOOD)
+        UA_TypeHierarchy_invalidate(th);
+}
+
+UA_Boolean
+UA_TypeHierarchy_isSubtype(const UA_TypeHierarchy *th, const UA_NodeId *type,
+                           const UA_NodeId *supertype) {
+    if(UA_NodeId_equal(type, supertype))
+        return true;
+    const UA_TypeHierarchyEntry *t = findEntry(th, type);
+    if(!t)
+        return false;
+    const UA_TypeHierarchyEntry *s = findEntry(th, supertype);
+    if(!s)
+        return false;
+    return ancestorsContain(&t->ancestors, s);
+}
+
+UA_StatusCode
+UA_TypeHierarchy_getSubtypes(const UA_TypeHierarchy *th, const UA_NodeId *type,
+                             size_t *typesSize, UA_NodeId **types) {
+    /* Collect the subtypes */
+    UA_TypeList subtree;
+    memset(&subtree, 0, sizeof(UA_TypeList));
+    UA_TypeHierarchyEntry *entry = findEntry(th, type);
+    if(entry) {
+        UA_StatusCode retval = collectSubtree(entry, &subtree);
+        if(retval != UA_STATUSCODE_GOOD) {
+            typeList_clear(&subtree);
+            return retval;
+        }
+    }
+    size_t count = (entry) ? subtree.size : 1;
+
+    /* Allocate space (realloc if non-NULL) */
+    UA_NodeId *newTypes = (UA_NodeId*)
+        UA_realloc(*types, (*typesSize + count) * sizeof(UA_NodeId));
+    if(!newTypes) {
+        typeList_clear(&subtree);
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    *types = newTypes;
+
+    /* Copy the NodeIds */
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    UA_NodeId *pos = &newTypes[*typesSize];
+    if(!entry) {
+        retval = UA_NodeId_copy(type, pos);
+        pos++;
+    } else {
+        for(size_t i = 0; i < subtree.size && retval == UA_STATUSCODE_GOOD; i++) {
+            retval = UA_NodeId_copy(&subtree.entries[i]->key.nodeId, pos);
+            pos++;
+        }
+    }
+    typeList_clear(&subtree);
+    if(retval != UA_STATUSCODE_GOOD) {
+        for(UA_NodeId *p = &newTypes[*typesSize]; p < pos; p++)
+            UA_NodeId_clear(p);
+        return retval;
+    }
+    *typesSize += count;
+    return UA_STATUSCODE_GOOD;
+}
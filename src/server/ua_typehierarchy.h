@@ -0,0 +1,88 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#ifndef UA_TYPEHIERARCHY_H_
+#define UA_TYPEHIERARCHY_H_
+
+#include <open62541/types.h>
+#include <open62541/types_generated_handling.h>
+#include "open62541_queue.h"
+#include "ziptree.h"
+
+_UA_BEGIN_DECLS
+
+/* Cache for the transitive closure of the HasSubtype hierarchy. Every node that
+ * takes part in a HasSubtype reference (ReferenceTypes, DataTypes, ObjectTypes
+ * and VariableTypes) gets an entry with its direct supertypes and subtypes and
+ * the list of all its (recursive) supertypes. The hierarchy is mostly single
+ * inheritance. So the lists are short and the memory grows with the number of
+ * types times the depth of the hierarchy. The list of all supertypes is sorted.
+ * A subtype check is a lookup of both types in the tree and a binary search in
+ * the supertypes, O(log n + log depth).
+ *
+ * Added and removed HasSubtype references and removed types update the
+ * supertypes of the subtree below. The cache is rebuilt from the nodestore
+ * only after it was invalidated. The cache is not thread-safe. In the server,
+ * it is protected by the service mutex. */
+
+struct UA_TypeHierarchyEntry;
+typedef struct UA_TypeHierarchyEntry UA_TypeHierarchyEntry;
+
+ZIP_HEAD(UA_TypeHierarchyTree, UA_TypeHierarchyEntry);
+typedef struct UA_TypeHierarchyTree UA_TypeHierarchyTree;
+
+typedef struct {
+    UA_Boolean valid;
+    UA_TypeHierarchyTree root;
+    LIST_HEAD(, UA_TypeHierarchyEntry) entries;
+    size_t entriesSize;
+} UA_TypeHierarchy;
+
+void
+UA_TypeHierarchy_init(UA_TypeHierarchy *th);
+
+void
+UA_TypeHierarchy_clear(UA_TypeHierarchy *th);
+
+/* Drop the content. The cache needs to be rebuilt before it is used again. */
+void
+UA_TypeHierarchy_invalidate(UA_TypeHierarchy *th);
+
+/* Add a HasSubtype relation. During the rebuild of an invalid cache, only the
+ * relation is stored. The supertypes are computed in UA_TypeHierarchy_validate.
+ * A valid cache is invalidated if memory runs out. */
+UA_StatusCode
+UA_TypeHierarchy_addSubtype(UA_TypeHierarchy *th, const UA_NodeId *supertype,
+                            const UA_NodeId *subtype);
+
+/* Compute the supertypes after the rebuild and mark the cache as valid */
+UA_StatusCode
+UA_TypeHierarchy_validate(UA_TypeHierarchy *th);
+
+/* Remove a HasSubtype relation from a valid cache */
+void
+UA_TypeHierarchy_removeSubtype(UA_TypeHierarchy *th, const UA_NodeId *supertype,
+                               const UA_NodeId *subtype);
+
+/* Remove a type and its relations from a valid cache */
+void
+UA_TypeHierarchy_removeType(UA_TypeHierarchy *th, const UA_NodeId *type);
+
+/* Is the type a subtype of the supertype (or the same node)? */
+UA_Boolean
+UA_TypeHierarchy_isSubtype(const UA_TypeHierarchy *th, const UA_NodeId *type,
+                           const UA_NodeId *supertype);
+
+/* Returns the type and all its (recursive) subtypes. The array is appended to
+ * the (possibly non-empty) input array. */
+UA_StatusCode
+UA_TypeHierarchy_getSubtypes(const UA_TypeHierarchy *th, const UA_NodeId *type,
+                             size_t *typesSize, UA_NodeId **types);
+
+_UA_END_DECLS
+
+#endif /* UA_TYPEHIERARCHY_H_ */
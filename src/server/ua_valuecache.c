@@ -0,0 +1,143 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_valuecache.h"
+
+typedef struct {
+    UA_UInt32 hash;
+    UA_NodeId nodeId;
+} UA_ValueCacheKey;
+
+struct UA_ValueCacheEntry {
+    ZIP_ENTRY(UA_ValueCacheEntry) zipfields;
+    TAILQ_ENTRY(UA_ValueCacheEntry) listEntry;
+    UA_ValueCacheKey key;
+    UA_DateTime readTime; /* Monotonic */
+    UA_DataValue value;
+};
+
+static enum ZIP_CMP
+cmpValueCacheKey(const void *a, const void *b) {
+    const UA_ValueCacheKey *aa = (const UA_ValueCacheKey*)a;
+    const UA_ValueCacheKey *bb = (const UA_ValueCacheKey*)b;
+    if(aa->hash < bb->hash)
+        return ZIP_CMP_LESS;
+    if(aa->hash > bb->hash)
+        return ZIP_CMP_MORE;
+    return (enum ZIP_CMP)UA_NodeId_order(&aa->nodeId, &bb->nodeId);
+}
+
+ZIP_PROTTYPE(UA_ValueCacheTree, UA_ValueCacheEntry, UA_ValueCacheKey)
+ZIP_IMPL(UA_ValueCacheTree, UA_ValueCacheEntry, zipfields,
+         UA_ValueCacheKey, key, cmpValueCacheKey)
+
+static UA_ValueCacheEntry *
+findEntry(const UA_ValueCache *cache, const UA_NodeId *nodeId) {
+    UA_ValueCacheKey key;
+    key.hash = UA_NodeId_hash(nodeId);
+    key.nodeId = *nodeId;
+    return ZIP_FIND(UA_ValueCacheTree, (UA_ValueCacheTree*)(uintptr_t)&cache->root, &key);
+}
+
+static void
+removeEntry(UA_ValueCache *cache, UA_ValueCacheEntry *entry) {
+    ZIP_REMOVE(UA_ValueCacheTree, &cache->root, entry);
+    TAILQ_REMOVE(&cache->entries, entry, listEntry);
+    cache->entriesSize--;
+    UA_NodeId_clear(&entry->key.nodeId);
+    UA_DataValue_clear(&entry->value);
+    UA_free(entry);
+}
+
+void
+UA_ValueCache_init(UA_ValueCache *cache) {
+    memset(cache, 0, sizeof(UA_ValueCache));
+    ZIP_INIT(&cache->root);
+    TAILQ_INIT(&cache->entries);
+}
+
+void
+UA_ValueCache_clear(UA_ValueCache *cache) {
+    UA_ValueCacheEntry *entry, *entry_tmp;
+    TAILQ_FOREACH_SAFE(entry, &cache->entries, listEntry, entry_tmp)
+        removeEntry(cache, entry);
+    UA_ValueCache_init(cache);
+}
+
+UA_Boolean
+UA_ValueCache_isFresh(const UA_ValueCache *cache, const UA_NodeId *nodeId,
+                      UA_DateTime maxAge, UA_DateTime now) {
+    const UA_ValueCacheEntry *entry = findEntry(cache, nodeId);
+    return (entry && now - entry->readTime <= maxAge);
+}
+
+UA_StatusCode
+UA_ValueCache_get(UA_ValueCache *cache, const UA_NodeId *nodeId,
+                  UA_DateTime maxAge, UA_DateTime now, UA_DataValue *value) {
+    UA_ValueCacheEntry *entry = findEntry(cache, nodeId);
+    if(!entry || now - entry->readTime > maxAge) {
+        cache->misses++;
+        return UA_STATUSCODE_BADNOTFOUND;
+    }
+    cache->hits++;
+    return UA_DataValue_copy(&entry->value, value);
+}
+
+UA_StatusCode
+UA_ValueCache_store(UA_ValueCache *cache, size_t maxEntries,
+                    const UA_NodeId *nodeId, UA_DateTime now,
+                    const UA_DataValue *value) {
+    if(maxEntries == 0)
+        return UA_STATUSCODE_GOOD;
+
+    /* Update an existing entry. Moves to the end of the list. */
+    UA_ValueCacheEntry *entry = findEntry(cache, nodeId);
+    if(entry) {
+        UA_DataValue newValue;
+        UA_StatusCode retval = UA_DataValue_copy(value, &newValue);
+        if(retval != UA_STATUSCODE_GOOD) {
+            removeEntry(cache, entry); /* Don't keep the outdated value */
+            return retval;
+        }
+        UA_DataValue_clear(&entry->value);
+        entry->value = newValue;
+        entry->readTime = now;
+        TAILQ_REMOVE(&cache->entries, entry, listEntry);
+        TAILQ_INSERT_TAIL(&cache->entries, entry, listEntry);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /* Evict the least recently updated entry */
+    if(cache->entriesSize >= maxEntries)
+        removeEntry(cache, TAILQ_FIRST(&cache->entries));
+
+    /* Add a new entry */
+    entry = (UA_ValueCacheEntry*)UA_calloc(1, sizeof(UA_ValueCacheEntry));
+    if(!entry)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    UA_StatusCode retval = UA_NodeId_copy(nodeId, &entry->key.nodeId);
+    retval |= UA_DataValue_copy(value, &entry->value);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_NodeId_clear(&entry->key.nodeId);
+        UA_DataValue_clear(&entry->value);
+        UA_free(entry);
+        return retval;
+    }
+    entry->key.hash = UA_NodeId_hash(nodeId);
+    entry->readTime = now;
+    ZIP_INSERT(UA_ValueCacheTree, &cache->root, entry, ZIP_FFS32(UA_UInt32_random()));
+    TAILQ_INSERT_TAIL(&cache->entries, entry, listEntry);
+    cache->entriesSize++;
+    return UA_STATUSCODE_GOOD;
+}
+
+void
+UA_ValueCache_remove(UA_ValueCache *cache, const UA_NodeId *nodeId) {
+    UA_ValueCacheEntry *entry = findEntry(cache, nodeId);
+    if(entry)
+        removeEntry(cache, entry);
+}
@@ -0,0 +1,72 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#ifndef UA_VALUECACHE_H_
+#define UA_VALUECACHE_H_
+
+#include <open62541/types.h>
+#include <open62541/types_generated_handling.h>
+#include "open62541_queue.h"
+#include "ziptree.h"
+
+_UA_BEGIN_DECLS
+
+/* The ValueCache holds the last value read from DataSource variables together
+ * with the (monotonic) time of the read. Reads that accept a value of a certain
+ * age are answered from the cache instead of calling the DataSource again.
+ *
+ * The number of entries is bounded. When the cache is full, the entry that was
+ * updated least recently is evicted.
+ *
+ * The ValueCache is not thread-safe. In the server, all accesses are protected
+ * by the service mutex. */
+
+struct UA_ValueCacheEntry;
+typedef struct UA_ValueCacheEntry UA_ValueCacheEntry;
+
+ZIP_HEAD(UA_ValueCacheTree, UA_ValueCacheEntry);
+typedef struct UA_ValueCacheTree UA_ValueCacheTree;
+
+typedef struct {
+    UA_ValueCacheTree root;
+    TAILQ_HEAD(, UA_ValueCacheEntry) entries; /* Least recently updated first */
+    size_t entriesSize;
+    UA_UInt64 hits;
+    UA_UInt64 misses;
+} UA_ValueCache;
+
+void
+UA_ValueCache_init(UA_ValueCache *cache);
+
+void
+UA_ValueCache_clear(UA_ValueCache *cache);
+
+/* Returns whether an entry for the node is not older than maxAge. Does not
+ * count as a hit or miss. */
+UA_Boolean
+UA_ValueCache_isFresh(const UA_ValueCache *cache, const UA_NodeId *nodeId,
+                      UA_DateTime maxAge, UA_DateTime now);
+
+/* Copies the cached value into the DataValue if it is not older than maxAge.
+ * Returns UA_STATUSCODE_BADNOTFOUND if there is no such entry. */
+UA_StatusCode
+UA_ValueCache_get(UA_ValueCache *cache, const UA_NodeId *nodeId,
+                  UA_DateTime maxAge, UA_DateTime now, UA_DataValue *value);
+
+/* Stores a copy of the value. Replaces an existing entry for the node. */
+UA_StatusCode
+UA_ValueCache_store(UA_ValueCache *cache, size_t maxEntries,
+                    const UA_NodeId *nodeId, UA_DateTime now,
+                    const UA_DataValue *value);
+
+/* Removes the entry for the node, for example after a write */
+void
+UA_ValueCache_remove(UA_ValueCache *cache, const UA_NodeId *nodeId);
+
+_UA_END_DECLS
+
+#endif /* UA_VALUECACHE_H_ */
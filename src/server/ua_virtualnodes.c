@@ -0,0 +1,437 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_server_internal.h"
+#include "ua_types_encoding_binary.h"
+
+#ifdef UA_ENABLE_VIRTUAL_NODES
+
+/* The children of instances of a virtual type are not copied into the
+ * nodestore. The instance only gets a reference to each (mandatory) child. The
+ * NodeId of the child encodes the instance and the instance declaration in the
+ * type. When the child is accessed, a temporary node is created from the
+ * declaration. The references of the declaration are rewritten to point to the
+ * instance and to the virtual children of the instance.
+ *
+ * A virtual child that is written or referenced is materialized. That is, it is
+ * inserted into the nodestore under its virtual NodeId. The nodestore then
+ * holds the overrides of the instance and is looked up first. */
+
+/* The NodeId is a ByteString in the namespace of the instance. A marker is
+ * followed by the binary encoding of the instance and the declaration
+ * NodeId. */
+static const UA_Byte virtualIdMarker[4] = {'v', 'n', 'o', 'd'};
+
+static const UA_NodeId aggregatesId =
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_AGGREGATES}};
+static const UA_NodeId hasTypeDefinitionId =
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASTYPEDEFINITION}};
+static const UA_NodeId hasModellingRuleId =
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASMODELLINGRULE}};
+static const UA_NodeId mandatoryId =
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_MODELLINGRULE_MANDATORY}};
+
+UA_Boolean
+UA_VirtualNodes_isVirtualNodeId(const UA_NodeId *nodeId) {
+    return nodeId->identifierType == UA_NODEIDTYPE_BYTESTRING &&
+        nodeId->identifier.byteString.length > sizeof(virtualIdMarker) &&
+        memcmp(nodeId->identifier.byteString.data, virtualIdMarker,
+               sizeof(virtualIdMarker)) == 0;
+}
+
+UA_StatusCode
+UA_VirtualNodes_encodeId(const UA_NodeId *instanceId, const UA_NodeId *declarationId,
+                         UA_NodeId *outId) {
+    size_t len = sizeof(virtualIdMarker) +
+        UA_calcSizeBinary(instanceId, &UA_TYPES[UA_TYPES_NODEID]) +
+        UA_calcSizeBinary(declarationId, &UA_TYPES[UA_TYPES_NODEID]);
+    UA_NodeId_init(outId);
+    UA_StatusCode retval = UA_ByteString_allocBuffer(&outId->identifier.byteString, len);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+    outId->namespaceIndex = instanceId->namespaceIndex;
+    outId->identifierType = UA_NODEIDTYPE_BYTESTRING;
+
+    UA_Byte *pos = outId->identifier.byteString.data;
+    const UA_Byte *end = &pos[len];
+    memcpy(pos, virtualIdMarker, sizeof(virtualIdMarker));
+    pos += sizeof(virtualIdMarker);
+    retval = UA_encodeBinary(instanceId, &UA_TYPES[UA_TYPES_NODEID],
+                             &pos, &end, NULL, NULL);
+    retval |= UA_encodeBinary(declarationId, &UA_TYPES[UA_TYPES_NODEID],
+                              &pos, &end, NULL, NULL);
+    if(retval != UA_STATUSCODE_GOOD)
+        UA_NodeId_clear(outId);
+    return retval;
+}
+
+static UA_StatusCode
+decodeVirtualNodeId(const UA_NodeId *nodeId, UA_NodeId *instanceId,
+                    UA_NodeId *declarationId) {
+    UA_NodeId_init(instanceId);
+    UA_NodeId_init(declarationId);
+    if(!UA_VirtualNodes_isVirtualNodeId(nodeId))
+        return UA_STATUSCODE_BADNODEIDUNKNOWN;
+    const UA_ByteString *bs = &nodeId->identifier.byteString;
+    size_t offset = sizeof(virtualIdMarker);
+    UA_StatusCode retval =
+        UA_decodeBinary(bs, &offset, instanceId, &UA_TYPES[UA_TYPES_NODEID], NULL);
+    if(retval == UA_STATUSCODE_GOOD)
+        retval = UA_decodeBinary(bs, &offset, declarationId,
+                                 &UA_TYPES[UA_TYPES_NODEID], NULL);
+    if(retval != UA_STATUSCODE_GOOD || offset != bs->length ||
+       instanceId->namespaceIndex != nodeId->namespaceIndex) {
+        UA_NodeId_clear(instanceId);
+        UA_NodeId_clear(declarationId);
+        return UA_STATUSCODE_BADNODEIDUNKNOWN;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+/********************/
+/* Type Declaration */
+/********************/
+
+UA_Boolean
+UA_VirtualNodes_isVirtualType(UA_Server *server, const UA_NodeId *typeId) {
+    for(size_t i = 0; i < server->virtualTypesSize; i++) {
+        if(UA_NodeId_equal(&server->virtualTypes[i], typeId))
+            return true;
+    }
+    return false;
+}
+
+UA_StatusCode
+UA_Server_setVirtualInstanceChildren(UA_Server *server, const UA_NodeId typeId,
+                                     UA_Boolean enable) {
+    UA_LOCK(server->serviceMutex);
+    const UA_Node *type = UA_Nodestore_getNode(server->nsCtx, &typeId);
+    if(!type) {
+        UA_UNLOCK(server->serviceMutex);
+        return UA_STATUSCODE_BADNODEIDUNKNOWN;
+    }
+    UA_NodeClass nodeClass = type->nodeClass;
+    UA_Nodestore_releaseNode(server->nsCtx, type);
+    if(nodeClass != UA_NODECLASS_OBJECTTYPE) {
+        UA_UNLOCK(server->serviceMutex);
+        return UA_STATUSCODE_BADNODECLASSINVALID;
+    }
+
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    UA_Boolean isVirtual = UA_VirtualNodes_isVirtualType(server, &typeId);
+    if(enable && !isVirtual) {
+        UA_NodeId *types = (UA_NodeId*)
+            UA_realloc(server->virtualTypes,
+                       sizeof(UA_NodeId) * (server->virtualTypesSize + 1));
+        if(types) {
+            server->virtualTypes = types;
+            retval = UA_NodeId_copy(&typeId, &types[server->virtualTypesSize]);
+            if(retval == UA_STATUSCODE_GOOD)
+                server->virtualTypesSize++;
+        } else {
+            retval = UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+    } else if(!enable && isVirtual) {
+        /* Instances that were already created keep their virtual children */
+        for(size_t i = 0; i < server->virtualTypesSize; i++) {
+            if(!UA_NodeId_equal(&server->virtualTypes[i], &typeId))
+                continue;
+            UA_NodeId_clear(&server->virtualTypes[i]);
+            server->virtualTypes[i] = server->virtualTypes[server->virtualTypesSize - 1];
+            server->virtualTypesSize--;
+            if(server->virtualTypesSize == 0) {
+                UA_free(server->virtualTypes);
+                server->virtualTypes = NULL;
+            }
+            break;
+        }
+    }
+    UA_UNLOCK(server->serviceMutex);
+    return retval;
+}
+
+/*************************/
+/* Resolve Virtual Nodes */
+/*************************/
+
+static UA_Boolean
+isLocalTarget(const UA_ExpandedNodeId *target) {
+    return target->serverIndex == 0 && target->namespaceUri.data == NULL;
+}
+
+static UA_Boolean
+isMandatoryDeclaration(const UA_Node *node) {
+    for(size_t i = 0; i < node->referencesSize; i++) {
+        const UA_NodeReferenceKind *rk = &node->references[i];
+        if(rk->isInverse || !UA_NodeId_equal(&rk->referenceTypeId, &hasModellingRuleId))
+            continue;
+        for(size_t j = 0; j < rk->refTargetsSize; j++) {
+            if(UA_NodeId_equal(&rk->refTargets[j].target.nodeId, &mandatoryId))
+                return true;
+        }
+    }
+    return false;
+}
+
+static UA_Boolean
+hasForwardTarget(const UA_Node *node, const UA_NodeId *targetId) {
+    for(size_t i = 0; i < node->referencesSize; i++) {
+        const UA_NodeReferenceKind *rk = &node->references[i];
+        if(rk->isInverse)
+            continue;
+        for(size_t j = 0; j < rk->refTargetsSize; j++) {
+            if(UA_NodeId_equal(&rk->refTargets[j].target.nodeId, targetId))
+                return true;
+        }
+    }
+    return false;
+}
+
+/* Returns the (first) node in the type that aggregates the declaration */
+static UA_StatusCode
+getDeclarationParent(UA_Server *server, const UA_Node *declaration,
+                     const UA_Node **outParent) {
+    for(size_t i = 0; i < declaration->referencesSize; i++) {
+        const UA_NodeReferenceKind *rk = &declaration->references[i];
+        if(!rk->isInverse || rk->refTargetsSize == 0 ||
+           !isNodeInTree(server, &rk->referenceTypeId, &aggregatesId, &subtypeId, 1))
+            continue;
+        *outParent = UA_Nodestore_getNode(server->nsCtx, &rk->refTargets[0].target.nodeId);
+        if(*outParent)
+            return UA_STATUSCODE_GOOD;
+    }
+    return UA_STATUSCODE_BADNODEIDUNKNOWN;
+}
+
+static UA_Boolean
+isTypeNode(const UA_Node *node) {
+    return node->nodeClass == UA_NODECLASS_OBJECTTYPE ||
+        node->nodeClass == UA_NODECLASS_VARIABLETYPE;
+}
+
+/* Forged NodeIds can combine any instance with any node. Check that the
+ * instance (or the virtual parent) actually has the child. */
+static UA_Boolean
+isValidVirtualChild(UA_Server *server, const UA_NodeId *nodeId,
+                    const UA_NodeId *instanceId, const UA_Node *declaration) {
+    if(declaration->nodeClass != UA_NODECLASS_OBJECT &&
+       declaration->nodeClass != UA_NODECLASS_VARIABLE)
+        return false;
+
+    const UA_Node *parent = NULL;
+    if(getDeclarationParent(server, declaration, &parent) != UA_STATUSCODE_GOOD)
+        return false;
+
+    UA_Boolean valid = false;
+    if(isTypeNode(parent)) {
+        /* Direct child of the instance */
+        const UA_Node *instance = UA_Nodestore_getNode(server->nsCtx, instanceId);
+        if(instance) {
+            valid = hasForwardTarget(instance, nodeId);
+            UA_Nodestore_releaseNode(server->nsCtx, instance);
+        }
+    } else if(isMandatoryDeclaration(declaration)) {
+        /* Child of a virtual child */
+        UA_NodeId parentId;
+        if(UA_VirtualNodes_encodeId(instanceId, &parent->nodeId,
+                                    &parentId) == UA_STATUSCODE_GOOD) {
+            valid = isValidVirtualChild(server, &parentId, instanceId, parent);
+            UA_NodeId_clear(&parentId);
+        }
+    }
+    UA_Nodestore_releaseNode(server->nsCtx, parent);
+    return valid;
+}
+
+/* Rewrite the references of the copied declaration. Aggregated children become
+ * virtual children of the instance. Methods are shared with the type. The
+ * modelling rule and the type definition are kept. The NodeId of the parent is
+ * returned in outParentId. */
+static UA_StatusCode
+rewriteReferences(UA_Server *server, UA_Node *node, const UA_NodeId *instanceId,
+                  UA_NodeId *outParentId) {
+    size_t itemsSize = 0;
+    for(size_t i = 0; i < node->referencesSize; i++)
+        itemsSize += node->references[i].refTargetsSize;
+    UA_AddReferencesItem *items = (UA_AddReferencesItem*)
+        UA_Array_new(itemsSize, &UA_TYPES[UA_TYPES_ADDREFERENCESITEM]);
+    if(!items && itemsSize > 0)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+
+    UA_StatusCode retval = UA_STATUSCODE_GOOD;
+    size_t newSize = 0;
+    for(size_t i = 0; i < node->referencesSize && retval == UA_STATUSCODE_GOOD; i++) {
+        const UA_NodeReferenceKind *rk = &node->references[i];
+        UA_Boolean aggregates =
+            isNodeInTree(server, &rk->referenceTypeId, &aggregatesId, &subtypeId, 1);
+        if(!aggregates && (rk->isInverse ||
+                           (!UA_NodeId_equal(&rk->referenceTypeId, &hasTypeDefinitionId) &&
+                            !UA_NodeId_equal(&rk->referenceTypeId, &hasModellingRuleId))))
+            continue;
+
+        for(size_t j = 0; j < rk->refTargetsSize && retval == UA_STATUSCODE_GOOD; j++) {
+            const UA_ExpandedNodeId *target = &rk->refTargets[j].target;
+            if(!isLocalTarget(target))
+                continue;
+            UA_AddReferencesItem *item = &items[newSize];
+            item->isForward = !rk->isInverse;
+            retval = UA_NodeId_copy(&rk->referenceTypeId, &item->referenceTypeId);
+            if(retval != UA_STATUSCODE_GOOD)
+                break;
+
+            /* Keep the target */
+            if(!aggregates) {
+                retval = UA_NodeId_copy(&target->nodeId, &item->targetNodeId.nodeId);
+                newSize++;
+                continue;
+            }
+
+            const UA_Node *t = UA_Nodestore_getNode(server->nsCtx, &target->nodeId);
+            if(!t) {
+                UA_AddReferencesItem_clear(item);
+                continue;
+            }
+            if(rk->isInverse) {
+                /* The parent is the instance or a virtual child */
+                if(isTypeNode(t))
+                    retval = UA_NodeId_copy(instanceId, &item->targetNodeId.nodeId);
+                else
+                    retval = UA_VirtualNodes_encodeId(instanceId, &t->nodeId,
+                                                      &item->targetNodeId.nodeId);
+                if(retval == UA_STATUSCODE_GOOD && UA_NodeId_isNull(outParentId))
+                    retval = UA_NodeId_copy(&item->targetNodeId.nodeId, outParentId);
+                newSize++;
+            } else if(t->nodeClass == UA_NODECLASS_METHOD) {
+                retval = UA_NodeId_copy(&t->nodeId, &item->targetNodeId.nodeId);
+                newSize++;
+            } else if((t->nodeClass == UA_NODECLASS_OBJECT ||
+                       t->nodeClass == UA_NODECLASS_VARIABLE) &&
+                      isMandatoryDeclaration(t)) {
+                retval = UA_VirtualNodes_encodeId(instanceId, &t->nodeId,
+                                                  &item->targetNodeId.nodeId);
+                newSize++;
+            } else {
+                /* Optional children are not instantiated */
+                UA_AddReferencesItem_clear(item);
+            }
+            UA_Nodestore_releaseNode(server->nsCtx, t);
+        }
+    }
+
+    /* Replace the references */
+    if(retval == UA_STATUSCODE_GOOD) {
+        UA_Node_deleteReferences(node);
+        for(size_t i = 0; i < newSize && retval == UA_STATUSCODE_GOOD; i++)
+            retval = UA_Node_addReference(node, &items[i]);
+    }
+    UA_Array_delete(items, itemsSize, &UA_TYPES[UA_TYPES_ADDREFERENCESITEM]);
+    return retval;
+}
+
+/* Create the node of a virtual child from the declaration. The node is
+ * allocated in the nodestore but not inserted. */
+static UA_StatusCode
+createVirtualNode(UA_Server *server, const UA_NodeId *nodeId,
+                  UA_Node **outNode, UA_NodeId *outParentId) {
+    UA_NodeId instanceId, declarationId;
+    UA_StatusCode retval = decodeVirtualNodeId(nodeId, &instanceId, &declarationId);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+
+    const UA_Node *declaration = UA_Nodestore_getNode(server->nsCtx, &declarationId);
+    if(!declaration) {
+        retval = UA_STATUSCODE_BADNODEIDUNKNOWN;
+        goto cleanup;
+    }
+    UA_Boolean valid = isValidVirtualChild(server, nodeId, &instanceId, declaration);
+    UA_Nodestore_releaseNode(server->nsCtx, declaration);
+    if(!valid) {
+        retval = UA_STATUSCODE_BADNODEIDUNKNOWN;
+        goto cleanup;
+    }
+
+    UA_Node *node = NULL;
+    retval = UA_Nodestore_getNodeCopy(server->nsCtx, &declarationId, &node);
+    if(retval != UA_STATUSCODE_GOOD)
+        goto cleanup;
+
+    /* Same as when a child is copied during instantiation */
+    node->context = NULL;
+    node->constructed = false;
+    UA_NodeId_clear(&node->nodeId);
+    retval = UA_NodeId_copy(nodeId, &node->nodeId);
+    if(retval == UA_STATUSCODE_GOOD)
+        retval = rewriteReferences(server, node, &instanceId, outParentId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_Nodestore_deleteNode(server->nsCtx, node);
+        goto cleanup;
+    }
+    *outNode = node;
+
+ cleanup:
+    UA_NodeId_clear(&instanceId);
+    UA_NodeId_clear(&declarationId);
+    return retval;
+}
+
+const UA_Node *
+UA_VirtualNodes_getNode(UA_Server *server, const UA_NodeId *nodeId) {
+    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, nodeId);
+    if(node || !UA_VirtualNodes_isVirtualNodeId(nodeId))
+        return node;
+    UA_Node *vnode = NULL;
+    UA_NodeId parentId = UA_NODEID_NULL;
+    createVirtualNode(server, nodeId, &vnode, &parentId);
+    UA_NodeId_clear(&parentId);
+    return vnode;
+}
+
+void
+UA_VirtualNodes_releaseNode(UA_Server *server, const UA_Node *node) {
+    if(!node)
+        return;
+    if(UA_VirtualNodes_isVirtualNodeId(&node->nodeId)) {
+        /* Temporary node that is not in the nodestore? */
+        const UA_Node *stored = UA_Nodestore_getNode(server->nsCtx, &node->nodeId);
+        if(stored)
+            UA_Nodestore_releaseNode(server->nsCtx, stored);
+        if(stored != node) {
+            UA_Nodestore_deleteNode(server->nsCtx, (UA_Node*)(uintptr_t)node);
+            return;
+        }
+    }
+    UA_Nodestore_releaseNode(server->nsCtx, node);
+}
+
+UA_StatusCode
+UA_VirtualNodes_materialize(UA_Server *server, const UA_NodeId *nodeId) {
+    if(!UA_VirtualNodes_isVirtualNodeId(nodeId))
+        return UA_STATUSCODE_GOOD;
+    const UA_Node *stored = UA_Nodestore_getNode(server->nsCtx, nodeId);
+    if(stored) {
+        UA_Nodestore_releaseNode(server->nsCtx, stored);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    UA_Node *node = NULL;
+    UA_NodeId parentId = UA_NODEID_NULL;
+    UA_StatusCode retval = createVirtualNode(server, nodeId, &node, &parentId);
+    if(retval != UA_STATUSCODE_GOOD)
+        return retval;
+
+    /* Materialize the parent first. So the real nodes below the instance stay
+     * connected and are removed together with the instance. */
+    retval = UA_VirtualNodes_materialize(server, &parentId);
+    UA_NodeId_clear(&parentId);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_Nodestore_deleteNode(server->nsCtx, node);
+        return retval;
+    }
+    return UA_Nodestore_insertNode(server->nsCtx, node, NULL);
+}
+
+#endif /* UA_ENABLE_VIRTUAL_NODES */
@@ -968,6 +968,7 @@ addChunkPayload(UA_SecureChannel *channel, UA_UInt32 requestId,
         memset(latest, 0, sizeof(UA_Message));
         latest->requestId = requestId;
         latest->messageType = messageType;
+        latest->receiveTime = UA_DateTime_nowMonotonic();
         SIMPLEQ_INIT(&latest->chunkPayloads);
         TAILQ_INSERT_TAIL(&channel->messages, latest, pointers);
     }
@@ -1003,6 +1004,7 @@ addChunkPayload(UA_SecureChannel *channel, UA_UInt32 requestId,
 static UA_StatusCode
 processMessage(UA_SecureChannel *channel, const UA_Message *message,
                void *application, UA_ProcessMessageCallback callback) {
+    channel->messageReceiveTime = message->receiveTime;
     if(message->chunkPayloadsSize == 1) {
         /* No need to combine chunks */
         UA_ChunkPayload *cp = SIMPLEQ_FIRST(&message->chunkPayloads);
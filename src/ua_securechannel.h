@@ -61,6 +61,7 @@ typedef struct UA_Message {
     size_t chunkPayloadsSize; /* No of chunks received so far */
     size_t messageSize; /* Total length of the chunks received so far */
     UA_Boolean final; /* All chunks for the message have been received */
+    UA_DateTime receiveTime; /* Monotonic time when the first chunk arrived */
 } UA_Message;
 
 typedef enum {
@@ -103,6 +104,7 @@ struct UA_SecureChannel {
 
     LIST_HEAD(, UA_SessionHeader) sessions;
     UA_MessageQueue messages;
+    UA_DateTime messageReceiveTime; /* Of the message in processing */
 };
 
 void UA_SecureChannel_init(UA_SecureChannel *channel);
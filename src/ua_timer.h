@@ -18,6 +18,8 @@ _UA_BEGIN_DECLS
 struct UA_TimerEntry;
 typedef struct UA_TimerEntry UA_TimerEntry;
 
+#ifndef UA_ENABLE_TIMER_WHEEL
+
 ZIP_HEAD(UA_TimerZip, UA_TimerEntry);
 typedef struct UA_TimerZip UA_TimerZip;
 
@@ -31,6 +33,48 @@ typedef struct {
     UA_UInt64 idCounter;
 } UA_Timer;
 
+#else
+
+/* Hierarchical timing wheel with a resolution of one millisecond (tick). Every
+ * level has 64 slots. A slot of level n spans 64^n ticks. Callbacks beyond the
+ * range of the wheel are kept in an overflow list. Repeated callbacks with the
+ * same interval that are due in the same tick are batched. */
+#define UA_TIMERWHEEL_LEVELS 6
+#define UA_TIMERWHEEL_SLOTS 64
+#define UA_TIMERWHEEL_BATCHCACHE 64
+
+struct UA_TimerBatch;
+typedef struct UA_TimerBatch UA_TimerBatch;
+
+TAILQ_HEAD(UA_TimerBatchList, UA_TimerBatch);
+typedef struct UA_TimerBatchList UA_TimerBatchList;
+
+/* The callback identifier is the index in the id table and a generation
+ * counter that is incremented when the index is reused */
+typedef struct {
+    UA_TimerEntry *entry;
+    UA_UInt32 generation;
+    UA_UInt32 nextFree;
+} UA_TimerIdSlot;
+
+/* Only for a single thread. Protect by a mutex if required. */
+typedef struct {
+    UA_UInt64 currentTick;
+    UA_UInt64 occupied[UA_TIMERWHEEL_LEVELS]; /* Bitmap of non-empty slots */
+    UA_TimerBatchList wheel[UA_TIMERWHEEL_LEVELS][UA_TIMERWHEEL_SLOTS];
+    UA_TimerBatchList overflow;
+    UA_TimerBatchList due; /* Taken from the current slot during _process */
+
+    /* Recently scheduled batches that new callbacks can join */
+    UA_TimerBatch *batchCache[UA_TIMERWHEEL_BATCHCACHE];
+
+    UA_TimerIdSlot *ids;
+    UA_UInt32 idsSize;
+    UA_UInt32 freeIds;
+} UA_Timer;
+
+#endif
+
 void UA_Timer_init(UA_Timer *t);
 
 UA_StatusCode
@@ -0,0 +1,543 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ *    Copyright 2026 (c) agent
+ */
+
+#include "ua_util_internal.h"
+#include "ua_timer.h"
+
+/* The callbacks are kept in batches. All callbacks of a batch have the same
+ * interval and are due at the same time. The batches are placed in the slot of
+ * the timing wheel for the tick when they are due. The level of a batch is
+ * given by the most significant group of bits (six bits per level) where its
+ * tick differs from the current tick. When the current tick reaches the start
+ * of a slot on a higher level, the batches of the slot are cascaded down.
+ *
+ * The callbacks keep their exact due time. A batch is executed when its due
+ * time has passed, not when its slot is reached. The first execution of a
+ * repeated callback that joins an existing batch can be up to one tick early.
+ *
+ * Adding, removing and rescheduling a callback takes constant time. Callbacks
+ * are found in the id table from their identifier. */
+
+#define UA_TIMERWHEEL_TICK UA_DATETIME_MSEC
+#define UA_TIMERWHEEL_SLOTBITS 6
+#define UA_TIMERWHEEL_SLOTMASK (UA_TIMERWHEEL_SLOTS - 1)
+#define UA_TIMERWHEEL_RANGEBITS (UA_TIMERWHEEL_SLOTBITS * UA_TIMERWHEEL_LEVELS)
+#define UA_TIMERWHEEL_NOID UA_UINT32_MAX
+
+struct UA_TimerEntry {
+    TAILQ_ENTRY(UA_TimerEntry) batchEntry;
+    UA_TimerBatch *batch;
+    UA_ApplicationCallback callback;
+    void *application;
+    void *data;
+    UA_UInt64 id;
+};
+
+TAILQ_HEAD(UA_TimerEntryList, UA_TimerEntry);
+
+struct UA_TimerBatch {
+    TAILQ_ENTRY(UA_TimerBatch) slotEntry;
+    UA_TimerBatchList *list;  /* The slot that contains the batch */
+    UA_Byte level;            /* UA_TIMERWHEEL_LEVELS outside of the wheel */
+    UA_Byte cacheIndex;
+    UA_Boolean processing;    /* Don't free and don't join */
+    UA_DateTime nextTime;     /* The next time when the callbacks are executed */
+    UA_UInt64 interval;       /* Interval in 100ns resolution. 0 for timed
+                               * callbacks that are executed once. */
+    struct UA_TimerEntryList entries;
+    UA_TimerEntry *cursor;    /* The next entry to execute during processing */
+};
+
+static UA_UInt64
+tickOf(UA_DateTime time) {
+    return (time > 0) ? (UA_UInt64)time / UA_TIMERWHEEL_TICK : 0;
+}
+
+static size_t
+lowestBit(UA_UInt64 v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_ctzll(v);
+#else
+    size_t i = 0;
+    for(; !(v & 1); v >>= 1)
+        i++;
+    return i;
+#endif
+}
+
+/* Returns the first non-empty slot after the position of the current tick in
+ * the level or UA_TIMERWHEEL_SLOTS */
+static size_t
+nextOccupied(const UA_Timer *t, size_t level) {
+    size_t pos = (size_t)(t->currentTick >> (level * UA_TIMERWHEEL_SLOTBITS)) &
+        UA_TIMERWHEEL_SLOTMASK;
+    if(pos == UA_TIMERWHEEL_SLOTMASK)
+        return UA_TIMERWHEEL_SLOTS;
+    UA_UInt64 later = t->occupied[level] & (~(UA_UInt64)0 << (pos + 1));
+    return (later) ? lowestBit(later) : UA_TIMERWHEEL_SLOTS;
+}
+
+/* The first tick of a slot in the current round of the level */
+static UA_UInt64
+slotStart(const UA_Timer *t, size_t level, size_t slot) {
+    size_t shift = level * UA_TIMERWHEEL_SLOTBITS;
+    size_t roundShift = shift + UA_TIMERWHEEL_SLOTBITS;
+    return ((t->currentTick >> roundShift) << roundShift) | ((UA_UInt64)slot << shift);
+}
+
+/***********/
+/* Batches */
+/***********/
+
+static void
+insertBatch(UA_Timer *t, UA_TimerBatch *b) {
+    /* Batches that are already due go into the current slot */
+    UA_UInt64 tick = tickOf(b->nextTime);
+    if(tick < t->currentTick)
+        tick = t->currentTick;
+
+    UA_UInt64 diff = tick ^ t->currentTick;
+    if(diff >> UA_TIMERWHEEL_RANGEBITS) {
+        b->list = &t->overflow;
+        b->level = UA_TIMERWHEEL_LEVELS;
+    } else {
+        size_t level = 0;
+        while(diff >> ((level + 1) * UA_TIMERWHEEL_SLOTBITS))
+            level++;
+        size_t slot = (size_t)(tick >> (level * UA_TIMERWHEEL_SLOTBITS)) &
+            UA_TIMERWHEEL_SLOTMASK;
+        t->occupied[level] |= (UA_UInt64)1 << slot;
+        b->list = &t->wheel[level][slot];
+        b->level = (UA_Byte)level;
+    }
+    TAILQ_INSERT_TAIL(b->list, b, slotEntry);
+}
+
+static void
+unlinkBatch(UA_Timer *t, UA_TimerBatch *b) {
+    if(!b->list)
+        return;
+    TAILQ_REMOVE(b->list, b, slotEntry);
+    if(b->level < UA_TIMERWHEEL_LEVELS && TAILQ_EMPTY(b->list)) {
+        size_t slot = (size_t)(b->list - t->wheel[b->level]);
+        t->occupied[b->level] &= ~((UA_UInt64)1 << slot);
+    }
+    b->list = NULL;
+}
+
+static UA_Byte
+batchCacheIndex(UA_UInt64 interval, UA_UInt64 tick) {
+    UA_UInt64 h = (interval ^ (tick << 24)) * 0x9E3779B97F4A7C15ULL;
+    return (UA_Byte)((h >> 32) % UA_TIMERWHEEL_BATCHCACHE);
+}
+
+static void
+cacheBatch(UA_Timer *t, UA_TimerBatch *b) {
+    b->cacheIndex = batchCacheIndex(b->interval, tickOf(b->nextTime));
+    t->batchCache[b->cacheIndex] = b;
+}
+
+static void
+uncacheBatch(UA_Timer *t, UA_TimerBatch *b) {
+    if(t->batchCache[b->cacheIndex] == b)
+        t->batchCache[b->cacheIndex] = NULL;
+}
+
+static void
+freeBatch(UA_Timer *t, UA_TimerBatch *b) {
+    unlinkBatch(t, b);
+    uncacheBatch(t, b);
+    UA_free(b);
+}
+
+/* Move all batches of a slot to their position relative to the current tick */
+static void
+cascade(UA_Timer *t, UA_TimerBatchList *list) {
+    UA_TimerBatchList tmp;
+    TAILQ_INIT(&tmp);
+    UA_TimerBatch *b;
+    while((b = TAILQ_FIRST(list))) {
+        unlinkBatch(t, b);
+        TAILQ_INSERT_TAIL(&tmp, b, slotEntry);
+    }
+    while((b = TAILQ_FIRST(&tmp))) {
+        TAILQ_REMOVE(&tmp, b, slotEntry);
+        insertBatch(t, b);
+    }
+}
+
+/***********/
+/* Entries */
+/***********/
+
+static UA_StatusCode
+registerId(UA_Timer *t, UA_TimerEntry *te) {
+    if(t->freeIds == UA_TIMERWHEEL_NOID) {
+        UA_UInt32 newSize = (t->idsSize > 0) ? t->idsSize * 2 : 64;
+        if(newSize <= t->idsSize || newSize == UA_TIMERWHEEL_NOID)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        UA_TimerIdSlot *ids = (UA_TimerIdSlot*)
+            UA_realloc(t->ids, sizeof(UA_TimerIdSlot) * newSize);
+        if(!ids)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        for(UA_UInt32 i = t->idsSize; i < newSize; i++) {
+            ids[i].entry = NULL;
+            ids[i].generation = 0;
+            ids[i].nextFree = i + 1;
+        }
+        ids[newSize - 1].nextFree = UA_TIMERWHEEL_NOID;
+        t->freeIds = t->idsSize;
+        t->ids = ids;
+        t->idsSize = newSize;
+    }
+
+    /* The lower half of the identifier is never zero */
+    UA_UInt32 index = t->freeIds;
+    UA_TimerIdSlot *slot = &t->ids[index];
+    t->freeIds = slot->nextFree;
+    slot->entry = te;
+    te->id = ((UA_UInt64)slot->generation << 32) | ((UA_UInt64)index + 1);
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+releaseId(UA_Timer *t, UA_TimerEntry *te) {
+    UA_UInt32 index = (UA_UInt32)te->id - 1;
+    UA_TimerIdSlot *slot = &t->ids[index];
+    slot->entry = NULL;
+    slot->generation++;
+    slot->nextFree = t->freeIds;
+    t->freeIds = index;
+}
+
+static UA_TimerEntry *
+findEntry(UA_Timer *t, UA_UInt64 callbackId) {
+    UA_UInt32 index = (UA_UInt32)callbackId - 1;
+    if(index >= t->idsSize)
+        return NULL;
+    UA_TimerEntry *te = t->ids[index].entry;
+    return (te && te->id == callbackId) ? te : NULL;
+}
+
+/* Join a batch with the same interval in the same tick or create a new batch.
+ * Timed callbacks are only batched if they are due at exactly the same time. */
+static UA_StatusCode
+scheduleEntry(UA_Timer *t, UA_TimerEntry *te, UA_DateTime nextTime,
+              UA_UInt64 interval) {
+    UA_UInt64 tick = tickOf(nextTime);
+    UA_TimerBatch *b = t->batchCache[batchCacheIndex(interval, tick)];
+    if(!b || b->processing || b->interval != interval ||
+       tickOf(b->nextTime) != tick || (interval == 0 && b->nextTime != nextTime)) {
+        b = (UA_TimerBatch*)UA_malloc(sizeof(UA_TimerBatch));
+        if(!b)
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        b->nextTime = nextTime;
+        b->interval = interval;
+        b->processing = false;
+        b->cursor = NULL;
+        TAILQ_INIT(&b->entries);
+        insertBatch(t, b);
+        cacheBatch(t, b);
+    }
+    te->batch = b;
+    TAILQ_INSERT_TAIL(&b->entries, te, batchEntry);
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+detachEntry(UA_Timer *t, UA_TimerEntry *te) {
+    UA_TimerBatch *b = te->batch;
+    if(b->cursor == te)
+        b->cursor = TAILQ_NEXT(te, batchEntry);
+    TAILQ_REMOVE(&b->entries, te, batchEntry);
+    te->batch = NULL;
+    if(TAILQ_EMPTY(&b->entries) && !b->processing)
+        freeBatch(t, b);
+}
+
+/**************/
+/* Public API */
+/**************/
+
+void
+UA_Timer_init(UA_Timer *t) {
+    memset(t, 0, sizeof(UA_Timer));
+    for(size_t i = 0; i < UA_TIMERWHEEL_LEVELS; i++) {
+        for(size_t j = 0; j < UA_TIMERWHEEL_SLOTS; j++)
+            TAILQ_INIT(&t->wheel[i][j]);
+    }
+    TAILQ_INIT(&t->overflow);
+    TAILQ_INIT(&t->due);
+    t->freeIds = UA_TIMERWHEEL_NOID;
+    t->currentTick = tickOf(UA_DateTime_nowMonotonic());
+}
+
+static UA_StatusCode
+addCallback(UA_Timer *t, UA_ApplicationCallback callback, void *application, void *data,
+            UA_DateTime nextTime, UA_UInt64 interval, UA_UInt64 *callbackId) {
+    /* A callback method needs to be present */
+    if(!callback)
+        return UA_STATUSCODE_BADINTERNALERROR;
+
+    UA_TimerEntry *te = (UA_TimerEntry*)UA_malloc(sizeof(UA_TimerEntry));
+    if(!te)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    te->callback = callback;
+    te->application = application;
+    te->data = data;
+
+    UA_StatusCode retval = registerId(t, te);
+    if(retval != UA_STATUSCODE_GOOD) {
+        UA_free(te);
+        return retval;
+    }
+
+    retval = scheduleEntry(t, te, nextTime, interval);
+    if(retval != UA_STATUSCODE_GOOD) {
+        releaseId(t, te);
+        UA_free(te);
+        return retval;
+    }
+
+    /* Set the output identifier */
+    if(callbackId)
+        *callbackId = te->id;
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode
+UA_Timer_addTimedCallback(UA_Timer *t, UA_ApplicationCallback callback,
+                          void *application, void *data, UA_DateTime date,
+                          UA_UInt64 *callbackId) {
+    return addCallback(t, callback, application, data, date, 0, callbackId);
+}
+
+UA_StatusCode
+UA_Timer_addRepeatedCallback(UA_Timer *t, UA_ApplicationCallback callback,
+                             void *application, void *data, UA_Double interval_ms,
+                             UA_UInt64 *callbackId) {
+    /* The interval needs to be positive */
+    if(interval_ms <= 0.0)
+        return UA_STATUSCODE_BADINTERNALERROR;
+
+    UA_UInt64 interval = (UA_UInt64)(interval_ms * UA_DATETIME_MSEC);
+    if(interval == 0)
+        interval = 1;
+    UA_DateTime nextTime = UA_DateTime_nowMonotonic() + (UA_DateTime)interval;
+    return addCallback(t, callback, application, data, nextTime, interval, callbackId);
+}
+
+UA_StatusCode
+UA_Timer_changeRepeatedCallbackInterval(UA_Timer *t, UA_UInt64 callbackId,
+                                        UA_Double interval_ms) {
+    /* The interval needs to be positive */
+    if(interval_ms <= 0.0)
+        return UA_STATUSCODE_BADINTERNALERROR;
+
+    UA_TimerEntry *te = findEntry(t, callbackId);
+    if(!te)
+        return UA_STATUSCODE_BADNOTFOUND;
+
+    /* Move to a batch with the new interval */
+    UA_UInt64 interval = (UA_UInt64)(interval_ms * UA_DATETIME_MSEC);
+    if(interval == 0)
+        interval = 1;
+    detachEntry(t, te);
+    UA_StatusCode retval =
+        scheduleEntry(t, te, UA_DateTime_nowMonotonic() + (UA_DateTime)interval, interval);
+    if(retval != UA_STATUSCODE_GOOD) {
+        releaseId(t, te);
+        UA_free(te);
+    }
+    return retval;
+}
+
+void
+UA_Timer_removeCallback(UA_Timer *t, UA_UInt64 callbackId) {
+    UA_TimerEntry *te = findEntry(t, callbackId);
+    if(!te)
+        return;
+    detachEntry(t, te);
+    releaseId(t, te);
+    UA_free(te);
+}
+
+/**************/
+/* Processing */
+/**************/
+
+static void
+processBatch(UA_Timer *t, UA_TimerBatch *b, UA_DateTime nowMonotonic,
+             UA_TimerExecutionCallback executionCallback,
+             void *executionApplication) {
+    b->processing = true;
+
+    /* Reschedule repeated callbacks first. Because the callbacks can interact
+     * with the timer. Prevent an infinite loop by forcing the next processing
+     * into the next iteration. */
+    if(b->interval > 0) {
+        uncacheBatch(t, b);
+        b->nextTime += (UA_DateTime)b->interval;
+        if(b->nextTime < nowMonotonic)
+            b->nextTime = nowMonotonic + 1;
+        insertBatch(t, b);
+        cacheBatch(t, b);
+    }
+
+    /* The callbacks can remove entries from the batch. The cursor is moved
+     * forward when the next entry is removed. */
+    UA_TimerEntry *te = TAILQ_FIRST(&b->entries);
+    while(te) {
+        b->cursor = TAILQ_NEXT(te, batchEntry);
+        if(b->interval > 0) {
+            executionCallback(executionApplication, te->callback,
+                              te->application, te->data);
+        } else {
+            TAILQ_REMOVE(&b->entries, te, batchEntry);
+            releaseId(t, te);
+            executionCallback(executionApplication, te->callback,
+                              te->application, te->data);
+            UA_free(te);
+        }
+        te = b->cursor;
+    }
+
+    b->cursor = NULL;
+    b->processing = false;
+    if(TAILQ_EMPTY(&b->entries))
+        freeBatch(t, b);
+}
+
+/* Execute the due batches of the current slot. Batches can be added to the
+ * current slot (and be due) while the callbacks are executed. */
+static void
+processSlot(UA_Timer *t, UA_DateTime nowMonotonic,
+            UA_TimerExecutionCallback executionCallback,
+            void *executionApplication) {
+    UA_TimerBatchList *slot =
+        &t->wheel[0][t->currentTick & UA_TIMERWHEEL_SLOTMASK];
+    while(true) {
+        UA_TimerBatch *b, *b_tmp;
+        TAILQ_FOREACH_SAFE(b, slot, slotEntry, b_tmp) {
+            if(b->nextTime > nowMonotonic)
+                continue;
+            unlinkBatch(t, b);
+            TAILQ_INSERT_TAIL(&t->due, b, slotEntry);
+            b->list = &t->due;
+            b->level = UA_TIMERWHEEL_LEVELS;
+        }
+        if(TAILQ_EMPTY(&t->due))
+            return;
+        while((b = TAILQ_FIRST(&t->due))) {
+            unlinkBatch(t, b);
+            processBatch(t, b, nowMonotonic, executionCallback, executionApplication);
+        }
+    }
+}
+
+/* Advance the current tick to the next slot that contains batches, but not
+ * beyond the target tick. The slots of higher levels that start at the new
+ * current tick are cascaded down. */
+static void
+advance(UA_Timer *t, UA_UInt64 target) {
+    UA_UInt64 next = target;
+    size_t level = 0;
+    for(; level < UA_TIMERWHEEL_LEVELS; level++) {
+        size_t slot = nextOccupied(t, level);
+        if(slot == UA_TIMERWHEEL_SLOTS)
+            continue;
+        UA_UInt64 start = slotStart(t, level, slot);
+        if(start < next)
+            next = start;
+        break;
+    }
+    if(level == UA_TIMERWHEEL_LEVELS && !TAILQ_EMPTY(&t->overflow)) {
+        UA_UInt64 start = ((t->currentTick >> UA_TIMERWHEEL_RANGEBITS) + 1)
+            << UA_TIMERWHEEL_RANGEBITS;
+        if(start < next)
+            next = start;
+    }
+
+    t->currentTick = next;
+    if((next & (((UA_UInt64)1 << UA_TIMERWHEEL_RANGEBITS) - 1)) == 0)
+        cascade(t, &t->overflow);
+    for(level = UA_TIMERWHEEL_LEVELS - 1; level > 0; level--) {
+        size_t shift = level * UA_TIMERWHEEL_SLOTBITS;
+        if(next & (((UA_UInt64)1 << shift) - 1))
+            continue;
+        size_t slot = (size_t)(next >> shift) & UA_TIMERWHEEL_SLOTMASK;
+        if(t->occupied[level] & ((UA_UInt64)1 << slot))
+            cascade(t, &t->wheel[level][slot]);
+    }
+}
+
+static UA_DateTime
+earliestTime(const UA_TimerBatchList *list) {
+    UA_DateTime earliest = UA_INT64_MAX;
+    UA_TimerBatch *b;
+    TAILQ_FOREACH(b, list, slotEntry) {
+        if(b->nextTime < earliest)
+            earliest = b->nextTime;
+    }
+    return earliest;
+}
+
+/* Batches on level 0 are precise. For the higher levels, the start of the slot
+ * is returned. */
+static UA_DateTime
+nextTime(const UA_Timer *t) {
+    const UA_TimerBatchList *current =
+        &t->wheel[0][t->currentTick & UA_TIMERWHEEL_SLOTMASK];
+    if(!TAILQ_EMPTY(current))
+        return earliestTime(current);
+    for(size_t level = 0; level < UA_TIMERWHEEL_LEVELS; level++) {
+        size_t slot = nextOccupied(t, level);
+        if(slot == UA_TIMERWHEEL_SLOTS)
+            continue;
+        if(level == 0)
+            return earliestTime(&t->wheel[0][slot]);
+        return (UA_DateTime)(slotStart(t, level, slot) * UA_TIMERWHEEL_TICK);
+    }
+    return earliestTime(&t->overflow);
+}
+
+UA_DateTime
+UA_Timer_process(UA_Timer *t, UA_DateTime nowMonotonic,
+                 UA_TimerExecutionCallback executionCallback,
+                 void *executionApplication) {
+    UA_UInt64 nowTick = tickOf(nowMonotonic);
+    processSlot(t, nowMonotonic, executionCallback, executionApplication);
+    while(t->currentTick < nowTick) {
+        advance(t, nowTick);
+        processSlot(t, nowMonotonic, executionCallback, executionApplication);
+    }
+    return nextTime(t);
+}
+
+static void
+freeList(UA_TimerBatchList *list) {
+    UA_TimerBatch *b;
+    while((b = TAILQ_FIRST(list))) {
+        UA_TimerEntry *te, *te_tmp;
+        TAILQ_FOREACH_SAFE(te, &b->entries, batchEntry, te_tmp)
+            UA_free(te);
+        TAILQ_REMOVE(list, b, slotEntry);
+        UA_free(b);
+    }
+}
+
+void
+UA_Timer_deleteMembers(UA_Timer *t) {
+    for(size_t i = 0; i < UA_TIMERWHEEL_LEVELS; i++) {
+        for(size_t j = 0; j < UA_TIMERWHEEL_SLOTS; j++)
+            freeList(&t->wheel[i][j]);
+    }
+    freeList(&t->overflow);
+    freeList(&t->due);
+    UA_free(t->ids);
+    UA_Timer_init(t);
+}
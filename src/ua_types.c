@@ -41,9 +41,12 @@ const UA_ExpandedNodeId UA_EXPANDEDNODEID_NULL = {{0, UA_NODEIDTYPE_NUMERIC, {0}
 typedef UA_StatusCode (*UA_copySignature)(const void *src, void *dst,
                                           const UA_DataType *type);
 typedef void (*UA_clearSignature)(void *p, const UA_DataType *type);
+typedef UA_Boolean (*UA_equalSignature)(const void *p1, const void *p2,
+                                        const UA_DataType *type);
 
 extern const UA_copySignature copyJumpTable[UA_DATATYPEKINDS];
 extern const UA_clearSignature clearJumpTable[UA_DATATYPEKINDS];
+extern const UA_equalSignature equalJumpTable[UA_DATATYPEKINDS];
 
 /* TODO: The standard-defined types are ordered. See if binary search is
  * more efficient. */
@@ -359,6 +362,10 @@ UA_NodeId_order(const UA_NodeId *n1, const UA_NodeId *n2) {
         break;
     case UA_NODEIDTYPE_STRING:
     case UA_NODEIDTYPE_BYTESTRING: {
+        /* Shortcut for shared (e.g. interned) strings */
+        if(n1->identifier.string.data == n2->identifier.string.data &&
+           n1->identifier.string.length == n2->identifier.string.length)
+            break;
         size_t minLength = UA_MIN(n1->identifier.string.length, n2->identifier.string.length);
         int cmp = strncmp((const char*)n1->identifier.string.data,
                           (const char*)n2->identifier.string.data,
@@ -384,8 +391,8 @@ UA_NodeId_order(const UA_NodeId *n1, const UA_NodeId *n2) {
 /* FNV non-cryptographic hash function. See
  * https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function */
 #define FNV_PRIME_32 16777619
-static u32
-fnv32(u32 fnv, const u8 *buf, size_t size) {
+u32
+UA_ByteString_hash(u32 fnv, const u8 *buf, size_t size) {
     for(size_t i = 0; i < size; ++i) {
         fnv = fnv ^ (buf[i]);
         fnv = fnv * FNV_PRIME_32;
@@ -402,9 +409,11 @@ UA_NodeId_hash(const UA_NodeId *n) {
         return (u32)((n->namespaceIndex + ((n->identifier.numeric * (u64)2654435761) >> (32))) & UINT32_C(4294967295)); /*  Knuth's multiplicative hashing */
     case UA_NODEIDTYPE_STRING:
     case UA_NODEIDTYPE_BYTESTRING:
-        return fnv32(n->namespaceIndex, n->identifier.string.data, n->identifier.string.length);
+        return UA_ByteString_hash(n->namespaceIndex, n->identifier.string.data,
+                                  n->identifier.string.length);
     case UA_NODEIDTYPE_GUID:
-        return fnv32(n->namespaceIndex, (const u8*)&n->identifier.guid, sizeof(UA_Guid));
+        return UA_ByteString_hash(n->namespaceIndex, (const u8*)&n->identifier.guid,
+                                  sizeof(UA_Guid));
     }
 }
 
@@ -450,8 +459,8 @@ UA_ExpandedNodeId_order(const UA_ExpandedNodeId *n1,
 u32
 UA_ExpandedNodeId_hash(const UA_ExpandedNodeId *n) {
     u32 h = UA_NodeId_hash(&n->nodeId);
-    h = fnv32(h, (const UA_Byte*)&n->serverIndex, 4);
-    return fnv32(h, n->namespaceUri.data, n->namespaceUri.length);
+    h = UA_ByteString_hash(h, (const UA_Byte*)&n->serverIndex, 4);
+    return UA_ByteString_hash(h, n->namespaceUri.data, n->namespaceUri.length);
 }
 
 /* ExtensionObject */
@@ -1140,6 +1149,265 @@ UA_delete(void *p, const UA_DataType *type) {
     UA_free(p);
 }
 
+/************/
+/* Equality */
+/************/
+
+/* The comparison follows the binary encoding. Two values are equal if they
+ * have the same encoding. But without encoding them. */
+
+static UA_Boolean
+arrayEqual(const void *p1, size_t size1, const void *p2, size_t size2,
+           const UA_DataType *type) {
+    if(size1 != size2)
+        return false;
+    /* The NULL array and the empty array are encoded differently */
+    if(size1 == 0)
+        return ((p1 == NULL) == (p2 == NULL));
+    if(type->overlayable)
+        return (memcmp(p1, p2, type->memSize * size1) == 0);
+    const UA_equalSignature equal = equalJumpTable[type->typeKind];
+    uintptr_t ptr1 = (uintptr_t)p1;
+    uintptr_t ptr2 = (uintptr_t)p2;
+    for(size_t i = 0; i < size1; ++i) {
+        if(!equal((const void*)ptr1, (const void*)ptr2, type))
+            return false;
+        ptr1 += type->memSize;
+        ptr2 += type->memSize;
+    }
+    return true;
+}
+
+static UA_Boolean
+equalByte(const u8 *p1, const u8 *p2, const UA_DataType *_) {
+    return (*p1 == *p2);
+}
+
+static UA_Boolean
+equal2Byte(const u16 *p1, const u16 *p2, const UA_DataType *_) {
+    return (*p1 == *p2);
+}
+
+/* Floating point values are compared by their bits, as in the encoding */
+static UA_Boolean
+equal4Byte(const u32 *p1, const u32 *p2, const UA_DataType *_) {
+    return (*p1 == *p2);
+}
+
+static UA_Boolean
+equal8Byte(const u64 *p1, const u64 *p2, const UA_DataType *_) {
+    return (*p1 == *p2);
+}
+
+static UA_Boolean
+equalGuid(const UA_Guid *p1, const UA_Guid *p2, const UA_DataType *_) {
+    return UA_Guid_equal(p1, p2);
+}
+
+static UA_Boolean
+String_equal(const UA_String *p1, const UA_String *p2, const UA_DataType *_) {
+    return arrayEqual(p1->data, p1->length, p2->data, p2->length,
+                      &UA_TYPES[UA_TYPES_BYTE]);
+}
+
+static UA_Boolean
+NodeId_equal(const UA_NodeId *p1, const UA_NodeId *p2, const UA_DataType *_) {
+    return (UA_NodeId_order(p1, p2) == UA_ORDER_EQ);
+}
+
+static UA_Boolean
+ExpandedNodeId_equal(const UA_ExpandedNodeId *p1, const UA_ExpandedNodeId *p2,
+                     const UA_DataType *_) {
+    return (p1->serverIndex == p2->serverIndex &&
+            String_equal(&p1->namespaceUri, &p2->namespaceUri, NULL) &&
+            NodeId_equal(&p1->nodeId, &p2->nodeId, NULL));
+}
+
+static UA_Boolean
+QualifiedName_equal(const UA_QualifiedName *p1, const UA_QualifiedName *p2,
+                    const UA_DataType *_) {
+    return (p1->namespaceIndex == p2->namespaceIndex &&
+            String_equal(&p1->name, &p2->name, NULL));
+}
+
+static UA_Boolean
+LocalizedText_equal(const UA_LocalizedText *p1, const UA_LocalizedText *p2,
+                    const UA_DataType *_) {
+    return (String_equal(&p1->locale, &p2->locale, NULL) &&
+            String_equal(&p1->text, &p2->text, NULL));
+}
+
+static UA_Boolean
+ExtensionObject_equal(const UA_ExtensionObject *p1, const UA_ExtensionObject *p2,
+                      const UA_DataType *_) {
+    UA_Boolean decoded1 = (p1->encoding >= UA_EXTENSIONOBJECT_DECODED);
+    UA_Boolean decoded2 = (p2->encoding >= UA_EXTENSIONOBJECT_DECODED);
+    if(decoded1 != decoded2)
+        return false;
+    if(!decoded1)
+        return (p1->encoding == p2->encoding &&
+                NodeId_equal(&p1->content.encoded.typeId,
+                             &p2->content.encoded.typeId, NULL) &&
+                String_equal(&p1->content.encoded.body,
+                             &p2->content.encoded.body, NULL));
+    const UA_DataType *type = p1->content.decoded.type;
+    if(type != p2->content.decoded.type)
+        return false;
+    if(!type || !p1->content.decoded.data || !p2->content.decoded.data)
+        return (p1->content.decoded.data == p2->content.decoded.data);
+    return equalJumpTable[type->typeKind](p1->content.decoded.data,
+                                          p2->content.decoded.data, type);
+}
+
+static UA_Boolean
+Variant_equal(const UA_Variant *p1, const UA_Variant *p2, const UA_DataType *_) {
+    if(p1->type != p2->type)
+        return false;
+    if(!p1->type)
+        return true; /* Both are empty */
+    UA_Boolean scalar = UA_Variant_isScalar(p1);
+    if(scalar != UA_Variant_isScalar(p2))
+        return false;
+    if(scalar)
+        return equalJumpTable[p1->type->typeKind](p1->data, p2->data, p1->type);
+    return (arrayEqual(p1->data, p1->arrayLength,
+                       p2->data, p2->arrayLength, p1->type) &&
+            arrayEqual(p1->arrayDimensions, p1->arrayDimensionsSize,
+                       p2->arrayDimensions, p2->arrayDimensionsSize,
+                       &UA_TYPES[UA_TYPES_UINT32]));
+}
+
+/* Only the fields that are present are compared */
+static UA_Boolean
+DataValue_equal(const UA_DataValue *p1, const UA_DataValue *p2,
+                const UA_DataType *_) {
+    if(p1->hasValue != p2->hasValue ||
+       p1->hasStatus != p2->hasStatus ||
+       p1->hasSourceTimestamp != p2->hasSourceTimestamp ||
+       p1->hasServerTimestamp != p2->hasServerTimestamp ||
+       p1->hasSourcePicoseconds != p2->hasSourcePicoseconds ||
+       p1->hasServerPicoseconds != p2->hasServerPicoseconds)
+        return false;
+    if(p1->hasStatus && p1->status != p2->status)
+        return false;
+    if(p1->hasSourceTimestamp && p1->sourceTimestamp != p2->sourceTimestamp)
+        return false;
+    if(p1->hasServerTimestamp && p1->serverTimestamp != p2->serverTimestamp)
+        return false;
+    if(p1->hasSourcePicoseconds && p1->sourcePicoseconds != p2->sourcePicoseconds)
+        return false;
+    if(p1->hasServerPicoseconds && p1->serverPicoseconds != p2->serverPicoseconds)
+        return false;
+    if(p1->hasValue)
+        return Variant_equal(&p1->value, &p2->value, NULL);
+    return true;
+}
+
+static UA_Boolean
+DiagnosticInfo_equal(const UA_DiagnosticInfo *p1, const UA_DiagnosticInfo *p2,
+                     const UA_DataType *_) {
+    if(p1->hasSymbolicId != p2->hasSymbolicId ||
+       p1->hasNamespaceUri != p2->hasNamespaceUri ||
+       p1->hasLocalizedText != p2->hasLocalizedText ||
+       p1->hasLocale != p2->hasLocale ||
+       p1->hasAdditionalInfo != p2->hasAdditionalInfo ||
+       p1->hasInnerStatusCode != p2->hasInnerStatusCode ||
+       p1->hasInnerDiagnosticInfo != p2->hasInnerDiagnosticInfo)
+        return false;
+    if((p1->hasSymbolicId && p1->symbolicId != p2->symbolicId) ||
+       (p1->hasNamespaceUri && p1->namespaceUri != p2->namespaceUri) ||
+       (p1->hasLocalizedText && p1->localizedText != p2->localizedText) ||
+       (p1->hasLocale && p1->locale != p2->locale) ||
+       (p1->hasInnerStatusCode && p1->innerStatusCode != p2->innerStatusCode))
+        return false;
+    if(p1->hasAdditionalInfo &&
+       !String_equal(&p1->additionalInfo, &p2->additionalInfo, NULL))
+        return false;
+    if(p1->hasInnerDiagnosticInfo) {
+        if(!p1->innerDiagnosticInfo || !p2->innerDiagnosticInfo)
+            return (p1->innerDiagnosticInfo == p2->innerDiagnosticInfo);
+        return DiagnosticInfo_equal(p1->innerDiagnosticInfo,
+                                    p2->innerDiagnosticInfo, NULL);
+    }
+    return true;
+}
+
+static UA_Boolean
+equalStructure(const void *p1, const void *p2, const UA_DataType *type) {
+    uintptr_t ptr1 = (uintptr_t)p1;
+    uintptr_t ptr2 = (uintptr_t)p2;
+    const UA_DataType *typelists[2] = { UA_TYPES, &type[-type->typeIndex] };
+    for(size_t i = 0; i < type->membersSize; ++i) {
+        const UA_DataTypeMember *m = &type->members[i];
+        const UA_DataType *mt = &typelists[!m->namespaceZero][m->memberTypeIndex];
+        ptr1 += m->padding;
+        ptr2 += m->padding;
+        if(!m->isArray) {
+            if(!equalJumpTable[mt->typeKind]((const void*)ptr1, (const void*)ptr2, mt))
+                return false;
+            ptr1 += mt->memSize;
+            ptr2 += mt->memSize;
+        } else {
+            const size_t size1 = *((const size_t*)ptr1);
+            const size_t size2 = *((const size_t*)ptr2);
+            ptr1 += sizeof(size_t);
+            ptr2 += sizeof(size_t);
+            if(!arrayEqual(*(void* const*)ptr1, size1, *(void* const*)ptr2, size2, mt))
+                return false;
+            ptr1 += sizeof(void*);
+            ptr2 += sizeof(void*);
+        }
+    }
+    return true;
+}
+
+/* Values of types that cannot be compared are always considered different */
+static UA_Boolean
+equalNotImplemented(const void *p1, const void *p2, const UA_DataType *type) {
+    return false;
+}
+
+const UA_equalSignature equalJumpTable[UA_DATATYPEKINDS] = {
+    (UA_equalSignature)equalByte, /* Boolean */
+    (UA_equalSignature)equalByte, /* SByte */
+    (UA_equalSignature)equalByte, /* Byte */
+    (UA_equalSignature)equal2Byte, /* Int16 */
+    (UA_equalSignature)equal2Byte, /* UInt16 */
+    (UA_equalSignature)equal4Byte, /* Int32 */
+    (UA_equalSignature)equal4Byte, /* UInt32 */
+    (UA_equalSignature)equal8Byte, /* Int64 */
+    (UA_equalSignature)equal8Byte, /* UInt64 */
+    (UA_equalSignature)equal4Byte, /* Float */
+    (UA_equalSignature)equal8Byte, /* Double */
+    (UA_equalSignature)String_equal,
+    (UA_equalSignature)equal8Byte, /* DateTime */
+    (UA_equalSignature)equalGuid, /* Guid */
+    (UA_equalSignature)String_equal, /* ByteString */
+    (UA_equalSignature)String_equal, /* XmlElement */
+    (UA_equalSignature)NodeId_equal,
+    (UA_equalSignature)ExpandedNodeId_equal,
+    (UA_equalSignature)equal4Byte, /* StatusCode */
+    (UA_equalSignature)QualifiedName_equal,
+    (UA_equalSignature)LocalizedText_equal,
+    (UA_equalSignature)ExtensionObject_equal,
+    (UA_equalSignature)DataValue_equal,
+    (UA_equalSignature)Variant_equal,
+    (UA_equalSignature)DiagnosticInfo_equal,
+    (UA_equalSignature)equalNotImplemented, /* Decimal */
+    (UA_equalSignature)equal4Byte, /* Enumeration */
+    (UA_equalSignature)equalStructure,
+    (UA_equalSignature)equalNotImplemented, /* Structure with Optional Fields */
+    (UA_equalSignature)equalNotImplemented, /* Union */
+    (UA_equalSignature)equalNotImplemented /* BitfieldCluster*/
+};
+
+UA_Boolean
+UA_equal(const void *p1, const void *p2, const UA_DataType *type) {
+    if(p1 == p2)
+        return true;
+    return equalJumpTable[type->typeKind](p1, p2, type);
+}
+
 /******************/
 /* Array Handling */
 /******************/
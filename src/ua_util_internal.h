@@ -41,6 +41,10 @@ typedef UA_StatusCode status;
 /* Utility Functions
  * ----------------- */
 
+/* FNV non-cryptographic hash function over the bytes. The initial value allows
+ * to hash several buffers in sequence. */
+u32 UA_ByteString_hash(u32 initialHashValue, const u8 *data, size_t size);
+
 #ifdef UA_DEBUG_DUMP_PKGS
 void UA_EXPORT UA_dump_hex_pkg(UA_Byte* buffer, size_t bufferLen);
 #endif
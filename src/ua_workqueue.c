@@ -177,6 +177,87 @@ void UA_WorkQueue_enqueue(UA_WorkQueue *wq, UA_ApplicationCallback cb,
     pthread_cond_broadcast(&wq->dispatchQueue_condition);
 }
 
+/* A worker can start after all slices are taken and the caller has returned.
+ * Hence the refcount. */
+typedef struct {
+    UA_SliceCallback callback;
+    void *application;
+    void *data;
+    size_t slicesSize;
+    volatile UA_UInt32 nextSlice;
+    volatile UA_UInt32 refCount;
+    size_t slicesDone; /* Protected by the mutex */
+    pthread_mutex_t mutex;
+    pthread_cond_t done;
+} UA_SlicedJob;
+
+static void
+releaseSlicedJob(UA_SlicedJob *job) {
+    if(UA_atomic_subUInt32(&job->refCount, 1) > 0)
+        return;
+    pthread_cond_destroy(&job->done);
+    pthread_mutex_destroy(&job->mutex);
+    UA_free(job);
+}
+
+static void
+processSlicedJob(UA_SlicedJob *job) {
+    while(true) {
+        size_t slice = (size_t)UA_atomic_addUInt32(&job->nextSlice, 1) - 1;
+        if(slice >= job->slicesSize)
+            break;
+        job->callback(job->application, job->data, slice);
+        pthread_mutex_lock(&job->mutex);
+        job->slicesDone++;
+        if(job->slicesDone == job->slicesSize)
+            pthread_cond_signal(&job->done);
+        pthread_mutex_unlock(&job->mutex);
+    }
+}
+
+static void
+slicedJobWorkerCallback(void *application, UA_SlicedJob *job) {
+    processSlicedJob(job);
+    releaseSlicedJob(job);
+}
+
+void
+UA_WorkQueue_processSlices(UA_WorkQueue *wq, UA_SliceCallback cb,
+                           void *application, void *data, size_t slicesSize) {
+    size_t workers = wq->workersSize;
+    if(workers > 0 && slicesSize > 0 && workers > slicesSize - 1)
+        workers = slicesSize - 1;
+    UA_SlicedJob *job = NULL;
+    if(workers > 0 && slicesSize <= UA_UINT32_MAX)
+        job = (UA_SlicedJob*)UA_calloc(1, sizeof(UA_SlicedJob));
+
+    /* Process in the calling thread if there are no workers to help */
+    if(!job) {
+        for(size_t i = 0; i < slicesSize; i++)
+            cb(application, data, i);
+        return;
+    }
+
+    job->callback = cb;
+    job->application = application;
+    job->data = data;
+    job->slicesSize = slicesSize;
+    job->refCount = (UA_UInt32)workers + 1;
+    pthread_mutex_init(&job->mutex, NULL);
+    pthread_cond_init(&job->done, NULL);
+    for(size_t i = 0; i < workers; i++)
+        UA_WorkQueue_enqueue(wq, (UA_ApplicationCallback)slicedJobWorkerCallback,
+                             application, job);
+
+    /* Take part in the processing, then wait until all slices are done */
+    processSlicedJob(job);
+    pthread_mutex_lock(&job->mutex);
+    while(job->slicesDone < job->slicesSize)
+        pthread_cond_wait(&job->done, &job->mutex);
+    pthread_mutex_unlock(&job->mutex);
+    releaseSlicedJob(job);
+}
+
 #endif
 
 /*********************/
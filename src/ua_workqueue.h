@@ -115,6 +115,16 @@ void UA_WorkQueue_stop(UA_WorkQueue *wq);
 void UA_WorkQueue_enqueue(UA_WorkQueue *wq, UA_ApplicationCallback cb,
                           void *application, void *data);
 
+/* Callback for one slice of a job that is split up */
+typedef void (*UA_SliceCallback)(void *application, void *data, size_t slice);
+
+/* Call the callback for every slice in [0, slicesSize). The worker threads and
+ * the calling thread take slices until none are left. Returns when all slices
+ * are done. The calling thread does not wait for idle workers. So a busy work
+ * queue cannot stall the job. */
+void UA_WorkQueue_processSlices(UA_WorkQueue *wq, UA_SliceCallback cb,
+                                void *application, void *data, size_t slicesSize);
+
 #else
 
 /* Process all enqueued delayed work. This is not needed when workers are
@@ -4,11 +4,13 @@
 
 #include "ua_timer.h"
 #include "check.h"
+#include "testing_clock.h"
 
 #include <time.h>
 #include <stdio.h>
 
 #define N_EVENTS 10000
+#define N_CALLBACKS 1000000
 
 size_t count = 0;
 
@@ -57,10 +59,199 @@ START_TEST(benchmarkTimer) {
     UA_Timer_deleteMembers(&timer);
 } END_TEST
 
+/* Every callback counts its executions in the data pointer */
+static void
+countCallback(void *application, void *data) {
+    (*(size_t*)data)++;
+}
+
+static void
+process(UA_Timer *t) {
+    UA_DateTime now = UA_DateTime_nowMonotonic();
+    UA_DateTime next = UA_Timer_process(t, now, executionCallback, NULL);
+    ck_assert(next > now);
+}
+
+START_TEST(timerRepeated) {
+    UA_Timer timer;
+    UA_Timer_init(&timer);
+    size_t executions = 0;
+    UA_UInt64 id;
+    UA_StatusCode retval =
+        UA_Timer_addRepeatedCallback(&timer, countCallback, NULL, &executions, 100.0, &id);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+
+    process(&timer);
+    ck_assert_uint_eq(executions, 0);
+    UA_fakeSleep(100);
+    process(&timer);
+    ck_assert_uint_eq(executions, 1);
+    UA_fakeSleep(50);
+    process(&timer);
+    ck_assert_uint_eq(executions, 1);
+    UA_fakeSleep(50);
+    process(&timer);
+    ck_assert_uint_eq(executions, 2);
+
+    /* The new interval starts now */
+    retval = UA_Timer_changeRepeatedCallbackInterval(&timer, id, 200.0);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    UA_fakeSleep(100);
+    process(&timer);
+    ck_assert_uint_eq(executions, 2);
+    UA_fakeSleep(100);
+    process(&timer);
+    ck_assert_uint_eq(executions, 3);
+
+    UA_Timer_removeCallback(&timer, id);
+    UA_fakeSleep(1000);
+    process(&timer);
+    ck_assert_uint_eq(executions, 3);
+    retval = UA_Timer_changeRepeatedCallbackInterval(&timer, id, 200.0);
+    ck_assert_int_eq(retval, UA_STATUSCODE_BADNOTFOUND);
+    UA_Timer_deleteMembers(&timer);
+} END_TEST
+
+START_TEST(timerTimed) {
+    UA_Timer timer;
+    UA_Timer_init(&timer);
+    size_t executions = 0;
+    UA_DateTime date = UA_DateTime_nowMonotonic() + (10 * UA_DATETIME_MSEC);
+    UA_StatusCode retval =
+        UA_Timer_addTimedCallback(&timer, countCallback, NULL, &executions, date, NULL);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+
+    /* The next time is not later than the timed callback */
+    UA_DateTime next = UA_Timer_process(&timer, date - 1, executionCallback, NULL);
+    ck_assert_uint_eq(executions, 0);
+    ck_assert(next <= date);
+    next = UA_Timer_process(&timer, date, executionCallback, NULL);
+    ck_assert_uint_eq(executions, 1);
+    ck_assert(next == UA_INT64_MAX);
+    UA_Timer_process(&timer, date + UA_DATETIME_SEC, executionCallback, NULL);
+    ck_assert_uint_eq(executions, 1);
+    UA_Timer_deleteMembers(&timer);
+} END_TEST
+
+/* Callbacks with the same interval can remove each other */
+static UA_Timer removeTimer;
+static UA_UInt64 removeIds[2];
+static size_t removeExecutions[2];
+
+static void
+removeCallback(void *application, void *data) {
+    size_t i = (size_t)(uintptr_t)data;
+    removeExecutions[i]++;
+    UA_Timer_removeCallback(&removeTimer, removeIds[1 - i]);
+    if(removeExecutions[i] == 2)
+        UA_Timer_removeCallback(&removeTimer, removeIds[i]);
+}
+
+START_TEST(timerRemoveInCallback) {
+    UA_Timer_init(&removeTimer);
+    memset(removeExecutions, 0, sizeof(removeExecutions));
+    for(size_t i = 0; i < 2; i++) {
+        UA_StatusCode retval =
+            UA_Timer_addRepeatedCallback(&removeTimer, removeCallback, NULL,
+                                         (void*)(uintptr_t)i, 100.0, &removeIds[i]);
+        ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    for(size_t i = 0; i < 5; i++) {
+        UA_fakeSleep(100);
+        process(&removeTimer);
+    }
+    /* Only the first executed callback remains and removes itself */
+    ck_assert_uint_eq(removeExecutions[0] + removeExecutions[1], 2);
+    ck_assert(removeExecutions[0] == 0 || removeExecutions[1] == 0);
+    UA_Timer_deleteMembers(&removeTimer);
+} END_TEST
+
+START_TEST(timerSameInterval) {
+    UA_Timer timer;
+    UA_Timer_init(&timer);
+    size_t executions = 0;
+    for(size_t i = 0; i < 1000; i++) {
+        UA_StatusCode retval =
+            UA_Timer_addRepeatedCallback(&timer, countCallback, NULL, &executions, 250.0, NULL);
+        ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    for(size_t i = 1; i <= 4; i++) {
+        UA_fakeSleep(250);
+        process(&timer);
+        ck_assert_uint_eq(executions, 1000 * i);
+    }
+    UA_Timer_deleteMembers(&timer);
+} END_TEST
+
+START_TEST(timerFarFuture) {
+    UA_Timer timer;
+    UA_Timer_init(&timer);
+    size_t timedExecutions = 0;
+    size_t repeatedExecutions = 0;
+    UA_DateTime day = UA_DATETIME_SEC * 3600 * 24;
+    UA_DateTime start = UA_DateTime_nowMonotonic();
+    UA_StatusCode retval =
+        UA_Timer_addTimedCallback(&timer, countCallback, NULL, &timedExecutions,
+                                  start + (1000 * day), NULL);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    retval = UA_Timer_addRepeatedCallback(&timer, countCallback, NULL, &repeatedExecutions,
+                                          10.0 * 24 * 3600 * 1000, NULL);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_Timer_process(&timer, start + (5 * day), executionCallback, NULL);
+    ck_assert_uint_eq(repeatedExecutions, 0);
+    UA_Timer_process(&timer, start + (10 * day), executionCallback, NULL);
+    ck_assert_uint_eq(repeatedExecutions, 1);
+    UA_Timer_process(&timer, start + (25 * day), executionCallback, NULL);
+    ck_assert_uint_eq(repeatedExecutions, 2);
+    UA_Timer_process(&timer, start + (999 * day), executionCallback, NULL);
+    ck_assert_uint_eq(timedExecutions, 0);
+    UA_Timer_process(&timer, start + (1000 * day), executionCallback, NULL);
+    ck_assert_uint_eq(timedExecutions, 1);
+    UA_Timer_deleteMembers(&timer);
+} END_TEST
+
+/* Intervals between 100ms and 1s. Process every millisecond for one second. */
+START_TEST(benchmarkTimerMillion) {
+    UA_Timer timer;
+    UA_Timer_init(&timer);
+    count = 0;
+
+    clock_t begin = clock();
+    for(size_t i = 0; i < N_CALLBACKS; i++) {
+        UA_Double interval = 100.0 * (UA_Double)(1 + (i % 10));
+        UA_StatusCode retval =
+            UA_Timer_addRepeatedCallback(&timer, timerCallback, NULL, NULL, interval, NULL);
+        ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    clock_t added = clock();
+
+    UA_DateTime now = UA_DateTime_nowMonotonic();
+    for(size_t i = 0; i < 1000; i++) {
+        now += UA_DATETIME_MSEC;
+        UA_Timer_process(&timer, now, executionCallback, NULL);
+    }
+    clock_t finish = clock();
+
+    printf("adding %u callbacks took %f s\n", N_CALLBACKS,
+           (double)(added - begin) / CLOCKS_PER_SEC);
+    printf("processing %lu callbacks took %f s\n", (unsigned long)count,
+           (double)(finish - added) / CLOCKS_PER_SEC);
+    ck_assert_uint_eq(count, (N_CALLBACKS / 10) * (10 + 5 + 3 + 2 + 2 + 1 + 1 + 1 + 1 + 1));
+
+    UA_Timer_deleteMembers(&timer);
+} END_TEST
+
 int main(void) {
     Suite *s  = suite_create("Test Event Timer");
     TCase *tc = tcase_create("test cases");
+    tcase_add_test(tc, timerRepeated);
+    tcase_add_test(tc, timerTimed);
+    tcase_add_test(tc, timerRemoveInCallback);
+    tcase_add_test(tc, timerSameInterval);
+    tcase_add_test(tc, timerFarFuture);
     tcase_add_test(tc, benchmarkTimer);
+    tcase_add_test(tc, benchmarkTimerMillion);
     suite_add_tcase(s, tc);
 
     SRunner *sr = srunner_create(s);
@@ -1043,6 +1043,86 @@ START_TEST(UA_QualifiedName_equalShallWorkOnExample) {
 }
 END_TEST
 
+START_TEST(UA_DataValue_equalShallWorkOnExample) {
+    // given
+    UA_Double values[3] = {1.0, 2.0, 3.0};
+    UA_DataValue dv1;
+    UA_DataValue_init(&dv1);
+    UA_Variant_setArray(&dv1.value, values, 3, &UA_TYPES[UA_TYPES_DOUBLE]);
+    dv1.hasValue = true;
+    dv1.sourceTimestamp = 42;
+    UA_DataValue dv2;
+    UA_StatusCode retval = UA_DataValue_copy(&dv1, &dv2);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    // then
+    ck_assert(UA_equal(&dv1, &dv2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+
+    /* The source timestamp is only compared if it is set */
+    dv2.sourceTimestamp = 43;
+    ck_assert(UA_equal(&dv1, &dv2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    dv1.hasSourceTimestamp = true;
+    dv2.hasSourceTimestamp = true;
+    ck_assert(!UA_equal(&dv1, &dv2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    dv2.sourceTimestamp = 42;
+    ck_assert(UA_equal(&dv1, &dv2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+
+    ((UA_Double*)dv2.value.data)[2] = 4.0;
+    ck_assert(!UA_equal(&dv1, &dv2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    ((UA_Double*)dv2.value.data)[2] = 3.0;
+    dv2.value.arrayLength = 2;
+    ck_assert(!UA_equal(&dv1, &dv2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    dv2.value.arrayLength = 3;
+
+    /* A scalar is not an array with one element */
+    UA_Variant v1, v2;
+    UA_Variant_setScalar(&v1, values, &UA_TYPES[UA_TYPES_DOUBLE]);
+    UA_Variant_setArray(&v2, values, 1, &UA_TYPES[UA_TYPES_DOUBLE]);
+    ck_assert(!UA_equal(&v1, &v2, &UA_TYPES[UA_TYPES_VARIANT]));
+
+    // finally
+    UA_DataValue_deleteMembers(&dv2);
+}
+END_TEST
+
+START_TEST(UA_equalShallWorkOnStructures) {
+    // given
+    UA_String locales[2] = {UA_STRING_STATIC("en-US"), UA_STRING_STATIC("de-DE")};
+    UA_ReadRequest rr1;
+    UA_ReadRequest_init(&rr1);
+    rr1.maxAge = 100.0;
+    rr1.requestHeader.authenticationToken = UA_NODEID_STRING(1, "token");
+    rr1.requestHeader.auditEntryId = UA_STRING("audit");
+    UA_ReadRequest rr2;
+    UA_StatusCode retval = UA_ReadRequest_copy(&rr1, &rr2);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    // then
+    ck_assert(UA_equal(&rr1, &rr2, &UA_TYPES[UA_TYPES_READREQUEST]));
+    rr2.requestHeader.auditEntryId.data[0] = 'A';
+    ck_assert(!UA_equal(&rr1, &rr2, &UA_TYPES[UA_TYPES_READREQUEST]));
+
+    /* Empty strings and arrays differ from NULL */
+    UA_String s1 = UA_STRING_NULL;
+    UA_String s2 = {0, (UA_Byte*)UA_EMPTY_ARRAY_SENTINEL};
+    ck_assert(!UA_equal(&s1, &s2, &UA_TYPES[UA_TYPES_STRING]));
+
+    UA_ApplicationDescription ad1, ad2;
+    UA_ApplicationDescription_init(&ad1);
+    UA_ApplicationDescription_init(&ad2);
+    ad1.discoveryUrls = locales;
+    ad1.discoveryUrlsSize = 2;
+    ad2.discoveryUrls = locales;
+    ad2.discoveryUrlsSize = 1;
+    ck_assert(!UA_equal(&ad1, &ad2, &UA_TYPES[UA_TYPES_APPLICATIONDESCRIPTION]));
+    ad2.discoveryUrlsSize = 2;
+    ck_assert(UA_equal(&ad1, &ad2, &UA_TYPES[UA_TYPES_APPLICATIONDESCRIPTION]));
+
+    // finally
+    UA_ReadRequest_deleteMembers(&rr2);
+}
+END_TEST
+
 START_TEST(UA_ExtensionObject_copyShallWorkOnExample) {
     // given
     /* UA_Byte data[3] = { 1, 2, 3 }; */
@@ -1557,6 +1637,8 @@ static Suite *testSuite_builtin(void) {
 
     TCase *tc_equal = tcase_create("equal");
     tcase_add_test(tc_equal, UA_QualifiedName_equalShallWorkOnExample);
+    tcase_add_test(tc_equal, UA_DataValue_equalShallWorkOnExample);
+    tcase_add_test(tc_equal, UA_equalShallWorkOnStructures);
     suite_add_tcase(s, tc_equal);
 
     TCase *tc_copy = tcase_create("copy");
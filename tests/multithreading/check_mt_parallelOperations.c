@@ -0,0 +1,120 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+#include "server/ua_services.h"
+
+#include <check.h>
+
+#define NUMBER_OF_WORKERS 4
+#define NUMBER_OF_VARIABLES 2000
+
+static UA_Server *server;
+static volatile UA_UInt32 readCount;
+
+static UA_StatusCode
+readCallback(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+             const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+             const UA_NumericRange *range, UA_DataValue *value) {
+    UA_atomic_addUInt32(&readCount, 1);
+    UA_Int32 v = (UA_Int32)nodeId->identifier.numeric;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &v, &UA_TYPES[UA_TYPES_INT32]);
+}
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->nThreads = NUMBER_OF_WORKERS;
+    config->parallelOperationsThreshold = 100;
+
+    UA_DataSource ds;
+    ds.read = readCallback;
+    ds.write = NULL;
+    for(UA_UInt32 i = 0; i < NUMBER_OF_VARIABLES; i++) {
+        UA_VariableAttributes attr = UA_VariableAttributes_default;
+        UA_StatusCode retval =
+            UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, 10000 + i),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                                UA_QUALIFIEDNAME(1, "Variable"),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                                attr, ds, NULL, NULL);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    UA_Server_run_startup(server);
+    readCount = 0; /* The values are read when the nodes are added */
+}
+
+static void teardown(void) {
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static void
+readAll(size_t count) {
+    UA_ReadValueId *rvi = (UA_ReadValueId*)
+        UA_Array_new(count, &UA_TYPES[UA_TYPES_READVALUEID]);
+    for(size_t i = 0; i < count; i++) {
+        rvi[i].nodeId = UA_NODEID_NUMERIC(1, 10000 + (UA_UInt32)i);
+        rvi[i].attributeId = UA_ATTRIBUTEID_VALUE;
+    }
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.nodesToRead = rvi;
+    request.nodesToReadSize = count;
+    UA_ReadResponse response;
+    UA_ReadResponse_init(&response);
+
+    UA_LOCK(server->serviceMutex);
+    Service_Read(server, &server->adminSession, &request, &response);
+    UA_UNLOCK(server->serviceMutex);
+
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, count);
+    for(size_t i = 0; i < count; i++) {
+        ck_assert_uint_eq(response.results[i].status, UA_STATUSCODE_GOOD);
+        ck_assert_int_eq(*(UA_Int32*)response.results[i].value.data, 10000 + (UA_Int32)i);
+    }
+    ck_assert_uint_eq(readCount, count);
+
+    UA_ReadRequest_clear(&request);
+    UA_ReadResponse_clear(&response);
+}
+
+START_TEST(Parallel_read) {
+    readAll(NUMBER_OF_VARIABLES);
+} END_TEST
+
+START_TEST(Parallel_readBelowThreshold) {
+    readAll(50);
+} END_TEST
+
+START_TEST(Parallel_readOddSize) {
+    readAll(NUMBER_OF_VARIABLES - 7);
+} END_TEST
+
+static Suite *testSuite_parallelOperations(void) {
+    Suite *s = suite_create("Parallel Operations");
+    TCase *tc = tcase_create("Read");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, Parallel_read);
+    tcase_add_test(tc, Parallel_readBelowThreshold);
+    tcase_add_test(tc, Parallel_readOddSize);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_parallelOperations();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
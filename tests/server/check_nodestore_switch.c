@@ -0,0 +1,354 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+static UA_NodestoreInterface backend;
+static UA_UInt16 nsIndex;
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+    nsIndex = UA_Server_addNamespace(server, "urn:test:switch");
+    UA_StatusCode retval = UA_Nodestore_ZipTree(&backend);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    retval = UA_Server_setNamespaceNodestore(server, nsIndex, &backend);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static UA_StatusCode
+addVariable(UA_UInt16 ns, UA_UInt32 id) {
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    UA_Int32 value = (UA_Int32)id;
+    UA_Variant_setScalar(&attr.value, &value, &UA_TYPES[UA_TYPES_INT32]);
+    return UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(ns, id),
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                     UA_QUALIFIEDNAME(ns, "Variable"),
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                     attr, NULL, NULL);
+}
+
+static void
+countVisitor(void *visitorCtx, const UA_Node *node) {
+    if(node->nodeId.namespaceIndex == nsIndex)
+        (*(size_t*)visitorCtx)++;
+}
+
+START_TEST(Switch_routeByNamespace) {
+    ck_assert_uint_eq(addVariable(nsIndex, 1000), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addVariable(1, 1000), UA_STATUSCODE_GOOD);
+
+    /* The node was moved into the backend of its namespace */
+    UA_NodeId id = UA_NODEID_NUMERIC(nsIndex, 1000);
+    const UA_Node *node = backend.getNode(backend.context, &id);
+    ck_assert_ptr_ne(node, NULL);
+    backend.releaseNode(backend.context, node);
+    UA_NodeId other = UA_NODEID_NUMERIC(1, 1000);
+    ck_assert_ptr_eq(backend.getNode(backend.context, &other), NULL);
+
+    /* Services find the node through the switch */
+    UA_Variant value;
+    UA_StatusCode res = UA_Server_readValue(server, id, &value);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)value.data, 1000);
+    UA_Variant_clear(&value);
+
+    UA_Int32 newValue = 42;
+    UA_Variant_setScalar(&value, &newValue, &UA_TYPES[UA_TYPES_INT32]);
+    res = UA_Server_writeValue(server, id, value);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    res = UA_Server_readValue(server, id, &value);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)value.data, 42);
+    UA_Variant_clear(&value);
+
+    /* Iterating spans all backends */
+    size_t count = 0;
+    UA_Nodestore_iterate(server->nsCtx, countVisitor, &count);
+    ck_assert_uint_eq(count, 1);
+
+    res = UA_Server_deleteNode(server, id, true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_ptr_eq(backend.getNode(backend.context, &id), NULL);
+} END_TEST
+
+START_TEST(Switch_duplicateNodeId) {
+    ck_assert_uint_eq(addVariable(nsIndex, 1000), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addVariable(nsIndex, 1000), UA_STATUSCODE_BADNODEIDEXISTS);
+} END_TEST
+
+START_TEST(Switch_sharedBackend) {
+    /* The same backend serves a second namespace */
+    UA_UInt16 ns2 = UA_Server_addNamespace(server, "urn:test:switch2");
+    UA_StatusCode res = UA_Server_setNamespaceNodestore(server, ns2, &backend);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addVariable(ns2, 1000), UA_STATUSCODE_GOOD);
+    UA_NodeId id = UA_NODEID_NUMERIC(ns2, 1000);
+    const UA_Node *node = backend.getNode(backend.context, &id);
+    ck_assert_ptr_ne(node, NULL);
+    backend.releaseNode(backend.context, node);
+
+    /* Iterating visits the shared backend only once */
+    ck_assert_uint_eq(addVariable(nsIndex, 1000), UA_STATUSCODE_GOOD);
+    size_t count = 0;
+    UA_Nodestore_iterate(server->nsCtx, countVisitor, &count);
+    ck_assert_uint_eq(count, 1);
+
+    /* Resetting one namespace keeps the backend alive for the other */
+    res = UA_Server_setNamespaceNodestore(server, nsIndex, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    node = backend.getNode(backend.context, &id);
+    ck_assert_ptr_ne(node, NULL);
+    backend.releaseNode(backend.context, node);
+} END_TEST
+
+START_TEST(Switch_failedSwapKeepsCaches) {
+    /* Build the type hierarchy cache */
+    UA_NodeId folderType = UA_NODEID_NUMERIC(0, UA_NS0ID_FOLDERTYPE);
+    UA_NodeId baseType = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE);
+    UA_NodeId hasSubtype = UA_NODEID_NUMERIC(0, UA_NS0ID_HASSUBTYPE);
+    UA_LOCK(server->serviceMutex);
+    ck_assert(isNodeInTree(server, &folderType, &baseType, &hasSubtype, 1));
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert(server->typeHierarchy.valid);
+
+    /* An incomplete backend is rejected without touching the caches */
+    UA_NodestoreInterface incomplete = backend;
+    incomplete.iterate = NULL;
+    UA_StatusCode res = UA_Server_setNamespaceNodestore(server, nsIndex, &incomplete);
+    ck_assert_uint_eq(res, UA_STATUSCODE_BADINVALIDARGUMENT);
+    ck_assert(server->typeHierarchy.valid);
+
+    /* A successful swap drops the caches */
+    res = UA_Server_setNamespaceNodestore(server, nsIndex, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert(!server->typeHierarchy.valid);
+} END_TEST
+
+/* A second backend implementation that checks that it frees, inserts and
+ * replaces only the editable nodes it handed out itself */
+typedef struct {
+    UA_NodestoreInterface inner;
+    size_t nodesSize;
+    const UA_Node *nodes[64];
+    size_t foreign;
+} CheckedStore;
+
+static CheckedStore checked;
+
+static void
+checkedTrack(CheckedStore *cs, const UA_Node *node) {
+    ck_assert_uint_lt(cs->nodesSize, 64);
+    cs->nodes[cs->nodesSize++] = node;
+}
+
+static void
+checkedUntrack(CheckedStore *cs, const UA_Node *node) {
+    for(size_t i = 0; i < cs->nodesSize; i++) {
+        if(cs->nodes[i] != node)
+            continue;
+        cs->nodes[i] = cs->nodes[--cs->nodesSize];
+        return;
+    }
+    cs->foreign++;
+}
+
+static void
+checkedClear(void *nsCtx) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    cs->inner.clear(cs->inner.context);
+}
+
+static UA_Node *
+checkedNewNode(void *nsCtx, UA_NodeClass nodeClass) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    UA_Node *node = cs->inner.newNode(cs->inner.context, nodeClass);
+    if(node)
+        checkedTrack(cs, node);
+    return node;
+}
+
+static void
+checkedDeleteNode(void *nsCtx, UA_Node *node) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    checkedUntrack(cs, node);
+    cs->inner.deleteNode(cs->inner.context, node);
+}
+
+static const UA_Node *
+checkedGetNode(void *nsCtx, const UA_NodeId *nodeId) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    return cs->inner.getNode(cs->inner.context, nodeId);
+}
+
+static void
+checkedReleaseNode(void *nsCtx, const UA_Node *node) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    cs->inner.releaseNode(cs->inner.context, node);
+}
+
+static UA_StatusCode
+checkedGetNodeCopy(void *nsCtx, const UA_NodeId *nodeId, UA_Node **outNode) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    UA_StatusCode res = cs->inner.getNodeCopy(cs->inner.context, nodeId, outNode);
+    if(res == UA_STATUSCODE_GOOD)
+        checkedTrack(cs, *outNode);
+    return res;
+}
+
+static UA_StatusCode
+checkedInsertNode(void *nsCtx, UA_Node *node, UA_NodeId *addedNodeId) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    checkedUntrack(cs, node);
+    return cs->inner.insertNode(cs->inner.context, node, addedNodeId);
+}
+
+static UA_StatusCode
+checkedReplaceNode(void *nsCtx, UA_Node *node) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    checkedUntrack(cs, node);
+    return cs->inner.replaceNode(cs->inner.context, node);
+}
+
+static UA_StatusCode
+checkedRemoveNode(void *nsCtx, const UA_NodeId *nodeId) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    return cs->inner.removeNode(cs->inner.context, nodeId);
+}
+
+static void
+checkedIterate(void *nsCtx, UA_NodestoreVisitor visitor, void *visitorCtx) {
+    CheckedStore *cs = (CheckedStore*)nsCtx;
+    cs->inner.iterate(cs->inner.context, visitor, visitorCtx);
+}
+
+static UA_UInt16
+addCheckedNamespace(void) {
+    memset(&checked, 0, sizeof(CheckedStore));
+    ck_assert_uint_eq(UA_Nodestore_ZipTree(&checked.inner), UA_STATUSCODE_GOOD);
+    UA_NodestoreInterface ns;
+    ns.context = &checked;
+    ns.clear = checkedClear;
+    ns.newNode = checkedNewNode;
+    ns.deleteNode = checkedDeleteNode;
+    ns.getNode = checkedGetNode;
+    ns.releaseNode = checkedReleaseNode;
+    ns.getNodeCopy = checkedGetNodeCopy;
+    ns.insertNode = checkedInsertNode;
+    ns.replaceNode = checkedReplaceNode;
+    ns.removeNode = checkedRemoveNode;
+    ns.iterate = checkedIterate;
+    UA_UInt16 checkedNs = UA_Server_addNamespace(server, "urn:test:checked");
+    UA_StatusCode res = UA_Server_setNamespaceNodestore(server, checkedNs, &ns);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    return checkedNs;
+}
+
+START_TEST(Switch_copyAcrossBackends) {
+    UA_UInt16 checkedNs = addCheckedNamespace();
+
+    /* A copy from the checked backend is deleted there after the NodeId was
+     * changed to another namespace */
+    ck_assert_uint_eq(addVariable(checkedNs, 1000), UA_STATUSCODE_GOOD);
+    UA_NodeId id = UA_NODEID_NUMERIC(checkedNs, 1000);
+    UA_Node *copy = NULL;
+    UA_StatusCode res = UA_Nodestore_getNodeCopy(server->nsCtx, &id, &copy);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    copy->nodeId.namespaceIndex = nsIndex;
+    UA_Nodestore_deleteNode(server->nsCtx, copy);
+    ck_assert_uint_eq(checked.nodesSize, 0);
+    ck_assert_uint_eq(checked.foreign, 0);
+
+    /* A copy from the checked backend is moved into the other backend */
+    res = UA_Nodestore_getNodeCopy(server->nsCtx, &id, &copy);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    copy->nodeId = UA_NODEID_NUMERIC(nsIndex, 1001);
+    res = UA_Nodestore_insertNode(server->nsCtx, copy, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(checked.nodesSize, 0);
+    ck_assert_uint_eq(checked.foreign, 0);
+    UA_NodeId movedId = UA_NODEID_NUMERIC(nsIndex, 1001);
+    const UA_Node *node = backend.getNode(backend.context, &movedId);
+    ck_assert_ptr_ne(node, NULL);
+    backend.releaseNode(backend.context, node);
+
+    /* Instantiate a type from the checked backend in the other backend. The
+     * mandatory child is copied across. */
+    UA_ObjectTypeAttributes tattr = UA_ObjectTypeAttributes_default;
+    res = UA_Server_addObjectTypeNode(server, UA_NODEID_NUMERIC(checkedNs, 2000),
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_HASSUBTYPE),
+                                      UA_QUALIFIEDNAME(checkedNs, "CheckedType"),
+                                      tattr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    UA_VariableAttributes vattr = UA_VariableAttributes_default;
+    res = UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(checkedNs, 2001),
+                                    UA_NODEID_NUMERIC(checkedNs, 2000),
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT),
+                                    UA_QUALIFIEDNAME(checkedNs, "Child"),
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                    vattr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    res = UA_Server_addReference(server, UA_NODEID_NUMERIC(checkedNs, 2001),
+                                 UA_NODEID_NUMERIC(0, UA_NS0ID_HASMODELLINGRULE),
+                                 UA_EXPANDEDNODEID_NUMERIC(0, UA_NS0ID_MODELLINGRULE_MANDATORY),
+                                 true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+
+    UA_ObjectAttributes oattr = UA_ObjectAttributes_default;
+    res = UA_Server_addObjectNode(server, UA_NODEID_NUMERIC(nsIndex, 3000),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                  UA_QUALIFIEDNAME(nsIndex, "Instance"),
+                                  UA_NODEID_NUMERIC(checkedNs, 2000),
+                                  oattr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(checked.nodesSize, 0);
+    ck_assert_uint_eq(checked.foreign, 0);
+
+    /* The child was instantiated in the other backend */
+    UA_QualifiedName childName = UA_QUALIFIEDNAME(checkedNs, "Child");
+    UA_BrowsePathResult bpr =
+        UA_Server_browseSimplifiedBrowsePath(server, UA_NODEID_NUMERIC(nsIndex, 3000),
+                                             1, &childName);
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(bpr.targetsSize, 1);
+    node = backend.getNode(backend.context, &bpr.targets[0].targetId.nodeId);
+    ck_assert_ptr_ne(node, NULL);
+    backend.releaseNode(backend.context, node);
+    UA_BrowsePathResult_clear(&bpr);
+} END_TEST
+
+static Suite *testSuite_NodestoreSwitch(void) {
+    Suite *s = suite_create("Nodestore Switch");
+    TCase *tc = tcase_create("Switch");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, Switch_routeByNamespace);
+    tcase_add_test(tc, Switch_duplicateNodeId);
+    tcase_add_test(tc, Switch_sharedBackend);
+    tcase_add_test(tc, Switch_copyAcrossBackends);
+    tcase_add_test(tc, Switch_failedSwapKeepsCaches);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_NodestoreSwitch();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
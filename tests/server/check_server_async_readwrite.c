@@ -0,0 +1,275 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client.h>
+#include <open62541/client_config_default.h>
+#include <open62541/client_highlevel.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "thread_wrapper.h"
+
+#define ASYNC_VARIABLE 50000
+#define SYNC_VARIABLE 50001
+#define LOCKED_VARIABLE 50002
+
+static UA_Server *server;
+static UA_Boolean running;
+static THREAD_HANDLE server_thread;
+static UA_Boolean answerOperations;
+static size_t asyncReads;
+static size_t asyncWrites;
+static size_t dataSourceReads;
+static UA_Int32 deviceValue;
+
+static UA_StatusCode
+readDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    dataSourceReads++;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &deviceValue, &UA_TYPES[UA_TYPES_INT32]);
+}
+
+/* Answers the queued operations in the server thread */
+static void
+processAsyncOperations(void) {
+    UA_AsyncOperationType type;
+    const UA_AsyncOperationRequest *request = NULL;
+    void *context = NULL;
+    while(UA_Server_getAsyncOperation(server, &type, &request, &context)) {
+        UA_AsyncOperationResponse response;
+        memset(&response, 0, sizeof(UA_AsyncOperationResponse));
+        if(type == UA_ASYNCOPERATIONTYPE_READ) {
+            ck_assert_uint_eq(request->readValueId.nodeId.identifier.numeric,
+                              ASYNC_VARIABLE);
+            asyncReads++;
+            response.readResult.hasValue = true;
+            response.readResult.hasSourceTimestamp = true;
+            response.readResult.sourceTimestamp = UA_DateTime_now();
+            UA_Variant_setScalar(&response.readResult.value, &deviceValue,
+                                 &UA_TYPES[UA_TYPES_INT32]);
+        } else {
+            ck_assert_uint_eq(type, UA_ASYNCOPERATIONTYPE_WRITE);
+            asyncWrites++;
+            deviceValue = *(UA_Int32*)request->writeValue.value.value.data;
+            response.writeResult = UA_STATUSCODE_GOOD;
+        }
+        UA_Server_setAsyncOperationResult(server, &response, context);
+    }
+    /* Send the responses without waiting for the repeated callback */
+    UA_Server_CallMethodResponse(server, NULL);
+}
+
+THREAD_CALLBACK(serverloop) {
+    while(running) {
+        UA_Server_run_iterate(server, true);
+        if(answerOperations)
+            processAsyncOperations();
+    }
+    return 0;
+}
+
+static void
+addDevice(UA_UInt32 id, UA_Byte accessLevel) {
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = NULL;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = accessLevel;
+    UA_StatusCode retval =
+        UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, id),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                            UA_QUALIFIEDNAME(1, "Device"),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                            attr, ds, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void setup(void) {
+    running = true;
+    answerOperations = true;
+    asyncReads = 0;
+    asyncWrites = 0;
+    dataSourceReads = 0;
+    deviceValue = 42;
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+
+    addDevice(ASYNC_VARIABLE, UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE);
+    addDevice(SYNC_VARIABLE, UA_ACCESSLEVELMASK_READ);
+    addDevice(LOCKED_VARIABLE, 0);
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeAsync(server, UA_NODEID_NUMERIC(1, ASYNC_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    retval = UA_Server_setVariableNodeAsync(server, UA_NODEID_NUMERIC(1, LOCKED_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    dataSourceReads = 0; /* The DataSources are read when the nodes are added */
+
+    UA_Server_run_startup(server);
+    THREAD_CREATE(server_thread, serverloop);
+}
+
+static void teardown(void) {
+    running = false;
+    THREAD_JOIN(server_thread);
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static UA_Client *
+connectClient(void) {
+    UA_Client *client = UA_Client_new();
+    UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    return client;
+}
+
+START_TEST(Async_setVariableNodeAsync) {
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeAsync(server, UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNODECLASSINVALID);
+} END_TEST
+
+START_TEST(Async_read) {
+    UA_Client *client = connectClient();
+
+    UA_ReadValueId rvi[3];
+    for(size_t i = 0; i < 3; i++) {
+        UA_ReadValueId_init(&rvi[i]);
+        rvi[i].attributeId = UA_ATTRIBUTEID_VALUE;
+    }
+    rvi[0].nodeId = UA_NODEID_NUMERIC(1, ASYNC_VARIABLE);
+    rvi[1].nodeId = UA_NODEID_NUMERIC(1, SYNC_VARIABLE);
+    rvi[2].nodeId = UA_NODEID_NUMERIC(1, ASYNC_VARIABLE);
+    rvi[2].attributeId = UA_ATTRIBUTEID_DISPLAYNAME;
+
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.nodesToRead = rvi;
+    request.nodesToReadSize = 3;
+    UA_ReadResponse response = UA_Client_Service_read(client, request);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 3);
+    for(size_t i = 0; i < 3; i++)
+        ck_assert(!response.results[i].hasStatus);
+    ck_assert_int_eq(*(UA_Int32*)response.results[0].value.data, 42);
+    ck_assert_int_eq(*(UA_Int32*)response.results[1].value.data, 42);
+    ck_assert(response.results[2].value.type == &UA_TYPES[UA_TYPES_LOCALIZEDTEXT]);
+    UA_ReadResponse_clear(&response);
+
+    /* Only the value of the async variable was queued */
+    ck_assert_uint_eq(asyncReads, 1);
+    ck_assert_uint_eq(dataSourceReads, 1);
+
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+} END_TEST
+
+static UA_DataValue
+readAsyncWithTimestamps(UA_Client *client, UA_TimestampsToReturn timestamps) {
+    UA_ReadValueId rvi;
+    UA_ReadValueId_init(&rvi);
+    rvi.nodeId = UA_NODEID_NUMERIC(1, ASYNC_VARIABLE);
+    rvi.attributeId = UA_ATTRIBUTEID_VALUE;
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.nodesToRead = &rvi;
+    request.nodesToReadSize = 1;
+    request.timestampsToReturn = timestamps;
+    UA_ReadResponse response = UA_Client_Service_read(client, request);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 1);
+    UA_DataValue result = response.results[0];
+    UA_DataValue_init(&response.results[0]);
+    UA_ReadResponse_clear(&response);
+    return result;
+}
+
+/* The timestamps of queued reads are set as for synchronous reads */
+START_TEST(Async_readTimestamps) {
+    UA_Client *client = connectClient();
+
+    UA_DataValue result = readAsyncWithTimestamps(client, UA_TIMESTAMPSTORETURN_NEITHER);
+    ck_assert(result.hasValue);
+    ck_assert(!result.hasSourceTimestamp);
+    ck_assert(!result.hasServerTimestamp);
+    UA_DataValue_clear(&result);
+
+    result = readAsyncWithTimestamps(client, UA_TIMESTAMPSTORETURN_SERVER);
+    ck_assert(!result.hasSourceTimestamp);
+    ck_assert(result.hasServerTimestamp);
+    UA_DataValue_clear(&result);
+
+    result = readAsyncWithTimestamps(client, UA_TIMESTAMPSTORETURN_BOTH);
+    ck_assert(result.hasSourceTimestamp);
+    ck_assert(result.hasServerTimestamp);
+    UA_DataValue_clear(&result);
+    ck_assert_uint_eq(asyncReads, 3);
+
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+} END_TEST
+
+START_TEST(Async_readNotReadable) {
+    UA_Client *client = connectClient();
+    UA_Variant value;
+    UA_Variant_init(&value);
+    UA_StatusCode retval =
+        UA_Client_readValueAttribute(client, UA_NODEID_NUMERIC(1, LOCKED_VARIABLE), &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNOTREADABLE);
+    ck_assert_uint_eq(asyncReads, 0);
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+} END_TEST
+
+START_TEST(Async_write) {
+    UA_Client *client = connectClient();
+    UA_Int32 v = 7;
+    UA_Variant value;
+    UA_Variant_setScalar(&value, &v, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval =
+        UA_Client_writeValueAttribute(client, UA_NODEID_NUMERIC(1, ASYNC_VARIABLE), &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(asyncWrites, 1);
+    ck_assert_int_eq(deviceValue, 7);
+
+    /* Not writable, answered right away */
+    retval = UA_Client_writeValueAttribute(client, UA_NODEID_NUMERIC(1, SYNC_VARIABLE), &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNOTWRITABLE);
+    ck_assert_uint_eq(asyncWrites, 1);
+
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+} END_TEST
+
+static Suite *testSuite_asyncReadWrite(void) {
+    Suite *s = suite_create("Async Read/Write");
+    TCase *tc = tcase_create("Async Variables");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, Async_setVariableNodeAsync);
+    tcase_add_test(tc, Async_read);
+    tcase_add_test(tc, Async_readTimestamps);
+    tcase_add_test(tc, Async_readNotReadable);
+    tcase_add_test(tc, Async_write);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_asyncReadWrite();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
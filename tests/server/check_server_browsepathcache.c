@@ -0,0 +1,240 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+#include "server/ua_services.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+
+static void
+addObject(UA_UInt32 id, UA_UInt32 parentId, char *name) {
+    UA_ObjectAttributes attr = UA_ObjectAttributes_default;
+    UA_StatusCode retval =
+        UA_Server_addObjectNode(server, UA_NODEID_NUMERIC(1, id),
+                                UA_NODEID_NUMERIC(parentId == 0 ? 0 : 1, parentId == 0 ?
+                                                  UA_NS0ID_OBJECTSFOLDER : parentId),
+                                UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT),
+                                UA_QUALIFIEDNAME(1, name),
+                                UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                attr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->browsePathCacheSize = 2;
+    addObject(50000, 0, "Line");
+    addObject(50001, 50000, "Robot");
+    addObject(50002, 50001, "Axis");
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static UA_BrowsePathResult
+browseAxis(const char *robotName) {
+    UA_QualifiedName path[3];
+    path[0] = UA_QUALIFIEDNAME(1, "Line");
+    path[1] = UA_QUALIFIEDNAME(1, (char*)(uintptr_t)robotName);
+    path[2] = UA_QUALIFIEDNAME(1, "Axis");
+    return UA_Server_browseSimplifiedBrowsePath(server,
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                                3, path);
+}
+
+static void
+checkAxis(UA_UInt32 expectedId) {
+    UA_BrowsePathResult bpr = browseAxis("Robot");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(bpr.targetsSize, 1);
+    ck_assert_uint_eq(bpr.targets[0].targetId.nodeId.identifier.numeric, expectedId);
+    UA_BrowsePathResult_clear(&bpr);
+}
+
+static UA_BrowsePathCacheStatistics
+getStatistics(void) {
+    UA_BrowsePathCacheStatistics stats;
+    UA_Server_getBrowsePathCacheStatistics(server, &stats);
+    return stats;
+}
+
+START_TEST(BrowsePathCache_hit) {
+    checkAxis(50002);
+    checkAxis(50002);
+    UA_BrowsePathCacheStatistics stats = getStatistics();
+    ck_assert_uint_eq(stats.hits, 1);
+    ck_assert_uint_eq(stats.misses, 1);
+    ck_assert_uint_eq(stats.entries, 1);
+} END_TEST
+
+START_TEST(BrowsePathCache_noMatch) {
+    UA_BrowsePathResult bpr = browseAxis("Unknown");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_BADNOMATCH);
+    UA_BrowsePathResult_clear(&bpr);
+    bpr = browseAxis("Unknown");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_BADNOMATCH);
+    ck_assert_uint_eq(bpr.targetsSize, 0);
+    UA_BrowsePathResult_clear(&bpr);
+    ck_assert_uint_eq(getStatistics().hits, 1);
+
+    /* The new node is found */
+    addObject(50003, 50000, "Unknown");
+    addObject(50004, 50003, "Axis");
+    bpr = browseAxis("Unknown");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(bpr.targetsSize, 1);
+    ck_assert_uint_eq(bpr.targets[0].targetId.nodeId.identifier.numeric, 50004);
+    UA_BrowsePathResult_clear(&bpr);
+} END_TEST
+
+START_TEST(BrowsePathCache_deleteNode) {
+    checkAxis(50002);
+    UA_StatusCode retval = UA_Server_deleteNode(server, UA_NODEID_NUMERIC(1, 50002), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(getStatistics().entries, 0);
+    addObject(50005, 50001, "Axis");
+    checkAxis(50005);
+} END_TEST
+
+START_TEST(BrowsePathCache_references) {
+    checkAxis(50002);
+
+    /* Move the axis to another robot */
+    addObject(50006, 50000, "Robot2");
+    UA_StatusCode retval =
+        UA_Server_deleteReference(server, UA_NODEID_NUMERIC(1, 50001),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT), true,
+                                  UA_EXPANDEDNODEID_NUMERIC(1, 50002), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_BrowsePathResult bpr = browseAxis("Robot");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_BADNOMATCH);
+    UA_BrowsePathResult_clear(&bpr);
+
+    retval = UA_Server_addReference(server, UA_NODEID_NUMERIC(1, 50006),
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT),
+                                    UA_EXPANDEDNODEID_NUMERIC(1, 50002), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    bpr = browseAxis("Robot2");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(bpr.targetsSize, 1);
+    UA_BrowsePathResult_clear(&bpr);
+} END_TEST
+
+START_TEST(BrowsePathCache_browseName) {
+    checkAxis(50002);
+    UA_StatusCode retval =
+        UA_Server_writeBrowseName(server, UA_NODEID_NUMERIC(1, 50002),
+                                  UA_QUALIFIEDNAME(1, "Axis2"));
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_BrowsePathResult bpr = browseAxis("Robot");
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_BADNOMATCH);
+    UA_BrowsePathResult_clear(&bpr);
+} END_TEST
+
+START_TEST(BrowsePathCache_unrelatedChange) {
+    addObject(50007, 0, "Other");
+    checkAxis(50002);
+    /* Other is not evaluated for the path. Only its browse name is compared. */
+    addObject(50008, 50007, "Child");
+    ck_assert_uint_eq(getStatistics().entries, 1);
+    checkAxis(50002);
+    ck_assert_uint_eq(getStatistics().hits, 1);
+} END_TEST
+
+START_TEST(BrowsePathCache_evict) {
+    checkAxis(50002);
+    UA_BrowsePathResult bpr = browseAxis("Robot2");
+    UA_BrowsePathResult_clear(&bpr);
+    bpr = browseAxis("Robot3");
+    UA_BrowsePathResult_clear(&bpr);
+    ck_assert_uint_eq(getStatistics().entries, 2);
+
+    /* The least recently used path was evicted */
+    checkAxis(50002);
+    ck_assert_uint_eq(getStatistics().hits, 0);
+} END_TEST
+
+START_TEST(BrowsePathCache_service) {
+    UA_RelativePathElement rpe;
+    UA_RelativePathElement_init(&rpe);
+    rpe.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HIERARCHICALREFERENCES);
+    rpe.includeSubtypes = true;
+    rpe.targetName = UA_QUALIFIEDNAME(1, "Robot");
+    UA_BrowsePath bp;
+    UA_BrowsePath_init(&bp);
+    bp.startingNode = UA_NODEID_NUMERIC(1, 50000);
+    bp.relativePath.elements = &rpe;
+    bp.relativePath.elementsSize = 1;
+
+    UA_TranslateBrowsePathsToNodeIdsRequest request;
+    UA_TranslateBrowsePathsToNodeIdsRequest_init(&request);
+    request.browsePaths = &bp;
+    request.browsePathsSize = 1;
+    for(size_t i = 0; i < 2; i++) {
+        UA_TranslateBrowsePathsToNodeIdsResponse response;
+        UA_TranslateBrowsePathsToNodeIdsResponse_init(&response);
+        UA_LOCK(server->serviceMutex);
+        Service_TranslateBrowsePathsToNodeIds(server, &server->adminSession,
+                                              &request, &response);
+        UA_UNLOCK(server->serviceMutex);
+        ck_assert_uint_eq(response.resultsSize, 1);
+        ck_assert_uint_eq(response.results[0].statusCode, UA_STATUSCODE_GOOD);
+        ck_assert_uint_eq(response.results[0].targetsSize, 1);
+        ck_assert_uint_eq(response.results[0].targets[0].targetId.nodeId.identifier.numeric,
+                          50001);
+        UA_TranslateBrowsePathsToNodeIdsResponse_clear(&response);
+    }
+    ck_assert_uint_eq(getStatistics().hits, 1);
+
+    /* The NodeClass mask of the simplified browse path is part of the key */
+    UA_QualifiedName name = UA_QUALIFIEDNAME(1, "Robot");
+    UA_BrowsePathResult bpr =
+        UA_Server_browseSimplifiedBrowsePath(server, UA_NODEID_NUMERIC(1, 50000), 1, &name);
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_GOOD);
+    UA_BrowsePathResult_clear(&bpr);
+    ck_assert_uint_eq(getStatistics().hits, 1);
+} END_TEST
+
+START_TEST(BrowsePathCache_disabled) {
+    UA_Server_getConfig(server)->browsePathCacheSize = 0;
+    checkAxis(50002);
+    checkAxis(50002);
+    UA_BrowsePathCacheStatistics stats = getStatistics();
+    ck_assert_uint_eq(stats.hits, 0);
+    ck_assert_uint_eq(stats.entries, 0);
+} END_TEST
+
+static Suite *testSuite_BrowsePathCache(void) {
+    Suite *s = suite_create("BrowsePath Cache");
+    TCase *tc = tcase_create("TranslateBrowsePath");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, BrowsePathCache_hit);
+    tcase_add_test(tc, BrowsePathCache_noMatch);
+    tcase_add_test(tc, BrowsePathCache_deleteNode);
+    tcase_add_test(tc, BrowsePathCache_references);
+    tcase_add_test(tc, BrowsePathCache_browseName);
+    tcase_add_test(tc, BrowsePathCache_unrelatedChange);
+    tcase_add_test(tc, BrowsePathCache_evict);
+    tcase_add_test(tc, BrowsePathCache_service);
+    tcase_add_test(tc, BrowsePathCache_disabled);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_BrowsePathCache();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <time.h>
 
+#include "testing_clock.h"
 #include "testing_networklayers.h"
 #include "testing_policy.h"
 
@@ -100,12 +101,130 @@ START_TEST(monitorIntegerNoChanges) {
 }
 END_TEST
 
+START_TEST(monitorDoubleArrayNoChanges) {
+    /* add a variable node with an array value that is too large for the stack
+     * buffer of the change detection */
+    UA_Double values[256];
+    for(size_t i = 0; i < 256; i++)
+        values[i] = (UA_Double)i;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    UA_Variant_setArray(&attr.value, values, 256, &UA_TYPES[UA_TYPES_DOUBLE]);
+    attr.dataType = UA_TYPES[UA_TYPES_DOUBLE].typeId;
+    attr.displayName = UA_LOCALIZEDTEXT("en-US","the array");
+    UA_NodeId myArrayNodeId = UA_NODEID_STRING(1, "the.array");
+    UA_StatusCode retval =
+        UA_Server_addVariableNode(server, myArrayNodeId,
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                  UA_QUALIFIEDNAME(1, "the array"),
+                                  UA_NODEID_NULL, attr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_MonitoredItemCreateRequest item;
+    UA_MonitoredItemCreateRequest_init(&item);
+    item.itemToMonitor.nodeId = myArrayNodeId;
+    item.itemToMonitor.attributeId = UA_ATTRIBUTEID_VALUE;
+    item.monitoringMode = UA_MONITORINGMODE_REPORTING;
+    UA_Server_createDataChangeMonitoredItem(server, UA_TIMESTAMPSTORETURN_NEITHER,
+                                            item, NULL, dataChangeNotificationCallback);
+
+    callbackCount = 0;
+
+    UA_MonitoredItem *mon = LIST_FIRST(&server->localMonitoredItems);
+
+    clock_t begin, finish;
+    begin = clock();
+
+    for(int i = 0; i < 100000; i++) {
+        UA_MonitoredItem_sampleCallback(server, mon);
+    }
+
+    finish = clock();
+
+    double time_spent = (double)(finish - begin) / CLOCKS_PER_SEC;
+    printf("duration was %f s\n", time_spent);
+
+    UA_assert(callbackCount == 0);
+}
+END_TEST
+
+#define MANY_NODES 1000
+#define MANY_NODES_CYCLES 1000
+
+static void
+executeTimerCallback(void *executionApplication, UA_ApplicationCallback cb,
+                     void *callbackApplication, void *data) {
+    cb(callbackApplication, data);
+}
+
+/* Monitor many nodes with the same sampling interval and process the timer of
+ * the server */
+static void
+monitorManyNodes(UA_Boolean samplingGroups) {
+    UA_Server_getConfig(server)->samplingGroups = samplingGroups;
+
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    UA_Int32 myInteger = 42;
+    UA_Variant_setScalar(&attr.value, &myInteger, &UA_TYPES[UA_TYPES_INT32]);
+    UA_MonitoredItemCreateRequest item;
+    UA_MonitoredItemCreateRequest_init(&item);
+    item.itemToMonitor.attributeId = UA_ATTRIBUTEID_VALUE;
+    item.monitoringMode = UA_MONITORINGMODE_REPORTING;
+    item.requestedParameters.samplingInterval = 100.0;
+    for(UA_UInt32 i = 0; i < MANY_NODES; i++) {
+        UA_NodeId nodeId = UA_NODEID_NUMERIC(1, 50000 + i);
+        UA_StatusCode retval =
+            UA_Server_addVariableNode(server, nodeId,
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                      UA_QUALIFIEDNAME(1, "integer"),
+                                      UA_NODEID_NULL, attr, NULL, NULL);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+        item.itemToMonitor.nodeId = nodeId;
+        UA_MonitoredItemCreateResult result =
+            UA_Server_createDataChangeMonitoredItem(server, UA_TIMESTAMPSTORETURN_NEITHER,
+                                                    item, NULL, dataChangeNotificationCallback);
+        ck_assert_uint_eq(result.statusCode, UA_STATUSCODE_GOOD);
+    }
+
+    callbackCount = 0;
+
+    clock_t begin, finish;
+    begin = clock();
+
+    for(int i = 0; i < MANY_NODES_CYCLES; i++) {
+        UA_fakeSleep(100);
+        UA_Timer_process(&server->timer, UA_DateTime_nowMonotonic(),
+                         executeTimerCallback, server);
+    }
+
+    finish = clock();
+
+    double time_spent = (double)(finish - begin) / CLOCKS_PER_SEC;
+    printf("duration was %f s\n", time_spent);
+
+    ck_assert_uint_eq(callbackCount, 0);
+}
+
+START_TEST(monitorManyNodesNoChanges) {
+    monitorManyNodes(false);
+}
+END_TEST
+
+START_TEST(monitorManyNodesSamplingGroups) {
+    monitorManyNodes(true);
+}
+END_TEST
+
 static Suite * monitoring_speed_suite (void) {
     Suite *s = suite_create ("Monitoring Speed");
 
     TCase* tc_datachange = tcase_create ("DataChange");
     tcase_add_checked_fixture(tc_datachange, setup, teardown);
     tcase_add_test (tc_datachange, monitorIntegerNoChanges);
+    tcase_add_test (tc_datachange, monitorDoubleArrayNoChanges);
+    tcase_add_test (tc_datachange, monitorManyNodesNoChanges);
+    tcase_add_test (tc_datachange, monitorManyNodesSamplingGroups);
     suite_add_tcase (s, tc_datachange);
 
     return s;
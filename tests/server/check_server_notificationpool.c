@@ -0,0 +1,178 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client.h>
+#include <open62541/client_config_default.h>
+#include <open62541/client_highlevel.h>
+#include <open62541/client_subscriptions.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "testing_clock.h"
+#include "thread_wrapper.h"
+
+#define DATA_VARIABLE 50000
+#define SLAB_SIZE 16
+#define ROUNDS 5
+
+static UA_Server *server;
+static volatile UA_Boolean running;
+static THREAD_HANDLE server_thread;
+static UA_Client *client;
+static UA_UInt32 subId;
+static UA_Double publishingInterval;
+static size_t notifications;
+
+THREAD_CALLBACK(serverloop) {
+    while(running)
+        UA_Server_run_iterate(server, true);
+    return 0;
+}
+
+static void
+dataChangeHandler(UA_Client *c, UA_UInt32 subscriptionId, void *subContext,
+                  UA_UInt32 monId, void *monContext, UA_DataValue *value) {
+    notifications++;
+}
+
+static void
+setupServer(UA_UInt32 slabSize) {
+    running = true;
+    notifications = 0;
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->notificationSlabSize = slabSize;
+
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_UInt32 zero = 0;
+    UA_Variant_setScalar(&attr.value, &zero, &UA_TYPES[UA_TYPES_UINT32]);
+    UA_StatusCode retval =
+        UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                  UA_QUALIFIEDNAME(1, "Data"),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                  attr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Server_run_startup(server);
+    THREAD_CREATE(server_thread, serverloop);
+
+    client = UA_Client_new();
+    UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_CreateSubscriptionRequest request = UA_CreateSubscriptionRequest_default();
+    UA_CreateSubscriptionResponse response =
+        UA_Client_Subscriptions_create(client, request, NULL, NULL, NULL);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    subId = response.subscriptionId;
+    publishingInterval = response.revisedPublishingInterval;
+
+    UA_MonitoredItemCreateRequest monRequest =
+        UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1, DATA_VARIABLE));
+    UA_MonitoredItemCreateResult monResponse =
+        UA_Client_MonitoredItems_createDataChange(client, subId, UA_TIMESTAMPSTORETURN_BOTH,
+                                                  monRequest, NULL, dataChangeHandler, NULL);
+    ck_assert_uint_eq(monResponse.statusCode, UA_STATUSCODE_GOOD);
+}
+
+static void setup(void) {
+    setupServer(SLAB_SIZE);
+}
+
+static void teardown(void) {
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+    running = false;
+    THREAD_JOIN(server_thread);
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+/* Write a new value and wait for the notification. Don't wait with a timeout
+ * in the client. The testing clock is only advanced here. */
+static void
+writeAndReceive(UA_UInt32 value) {
+    UA_Variant v;
+    UA_Variant_setScalar(&v, &value, &UA_TYPES[UA_TYPES_UINT32]);
+    UA_StatusCode retval =
+        UA_Client_writeValueAttribute(client, UA_NODEID_NUMERIC(1, DATA_VARIABLE), &v);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    size_t expected = notifications + 1;
+    UA_fakeSleep((UA_UInt32)publishingInterval + 1);
+    for(size_t i = 0; i < 1000 && notifications < expected; i++) {
+        UA_Client_run_iterate(client, 0);
+        UA_realSleep(1);
+    }
+    ck_assert_uint_eq(notifications, expected);
+}
+
+START_TEST(NotificationPool_reuse) {
+    for(UA_UInt32 i = 1; i <= ROUNDS; i++)
+        writeAndReceive(i);
+
+    UA_NotificationPoolStatistics stats;
+    UA_Server_getNotificationPoolStatistics(server, &stats);
+
+    /* All notifications fit into one slab and have been published */
+    ck_assert_uint_eq(stats.notifications.slabs, 1);
+    ck_assert_uint_eq(stats.notifications.inUse, 0);
+    ck_assert_uint_eq(stats.notifications.free, SLAB_SIZE);
+    ck_assert_uint_ge(stats.notifications.allocations, ROUNDS);
+
+    /* Acknowledged messages return to the pool */
+    ck_assert_uint_eq(stats.retransmissions.slabs, 1);
+    ck_assert_uint_ge(stats.retransmissions.allocations, ROUNDS);
+    ck_assert_uint_eq(stats.retransmissions.inUse + stats.retransmissions.free, SLAB_SIZE);
+
+    /* The arrays of the acknowledged messages are reused */
+    ck_assert_uint_gt(stats.bufferReuses, 0);
+    ck_assert_uint_lt(stats.bufferAllocations, ROUNDS);
+    ck_assert_uint_eq(stats.bufferReuses + stats.bufferAllocations,
+                      stats.retransmissions.allocations);
+} END_TEST
+
+START_TEST(NotificationPool_disabled) {
+    teardown();
+    setupServer(0);
+    for(UA_UInt32 i = 1; i <= ROUNDS; i++)
+        writeAndReceive(i);
+
+    UA_NotificationPoolStatistics stats;
+    UA_Server_getNotificationPoolStatistics(server, &stats);
+    ck_assert_uint_eq(stats.notifications.slabs, 0);
+    ck_assert_uint_eq(stats.notifications.inUse, 0);
+    ck_assert_uint_eq(stats.notifications.free, 0);
+    ck_assert_uint_ge(stats.notifications.allocations, ROUNDS);
+    ck_assert_uint_eq(stats.retransmissions.slabs, 0);
+    ck_assert_uint_eq(stats.bufferReuses, 0);
+    ck_assert_uint_eq(stats.bufferAllocations, 0);
+} END_TEST
+
+static Suite *testSuite_notificationPool(void) {
+    Suite *s = suite_create("Notification Pool");
+    TCase *tc = tcase_create("Publish");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, NotificationPool_reuse);
+    tcase_add_test(tc, NotificationPool_disabled);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_notificationPool();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
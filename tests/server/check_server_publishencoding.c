@@ -0,0 +1,242 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client.h>
+#include <open62541/client_config_default.h>
+#include <open62541/client_highlevel.h>
+#include <open62541/client_subscriptions.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "testing_clock.h"
+#include "thread_wrapper.h"
+
+#define DATA_VARIABLE 50000
+#define ITEMS 3
+
+static UA_Server *server;
+static volatile UA_Boolean running;
+static THREAD_HANDLE server_thread;
+static UA_Client *client;
+static UA_UInt32 subId;
+static UA_Double publishingInterval;
+static UA_Boolean responseReceived;
+static UA_PublishResponse publishResponse;
+
+THREAD_CALLBACK(serverloop) {
+    while(running)
+        UA_Server_run_iterate(server, true);
+    return 0;
+}
+
+static void
+writeValue(UA_UInt32 node, UA_UInt32 value) {
+    UA_Variant v;
+    UA_Variant_setScalar(&v, &value, &UA_TYPES[UA_TYPES_UINT32]);
+    UA_StatusCode retval =
+        UA_Client_writeValueAttribute(client, UA_NODEID_NUMERIC(1, DATA_VARIABLE + node), &v);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+/* The Subscription and the MonitoredItems are created with the raw services.
+ * So the client does not send PublishRequests and acknowledgements on its
+ * own and all messages stay in the retransmission queue. */
+static void setup(void) {
+    running = true;
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->encodeNotifications = true;
+
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_UInt32 zero = 0;
+    UA_Variant_setScalar(&attr.value, &zero, &UA_TYPES[UA_TYPES_UINT32]);
+    for(UA_UInt32 i = 0; i < ITEMS; i++) {
+        UA_StatusCode retval =
+            UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE + i),
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                      UA_QUALIFIEDNAME(1, "Data"),
+                                      UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                      attr, NULL, NULL);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    UA_Server_run_startup(server);
+    THREAD_CREATE(server_thread, serverloop);
+
+    client = UA_Client_new();
+    UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_CreateSubscriptionRequest request = UA_CreateSubscriptionRequest_default();
+    UA_CreateSubscriptionResponse response;
+    __UA_Client_Service(client, &request, &UA_TYPES[UA_TYPES_CREATESUBSCRIPTIONREQUEST],
+                        &response, &UA_TYPES[UA_TYPES_CREATESUBSCRIPTIONRESPONSE]);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    subId = response.subscriptionId;
+    publishingInterval = response.revisedPublishingInterval;
+    UA_CreateSubscriptionResponse_clear(&response);
+}
+
+static void teardown(void) {
+    UA_PublishResponse_clear(&publishResponse);
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+    running = false;
+    THREAD_JOIN(server_thread);
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static void
+monitor(UA_UInt32 node) {
+    UA_MonitoredItemCreateRequest item =
+        UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1, DATA_VARIABLE + node));
+    item.requestedParameters.clientHandle = 100 + node;
+    UA_CreateMonitoredItemsRequest request;
+    UA_CreateMonitoredItemsRequest_init(&request);
+    request.subscriptionId = subId;
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    request.itemsToCreate = &item;
+    request.itemsToCreateSize = 1;
+    UA_CreateMonitoredItemsResponse response;
+    __UA_Client_Service(client, &request, &UA_TYPES[UA_TYPES_CREATEMONITOREDITEMSREQUEST],
+                        &response, &UA_TYPES[UA_TYPES_CREATEMONITOREDITEMSRESPONSE]);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 1);
+    ck_assert_uint_eq(response.results[0].statusCode, UA_STATUSCODE_GOOD);
+    UA_CreateMonitoredItemsResponse_clear(&response);
+}
+
+static void
+publishCallback(UA_Client *c, void *userdata, UA_UInt32 requestId, void *response) {
+    UA_PublishResponse_clear(&publishResponse);
+    UA_PublishResponse_copy((UA_PublishResponse*)response, &publishResponse);
+    responseReceived = true;
+}
+
+/* Send a PublishRequest without acknowledgements and wait for the response.
+ * The testing clock is only advanced here. */
+static void
+publish(void) {
+    UA_PublishRequest request;
+    UA_PublishRequest_init(&request);
+    responseReceived = false;
+    UA_StatusCode retval =
+        __UA_Client_AsyncService(client, &request, &UA_TYPES[UA_TYPES_PUBLISHREQUEST],
+                                 publishCallback, &UA_TYPES[UA_TYPES_PUBLISHRESPONSE],
+                                 NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_fakeSleep((UA_UInt32)publishingInterval + 1);
+    for(size_t i = 0; i < 1000 && !responseReceived; i++) {
+        UA_Client_run_iterate(client, 0);
+        UA_realSleep(1);
+    }
+    ck_assert(responseReceived);
+    ck_assert_uint_eq(publishResponse.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+}
+
+/* The message is decoded by the client like any other */
+static void
+checkMessage(const UA_NotificationMessage *message, size_t items, UA_UInt32 value) {
+    ck_assert_uint_eq(message->notificationDataSize, 1);
+    const UA_ExtensionObject *eo = &message->notificationData[0];
+    ck_assert_int_eq(eo->encoding, UA_EXTENSIONOBJECT_DECODED);
+    ck_assert(eo->content.decoded.type == &UA_TYPES[UA_TYPES_DATACHANGENOTIFICATION]);
+    const UA_DataChangeNotification *dcn =
+        (const UA_DataChangeNotification*)eo->content.decoded.data;
+    ck_assert_uint_eq(dcn->monitoredItemsSize, items);
+    ck_assert_uint_eq(dcn->diagnosticInfosSize, 0);
+    for(size_t i = 0; i < items; i++) {
+        const UA_MonitoredItemNotification *min = &dcn->monitoredItems[i];
+        ck_assert_uint_ge(min->clientHandle, 100);
+        ck_assert_uint_lt(min->clientHandle, 100 + ITEMS);
+        ck_assert(min->value.hasValue);
+        ck_assert(min->value.hasSourceTimestamp);
+        ck_assert(UA_Variant_hasScalarType(&min->value.value, &UA_TYPES[UA_TYPES_UINT32]));
+        ck_assert_uint_eq(*(UA_UInt32*)min->value.value.data, value);
+    }
+}
+
+static void
+republish(UA_UInt32 sequenceNumber, UA_NotificationMessage *message) {
+    UA_RepublishRequest request;
+    UA_RepublishRequest_init(&request);
+    request.subscriptionId = subId;
+    request.retransmitSequenceNumber = sequenceNumber;
+    UA_RepublishResponse response;
+    __UA_Client_Service(client, &request, &UA_TYPES[UA_TYPES_REPUBLISHREQUEST],
+                        &response, &UA_TYPES[UA_TYPES_REPUBLISHRESPONSE]);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    *message = response.notificationMessage;
+    UA_NotificationMessage_init(&response.notificationMessage);
+    UA_RepublishResponse_clear(&response);
+}
+
+START_TEST(EncodedPublish_dataChange) {
+    for(UA_UInt32 i = 0; i < ITEMS; i++)
+        monitor(i);
+    publish();
+    checkMessage(&publishResponse.notificationMessage, ITEMS, 0);
+    UA_UInt32 first = publishResponse.notificationMessage.sequenceNumber;
+
+    writeValue(1, 7);
+    publish();
+    checkMessage(&publishResponse.notificationMessage, 1, 7);
+    const UA_DataChangeNotification *dcn = (const UA_DataChangeNotification*)
+        publishResponse.notificationMessage.notificationData[0].content.decoded.data;
+    ck_assert_uint_eq(dcn->monitoredItems[0].clientHandle, 101);
+    UA_UInt32 second = publishResponse.notificationMessage.sequenceNumber;
+    ck_assert_uint_eq(second, first + 1);
+    ck_assert_uint_eq(publishResponse.availableSequenceNumbersSize, 2);
+} END_TEST
+
+START_TEST(EncodedPublish_republish) {
+    for(UA_UInt32 i = 0; i < ITEMS; i++)
+        monitor(i);
+    publish();
+    UA_UInt32 first = publishResponse.notificationMessage.sequenceNumber;
+    UA_DateTime firstPublishTime = publishResponse.notificationMessage.publishTime;
+    writeValue(2, 9);
+    publish();
+    UA_UInt32 second = publishResponse.notificationMessage.sequenceNumber;
+
+    /* The retransmitted messages are the same as the published ones */
+    UA_NotificationMessage message;
+    republish(first, &message);
+    ck_assert_uint_eq(message.sequenceNumber, first);
+    ck_assert_int_eq(message.publishTime, firstPublishTime);
+    checkMessage(&message, ITEMS, 0);
+    UA_NotificationMessage_clear(&message);
+
+    republish(second, &message);
+    ck_assert_uint_eq(message.sequenceNumber, second);
+    checkMessage(&message, 1, 9);
+    UA_NotificationMessage_clear(&message);
+} END_TEST
+
+static Suite *testSuite_publishEncoding(void) {
+    Suite *s = suite_create("Publish Encoding");
+    TCase *tc = tcase_create("Encoded Notifications");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, EncodedPublish_dataChange);
+    tcase_add_test(tc, EncodedPublish_republish);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_publishEncoding();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -103,6 +103,11 @@ START_TEST(readSpeed) {
         retval |= UA_encodeBinary(&res, &UA_TYPES[UA_TYPES_READRESPONSE],
                                   &rpos, &rend, NULL, NULL);
 
+        /* The response is encoded. Release the nodes it pointed into. */
+        UA_LOCK(server->serviceMutex);
+        UA_Session_releasePinnedNodes(server, &server->adminSession);
+        UA_UNLOCK(server->serviceMutex);
+
         UA_ReadRequest_deleteMembers(&req);
         UA_ReadResponse_deleteMembers(&res);
     }
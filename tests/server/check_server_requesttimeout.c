@@ -0,0 +1,222 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client.h>
+#include <open62541/client_config_default.h>
+#include <open62541/client_highlevel.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "testing_clock.h"
+#include "thread_wrapper.h"
+
+#define SLOW_VARIABLE 50000
+#define FAST_VARIABLE 50001
+
+static UA_Server *server;
+static volatile UA_Boolean running;
+static volatile UA_Boolean paused;
+static volatile UA_Boolean serverPaused;
+static THREAD_HANDLE server_thread;
+static UA_Client *client;
+
+/* Reading the slow variable takes 30ms on the testing clock */
+static UA_StatusCode
+readDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    if(nodeId->identifier.numeric == SLOW_VARIABLE)
+        UA_fakeSleep(30);
+    UA_Int32 v = 42;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &v, &UA_TYPES[UA_TYPES_INT32]);
+}
+
+THREAD_CALLBACK(serverloop) {
+    while(running) {
+        if(paused) {
+            serverPaused = true;
+            UA_realSleep(1);
+            continue;
+        }
+        serverPaused = false;
+        UA_Server_run_iterate(server, true);
+    }
+    return 0;
+}
+
+static void
+addDevice(UA_UInt32 id) {
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = NULL;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    UA_StatusCode retval =
+        UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, id),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                            UA_QUALIFIEDNAME(1, "Device"),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                            attr, ds, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void setup(void) {
+    running = true;
+    paused = false;
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+    addDevice(SLOW_VARIABLE);
+    addDevice(FAST_VARIABLE);
+    UA_Server_run_startup(server);
+    THREAD_CREATE(server_thread, serverloop);
+
+    client = UA_Client_new();
+    UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    UA_StatusCode retval = UA_Client_connect(client, "opc.tcp://localhost:4840");
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void teardown(void) {
+    UA_Client_disconnect(client);
+    UA_Client_delete(client);
+    running = false;
+    THREAD_JOIN(server_thread);
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static UA_RequestTimeoutStatistics
+getStatistics(void) {
+    UA_RequestTimeoutStatistics stats;
+    UA_Server_getRequestTimeoutStatistics(server, &stats);
+    return stats;
+}
+
+static UA_ReadResponse
+readDevices(UA_UInt32 timeoutHint) {
+    UA_ReadValueId rvi[3];
+    for(size_t i = 0; i < 3; i++) {
+        UA_ReadValueId_init(&rvi[i]);
+        rvi[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        rvi[i].nodeId = UA_NODEID_NUMERIC(1, SLOW_VARIABLE);
+    }
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.requestHeader.timeoutHint = timeoutHint;
+    request.nodesToRead = rvi;
+    request.nodesToReadSize = 3;
+    return UA_Client_Service_read(client, request);
+}
+
+START_TEST(RequestTimeout_noTimeoutHint) {
+    UA_ReadResponse response = readDevices(0);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 3);
+    for(size_t i = 0; i < 3; i++)
+        ck_assert(!response.results[i].hasStatus);
+    UA_ReadResponse_clear(&response);
+    UA_RequestTimeoutStatistics stats = getStatistics();
+    ck_assert_uint_eq(stats.rejected, 0);
+    ck_assert_uint_eq(stats.aborted, 0);
+} END_TEST
+
+START_TEST(RequestTimeout_abort) {
+    /* The third read starts after 60ms */
+    UA_ReadResponse response = readDevices(50);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_BADTIMEOUT);
+    ck_assert_uint_eq(response.resultsSize, 3);
+    ck_assert(!response.results[0].hasStatus);
+    ck_assert(!response.results[1].hasStatus);
+    ck_assert_uint_eq(response.results[2].status, UA_STATUSCODE_BADTIMEOUT);
+    UA_ReadResponse_clear(&response);
+    UA_RequestTimeoutStatistics stats = getStatistics();
+    ck_assert_uint_eq(stats.rejected, 0);
+    ck_assert_uint_eq(stats.aborted, 1);
+
+    /* The next request starts with a new deadline */
+    response = readDevices(100);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    UA_ReadResponse_clear(&response);
+} END_TEST
+
+static UA_StatusCode slowResult;
+static UA_StatusCode fastResult;
+static size_t responses;
+
+static void
+readCallback(UA_Client *c, void *userdata, UA_UInt32 requestId, void *r) {
+    UA_ReadResponse *response = (UA_ReadResponse*)r;
+    *(UA_StatusCode*)userdata = response->responseHeader.serviceResult;
+    responses++;
+}
+
+static void
+sendRead(UA_UInt32 nodeId, UA_UInt32 timeoutHint, UA_StatusCode *result) {
+    UA_ReadValueId rvi;
+    UA_ReadValueId_init(&rvi);
+    rvi.attributeId = UA_ATTRIBUTEID_VALUE;
+    rvi.nodeId = UA_NODEID_NUMERIC(1, nodeId);
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.requestHeader.timeoutHint = timeoutHint;
+    request.nodesToRead = &rvi;
+    request.nodesToReadSize = 1;
+    UA_StatusCode retval =
+        __UA_Client_AsyncService(client, &request, &UA_TYPES[UA_TYPES_READREQUEST],
+                                 readCallback, &UA_TYPES[UA_TYPES_READRESPONSE],
+                                 result, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+START_TEST(RequestTimeout_reject) {
+    /* Both requests are received before the slow read is processed */
+    paused = true;
+    while(!serverPaused)
+        UA_realSleep(1);
+    responses = 0;
+    slowResult = UA_STATUSCODE_BADINTERNALERROR;
+    fastResult = UA_STATUSCODE_BADINTERNALERROR;
+    sendRead(SLOW_VARIABLE, 0, &slowResult);
+    sendRead(FAST_VARIABLE, 10, &fastResult);
+    UA_realSleep(100); /* The second request can be held back by Nagle */
+    paused = false;
+
+    /* Don't wait with a timeout. The testing clock only advances in the
+     * DataSource. */
+    for(size_t i = 0; i < 1000 && responses < 2; i++) {
+        UA_Client_run_iterate(client, 0);
+        UA_realSleep(1);
+    }
+    ck_assert_uint_eq(responses, 2);
+    ck_assert_uint_eq(slowResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(fastResult, UA_STATUSCODE_BADTIMEOUT);
+    UA_RequestTimeoutStatistics stats = getStatistics();
+    ck_assert_uint_eq(stats.rejected, 1);
+    ck_assert_uint_eq(stats.aborted, 0);
+} END_TEST
+
+static Suite *testSuite_requestTimeout(void) {
+    Suite *s = suite_create("Request Timeout");
+    TCase *tc = tcase_create("TimeoutHint");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, RequestTimeout_noTimeoutHint);
+    tcase_add_test(tc, RequestTimeout_abort);
+    tcase_add_test(tc, RequestTimeout_reject);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_requestTimeout();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
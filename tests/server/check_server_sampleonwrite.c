@@ -0,0 +1,312 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client_subscriptions.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "testing_clock.h"
+
+#define DATA_VARIABLE 50000
+#define DEVICE_VARIABLE 50001
+
+static UA_Server *server;
+static size_t dataSourceReads;
+static UA_UInt32 deviceValue;
+static size_t notifications;
+static UA_UInt32 lastValue;
+static UA_StatusCode lastStatus;
+static size_t onReads;
+
+static UA_StatusCode
+readDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    dataSourceReads++;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &deviceValue, &UA_TYPES[UA_TYPES_UINT32]);
+}
+
+static void
+dataChangeCallback(UA_Server *s, UA_UInt32 monitoredItemId, void *monitoredItemContext,
+                   const UA_NodeId *nodeId, void *nodeContext, UA_UInt32 attributeId,
+                   const UA_DataValue *value) {
+    if(value->hasStatus && value->status != UA_STATUSCODE_GOOD) {
+        lastStatus = value->status;
+        notifications++;
+        return;
+    }
+    ck_assert(value->hasValue);
+    lastValue = *(UA_UInt32*)value->value.data;
+    notifications++;
+}
+
+static void
+setupServer(UA_Boolean sampleOnWrite) {
+    dataSourceReads = 0;
+    deviceValue = 0;
+    notifications = 0;
+    lastValue = 0;
+    lastStatus = UA_STATUSCODE_GOOD;
+    onReads = 0;
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->sampleOnWrite = sampleOnWrite;
+
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_UInt32 zero = 0;
+    UA_Variant_setScalar(&attr.value, &zero, &UA_TYPES[UA_TYPES_UINT32]);
+    UA_StatusCode retval =
+        UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                  UA_QUALIFIEDNAME(1, "Data"),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                  attr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = NULL;
+    attr = UA_VariableAttributes_default;
+    retval = UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE),
+                                                 UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                                 UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                                 UA_QUALIFIEDNAME(1, "Device"),
+                                                 UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                                 attr, ds, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Server_run_startup(server);
+}
+
+static void setup(void) {
+    setupServer(false);
+}
+
+static void teardown(void) {
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static UA_UInt32
+monitor(UA_UInt32 id) {
+    UA_MonitoredItemCreateRequest request =
+        UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1, id));
+    request.requestedParameters.samplingInterval = 100.0;
+    UA_MonitoredItemCreateResult result =
+        UA_Server_createDataChangeMonitoredItem(server, UA_TIMESTAMPSTORETURN_BOTH, request,
+                                                NULL, dataChangeCallback);
+    ck_assert_uint_eq(result.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(notifications, 1);
+    return result.monitoredItemId;
+}
+
+static void
+writeData(UA_UInt32 value) {
+    UA_Variant v;
+    UA_Variant_setScalar(&v, &value, &UA_TYPES[UA_TYPES_UINT32]);
+    UA_StatusCode retval = UA_Server_writeValue(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE), v);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void
+iterate(size_t cycles) {
+    for(size_t i = 0; i < cycles; i++) {
+        UA_fakeSleep(100);
+        UA_Server_run_iterate(server, false);
+    }
+}
+
+START_TEST(SampleOnWrite_write) {
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeSampleOnWrite(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    monitor(DATA_VARIABLE);
+
+    /* Sampled right away when the sampling interval has passed */
+    iterate(1);
+    writeData(1);
+    ck_assert_uint_eq(notifications, 2);
+    ck_assert_uint_eq(lastValue, 1);
+
+    /* Writes within the sampling interval are sampled together */
+    writeData(2);
+    writeData(3);
+    ck_assert_uint_eq(notifications, 2);
+    iterate(1);
+    ck_assert_uint_eq(notifications, 3);
+    ck_assert_uint_eq(lastValue, 3);
+
+    /* No sampling without writes */
+    iterate(5);
+    ck_assert_uint_eq(notifications, 3);
+} END_TEST
+
+START_TEST(SampleOnWrite_dataSource) {
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeSampleOnWrite(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    monitor(DEVICE_VARIABLE);
+
+    /* The DataSource is not polled */
+    dataSourceReads = 0;
+    iterate(5);
+    ck_assert_uint_eq(dataSourceReads, 0);
+
+    deviceValue = 7;
+    UA_Server_notifyValueChanged(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE));
+    ck_assert_uint_eq(dataSourceReads, 1);
+    ck_assert_uint_eq(notifications, 2);
+    ck_assert_uint_eq(lastValue, 7);
+} END_TEST
+
+START_TEST(SampleOnWrite_existingMonitoredItem) {
+    monitor(DEVICE_VARIABLE);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+
+    /* Applies to the MonitoredItem that already exists */
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeSampleOnWrite(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 0);
+
+    /* And back to polling */
+    retval = UA_Server_setVariableNodeSampleOnWrite(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE),
+                                                    false);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+
+    retval = UA_Server_setVariableNodeSampleOnWrite(server,
+                                                    UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                                    true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNODECLASSINVALID);
+} END_TEST
+
+START_TEST(SampleOnWrite_delete) {
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeSampleOnWrite(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_UInt32 id = monitor(DATA_VARIABLE);
+
+    /* Delete the MonitoredItem with a delayed sample */
+    writeData(1);
+    retval = UA_Server_deleteMonitoredItem(server, id);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    iterate(2);
+    writeData(2);
+    ck_assert_uint_eq(notifications, 1);
+} END_TEST
+
+START_TEST(SampleOnWrite_serverConfig) {
+    teardown();
+    setupServer(true);
+    monitor(DATA_VARIABLE);
+    notifications = 0;
+    monitor(DEVICE_VARIABLE);
+
+    /* Only the variable with the value in the node is sampled on write */
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+    writeData(1);
+    ck_assert_uint_eq(notifications, 2);
+    ck_assert_uint_eq(lastValue, 1);
+} END_TEST
+
+/* The variable gets a DataSource. Its value can now change without a write. */
+START_TEST(SampleOnWrite_setDataSource) {
+    teardown();
+    setupServer(true);
+    monitor(DATA_VARIABLE);
+
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = NULL;
+    UA_StatusCode retval =
+        UA_Server_setVariableNode_dataSource(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE), ds);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    /* Polled with the sampling interval again */
+    deviceValue = 5;
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+    ck_assert_uint_eq(lastValue, 5);
+} END_TEST
+
+static void
+onRead(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+       const UA_NodeId *nodeid, void *nodeContext, const UA_NumericRange *range,
+       const UA_DataValue *value) {
+    onReads++;
+}
+
+START_TEST(SampleOnWrite_setValueCallback) {
+    teardown();
+    setupServer(true);
+    monitor(DATA_VARIABLE);
+    iterate(2);
+    ck_assert_uint_eq(onReads, 0);
+
+    UA_ValueCallback callback;
+    callback.onRead = onRead;
+    callback.onWrite = NULL;
+    UA_StatusCode retval =
+        UA_Server_setVariableNode_valueCallback(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE),
+                                                callback);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    iterate(2);
+    ck_assert_uint_eq(onReads, 2);
+} END_TEST
+
+START_TEST(SampleOnWrite_deleteNode) {
+    UA_StatusCode retval =
+        UA_Server_setVariableNodeSampleOnWrite(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    monitor(DATA_VARIABLE);
+    iterate(1);
+
+    /* The MonitoredItem is notified that the node is gone */
+    retval = UA_Server_deleteNode(server, UA_NODEID_NUMERIC(1, DATA_VARIABLE), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    iterate(1);
+    ck_assert_uint_eq(notifications, 2);
+    ck_assert_uint_eq(lastStatus, UA_STATUSCODE_BADNODEIDUNKNOWN);
+} END_TEST
+
+static Suite *testSuite_sampleOnWrite(void) {
+    Suite *s = suite_create("Sample on Write");
+    TCase *tc = tcase_create("Local MonitoredItems");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, SampleOnWrite_write);
+    tcase_add_test(tc, SampleOnWrite_dataSource);
+    tcase_add_test(tc, SampleOnWrite_existingMonitoredItem);
+    tcase_add_test(tc, SampleOnWrite_delete);
+    tcase_add_test(tc, SampleOnWrite_serverConfig);
+    tcase_add_test(tc, SampleOnWrite_setDataSource);
+    tcase_add_test(tc, SampleOnWrite_setValueCallback);
+    tcase_add_test(tc, SampleOnWrite_deleteNode);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_sampleOnWrite();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,320 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client_subscriptions.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "testing_clock.h"
+
+#define DEVICE_VARIABLE 50000
+#define NODES 4
+#define MAX_READS 64
+
+static UA_Server *server;
+static UA_UInt32 deviceValue;
+static size_t notifications[NODES];
+static UA_UInt32 readLog[MAX_READS]; /* The order of the DataSource reads */
+static size_t dataSourceReads;
+static size_t batchCalls;
+static UA_UInt32 monIds[NODES];
+static UA_Boolean deleteNext; /* Delete the next MonitoredItem in the callback */
+
+/* Every read returns a new value */
+static UA_StatusCode
+readDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    if(dataSourceReads < MAX_READS)
+        readLog[dataSourceReads] = nodeId->identifier.numeric - DEVICE_VARIABLE;
+    dataSourceReads++;
+    deviceValue++;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &deviceValue, &UA_TYPES[UA_TYPES_UINT32]);
+}
+
+static UA_StatusCode
+readDeviceBatch(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+                UA_Boolean includeSourceTimeStamp, size_t itemsSize,
+                const UA_DataSourceReadItem *items, UA_DataValue *values) {
+    batchCalls++;
+    for(size_t i = 0; i < itemsSize; i++) {
+        UA_StatusCode retval =
+            readDevice(s, sessionId, sessionContext, items[i].nodeId, items[i].nodeContext,
+                       includeSourceTimeStamp, items[i].range, &values[i]);
+        if(retval != UA_STATUSCODE_GOOD)
+            return retval;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+dataChangeCallback(UA_Server *s, UA_UInt32 monitoredItemId, void *monitoredItemContext,
+                   const UA_NodeId *nodeId, void *nodeContext, UA_UInt32 attributeId,
+                   const UA_DataValue *value) {
+    ck_assert(value->hasValue);
+    size_t node = (size_t)(nodeId->identifier.numeric - DEVICE_VARIABLE);
+    (*(size_t*)monitoredItemContext)++;
+    if(deleteNext && node + 1 < NODES && monIds[node + 1] != 0) {
+        UA_StatusCode retval = UA_Server_deleteMonitoredItem(s, monIds[node + 1]);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+        monIds[node + 1] = 0;
+    }
+}
+
+static void
+setupServer(UA_Boolean samplingGroups, UA_Boolean sharedSampling) {
+    deviceValue = 0;
+    dataSourceReads = 0;
+    batchCalls = 0;
+    deleteNext = false;
+    memset(notifications, 0, sizeof(notifications));
+    memset(monIds, 0, sizeof(monIds));
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->samplingGroups = samplingGroups;
+    config->sharedSampling = sharedSampling;
+
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = NULL;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    for(UA_UInt32 i = 0; i < NODES; i++) {
+        UA_StatusCode retval =
+            UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE + i),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                                UA_QUALIFIEDNAME(1, "Device"),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                                attr, ds, NULL, NULL);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    UA_Server_run_startup(server);
+}
+
+static void setup(void) {
+    setupServer(true, false);
+}
+
+static void teardown(void) {
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static UA_UInt32
+monitor(UA_UInt32 node, size_t *counter, UA_Double samplingInterval) {
+    UA_MonitoredItemCreateRequest request =
+        UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1, DEVICE_VARIABLE + node));
+    request.requestedParameters.samplingInterval = samplingInterval;
+    UA_MonitoredItemCreateResult result =
+        UA_Server_createDataChangeMonitoredItem(server, UA_TIMESTAMPSTORETURN_BOTH, request,
+                                                counter, dataChangeCallback);
+    ck_assert_uint_eq(result.statusCode, UA_STATUSCODE_GOOD);
+    return result.monitoredItemId;
+}
+
+/* The first nodes get the batched read callback */
+static void
+setReadBatch(size_t nodes) {
+    for(UA_UInt32 i = 0; i < nodes; i++) {
+        UA_StatusCode retval =
+            UA_Server_setVariableNode_dataSourceReadBatch(server,
+                                                          UA_NODEID_NUMERIC(1, DEVICE_VARIABLE + i),
+                                                          readDeviceBatch);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+}
+
+/* Monitor all nodes in the reverse order of their NodeId */
+static void
+monitorAll(UA_Double samplingInterval) {
+    for(size_t i = NODES; i > 0; i--)
+        monIds[i - 1] = monitor((UA_UInt32)(i - 1), &notifications[i - 1], samplingInterval);
+}
+
+static void
+iterate(size_t cycles) {
+    for(size_t i = 0; i < cycles; i++) {
+        UA_fakeSleep(100);
+        UA_Server_run_iterate(server, false);
+    }
+}
+
+START_TEST(SamplingGroups_sortedByNodeId) {
+    monitorAll(100.0);
+    dataSourceReads = 0;
+    iterate(2);
+
+    /* Every node is read once per cycle, in the order of the NodeId */
+    ck_assert_uint_eq(dataSourceReads, 2 * NODES);
+    for(size_t i = 0; i < dataSourceReads; i++)
+        ck_assert_uint_eq(readLog[i], i % NODES);
+    for(size_t i = 0; i < NODES; i++)
+        ck_assert_uint_eq(notifications[i], 3);
+} END_TEST
+
+START_TEST(SamplingGroups_samplingInterval) {
+    monIds[0] = monitor(0, &notifications[0], 100.0);
+    monIds[1] = monitor(1, &notifications[1], 200.0);
+    monIds[2] = monitor(2, &notifications[2], 100.0);
+
+    dataSourceReads = 0;
+    iterate(4);
+    ck_assert_uint_eq(dataSourceReads, 10);
+    ck_assert_uint_eq(notifications[0], 5);
+    ck_assert_uint_eq(notifications[1], 3);
+    ck_assert_uint_eq(notifications[2], 5);
+} END_TEST
+
+START_TEST(SamplingGroups_delete) {
+    monitorAll(100.0);
+
+    /* The remaining members are still sampled in order */
+    UA_StatusCode retval = UA_Server_deleteMonitoredItem(server, monIds[1]);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    dataSourceReads = 0;
+    iterate(1);
+    ck_assert_uint_eq(dataSourceReads, NODES - 1);
+    ck_assert_uint_eq(readLog[0], 0);
+    ck_assert_uint_eq(readLog[1], 2);
+    ck_assert_uint_eq(readLog[2], 3);
+
+    /* No sampling without members */
+    for(size_t i = 0; i < NODES; i++) {
+        if(i == 1)
+            continue;
+        retval = UA_Server_deleteMonitoredItem(server, monIds[i]);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 0);
+
+    /* A new MonitoredItem creates a new group */
+    monitor(3, &notifications[3], 100.0);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+} END_TEST
+
+START_TEST(SamplingGroups_deleteInCallback) {
+    monitorAll(100.0);
+
+    /* Node 0 deletes the MonitoredItem of node 1, which is next in the group.
+     * Node 2 deletes node 3 in the same cycle. */
+    deleteNext = true;
+    dataSourceReads = 0;
+    iterate(1);
+    ck_assert_uint_eq(dataSourceReads, 2);
+    ck_assert_uint_eq(readLog[0], 0);
+    ck_assert_uint_eq(readLog[1], 2);
+    ck_assert_uint_eq(monIds[1], 0);
+    ck_assert_uint_eq(monIds[3], 0);
+
+    deleteNext = false;
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 4);
+    ck_assert_uint_eq(notifications[0], 4);
+    ck_assert_uint_eq(notifications[2], 4);
+} END_TEST
+
+START_TEST(SamplingGroups_sharedSampling) {
+    teardown();
+    setupServer(true, true);
+    monitorAll(100.0);
+    size_t extra = 0;
+    monitor(2, &extra, 100.0);
+
+    /* The Samplers are the members of the group */
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2 * NODES);
+    for(size_t i = 0; i < dataSourceReads; i++)
+        ck_assert_uint_eq(readLog[i], i % NODES);
+    ck_assert_uint_eq(notifications[2], 3);
+    ck_assert_uint_eq(extra, 3);
+} END_TEST
+
+START_TEST(SamplingGroups_readBatch) {
+    setReadBatch(NODES - 1);
+    monitorAll(100.0);
+
+    /* One batched read per cycle. The last node is read individually. */
+    batchCalls = 0;
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(batchCalls, 2);
+    ck_assert_uint_eq(dataSourceReads, 2 * NODES);
+    for(size_t i = 0; i < NODES; i++)
+        ck_assert_uint_eq(notifications[i], 3);
+
+    /* A removed member is no longer read in the batch */
+    UA_StatusCode retval = UA_Server_deleteMonitoredItem(server, monIds[1]);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    batchCalls = 0;
+    dataSourceReads = 0;
+    iterate(1);
+    ck_assert_uint_eq(batchCalls, 1);
+    ck_assert_uint_eq(dataSourceReads, NODES - 1);
+} END_TEST
+
+START_TEST(SamplingGroups_readBatchShared) {
+    teardown();
+    setupServer(true, true);
+    setReadBatch(NODES);
+    monitorAll(100.0);
+    size_t extra = 0;
+    monitor(2, &extra, 100.0);
+
+    /* The Samplers are read in one batch per cycle */
+    batchCalls = 0;
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(batchCalls, 2);
+    ck_assert_uint_eq(dataSourceReads, 2 * NODES);
+    ck_assert_uint_eq(notifications[2], 3);
+    ck_assert_uint_eq(extra, 3);
+} END_TEST
+
+START_TEST(SamplingGroups_disabled) {
+    teardown();
+    setupServer(false, false);
+    monitorAll(100.0);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2 * NODES);
+    for(size_t i = 0; i < NODES; i++)
+        ck_assert_uint_eq(notifications[i], 3);
+} END_TEST
+
+static Suite *testSuite_samplingGroups(void) {
+    Suite *s = suite_create("Sampling Groups");
+    TCase *tc = tcase_create("Local MonitoredItems");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, SamplingGroups_sortedByNodeId);
+    tcase_add_test(tc, SamplingGroups_samplingInterval);
+    tcase_add_test(tc, SamplingGroups_delete);
+    tcase_add_test(tc, SamplingGroups_deleteInCallback);
+    tcase_add_test(tc, SamplingGroups_sharedSampling);
+    tcase_add_test(tc, SamplingGroups_readBatch);
+    tcase_add_test(tc, SamplingGroups_readBatchShared);
+    tcase_add_test(tc, SamplingGroups_disabled);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_samplingGroups();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
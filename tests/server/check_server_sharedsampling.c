@@ -0,0 +1,186 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client_subscriptions.h>
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include <check.h>
+#include <stdlib.h>
+
+#include "testing_clock.h"
+
+#define DEVICE_VARIABLE 50000
+#define ITEMS 3
+
+static UA_Server *server;
+static size_t dataSourceReads;
+static UA_UInt32 deviceValue;
+static size_t notifications[ITEMS];
+
+/* Every read returns a new value */
+static UA_StatusCode
+readDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    dataSourceReads++;
+    deviceValue++;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &deviceValue, &UA_TYPES[UA_TYPES_UINT32]);
+}
+
+static void
+dataChangeCallback(UA_Server *s, UA_UInt32 monitoredItemId, void *monitoredItemContext,
+                   const UA_NodeId *nodeId, void *nodeContext, UA_UInt32 attributeId,
+                   const UA_DataValue *value) {
+    ck_assert(value->hasValue);
+    ck_assert_uint_eq(*(UA_UInt32*)value->value.data, deviceValue);
+    (*(size_t*)monitoredItemContext)++;
+}
+
+static void
+setupServer(UA_Boolean sharedSampling) {
+    dataSourceReads = 0;
+    deviceValue = 0;
+    memset(notifications, 0, sizeof(notifications));
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->sharedSampling = sharedSampling;
+
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = NULL;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    UA_StatusCode retval =
+        UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, DEVICE_VARIABLE),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                            UA_QUALIFIEDNAME(1, "Device"),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                            attr, ds, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    dataSourceReads = 0; /* The DataSource is read when the node is added */
+    UA_Server_run_startup(server);
+}
+
+static void setup(void) {
+    setupServer(true);
+}
+
+static void teardown(void) {
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static UA_UInt32
+monitor(size_t item, UA_Double samplingInterval) {
+    UA_MonitoredItemCreateRequest request =
+        UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1, DEVICE_VARIABLE));
+    request.requestedParameters.samplingInterval = samplingInterval;
+    UA_MonitoredItemCreateResult result =
+        UA_Server_createDataChangeMonitoredItem(server, UA_TIMESTAMPSTORETURN_BOTH, request,
+                                                &notifications[item], dataChangeCallback);
+    ck_assert_uint_eq(result.statusCode, UA_STATUSCODE_GOOD);
+    return result.monitoredItemId;
+}
+
+static void
+iterate(size_t cycles) {
+    for(size_t i = 0; i < cycles; i++) {
+        UA_fakeSleep(100);
+        UA_Server_run_iterate(server, false);
+    }
+}
+
+START_TEST(SharedSampling_sampleOnce) {
+    for(size_t i = 0; i < ITEMS; i++)
+        monitor(i, 100.0);
+    /* Every MonitoredItem takes its first sample on its own */
+    for(size_t i = 0; i < ITEMS; i++)
+        ck_assert_uint_eq(notifications[i], 1);
+
+    dataSourceReads = 0;
+    iterate(5);
+    ck_assert_uint_eq(dataSourceReads, 5);
+    for(size_t i = 0; i < ITEMS; i++)
+        ck_assert_uint_eq(notifications[i], 6);
+} END_TEST
+
+START_TEST(SharedSampling_samplingInterval) {
+    monitor(0, 100.0);
+    monitor(1, 100.0);
+    monitor(2, 200.0);
+
+    dataSourceReads = 0;
+    iterate(4);
+    ck_assert_uint_eq(dataSourceReads, 6);
+    ck_assert_uint_eq(notifications[0], 5);
+    ck_assert_uint_eq(notifications[1], 5);
+    ck_assert_uint_eq(notifications[2], 3);
+} END_TEST
+
+START_TEST(SharedSampling_delete) {
+    UA_UInt32 ids[ITEMS];
+    for(size_t i = 0; i < ITEMS; i++)
+        ids[i] = monitor(i, 100.0);
+
+    /* The remaining MonitoredItems are still sampled */
+    UA_StatusCode retval = UA_Server_deleteMonitoredItem(server, ids[0]);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+    ck_assert_uint_eq(notifications[0], 1);
+    ck_assert_uint_eq(notifications[1], 3);
+    ck_assert_uint_eq(notifications[2], 3);
+
+    /* No sampling without MonitoredItems */
+    for(size_t i = 1; i < ITEMS; i++) {
+        retval = UA_Server_deleteMonitoredItem(server, ids[i]);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 0);
+
+    /* A new MonitoredItem creates a new Sampler */
+    monitor(0, 100.0);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2);
+    ck_assert_uint_eq(notifications[0], 4);
+} END_TEST
+
+START_TEST(SharedSampling_disabled) {
+    teardown();
+    setupServer(false);
+    for(size_t i = 0; i < ITEMS; i++)
+        monitor(i, 100.0);
+    dataSourceReads = 0;
+    iterate(2);
+    ck_assert_uint_eq(dataSourceReads, 2 * ITEMS);
+} END_TEST
+
+static Suite *testSuite_sharedSampling(void) {
+    Suite *s = suite_create("Shared Sampling");
+    TCase *tc = tcase_create("Local MonitoredItems");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, SharedSampling_sampleOnce);
+    tcase_add_test(tc, SharedSampling_samplingInterval);
+    tcase_add_test(tc, SharedSampling_delete);
+    tcase_add_test(tc, SharedSampling_disabled);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_sharedSampling();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -73,12 +73,51 @@ START_TEST(addVariable) {
 }
 END_TEST
 
+START_TEST(addVariableBulk) {
+    /* add the same variable nodes in one batch */
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    UA_Int32 myInteger = 42;
+    UA_Variant_setScalar(&attr.value, &myInteger, &UA_TYPES[UA_TYPES_INT32]);
+    attr.description = UA_LOCALIZEDTEXT("en-US","the answer");
+    attr.displayName = UA_LOCALIZEDTEXT("en-US","the answer");
+
+    size_t itemsSize = 10000;
+    UA_AddNodesItem *items = (UA_AddNodesItem*)
+        UA_Array_new(itemsSize, &UA_TYPES[UA_TYPES_ADDNODESITEM]);
+    UA_AddNodesResult *results = (UA_AddNodesResult*)
+        UA_Array_new(itemsSize, &UA_TYPES[UA_TYPES_ADDNODESRESULT]);
+    for(size_t i = 0; i < itemsSize; i++) {
+        items[i].nodeClass = UA_NODECLASS_VARIABLE;
+        items[i].parentNodeId.nodeId = UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER);
+        items[i].referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES);
+        items[i].browseName = UA_QUALIFIEDNAME(1, "the answer");
+        items[i].nodeAttributes.encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+        items[i].nodeAttributes.content.decoded.type = &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES];
+        items[i].nodeAttributes.content.decoded.data = &attr;
+    }
+
+    clock_t begin = clock();
+    UA_StatusCode res = UA_Server_addNodes(server, itemsSize, items, NULL, results);
+    clock_t finish = clock();
+    double time_spent = (double)(finish - begin) / CLOCKS_PER_SEC;
+    printf("%i nodes in one batch:\t Duration was %f s\n", (int)itemsSize, time_spent);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    for(size_t i = 0; i < itemsSize; i++)
+        ck_assert_uint_eq(results[i].statusCode, UA_STATUSCODE_GOOD);
+
+    /* The items do not own their members */
+    UA_free(items);
+    UA_Array_delete(results, itemsSize, &UA_TYPES[UA_TYPES_ADDNODESRESULT]);
+}
+END_TEST
+
 static Suite * service_speed_suite (void) {
     Suite *s = suite_create ("Service Speed");
 
     TCase* tc_addnodes = tcase_create ("AddNodes");
     tcase_add_checked_fixture(tc_addnodes, setup, teardown);
     tcase_add_test(tc_addnodes, addVariable);
+    tcase_add_test(tc_addnodes, addVariableBulk);
     suite_add_tcase(s, tc_addnodes);
 
     return s;
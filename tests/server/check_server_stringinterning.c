@@ -0,0 +1,142 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static UA_StatusCode
+addObject(UA_UInt32 id, const char *name) {
+    UA_ObjectAttributes attr = UA_ObjectAttributes_default;
+    attr.displayName = UA_LOCALIZEDTEXT("en-US", (char*)(uintptr_t)name);
+    attr.description = UA_LOCALIZEDTEXT("en-US", "A shared description");
+    return UA_Server_addObjectNode(server, UA_NODEID_NUMERIC(1, id),
+                                   UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                   UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                   UA_QUALIFIEDNAME(1, (char*)(uintptr_t)name),
+                                   UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                   attr, NULL, NULL);
+}
+
+START_TEST(Interning_sharedAttributes) {
+    ck_assert_uint_eq(addObject(50000, "Device"), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addObject(50001, "Device"), UA_STATUSCODE_GOOD);
+
+    UA_NodeId id1 = UA_NODEID_NUMERIC(1, 50000);
+    UA_NodeId id2 = UA_NODEID_NUMERIC(1, 50001);
+    const UA_Node *n1 = UA_Nodestore_getNode(server->nsCtx, &id1);
+    const UA_Node *n2 = UA_Nodestore_getNode(server->nsCtx, &id2);
+    ck_assert_ptr_ne(n1, NULL);
+    ck_assert_ptr_ne(n2, NULL);
+
+    /* The identical strings point to the same memory */
+    ck_assert_ptr_eq(n1->browseName.name.data, n2->browseName.name.data);
+    ck_assert_ptr_eq(n1->displayName.text.data, n2->displayName.text.data);
+    ck_assert_ptr_eq(n1->description.text.data, n2->description.text.data);
+    ck_assert_ptr_eq(n1->description.locale.data, n2->description.locale.data);
+
+    UA_Nodestore_releaseNode(server->nsCtx, n1);
+    UA_Nodestore_releaseNode(server->nsCtx, n2);
+} END_TEST
+
+START_TEST(Interning_writeAndDelete) {
+    size_t before = server->stringPool.stringsSize;
+    ck_assert_uint_eq(addObject(50000, "UniqueDeviceName"), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addObject(50001, "UniqueDeviceName"), UA_STATUSCODE_GOOD);
+    ck_assert_uint_gt(server->stringPool.stringsSize, before);
+
+    /* Overwrite the DisplayName of one node. The other node is unaffected. */
+    UA_LocalizedText newName = UA_LOCALIZEDTEXT("de-DE", "Geraet");
+    UA_StatusCode res =
+        UA_Server_writeDisplayName(server, UA_NODEID_NUMERIC(1, 50000), newName);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+
+    UA_LocalizedText outName;
+    res = UA_Server_readDisplayName(server, UA_NODEID_NUMERIC(1, 50001), &outName);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    UA_String expected = UA_STRING("UniqueDeviceName");
+    ck_assert(UA_String_equal(&outName.text, &expected));
+    UA_LocalizedText_clear(&outName);
+
+    /* Deleting one node keeps the shared strings of the other */
+    res = UA_Server_deleteNode(server, UA_NODEID_NUMERIC(1, 50001), true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    UA_QualifiedName outBrowseName;
+    res = UA_Server_readBrowseName(server, UA_NODEID_NUMERIC(1, 50000), &outBrowseName);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert(UA_String_equal(&outBrowseName.name, &expected));
+    UA_QualifiedName_clear(&outBrowseName);
+
+    /* All strings are released when the last user is gone */
+    res = UA_Server_deleteNode(server, UA_NODEID_NUMERIC(1, 50000), true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(server->stringPool.stringsSize, before);
+} END_TEST
+
+START_TEST(Interning_stringNodeIdReferences) {
+    UA_ObjectAttributes attr = UA_ObjectAttributes_default;
+    UA_NodeId target = UA_NODEID_STRING(1, "Plant.Line1.Device");
+    UA_StatusCode res =
+        UA_Server_addObjectNode(server, target,
+                                UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                UA_QUALIFIEDNAME(1, "Device"),
+                                UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                attr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+
+    /* The reference from the ObjectsFolder points to the interned NodeId */
+    UA_NodeId objects = UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER);
+    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, &objects);
+    ck_assert_ptr_ne(node, NULL);
+    UA_Boolean found = false;
+    for(size_t i = 0; i < node->referencesSize; i++) {
+        UA_NodeReferenceKind *refs = &node->references[i];
+        for(size_t j = 0; j < refs->refTargetsSize; j++) {
+            if(!UA_NodeId_equal(&refs->refTargets[j].target.nodeId, &target))
+                continue;
+            ck_assert(refs->refTargets[j].interned);
+            found = true;
+        }
+    }
+    ck_assert(found);
+    UA_Nodestore_releaseNode(server->nsCtx, node);
+
+    res = UA_Server_deleteNode(server, target, true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+} END_TEST
+
+static Suite *testSuite_StringInterning(void) {
+    Suite *s = suite_create("String Interning");
+    TCase *tc = tcase_create("Interning");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, Interning_sharedAttributes);
+    tcase_add_test(tc, Interning_writeAndDelete);
+    tcase_add_test(tc, Interning_stringNodeIdReferences);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_StringInterning();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
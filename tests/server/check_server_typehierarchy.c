@@ -0,0 +1,171 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+static const UA_NodeId hasSubtype = {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HASSUBTYPE}};
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static UA_StatusCode
+addObjectType(UA_UInt32 id, UA_UInt16 parentNs, UA_UInt32 parentId) {
+    UA_ObjectTypeAttributes attr = UA_ObjectTypeAttributes_default;
+    attr.displayName = UA_LOCALIZEDTEXT("en-US", "CustomType");
+    return UA_Server_addObjectTypeNode(server, UA_NODEID_NUMERIC(1, id),
+                                       UA_NODEID_NUMERIC(parentNs, parentId),
+                                       hasSubtype, UA_QUALIFIEDNAME(1, "CustomType"),
+                                       attr, NULL, NULL);
+}
+
+static UA_Boolean
+isSubtype(UA_UInt32 typeId, UA_UInt16 superNs, UA_UInt32 superId) {
+    UA_NodeId type = UA_NODEID_NUMERIC(1, typeId);
+    UA_NodeId supertype = UA_NODEID_NUMERIC(superNs, superId);
+    UA_LOCK(server->serviceMutex);
+    UA_Boolean res = isNodeInTree(server, &type, &supertype, &hasSubtype, 1);
+    UA_UNLOCK(server->serviceMutex);
+    return res;
+}
+
+START_TEST(TypeHierarchy_incrementalAdd) {
+    /* Build the cache before adding the new types */
+    UA_NodeId folderType = UA_NODEID_NUMERIC(0, UA_NS0ID_FOLDERTYPE);
+    UA_NodeId baseType = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE);
+    UA_LOCK(server->serviceMutex);
+    ck_assert(isNodeInTree(server, &folderType, &baseType, &hasSubtype, 1));
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert(server->typeHierarchy.valid);
+
+    ck_assert_uint_eq(addObjectType(60000, 0, UA_NS0ID_BASEOBJECTTYPE), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addObjectType(60001, 1, 60000), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addObjectType(60002, 1, 60001), UA_STATUSCODE_GOOD);
+
+    /* The new types were merged without a rebuild */
+    ck_assert(server->typeHierarchy.valid);
+    ck_assert(isSubtype(60002, 0, UA_NS0ID_BASEOBJECTTYPE));
+    ck_assert(isSubtype(60002, 1, 60000));
+    ck_assert(isSubtype(60001, 1, 60001));
+    ck_assert(!isSubtype(60000, 1, 60002));
+    ck_assert(!isSubtype(60002, 0, UA_NS0ID_FOLDERTYPE));
+} END_TEST
+
+START_TEST(TypeHierarchy_browseSubtypes) {
+    /* A custom reference type is found when browsing for its supertype */
+    UA_ReferenceTypeAttributes attr = UA_ReferenceTypeAttributes_default;
+    attr.displayName = UA_LOCALIZEDTEXT("en-US", "CustomReference");
+    attr.inverseName = UA_LOCALIZEDTEXT("en-US", "InverseCustomReference");
+    UA_NodeId refType = UA_NODEID_NUMERIC(1, 60010);
+    UA_StatusCode res =
+        UA_Server_addReferenceTypeNode(server, refType,
+                                       UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                       hasSubtype, UA_QUALIFIEDNAME(1, "CustomReference"),
+                                       attr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+
+    UA_ObjectAttributes oattr = UA_ObjectAttributes_default;
+    res = UA_Server_addObjectNode(server, UA_NODEID_NUMERIC(1, 60011),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  refType, UA_QUALIFIEDNAME(1, "Child"),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                  oattr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+
+    UA_BrowseDescription bd;
+    UA_BrowseDescription_init(&bd);
+    bd.nodeId = UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER);
+    bd.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HIERARCHICALREFERENCES);
+    bd.includeSubtypes = true;
+    bd.browseDirection = UA_BROWSEDIRECTION_FORWARD;
+    UA_BrowseResult br = UA_Server_browse(server, 0, &bd);
+    ck_assert_uint_eq(br.statusCode, UA_STATUSCODE_GOOD);
+    UA_NodeId child = UA_NODEID_NUMERIC(1, 60011);
+    UA_Boolean found = false;
+    for(size_t i = 0; i < br.referencesSize; i++) {
+        if(UA_NodeId_equal(&br.references[i].nodeId.nodeId, &child))
+            found = true;
+    }
+    ck_assert(found);
+    UA_BrowseResult_clear(&br);
+} END_TEST
+
+START_TEST(TypeHierarchy_deleteSubtree) {
+    ck_assert_uint_eq(addObjectType(60000, 0, UA_NS0ID_BASEOBJECTTYPE), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addObjectType(60001, 1, 60000), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(addObjectType(60002, 1, 60001), UA_STATUSCODE_GOOD);
+    ck_assert(isSubtype(60002, 1, 60000));
+    ck_assert(server->typeHierarchy.valid);
+
+    /* Remove the HasSubtype reference between the first two types. The
+     * subtree below is updated without a rebuild. */
+    UA_ExpandedNodeId target = UA_EXPANDEDNODEID_NUMERIC(1, 60001);
+    UA_StatusCode res =
+        UA_Server_deleteReference(server, UA_NODEID_NUMERIC(1, 60000), hasSubtype,
+                                  true, target, true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert(server->typeHierarchy.valid);
+    ck_assert(!isSubtype(60001, 1, 60000));
+    ck_assert(!isSubtype(60002, 1, 60000));
+    ck_assert(!isSubtype(60002, 0, UA_NS0ID_BASEOBJECTTYPE));
+    ck_assert(isSubtype(60002, 1, 60001));
+    ck_assert(isSubtype(60000, 0, UA_NS0ID_BASEOBJECTTYPE));
+
+    /* Add the reference again */
+    res = UA_Server_addReference(server, UA_NODEID_NUMERIC(1, 60000), hasSubtype,
+                                 target, true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert(server->typeHierarchy.valid);
+    ck_assert(isSubtype(60002, 0, UA_NS0ID_BASEOBJECTTYPE));
+
+    /* Delete the type node at the bottom */
+    res = UA_Server_deleteNode(server, UA_NODEID_NUMERIC(1, 60002), true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    ck_assert(server->typeHierarchy.valid);
+    ck_assert(!isSubtype(60002, 1, 60000));
+    ck_assert(isSubtype(60001, 0, UA_NS0ID_BASEOBJECTTYPE));
+
+    /* Removing a type from the cache updates the subtypes below */
+    ck_assert_uint_eq(addObjectType(60002, 1, 60001), UA_STATUSCODE_GOOD);
+    UA_NodeId middle = UA_NODEID_NUMERIC(1, 60001);
+    UA_LOCK(server->serviceMutex);
+    UA_TypeHierarchy_removeType(&server->typeHierarchy, &middle);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert(server->typeHierarchy.valid);
+    ck_assert(!isSubtype(60001, 1, 60000));
+    ck_assert(!isSubtype(60002, 1, 60000));
+    ck_assert(!isSubtype(60002, 0, UA_NS0ID_BASEOBJECTTYPE));
+    ck_assert(isSubtype(60000, 0, UA_NS0ID_BASEOBJECTTYPE));
+} END_TEST
+
+static Suite *testSuite_TypeHierarchy(void) {
+    Suite *s = suite_create("Type Hierarchy");
+    TCase *tc = tcase_create("TypeHierarchy");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, TypeHierarchy_incrementalAdd);
+    tcase_add_test(tc, TypeHierarchy_browseSubtypes);
+    tcase_add_test(tc, TypeHierarchy_deleteSubtree);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_TypeHierarchy();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
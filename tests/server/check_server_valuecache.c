@@ -0,0 +1,237 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/client_subscriptions.h>
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+#include "server/ua_services.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+static size_t reads;
+static UA_Int32 deviceValue;
+
+static UA_StatusCode
+readDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    reads++;
+    value->hasValue = true;
+    if(includeSourceTimeStamp) {
+        value->hasSourceTimestamp = true;
+        value->sourceTimestamp = 1234;
+    }
+    return UA_Variant_setScalarCopy(&value->value, &deviceValue, &UA_TYPES[UA_TYPES_INT32]);
+}
+
+static UA_StatusCode
+writeDevice(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+            const UA_NodeId *nodeId, void *nodeContext,
+            const UA_NumericRange *range, const UA_DataValue *value) {
+    deviceValue = *(UA_Int32*)value->value.data;
+    return UA_STATUSCODE_GOOD;
+}
+
+static void
+addDevice(UA_UInt32 id) {
+    UA_DataSource ds;
+    ds.read = readDevice;
+    ds.write = writeDevice;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_StatusCode retval =
+        UA_Server_addDataSourceVariableNode(server, UA_NODEID_NUMERIC(1, id),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                            UA_QUALIFIEDNAME(1, "Device"),
+                                            UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                            attr, ds, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig *config = UA_Server_getConfig(server);
+    UA_ServerConfig_setDefault(config);
+    config->valueCacheSize = 2;
+    deviceValue = 42;
+    addDevice(50000);
+    addDevice(50001);
+    addDevice(50002);
+    UA_ValueCache_clear(&server->valueCache); /* Filled when adding the nodes */
+    reads = 0;
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static UA_DataValue
+readDeviceValue(UA_UInt32 id, UA_Double maxAge, const char *indexRange) {
+    UA_ReadValueId rvi;
+    UA_ReadValueId_init(&rvi);
+    rvi.nodeId = UA_NODEID_NUMERIC(1, id);
+    rvi.attributeId = UA_ATTRIBUTEID_VALUE;
+    if(indexRange)
+        rvi.indexRange = UA_STRING((char*)(uintptr_t)indexRange);
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.maxAge = maxAge;
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_SOURCE;
+    request.nodesToRead = &rvi;
+    request.nodesToReadSize = 1;
+    UA_ReadResponse response;
+    UA_ReadResponse_init(&response);
+    UA_LOCK(server->serviceMutex);
+    Service_Read(server, &server->adminSession, &request, &response);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 1);
+    UA_DataValue dv = response.results[0];
+    UA_DataValue_init(&response.results[0]);
+    UA_ReadResponse_clear(&response);
+    return dv;
+}
+
+START_TEST(ValueCache_maxAge) {
+    UA_DataValue dv = readDeviceValue(50000, 10000.0, NULL);
+    ck_assert_uint_eq(reads, 1);
+    UA_DataValue_clear(&dv);
+
+    /* Taken from the cache with the original source timestamp */
+    deviceValue = 43;
+    dv = readDeviceValue(50000, 10000.0, NULL);
+    ck_assert_uint_eq(reads, 1);
+    ck_assert_int_eq(*(UA_Int32*)dv.value.data, 42);
+    ck_assert(dv.hasSourceTimestamp);
+    ck_assert_int_eq(dv.sourceTimestamp, 1234);
+    UA_DataValue_clear(&dv);
+
+    /* maxAge 0 always reads the DataSource */
+    dv = readDeviceValue(50000, 0.0, NULL);
+    ck_assert_uint_eq(reads, 2);
+    ck_assert_int_eq(*(UA_Int32*)dv.value.data, 43);
+    UA_DataValue_clear(&dv);
+
+    UA_ValueCacheStatistics stats;
+    UA_Server_getValueCacheStatistics(server, &stats);
+    ck_assert_uint_eq(stats.hits, 1);
+    ck_assert_uint_eq(stats.misses, 1);
+    ck_assert_uint_eq(stats.entries, 1);
+} END_TEST
+
+START_TEST(ValueCache_disabled) {
+    UA_Server_getConfig(server)->valueCacheSize = 0;
+    UA_DataValue dv = readDeviceValue(50000, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+    dv = readDeviceValue(50000, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+    ck_assert_uint_eq(reads, 2);
+} END_TEST
+
+START_TEST(ValueCache_indexRange) {
+    UA_DataValue dv = readDeviceValue(50000, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+    /* Reads with an index range bypass the cache */
+    dv = readDeviceValue(50000, 10000.0, "0");
+    UA_DataValue_clear(&dv);
+    ck_assert_uint_eq(reads, 2);
+} END_TEST
+
+START_TEST(ValueCache_writeInvalidates) {
+    UA_DataValue dv = readDeviceValue(50000, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+
+    UA_Int32 v = 7;
+    UA_Variant value;
+    UA_Variant_setScalar(&value, &v, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval = UA_Server_writeValue(server, UA_NODEID_NUMERIC(1, 50000), value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    dv = readDeviceValue(50000, 10000.0, NULL);
+    ck_assert_uint_eq(reads, 2);
+    ck_assert_int_eq(*(UA_Int32*)dv.value.data, 7);
+    UA_DataValue_clear(&dv);
+} END_TEST
+
+START_TEST(ValueCache_evict) {
+    for(UA_UInt32 i = 0; i < 3; i++) {
+        UA_DataValue dv = readDeviceValue(50000 + i, 10000.0, NULL);
+        UA_DataValue_clear(&dv);
+    }
+    UA_ValueCacheStatistics stats;
+    UA_Server_getValueCacheStatistics(server, &stats);
+    ck_assert_uint_eq(stats.entries, 2);
+
+    /* The least recently read value was evicted */
+    UA_DataValue dv = readDeviceValue(50000, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+    ck_assert_uint_eq(reads, 4);
+    dv = readDeviceValue(50002, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+    ck_assert_uint_eq(reads, 4);
+} END_TEST
+
+START_TEST(ValueCache_deleteNode) {
+    UA_DataValue dv = readDeviceValue(50000, 10000.0, NULL);
+    UA_DataValue_clear(&dv);
+    UA_StatusCode retval = UA_Server_deleteNode(server, UA_NODEID_NUMERIC(1, 50000), true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_ValueCacheStatistics stats;
+    UA_Server_getValueCacheStatistics(server, &stats);
+    ck_assert_uint_eq(stats.entries, 0);
+} END_TEST
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+static void
+dataChangeCallback(UA_Server *s, UA_UInt32 monitoredItemId, void *monitoredItemContext,
+                   const UA_NodeId *nodeId, void *nodeContext, UA_UInt32 attributeId,
+                   const UA_DataValue *value) {
+}
+
+START_TEST(ValueCache_sampling) {
+    /* The first sample takes the value from the example read when the
+     * MonitoredItem is created */
+    UA_MonitoredItemCreateRequest item =
+        UA_MonitoredItemCreateRequest_default(UA_NODEID_NUMERIC(1, 50000));
+    item.requestedParameters.samplingInterval = 10000.0;
+    UA_MonitoredItemCreateResult result =
+        UA_Server_createDataChangeMonitoredItem(server, UA_TIMESTAMPSTORETURN_BOTH,
+                                                item, NULL, dataChangeCallback);
+    ck_assert_uint_eq(result.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(reads, 1);
+    UA_ValueCacheStatistics stats;
+    UA_Server_getValueCacheStatistics(server, &stats);
+    ck_assert_uint_eq(stats.hits, 1);
+} END_TEST
+#endif
+
+static Suite *testSuite_ValueCache(void) {
+    Suite *s = suite_create("Value Cache");
+    TCase *tc = tcase_create("Read");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, ValueCache_maxAge);
+    tcase_add_test(tc, ValueCache_disabled);
+    tcase_add_test(tc, ValueCache_indexRange);
+    tcase_add_test(tc, ValueCache_writeInvalidates);
+    tcase_add_test(tc, ValueCache_evict);
+    tcase_add_test(tc, ValueCache_deleteNode);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    tcase_add_test(tc, ValueCache_sampling);
+#endif
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_ValueCache();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
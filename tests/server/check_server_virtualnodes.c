@@ -0,0 +1,186 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+static UA_NodeId typeId = {1, UA_NODEIDTYPE_NUMERIC, {5000}};
+static UA_NodeId declarationId = {1, UA_NODEIDTYPE_NUMERIC, {5001}};
+static UA_NodeId instanceId = {1, UA_NODEIDTYPE_NUMERIC, {5002}};
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+
+    UA_ObjectTypeAttributes otAttr = UA_ObjectTypeAttributes_default;
+    UA_StatusCode retval =
+        UA_Server_addObjectTypeNode(server, typeId,
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_HASSUBTYPE),
+                                    UA_QUALIFIEDNAME(1, "DeviceType"), otAttr,
+                                    NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_VariableAttributes vAttr = UA_VariableAttributes_default;
+    vAttr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_Int32 value = 7;
+    UA_Variant_setScalar(&vAttr.value, &value, &UA_TYPES[UA_TYPES_INT32]);
+    retval = UA_Server_addVariableNode(server, declarationId, typeId,
+                                       UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT),
+                                       UA_QUALIFIEDNAME(1, "Setpoint"),
+                                       UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                       vAttr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    retval = UA_Server_addReference(server, declarationId,
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_HASMODELLINGRULE),
+                                    UA_EXPANDEDNODEID_NUMERIC(0, UA_NS0ID_MODELLINGRULE_MANDATORY),
+                                    true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    retval = UA_Server_setVirtualInstanceChildren(server, typeId, true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_ObjectAttributes oAttr = UA_ObjectAttributes_default;
+    retval = UA_Server_addObjectNode(server, instanceId,
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                     UA_QUALIFIEDNAME(1, "Device"), typeId,
+                                     oAttr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static UA_NodeId
+findChild(void) {
+    UA_RelativePathElement rpe;
+    UA_RelativePathElement_init(&rpe);
+    rpe.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT);
+    rpe.targetName = UA_QUALIFIEDNAME(1, "Setpoint");
+    UA_BrowsePath bp;
+    UA_BrowsePath_init(&bp);
+    bp.startingNode = instanceId;
+    bp.relativePath.elementsSize = 1;
+    bp.relativePath.elements = &rpe;
+    UA_BrowsePathResult bpr = UA_Server_translateBrowsePathToNodeIds(server, &bp);
+    ck_assert_uint_eq(bpr.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(bpr.targetsSize, 1);
+    UA_NodeId childId;
+    UA_NodeId_copy(&bpr.targets[0].targetId.nodeId, &childId);
+    UA_BrowsePathResult_clear(&bpr);
+    return childId;
+}
+
+static UA_Boolean
+isStored(const UA_NodeId *nodeId) {
+    const UA_Node *node = UA_Nodestore_getNode(server->nsCtx, nodeId);
+    if(!node)
+        return false;
+    UA_Nodestore_releaseNode(server->nsCtx, node);
+    return true;
+}
+
+START_TEST(Virtual_readChild) {
+    UA_NodeId childId = findChild();
+    ck_assert_int_eq(childId.identifierType, UA_NODEIDTYPE_BYTESTRING);
+    ck_assert(!isStored(&childId));
+
+    UA_Variant value;
+    UA_StatusCode retval = UA_Server_readValue(server, childId, &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)value.data, 7);
+    UA_Variant_clear(&value);
+
+    /* The child points back to the instance */
+    UA_BrowseDescription bd;
+    UA_BrowseDescription_init(&bd);
+    bd.nodeId = childId;
+    bd.browseDirection = UA_BROWSEDIRECTION_INVERSE;
+    bd.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT);
+    bd.resultMask = UA_BROWSERESULTMASK_ALL;
+    UA_BrowseResult br = UA_Server_browse(server, 0, &bd);
+    ck_assert_uint_eq(br.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(br.referencesSize, 1);
+    ck_assert(UA_NodeId_equal(&br.references[0].nodeId.nodeId, &instanceId));
+    UA_BrowseResult_clear(&br);
+
+    /* Reading did not store the node */
+    ck_assert(!isStored(&childId));
+    UA_NodeId_clear(&childId);
+} END_TEST
+
+START_TEST(Virtual_writeMaterializes) {
+    UA_NodeId childId = findChild();
+    UA_Int32 newValue = 42;
+    UA_Variant value;
+    UA_Variant_setScalar(&value, &newValue, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval = UA_Server_writeValue(server, childId, value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert(isStored(&childId));
+
+    retval = UA_Server_readValue(server, childId, &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)value.data, 42);
+    UA_Variant_clear(&value);
+
+    /* The declaration is unchanged */
+    retval = UA_Server_readValue(server, declarationId, &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)value.data, 7);
+    UA_Variant_clear(&value);
+
+    /* Deleting the instance removes the materialized child */
+    retval = UA_Server_deleteNode(server, instanceId, true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert(!isStored(&childId));
+    UA_NodeId_clear(&childId);
+} END_TEST
+
+START_TEST(Virtual_forgedId) {
+    /* The encoding is valid, but the instance does not reference the child */
+    UA_NodeId forged;
+    UA_NodeId other = UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER);
+    UA_StatusCode retval = UA_VirtualNodes_encodeId(&other, &declarationId, &forged);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Variant value;
+    retval = UA_Server_readValue(server, forged, &value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNODEIDUNKNOWN);
+    UA_NodeId_clear(&forged);
+} END_TEST
+
+START_TEST(Virtual_onlyObjectTypes) {
+    UA_StatusCode retval =
+        UA_Server_setVirtualInstanceChildren(server, declarationId, true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNODECLASSINVALID);
+    retval = UA_Server_setVirtualInstanceChildren(server, typeId, false);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+} END_TEST
+
+static Suite *testSuite_VirtualNodes(void) {
+    Suite *s = suite_create("Virtual Nodes");
+    TCase *tc = tcase_create("Virtual Instance Children");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, Virtual_readChild);
+    tcase_add_test(tc, Virtual_writeMaterializes);
+    tcase_add_test(tc, Virtual_forgedId);
+    tcase_add_test(tc, Virtual_onlyObjectTypes);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_VirtualNodes();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
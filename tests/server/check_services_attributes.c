@@ -824,6 +824,92 @@ START_TEST(WriteSingleAttributeValueRangeFromArray) {
     ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
 } END_TEST
 
+static const void *
+arrayData(void) {
+    UA_NodeId id = UA_NODEID_STRING(1, "myarray");
+    const UA_VariableNode *node = (const UA_VariableNode*)
+        UA_Nodestore_getNode(server->nsCtx, &id);
+    ck_assert_ptr_ne(node, NULL);
+    const void *data = node->value.data.value.value.data;
+    UA_Nodestore_releaseNode(server->nsCtx, (const UA_Node*)node);
+    return data;
+}
+
+START_TEST(WriteSingleAttributeValueSameShape) {
+    UA_Int32 myIntegerArray[9] = {9,8,7,6,5,4,3,2,1};
+    UA_UInt32 myIntegerDimensions[2] = {3,3};
+    UA_Variant value;
+    UA_Variant_setArray(&value, myIntegerArray, 9, &UA_TYPES[UA_TYPES_INT32]);
+    value.arrayDimensions = myIntegerDimensions;
+    value.arrayDimensionsSize = 2;
+
+    const void *before = arrayData();
+    UA_StatusCode retval = UA_Server_writeValue(server, UA_NODEID_STRING(1, "myarray"), value);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+#ifndef UA_ENABLE_IMMUTABLE_NODES
+    /* Overwritten in place */
+    ck_assert_ptr_eq(arrayData(), before);
+#else
+    (void)before;
+#endif
+
+    UA_Variant out;
+    retval = UA_Server_readValue(server, UA_NODEID_STRING(1, "myarray"), &out);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(out.arrayLength, 9);
+    ck_assert_uint_eq(out.arrayDimensionsSize, 2);
+    ck_assert_int_eq(((UA_Int32*)out.data)[0], 9);
+    ck_assert_int_eq(((UA_Int32*)out.data)[8], 1);
+    UA_Variant_clear(&out);
+
+    /* A different length is written as a new value */
+    UA_Variant_setArray(&value, myIntegerArray, 4, &UA_TYPES[UA_TYPES_INT32]);
+    retval = UA_Server_writeValue(server, UA_NODEID_STRING(1, "myarray"), value);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    retval = UA_Server_readValue(server, UA_NODEID_STRING(1, "myarray"), &out);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(out.arrayLength, 4);
+    ck_assert_uint_eq(out.arrayDimensionsSize, 0);
+    UA_Variant_clear(&out);
+} END_TEST
+
+START_TEST(WriteSingleAttributeValueSameType) {
+    UA_Int32 myInteger = 21;
+    UA_Variant value;
+    UA_Variant_setScalar(&value, &myInteger, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval =
+        UA_Server_writeValueSameType(server, UA_NODEID_STRING(1, "the.answer"), value);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+
+    UA_Variant out;
+    retval = UA_Server_readValue(server, UA_NODEID_STRING(1, "the.answer"), &out);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)out.data, 21);
+    UA_Variant_clear(&out);
+
+    /* A value of another type is fully type-checked */
+    UA_VariableAttributes vattr = UA_VariableAttributes_default;
+    vattr.dataType = UA_TYPES[UA_TYPES_INT32].typeId;
+    vattr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_Variant_setScalar(&vattr.value, &myInteger, &UA_TYPES[UA_TYPES_INT32]);
+    retval = UA_Server_addVariableNode(server, UA_NODEID_STRING(1, "typed"),
+                                       UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                       UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                       UA_QUALIFIEDNAME(1, "typed"),
+                                       UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                       vattr, NULL, NULL);
+    ck_assert_int_eq(retval, UA_STATUSCODE_GOOD);
+    UA_String str = UA_STRING("foo");
+    UA_Variant_setScalar(&value, &str, &UA_TYPES[UA_TYPES_STRING]);
+    retval = UA_Server_writeValueSameType(server, UA_NODEID_STRING(1, "typed"), value);
+    ck_assert_int_eq(retval, UA_STATUSCODE_BADTYPEMISMATCH);
+
+    /* Only variables */
+    retval = UA_Server_writeValueSameType(server,
+                                          UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER), value);
+    ck_assert_int_eq(retval, UA_STATUSCODE_BADNODECLASSINVALID);
+} END_TEST
+
 START_TEST(WriteSingleAttributeDataType) {
     UA_WriteValue wValue;
     UA_WriteValue_init(&wValue);
@@ -977,6 +1063,8 @@ static Suite * testSuite_services_attributes(void) {
     tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeDataType);
     tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeValueRangeFromScalar);
     tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeValueRangeFromArray);
+    tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeValueSameShape);
+    tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeValueSameType);
     tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeValueRank);
     tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeArrayDimensions);
     tcase_add_test(tc_writeSingleAttributes, WriteSingleAttributeAccessLevel);
@@ -266,6 +266,127 @@ START_TEST(AddNodeTwiceGivesError) {
     ck_assert_int_eq(res, UA_STATUSCODE_BADNODEIDEXISTS);
 } END_TEST
 
+static void
+setupAddNodesItem(UA_AddNodesItem *item, UA_NodeClass nodeClass, UA_NodeId id,
+                  UA_NodeId parent, UA_NodeId typeDefinition,
+                  const void *attr, const UA_DataType *attrType) {
+    UA_AddNodesItem_init(item);
+    item->nodeClass = nodeClass;
+    item->requestedNewNodeId.nodeId = id;
+    item->parentNodeId.nodeId = parent;
+    item->referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT);
+    item->browseName = UA_QUALIFIEDNAME(1, "BulkNode");
+    item->typeDefinition.nodeId = typeDefinition;
+    item->nodeAttributes.encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+    item->nodeAttributes.content.decoded.type = attrType;
+    item->nodeAttributes.content.decoded.data = (void*)(uintptr_t)attr;
+}
+
+START_TEST(AddNodesBulk) {
+    UA_ObjectAttributes oattr = UA_ObjectAttributes_default;
+    UA_VariableAttributes vattr = UA_VariableAttributes_default;
+    UA_Int32 value = 42;
+    UA_Variant_setScalar(&vattr.value, &value, &UA_TYPES[UA_TYPES_INT32]);
+    UA_NodeId objectId = UA_NODEID_NUMERIC(1, 70000);
+
+    /* The variables come before their parent object */
+    UA_AddNodesItem items[5];
+    for(size_t i = 0; i < 3; i++)
+        setupAddNodesItem(&items[i], UA_NODECLASS_VARIABLE,
+                          UA_NODEID_NUMERIC(1, 70001 + (UA_UInt32)i), objectId,
+                          UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                          &vattr, &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]);
+    setupAddNodesItem(&items[3], UA_NODECLASS_OBJECT, objectId,
+                      UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                      UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                      &oattr, &UA_TYPES[UA_TYPES_OBJECTATTRIBUTES]);
+    items[3].referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES);
+
+    /* A variable with an object type as type definition fails */
+    setupAddNodesItem(&items[4], UA_NODECLASS_VARIABLE, UA_NODEID_NUMERIC(1, 70004),
+                      objectId, UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                      &vattr, &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]);
+
+    UA_AddNodesResult results[5];
+    UA_StatusCode res = UA_Server_addNodes(server, 5, items, NULL, results);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    for(size_t i = 0; i < 4; i++)
+        ck_assert_uint_eq(results[i].statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(results[4].statusCode, UA_STATUSCODE_BADTYPEDEFINITIONINVALID);
+
+    /* The failed node was removed */
+    UA_NodeId outId;
+    res = UA_Server_readNodeId(server, UA_NODEID_NUMERIC(1, 70004), &outId);
+    ck_assert_uint_eq(res, UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+    /* The object has the three variables as components */
+    UA_BrowseDescription bd;
+    UA_BrowseDescription_init(&bd);
+    bd.nodeId = objectId;
+    bd.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT);
+    bd.browseDirection = UA_BROWSEDIRECTION_FORWARD;
+    UA_BrowseResult br = UA_Server_browse(server, 0, &bd);
+    ck_assert_uint_eq(br.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(br.referencesSize, 3);
+    UA_BrowseResult_clear(&br);
+
+    for(size_t i = 0; i < 5; i++)
+        UA_AddNodesResult_clear(&results[i]);
+} END_TEST
+
+/* UA_NS0ID_MODELLINGRULE_MANDATORY is not available in Minimal Nodeset */
+#ifdef UA_GENERATED_NAMESPACE_ZERO
+START_TEST(AddNodesBulkInstantiate) {
+    /* An object type with a mandatory variable */
+    UA_NodeId typeId = UA_NODEID_NUMERIC(1, 71000);
+    UA_ObjectTypeAttributes tattr = UA_ObjectTypeAttributes_default;
+    UA_StatusCode res =
+        UA_Server_addObjectTypeNode(server, typeId,
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_HASSUBTYPE),
+                                    UA_QUALIFIEDNAME(1, "BulkType"), tattr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    UA_NodeId childId = UA_NODEID_NUMERIC(1, 71001);
+    UA_VariableAttributes vattr = UA_VariableAttributes_default;
+    res = UA_Server_addVariableNode(server, childId, typeId,
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT),
+                                    UA_QUALIFIEDNAME(1, "Child"),
+                                    UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                    vattr, NULL, NULL);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    res = UA_Server_addReference(server, childId,
+                                 UA_NODEID_NUMERIC(0, UA_NS0ID_HASMODELLINGRULE),
+                                 UA_EXPANDEDNODEID_NUMERIC(0, UA_NS0ID_MODELLINGRULE_MANDATORY),
+                                 true);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+
+    /* Every object of the batch gets the child */
+    UA_ObjectAttributes oattr = UA_ObjectAttributes_default;
+    UA_AddNodesItem items[3];
+    for(size_t i = 0; i < 3; i++)
+        setupAddNodesItem(&items[i], UA_NODECLASS_OBJECT,
+                          UA_NODEID_NUMERIC(1, 71002 + (UA_UInt32)i),
+                          UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER), typeId,
+                          &oattr, &UA_TYPES[UA_TYPES_OBJECTATTRIBUTES]);
+    UA_AddNodesResult results[3];
+    res = UA_Server_addNodes(server, 3, items, NULL, results);
+    ck_assert_uint_eq(res, UA_STATUSCODE_GOOD);
+    for(size_t i = 0; i < 3; i++) {
+        ck_assert_uint_eq(results[i].statusCode, UA_STATUSCODE_GOOD);
+        UA_BrowseDescription bd;
+        UA_BrowseDescription_init(&bd);
+        bd.nodeId = results[i].addedNodeId;
+        bd.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASCOMPONENT);
+        bd.browseDirection = UA_BROWSEDIRECTION_FORWARD;
+        UA_BrowseResult br = UA_Server_browse(server, 0, &bd);
+        ck_assert_uint_eq(br.statusCode, UA_STATUSCODE_GOOD);
+        ck_assert_uint_eq(br.referencesSize, 1);
+        UA_BrowseResult_clear(&br);
+        UA_AddNodesResult_clear(&results[i]);
+    }
+} END_TEST
+#endif
+
 static UA_Boolean constructorCalled = false;
 
 static UA_StatusCode
@@ -629,6 +750,10 @@ int main(void) {
     tcase_add_test(tc_addnodes, InstantiateVariableTypeNodeLessDims);
     tcase_add_test(tc_addnodes, AddComplexTypeWithInheritance);
     tcase_add_test(tc_addnodes, AddNodeTwiceGivesError);
+    tcase_add_test(tc_addnodes, AddNodesBulk);
+#ifdef UA_GENERATED_NAMESPACE_ZERO
+    tcase_add_test(tc_addnodes, AddNodesBulkInstantiate);
+#endif
     tcase_add_test(tc_addnodes, AddObjectWithConstructor);
     tcase_add_test(tc_addnodes, InstantiateObjectType);
     suite_add_tcase(s, tc_addnodes);
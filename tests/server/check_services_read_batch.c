@@ -0,0 +1,216 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+#include "server/ua_services.h"
+
+#include <check.h>
+
+#define NUMBER_OF_VARIABLES 10
+
+static UA_Server *server = NULL;
+static size_t singleReads;
+static size_t batchCalls;
+static size_t batchItems;
+static size_t otherBatchCalls;
+static UA_StatusCode batchResult;
+
+static UA_StatusCode
+readSingle(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+           const UA_NodeId *nodeId, void *nodeContext, UA_Boolean includeSourceTimeStamp,
+           const UA_NumericRange *range, UA_DataValue *value) {
+    singleReads++;
+    UA_Int32 v = (UA_Int32)(uintptr_t)nodeContext;
+    value->hasValue = true;
+    return UA_Variant_setScalarCopy(&value->value, &v, &UA_TYPES[UA_TYPES_INT32]);
+}
+
+static UA_Int32 block[NUMBER_OF_VARIABLES];
+
+static UA_StatusCode
+readBatch(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+          UA_Boolean includeSourceTimeStamp, size_t itemsSize,
+          const UA_DataSourceReadItem *items, UA_DataValue *values) {
+    batchCalls++;
+    batchItems += itemsSize;
+    if(batchResult != UA_STATUSCODE_GOOD)
+        return batchResult;
+    /* Point into the block buffer that is reused for the next call */
+    for(size_t i = 0; i < itemsSize; i++) {
+        UA_Int32 v = (UA_Int32)(uintptr_t)items[i].nodeContext;
+        block[i] = v;
+        if(items[i].range) {
+            values[i].hasStatus = true;
+            values[i].status = UA_STATUSCODE_BADINDEXRANGEINVALID;
+            continue;
+        }
+        UA_Variant_setScalar(&values[i].value, &block[i], &UA_TYPES[UA_TYPES_INT32]);
+        values[i].value.storageType = UA_VARIANT_DATA_NODELETE;
+        values[i].hasValue = true;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+static UA_StatusCode
+readOtherBatch(UA_Server *s, const UA_NodeId *sessionId, void *sessionContext,
+               UA_Boolean includeSourceTimeStamp, size_t itemsSize,
+               const UA_DataSourceReadItem *items, UA_DataValue *values) {
+    otherBatchCalls++;
+    return readBatch(s, sessionId, sessionContext, includeSourceTimeStamp,
+                     itemsSize, items, values);
+}
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+
+    UA_DataSource ds;
+    ds.read = readSingle;
+    ds.write = NULL;
+    for(UA_UInt32 i = 0; i < NUMBER_OF_VARIABLES; i++) {
+        UA_VariableAttributes attr = UA_VariableAttributes_default;
+        UA_NodeId id = UA_NODEID_NUMERIC(1, 10000 + i);
+        UA_StatusCode retval =
+            UA_Server_addDataSourceVariableNode(server, id,
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                                UA_QUALIFIEDNAME(1, "Tag"),
+                                                UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                                attr, ds, (void*)(uintptr_t)(100 + i), NULL);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+        /* The last variable belongs to another driver */
+        retval = UA_Server_setVariableNode_dataSourceReadBatch(server, id,
+                     (i < NUMBER_OF_VARIABLES - 1) ? readBatch : readOtherBatch);
+        ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    }
+
+    singleReads = 0;
+    batchCalls = 0;
+    batchItems = 0;
+    otherBatchCalls = 0;
+    batchResult = UA_STATUSCODE_GOOD;
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static void
+readTags(size_t count, const char *indexRange, UA_ReadResponse *response) {
+    UA_ReadValueId rvi[NUMBER_OF_VARIABLES + 1];
+    for(size_t i = 0; i < count; i++) {
+        UA_ReadValueId_init(&rvi[i]);
+        rvi[i].nodeId = UA_NODEID_NUMERIC(1, 10000 + (UA_UInt32)i);
+        rvi[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        if(indexRange)
+            rvi[i].indexRange = UA_STRING((char*)(uintptr_t)indexRange);
+    }
+    /* A variable without batched read at the end */
+    UA_ReadValueId_init(&rvi[count]);
+    rvi[count].nodeId = UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER_SERVERSTATUS_STATE);
+    rvi[count].attributeId = UA_ATTRIBUTEID_VALUE;
+
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.nodesToRead = rvi;
+    request.nodesToReadSize = count + 1;
+    UA_ReadResponse_init(response);
+    UA_LOCK(server->serviceMutex);
+    Service_Read(server, &server->adminSession, &request, response);
+    UA_Session_releasePinnedNodes(server, &server->adminSession);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response->responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response->resultsSize, count + 1);
+}
+
+START_TEST(Batch_groupByCallback) {
+    UA_ReadResponse response;
+    readTags(NUMBER_OF_VARIABLES, NULL, &response);
+    ck_assert_uint_eq(singleReads, 0);
+    ck_assert_uint_eq(batchCalls, 2);
+    ck_assert_uint_eq(otherBatchCalls, 1);
+    ck_assert_uint_eq(batchItems, NUMBER_OF_VARIABLES);
+    for(size_t i = 0; i < NUMBER_OF_VARIABLES; i++) {
+        ck_assert(response.results[i].hasValue);
+        ck_assert_int_eq(response.results[i].value.storageType, UA_VARIANT_DATA);
+        ck_assert_int_eq(*(UA_Int32*)response.results[i].value.data, 100 + (UA_Int32)i);
+    }
+    ck_assert(response.results[NUMBER_OF_VARIABLES].hasValue);
+    UA_ReadResponse_clear(&response);
+} END_TEST
+
+START_TEST(Batch_singleOperation) {
+    /* A single DataSource operation is read individually */
+    UA_ReadResponse response;
+    readTags(1, NULL, &response);
+    ck_assert_uint_eq(singleReads, 1);
+    ck_assert_uint_eq(batchCalls, 0);
+    ck_assert_int_eq(*(UA_Int32*)response.results[0].value.data, 100);
+    UA_ReadResponse_clear(&response);
+} END_TEST
+
+START_TEST(Batch_error) {
+    batchResult = UA_STATUSCODE_BADCOMMUNICATIONERROR;
+    UA_ReadResponse response;
+    readTags(NUMBER_OF_VARIABLES, NULL, &response);
+    ck_assert_uint_eq(singleReads, 0);
+    for(size_t i = 0; i < NUMBER_OF_VARIABLES; i++) {
+        ck_assert(response.results[i].hasStatus);
+        ck_assert_uint_eq(response.results[i].status, UA_STATUSCODE_BADCOMMUNICATIONERROR);
+    }
+    UA_ReadResponse_clear(&response);
+} END_TEST
+
+START_TEST(Batch_indexRange) {
+    UA_ReadResponse response;
+    readTags(NUMBER_OF_VARIABLES, "1", &response);
+    ck_assert_uint_eq(batchItems, NUMBER_OF_VARIABLES);
+    for(size_t i = 0; i < NUMBER_OF_VARIABLES; i++)
+        ck_assert_uint_eq(response.results[i].status, UA_STATUSCODE_BADINDEXRANGEINVALID);
+    UA_ReadResponse_clear(&response);
+} END_TEST
+
+START_TEST(Batch_newDataSourceRemovesBatch) {
+    UA_DataSource ds;
+    ds.read = readSingle;
+    ds.write = NULL;
+    UA_StatusCode retval =
+        UA_Server_setVariableNode_dataSource(server, UA_NODEID_NUMERIC(1, 10000), ds);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_ReadResponse response;
+    readTags(NUMBER_OF_VARIABLES, NULL, &response);
+    ck_assert_uint_eq(singleReads, 1);
+    ck_assert_uint_eq(batchItems, NUMBER_OF_VARIABLES - 1);
+    UA_ReadResponse_clear(&response);
+
+    /* Only variables have a batched read */
+    retval = UA_Server_setVariableNode_dataSourceReadBatch(server,
+                 UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER), readBatch);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADNODECLASSINVALID);
+} END_TEST
+
+static Suite *testSuite_ReadBatch(void) {
+    Suite *s = suite_create("Batched DataSource Reads");
+    TCase *tc = tcase_create("Read");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, Batch_groupByCallback);
+    tcase_add_test(tc, Batch_singleOperation);
+    tcase_add_test(tc, Batch_error);
+    tcase_add_test(tc, Batch_indexRange);
+    tcase_add_test(tc, Batch_newDataSourceRemovesBatch);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_ReadBatch();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
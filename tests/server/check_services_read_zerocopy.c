@@ -0,0 +1,167 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+#include "server/ua_services.h"
+
+#include <check.h>
+
+#define ARRAY_LENGTH 10000
+
+static UA_Server *server = NULL;
+static UA_NodeId arrayId = {1, UA_NODEIDTYPE_NUMERIC, {6000}};
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+
+    UA_Int32 *array = (UA_Int32*)UA_Array_new(ARRAY_LENGTH, &UA_TYPES[UA_TYPES_INT32]);
+    for(UA_Int32 i = 0; i < ARRAY_LENGTH; i++)
+        array[i] = i;
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    attr.valueRank = UA_VALUERANK_ONE_DIMENSION;
+    UA_UInt32 arrayDims = ARRAY_LENGTH;
+    attr.arrayDimensions = &arrayDims;
+    attr.arrayDimensionsSize = 1;
+    UA_Variant_setArray(&attr.value, array, ARRAY_LENGTH, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval =
+        UA_Server_addVariableNode(server, arrayId,
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                  UA_QUALIFIEDNAME(1, "Array"),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                  attr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Array_delete(array, ARRAY_LENGTH, &UA_TYPES[UA_TYPES_INT32]);
+}
+
+static void teardown(void) {
+    UA_Server_delete(server);
+}
+
+static void
+readArray(const char *indexRange, UA_ReadResponse *response) {
+    UA_ReadValueId rvi;
+    UA_ReadValueId_init(&rvi);
+    rvi.nodeId = arrayId;
+    rvi.attributeId = UA_ATTRIBUTEID_VALUE;
+    if(indexRange)
+        rvi.indexRange = UA_STRING((char*)(uintptr_t)indexRange);
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    request.nodesToRead = &rvi;
+    request.nodesToReadSize = 1;
+
+    UA_ReadResponse_init(response);
+    UA_LOCK(server->serviceMutex);
+    Service_Read(server, &server->adminSession, &request, response);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response->responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response->resultsSize, 1);
+    ck_assert(response->results[0].hasValue);
+}
+
+static void
+checkArray(const UA_Variant *v, UA_Int32 offset) {
+    ck_assert_uint_eq(v->arrayLength, ARRAY_LENGTH);
+    const UA_Int32 *array = (const UA_Int32*)v->data;
+    for(UA_Int32 i = 0; i < ARRAY_LENGTH; i++)
+        ck_assert_int_eq(array[i], i + offset);
+}
+
+static void
+releasePinned(void) {
+    UA_LOCK(server->serviceMutex);
+    UA_Session_releasePinnedNodes(server, &server->adminSession);
+    UA_UNLOCK(server->serviceMutex);
+}
+
+START_TEST(ZeroCopy_borrowsValue) {
+    UA_ReadResponse response;
+    readArray(NULL, &response);
+    ck_assert_int_eq(response.results[0].value.storageType, UA_VARIANT_DATA_NODELETE);
+    ck_assert(response.results[0].hasServerTimestamp);
+    ck_assert_uint_eq(server->adminSession.pinnedNodesCount, 1);
+    checkArray(&response.results[0].value, 0);
+    UA_ReadResponse_clear(&response);
+    releasePinned();
+    ck_assert_uint_eq(server->adminSession.pinnedNodesCount, 0);
+} END_TEST
+
+START_TEST(ZeroCopy_writeWhilePinned) {
+    UA_ReadResponse response;
+    readArray(NULL, &response);
+
+    /* The write replaces the node. The borrowed value is unchanged. */
+    UA_Int32 *array = (UA_Int32*)UA_Array_new(ARRAY_LENGTH, &UA_TYPES[UA_TYPES_INT32]);
+    for(UA_Int32 i = 0; i < ARRAY_LENGTH; i++)
+        array[i] = i + 1;
+    UA_Variant value;
+    UA_Variant_setArray(&value, array, ARRAY_LENGTH, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval = UA_Server_writeValue(server, arrayId, value);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Variant_clear(&value);
+    checkArray(&response.results[0].value, 0);
+
+    /* Deleting the node also keeps the pinned node alive */
+    retval = UA_Server_deleteNode(server, arrayId, true);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    checkArray(&response.results[0].value, 0);
+
+    UA_ReadResponse_clear(&response);
+    releasePinned();
+} END_TEST
+
+START_TEST(ZeroCopy_indexRangeCopies) {
+    UA_ReadResponse response;
+    readArray("10:19", &response);
+    ck_assert_int_eq(response.results[0].value.storageType, UA_VARIANT_DATA);
+    ck_assert_uint_eq(response.results[0].value.arrayLength, 10);
+    ck_assert_int_eq(((UA_Int32*)response.results[0].value.data)[0], 10);
+    ck_assert_uint_eq(server->adminSession.pinnedNodesCount, 0);
+    UA_ReadResponse_clear(&response);
+} END_TEST
+
+START_TEST(ZeroCopy_tooManyPinned) {
+    /* Once the session cannot pin more nodes, the values are copied */
+    for(size_t i = 0; i < UA_MAXPINNEDNODES; i++) {
+        UA_ReadResponse response;
+        readArray(NULL, &response);
+        ck_assert_int_eq(response.results[0].value.storageType, UA_VARIANT_DATA_NODELETE);
+        UA_ReadResponse_clear(&response);
+    }
+    UA_ReadResponse response;
+    readArray(NULL, &response);
+    ck_assert_int_eq(response.results[0].value.storageType, UA_VARIANT_DATA);
+    checkArray(&response.results[0].value, 0);
+    UA_ReadResponse_clear(&response);
+    ck_assert_uint_eq(server->adminSession.pinnedNodesCount, UA_MAXPINNEDNODES);
+    releasePinned();
+} END_TEST
+
+static Suite *testSuite_ReadZeroCopy(void) {
+    Suite *s = suite_create("Read Zero-Copy");
+    TCase *tc = tcase_create("Pinned Nodes");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, ZeroCopy_borrowsValue);
+    tcase_add_test(tc, ZeroCopy_writeWhilePinned);
+    tcase_add_test(tc, ZeroCopy_indexRangeCopies);
+    tcase_add_test(tc, ZeroCopy_tooManyPinned);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_ReadZeroCopy();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,262 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <open62541/server.h>
+#include <open62541/server_config_default.h>
+
+#include "server/ua_server_internal.h"
+#include "server/ua_services.h"
+
+#include <check.h>
+
+static UA_Server *server = NULL;
+static UA_Session *session = NULL;
+
+#define VARIABLES 100
+
+static void
+addVariable(UA_UInt32 id) {
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+    UA_Int32 value = (UA_Int32)id;
+    UA_Variant_setScalar(&attr.value, &value, &UA_TYPES[UA_TYPES_INT32]);
+    UA_StatusCode retval =
+        UA_Server_addVariableNode(server, UA_NODEID_NUMERIC(1, id),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                  UA_QUALIFIEDNAME(1, "Variable"),
+                                  UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE),
+                                  attr, NULL, NULL);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+}
+
+static void setup(void) {
+    server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+    UA_Server_run_startup(server);
+
+    UA_CreateSessionRequest request;
+    UA_CreateSessionRequest_init(&request);
+    request.requestedSessionTimeout = UA_UINT32_MAX;
+    UA_LOCK(server->serviceMutex);
+    UA_StatusCode retval = UA_SessionManager_createSession(&server->sessionManager, NULL,
+                                                           &request, &session);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+
+    for(UA_UInt32 i = 0; i < VARIABLES; i++)
+        addVariable(50000 + i);
+}
+
+static void teardown(void) {
+    UA_Server_run_shutdown(server);
+    UA_Server_delete(server);
+}
+
+static UA_RegisterNodesResponse
+registerNodes(const UA_NodeId *nodeIds, size_t nodeIdsSize) {
+    UA_RegisterNodesRequest request;
+    UA_RegisterNodesRequest_init(&request);
+    request.nodesToRegister = (UA_NodeId*)(uintptr_t)nodeIds;
+    request.nodesToRegisterSize = nodeIdsSize;
+    UA_RegisterNodesResponse response;
+    UA_RegisterNodesResponse_init(&response);
+    UA_LOCK(server->serviceMutex);
+    Service_RegisterNodes(server, session, &request, &response);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.registeredNodeIdsSize, nodeIdsSize);
+    return response;
+}
+
+static void
+unregisterNodes(const UA_NodeId *nodeIds, size_t nodeIdsSize) {
+    UA_UnregisterNodesRequest request;
+    UA_UnregisterNodesRequest_init(&request);
+    request.nodesToUnregister = (UA_NodeId*)(uintptr_t)nodeIds;
+    request.nodesToUnregisterSize = nodeIdsSize;
+    UA_UnregisterNodesResponse response;
+    UA_UnregisterNodesResponse_init(&response);
+    UA_LOCK(server->serviceMutex);
+    Service_UnregisterNodes(server, session, &request, &response);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    UA_UnregisterNodesResponse_clear(&response);
+}
+
+static UA_DataValue
+readValue(const UA_NodeId *nodeId) {
+    UA_ReadValueId rvi;
+    UA_ReadValueId_init(&rvi);
+    rvi.nodeId = *nodeId;
+    rvi.attributeId = UA_ATTRIBUTEID_VALUE;
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.nodesToRead = &rvi;
+    request.nodesToReadSize = 1;
+    UA_ReadResponse response;
+    UA_ReadResponse_init(&response);
+    UA_LOCK(server->serviceMutex);
+    Service_Read(server, session, &request, &response);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 1);
+    UA_DataValue dv = response.results[0];
+    UA_DataValue_init(&response.results[0]);
+    UA_ReadResponse_clear(&response);
+    return dv;
+}
+
+static UA_StatusCode
+writeValue(const UA_NodeId *nodeId, UA_Int32 value) {
+    UA_WriteValue wv;
+    UA_WriteValue_init(&wv);
+    wv.nodeId = *nodeId;
+    wv.attributeId = UA_ATTRIBUTEID_VALUE;
+    wv.value.hasValue = true;
+    UA_Variant_setScalar(&wv.value.value, &value, &UA_TYPES[UA_TYPES_INT32]);
+    UA_WriteRequest request;
+    UA_WriteRequest_init(&request);
+    request.nodesToWrite = &wv;
+    request.nodesToWriteSize = 1;
+    UA_WriteResponse response;
+    UA_WriteResponse_init(&response);
+    UA_LOCK(server->serviceMutex);
+    Service_Write(server, session, &request, &response);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(response.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(response.resultsSize, 1);
+    UA_StatusCode res = response.results[0];
+    UA_WriteResponse_clear(&response);
+    return res;
+}
+
+START_TEST(RegisterNodes_readWriteAlias) {
+    UA_NodeId nodeId = UA_NODEID_NUMERIC(1, 50000);
+    UA_RegisterNodesResponse res = registerNodes(&nodeId, 1);
+    UA_NodeId *alias = &res.registeredNodeIds[0];
+    ck_assert_uint_eq(alias->namespaceIndex, UA_REGISTEREDNODES_NS);
+    ck_assert_int_eq(alias->identifierType, UA_NODEIDTYPE_NUMERIC);
+
+    UA_DataValue dv = readValue(alias);
+    ck_assert_uint_eq(dv.status, UA_STATUSCODE_GOOD);
+    ck_assert_int_eq(*(UA_Int32*)dv.value.data, 50000);
+    UA_DataValue_clear(&dv);
+
+    ck_assert_uint_eq(writeValue(alias, 42), UA_STATUSCODE_GOOD);
+    dv = readValue(&nodeId);
+    ck_assert_int_eq(*(UA_Int32*)dv.value.data, 42);
+    UA_DataValue_clear(&dv);
+
+    /* Registering twice returns the same alias */
+    UA_RegisterNodesResponse res2 = registerNodes(&nodeId, 1);
+    ck_assert(UA_NodeId_equal(alias, &res2.registeredNodeIds[0]));
+    UA_RegisterNodesResponse_clear(&res2);
+
+    /* The alias remains until the last registration is removed */
+    unregisterNodes(alias, 1);
+    dv = readValue(alias);
+    ck_assert_uint_eq(dv.status, UA_STATUSCODE_GOOD);
+    UA_DataValue_clear(&dv);
+    unregisterNodes(alias, 1);
+    dv = readValue(alias);
+    ck_assert_uint_eq(dv.status, UA_STATUSCODE_BADNODEIDUNKNOWN);
+    UA_DataValue_clear(&dv);
+
+    UA_RegisterNodesResponse_clear(&res);
+} END_TEST
+
+START_TEST(RegisterNodes_unknownNode) {
+    /* Unknown NodeIds are returned unchanged */
+    UA_NodeId nodeId = UA_NODEID_NUMERIC(1, 12345678);
+    UA_RegisterNodesResponse res = registerNodes(&nodeId, 1);
+    ck_assert(UA_NodeId_equal(&nodeId, &res.registeredNodeIds[0]));
+    UA_RegisterNodesResponse_clear(&res);
+} END_TEST
+
+START_TEST(RegisterNodes_browseAlias) {
+    UA_NodeId nodeId = UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER);
+    UA_RegisterNodesResponse res = registerNodes(&nodeId, 1);
+    UA_BrowseDescription bd;
+    UA_BrowseDescription_init(&bd);
+    bd.nodeId = res.registeredNodeIds[0];
+    bd.browseDirection = UA_BROWSEDIRECTION_FORWARD;
+    UA_BrowseResult br;
+    UA_BrowseResult_init(&br);
+    UA_UInt32 maxrefs = 0;
+    UA_LOCK(server->serviceMutex);
+    Operation_Browse(server, session, &maxrefs, &bd, &br);
+    UA_UNLOCK(server->serviceMutex);
+    ck_assert_uint_eq(br.statusCode, UA_STATUSCODE_GOOD);
+    ck_assert_uint_gt(br.referencesSize, VARIABLES);
+    UA_BrowseResult_clear(&br);
+    UA_RegisterNodesResponse_clear(&res);
+} END_TEST
+
+/* Delete, re-add and read the registered nodes in turns. The aliases must
+ * never point to a removed node. */
+START_TEST(RegisterNodes_deleteStress) {
+    UA_NodeId nodeIds[VARIABLES];
+    for(UA_UInt32 i = 0; i < VARIABLES; i++)
+        nodeIds[i] = UA_NODEID_NUMERIC(1, 50000 + i);
+    UA_RegisterNodesResponse res = registerNodes(nodeIds, VARIABLES);
+
+    for(size_t round = 0; round < 20; round++) {
+        for(size_t i = round % 3; i < VARIABLES; i += 3) {
+            UA_StatusCode retval = UA_Server_deleteNode(server, nodeIds[i], true);
+            ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+        }
+
+        for(size_t i = 0; i < VARIABLES; i++) {
+            UA_DataValue dv = readValue(&res.registeredNodeIds[i]);
+            if(i % 3 == round % 3) {
+                ck_assert_uint_eq(dv.status, UA_STATUSCODE_BADNODEIDUNKNOWN);
+                ck_assert_uint_eq(writeValue(&res.registeredNodeIds[i], 1),
+                                  UA_STATUSCODE_BADNODEIDUNKNOWN);
+            } else {
+                ck_assert_uint_eq(dv.status, UA_STATUSCODE_GOOD);
+                ck_assert_uint_eq(writeValue(&res.registeredNodeIds[i], (UA_Int32)round),
+                                  UA_STATUSCODE_GOOD);
+            }
+            UA_DataValue_clear(&dv);
+        }
+
+        /* The alias resolves to the re-added node */
+        for(size_t i = round % 3; i < VARIABLES; i += 3)
+            addVariable(nodeIds[i].identifier.numeric);
+        for(size_t i = round % 3; i < VARIABLES; i += 3) {
+            UA_DataValue dv = readValue(&res.registeredNodeIds[i]);
+            ck_assert_uint_eq(dv.status, UA_STATUSCODE_GOOD);
+            ck_assert_int_eq(*(UA_Int32*)dv.value.data,
+                             (UA_Int32)nodeIds[i].identifier.numeric);
+            UA_DataValue_clear(&dv);
+        }
+    }
+
+    unregisterNodes(res.registeredNodeIds, res.registeredNodeIdsSize);
+    ck_assert_uint_eq(session->registeredNodesCount, 0);
+    UA_RegisterNodesResponse_clear(&res);
+} END_TEST
+
+static Suite *testSuite_Services_RegisterNodes(void) {
+    Suite *s = suite_create("Services RegisterNodes");
+    TCase *tc = tcase_create("RegisterNodes");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, RegisterNodes_readWriteAlias);
+    tcase_add_test(tc, RegisterNodes_unknownNode);
+    tcase_add_test(tc, RegisterNodes_browseAlias);
+    tcase_add_test(tc, RegisterNodes_deleteStress);
+    suite_add_tcase(s, tc);
+    return s;
+}
+
+int main(void) {
+    Suite *s = testSuite_Services_RegisterNodes();
+    SRunner *sr = srunner_create(s);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -2,8 +2,10 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <open62541/server_config_default.h>
 #include <open62541/types.h>
 
+#include "server/ua_server_internal.h"
 #include "server/ua_services.h"
 
 #include <check.h>
@@ -44,11 +46,66 @@ START_TEST(Session_updateLifetime_ShallWork) {
 }
 END_TEST
 
+static UA_Session *
+createSession(UA_Server *server, UA_Double timeout) {
+    UA_CreateSessionRequest request;
+    UA_CreateSessionRequest_init(&request);
+    request.requestedSessionTimeout = timeout;
+    UA_Session *session = NULL;
+    UA_StatusCode retval =
+        UA_SessionManager_createSession(&server->sessionManager, NULL, &request, &session);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    return session;
+}
+
+START_TEST(SessionManager_lookupAndTimeout) {
+    UA_Server *server = UA_Server_new();
+    UA_ServerConfig_setDefault(UA_Server_getConfig(server));
+    UA_SessionManager *sm = &server->sessionManager;
+    UA_LOCK(server->serviceMutex);
+
+    UA_Session *sessions[10];
+    for(size_t i = 0; i < 10; i++)
+        sessions[i] = createSession(server, (UA_Double)(1000 * (i + 1)));
+    for(size_t i = 0; i < 10; i++) {
+        ck_assert_ptr_eq(UA_SessionManager_getSessionByToken(sm,
+                             &sessions[i]->header.authenticationToken), sessions[i]);
+        ck_assert_ptr_eq(UA_SessionManager_getSessionById(sm, &sessions[i]->sessionId),
+                         sessions[i]);
+    }
+
+    /* The first session was used in the meantime */
+    UA_DateTime now = UA_DateTime_nowMonotonic();
+    sessions[0]->validTill = now + 4500 * UA_DATETIME_MSEC;
+
+    /* Sessions 1 and 2 time out */
+    UA_SessionManager_cleanupTimedOut(sm, now + 3500 * UA_DATETIME_MSEC);
+    ck_assert_uint_eq(sm->currentSessionCount, 8);
+    ck_assert_ptr_eq(UA_SessionManager_getSessionById(sm, &sessions[0]->sessionId),
+                     sessions[0]);
+
+    /* Session 0 times out with its updated lifetime, together with sessions
+     * 3 and 4 */
+    UA_SessionManager_cleanupTimedOut(sm, now + 5500 * UA_DATETIME_MSEC);
+    ck_assert_uint_eq(sm->currentSessionCount, 5);
+
+    UA_NodeId token = sessions[9]->header.authenticationToken;
+    ck_assert_uint_eq(UA_SessionManager_removeSession(sm, &token), UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(UA_SessionManager_removeSession(sm, &token),
+                      UA_STATUSCODE_BADSESSIONIDINVALID);
+    ck_assert_uint_eq(sm->currentSessionCount, 4);
+
+    UA_UNLOCK(server->serviceMutex);
+    UA_Server_delete(server);
+}
+END_TEST
+
 static Suite* testSuite_Session(void) {
     Suite *s = suite_create("Session");
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, Session_init_ShallWork);
     tcase_add_test(tc_core, Session_updateLifetime_ShallWork);
+    tcase_add_test(tc_core, SessionManager_lookupAndTimeout);
 
     suite_add_tcase(s,tc_core);
     return s;
@@ -303,7 +303,8 @@ eventSetup(UA_NodeId *eventNodeId) {
 }
 
 static UA_MonitoredItemCreateResult
-addMonitoredItem(UA_Client_EventNotificationCallback handler, bool setFilter) {
+addMonitoredItemWhere(UA_Client_EventNotificationCallback handler, bool setFilter,
+                      const UA_ContentFilter *whereClause) {
     UA_MonitoredItemCreateRequest item;
     UA_MonitoredItemCreateRequest_init(&item);
     item.itemToMonitor.nodeId = UA_NODEID_NUMERIC(0, 2253); // Root->Objects->Server
@@ -314,6 +315,8 @@ addMonitoredItem(UA_Client_EventNotificationCallback handler, bool setFilter) {
     UA_EventFilter_init(&filter);
     filter.selectClauses = selectClauses;
     filter.selectClausesSize = nSelectClauses;
+    if(whereClause)
+        filter.whereClause = *whereClause;
 
     if (setFilter) {
         item.requestedParameters.filter.encoding = UA_EXTENSIONOBJECT_DECODED;
@@ -329,6 +332,11 @@ addMonitoredItem(UA_Client_EventNotificationCallback handler, bool setFilter) {
                                                 &monitoredItemId, handler, NULL);
 }
 
+static UA_MonitoredItemCreateResult
+addMonitoredItem(UA_Client_EventNotificationCallback handler, bool setFilter) {
+    return addMonitoredItemWhere(handler, setFilter, NULL);
+}
+
 
 /* Create event with empty filter */
 
@@ -343,8 +351,28 @@ START_TEST(generateEventEmptyFilter) {
 } END_TEST
 
 
+static void
+removeMonitoredItem(void) {
+    UA_DeleteMonitoredItemsRequest deleteRequest;
+    UA_DeleteMonitoredItemsRequest_init(&deleteRequest);
+    deleteRequest.subscriptionId = subscriptionId;
+    deleteRequest.monitoredItemIds = &monitoredItemId;
+    deleteRequest.monitoredItemIdsSize = 1;
+
+    UA_DeleteMonitoredItemsResponse deleteResponse =
+        UA_Client_MonitoredItems_delete(client, deleteRequest);
+
+    sleepUntilAnswer(publishingInterval + 100);
+    ck_assert_uint_eq(deleteResponse.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(deleteResponse.resultsSize, 1);
+    ck_assert_uint_eq(*(deleteResponse.results), UA_STATUSCODE_GOOD);
+
+    UA_DeleteMonitoredItemsResponse_deleteMembers(&deleteResponse);
+}
+
 /* Ensure events are received with proper values */
-START_TEST(generateEvents) {
+static void
+checkGenerateEvents(void) {
     UA_NodeId eventNodeId;
     UA_StatusCode retval = eventSetup(&eventNodeId);
     ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
@@ -367,22 +395,347 @@ START_TEST(generateEvents) {
     ck_assert_uint_eq(notificationReceived, true);
     ck_assert_uint_eq(createResult.revisedQueueSize, 1);
 
-    // delete the monitoredItem
-    UA_DeleteMonitoredItemsRequest deleteRequest;
-    UA_DeleteMonitoredItemsRequest_init(&deleteRequest);
-    deleteRequest.subscriptionId = subscriptionId;
-    deleteRequest.monitoredItemIds = &monitoredItemId;
-    deleteRequest.monitoredItemIdsSize = 1;
+    removeMonitoredItem();
+}
 
-    UA_DeleteMonitoredItemsResponse deleteResponse =
-        UA_Client_MonitoredItems_delete(client, deleteRequest);
+START_TEST(generateEvents) {
+    checkGenerateEvents();
+} END_TEST
+
+/* The events are encoded directly into the publish response */
+START_TEST(generateEventsEncoded) {
+    serverMutexLock();
+    UA_Server_getConfig(server)->encodeNotifications = true;
+    serverMutexUnlock();
+    checkGenerateEvents();
+    serverMutexLock();
+    UA_Server_getConfig(server)->encodeNotifications = false;
+    serverMutexUnlock();
+} END_TEST
+
+/* The event is emitted from its fields without a node */
+START_TEST(emitEvent) {
+    UA_MonitoredItemCreateResult createResult = addMonitoredItem(handler_events_simple, true);
+    ck_assert_uint_eq(createResult.statusCode, UA_STATUSCODE_GOOD);
+    monitoredItemId = createResult.monitoredItemId;
+
+    UA_UInt16 eventSeverity = 1000;
+    UA_LocalizedText message = UA_LOCALIZEDTEXT("en-US", "Generated Event");
+    UA_EventField fields[2];
+    fields[0].name = UA_QUALIFIEDNAME(0, "Severity");
+    UA_Variant_setScalar(&fields[0].value, &eventSeverity, &UA_TYPES[UA_TYPES_UINT16]);
+    fields[1].name = UA_QUALIFIEDNAME(0, "Message");
+    UA_Variant_setScalar(&fields[1].value, &message, &UA_TYPES[UA_TYPES_LOCALIZEDTEXT]);
+
+    UA_ByteString eventId = UA_BYTESTRING_NULL;
+    serverMutexLock();
+    UA_StatusCode retval =
+        UA_Server_emitEvent(server, eventType, UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER),
+                            2, fields, &eventId);
+    serverMutexUnlock();
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(eventId.length, 16);
+    UA_ByteString_clear(&eventId);
+
+    /* Only subtypes of BaseEventType can be emitted */
+    serverMutexLock();
+    retval = UA_Server_emitEvent(server, UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                 UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER), 2, fields, NULL);
+    serverMutexUnlock();
+    ck_assert_uint_eq(retval, UA_STATUSCODE_BADINVALIDARGUMENT);
 
+    notificationReceived = false;
     sleepUntilAnswer(publishingInterval + 100);
-    ck_assert_uint_eq(deleteResponse.responseHeader.serviceResult, UA_STATUSCODE_GOOD);
-    ck_assert_uint_eq(deleteResponse.resultsSize, 1);
-    ck_assert_uint_eq(*(deleteResponse.results), UA_STATUSCODE_GOOD);
+    retval = UA_Client_run_iterate(client, 0);
+    sleepUntilAnswer(publishingInterval + 100);
+    retval = UA_Client_run_iterate(client, 0);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(notificationReceived, true);
 
-    UA_DeleteMonitoredItemsResponse_deleteMembers(&deleteResponse);
+    removeMonitoredItem();
+} END_TEST
+
+static UA_StatusCode
+emitEventLocked(const UA_NodeId origin) {
+    UA_UInt16 eventSeverity = 1000;
+    UA_LocalizedText message = UA_LOCALIZEDTEXT("en-US", "Generated Event");
+    UA_EventField fields[2];
+    fields[0].name = UA_QUALIFIEDNAME(0, "Severity");
+    UA_Variant_setScalar(&fields[0].value, &eventSeverity, &UA_TYPES[UA_TYPES_UINT16]);
+    fields[1].name = UA_QUALIFIEDNAME(0, "Message");
+    UA_Variant_setScalar(&fields[1].value, &message, &UA_TYPES[UA_TYPES_LOCALIZEDTEXT]);
+    serverMutexLock();
+    UA_StatusCode retval = UA_Server_emitEvent(server, eventType, origin, 2, fields, NULL);
+    serverMutexUnlock();
+    return retval;
+}
+
+static void
+receiveEvent(void) {
+    notificationReceived = false;
+    sleepUntilAnswer(publishingInterval + 100);
+    UA_StatusCode retval = UA_Client_run_iterate(client, 0);
+    sleepUntilAnswer(publishingInterval + 100);
+    retval = UA_Client_run_iterate(client, 0);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(notificationReceived, true);
+}
+
+START_TEST(eventIndex) {
+    serverMutexLock();
+    UA_Server_getConfig(server)->eventIndexSize = 10;
+    serverMutexUnlock();
+
+    UA_MonitoredItemCreateResult createResult = addMonitoredItem(handler_events_simple, true);
+    ck_assert_uint_eq(createResult.statusCode, UA_STATUSCODE_GOOD);
+    monitoredItemId = createResult.monitoredItemId;
+
+    /* The first event of the origin browses its parents */
+    UA_EventIndexStatistics before, stats;
+    UA_Server_getEventIndexStatistics(server, &before);
+    UA_NodeId serverId = UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER);
+    ck_assert_uint_eq(emitEventLocked(serverId), UA_STATUSCODE_GOOD);
+    UA_Server_getEventIndexStatistics(server, &stats);
+    ck_assert_uint_eq(stats.misses, before.misses + 1);
+    ck_assert_uint_eq(stats.hits, before.hits);
+    ck_assert_uint_eq(stats.entries, 1);
+    receiveEvent();
+
+    /* The next event is delivered with the indexed MonitoredItems */
+    ck_assert_uint_eq(emitEventLocked(serverId), UA_STATUSCODE_GOOD);
+    UA_Server_getEventIndexStatistics(server, &stats);
+    ck_assert_uint_eq(stats.hits, before.hits + 1);
+    receiveEvent();
+
+    /* A new Organizes reference resets the index */
+    UA_NodeId objectId = UA_NODEID_NUMERIC(1, 7000);
+    serverMutexLock();
+    UA_StatusCode retval = UA_Server_addObjectNode(server, objectId,
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_OBJECTSFOLDER),
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                     UA_QUALIFIEDNAME(1, "EventSource"),
+                                     UA_NODEID_NUMERIC(0, UA_NS0ID_BASEOBJECTTYPE),
+                                     UA_ObjectAttributes_default, NULL, NULL);
+    serverMutexUnlock();
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Server_getEventIndexStatistics(server, &stats);
+    ck_assert_uint_eq(stats.entries, 0);
+
+    /* Deleting the origin removes its entry */
+    ck_assert_uint_eq(emitEventLocked(objectId), UA_STATUSCODE_GOOD);
+    UA_Server_getEventIndexStatistics(server, &stats);
+    ck_assert_uint_eq(stats.entries, 1);
+    serverMutexLock();
+    retval = UA_Server_deleteNode(server, objectId, true);
+    serverMutexUnlock();
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    UA_Server_getEventIndexStatistics(server, &stats);
+    ck_assert_uint_eq(stats.entries, 0);
+    ck_assert_uint_eq(emitEventLocked(objectId), UA_STATUSCODE_BADNOTFOUND);
+
+    /* Removing the MonitoredItem resets the index */
+    ck_assert_uint_eq(emitEventLocked(serverId), UA_STATUSCODE_GOOD);
+    removeMonitoredItem();
+    UA_Server_getEventIndexStatistics(server, &stats);
+    ck_assert_uint_eq(stats.entries, 0);
+
+    serverMutexLock();
+    UA_Server_getConfig(server)->eventIndexSize = 0;
+    serverMutexUnlock();
+} END_TEST
+
+static void
+setOperand(UA_ExtensionObject *eo, const UA_DataType *type, void *data) {
+    UA_ExtensionObject_init(eo);
+    eo->encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+    eo->content.decoded.type = type;
+    eo->content.decoded.data = data;
+}
+
+static void
+setFieldOperand(UA_SimpleAttributeOperand *sao, UA_QualifiedName *name) {
+    UA_SimpleAttributeOperand_init(sao);
+    sao->typeDefinitionId = UA_NODEID_NUMERIC(0, UA_NS0ID_BASEEVENTTYPE);
+    sao->browsePathSize = 1;
+    sao->browsePath = name;
+    sao->attributeId = UA_ATTRIBUTEID_VALUE;
+}
+
+/* Emits an event and checks whether it passes the where clause */
+static void
+checkWhereClause(const UA_ContentFilter *whereClause, UA_Boolean expected) {
+    UA_MonitoredItemCreateResult createResult =
+        addMonitoredItemWhere(handler_events_simple, true, whereClause);
+    ck_assert_uint_eq(createResult.statusCode, UA_STATUSCODE_GOOD);
+    monitoredItemId = createResult.monitoredItemId;
+
+    ck_assert_uint_eq(emitEventLocked(UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER)),
+                      UA_STATUSCODE_GOOD);
+    notificationReceived = false;
+    sleepUntilAnswer(publishingInterval + 100);
+    UA_StatusCode retval = UA_Client_run_iterate(client, 0);
+    sleepUntilAnswer(publishingInterval + 100);
+    retval = UA_Client_run_iterate(client, 0);
+    ck_assert_uint_eq(retval, UA_STATUSCODE_GOOD);
+    ck_assert_uint_eq(notificationReceived, expected);
+
+    removeMonitoredItem();
+}
+
+static UA_StatusCode
+createWithWhereClause(const UA_ContentFilter *whereClause) {
+    UA_MonitoredItemCreateResult createResult =
+        addMonitoredItemWhere(handler_events_simple, true, whereClause);
+    if(createResult.statusCode == UA_STATUSCODE_GOOD) {
+        monitoredItemId = createResult.monitoredItemId;
+        removeMonitoredItem();
+    }
+    return createResult.statusCode;
+}
+
+START_TEST(whereClause) {
+    UA_QualifiedName severityName = UA_QUALIFIEDNAME(0, "Severity");
+    UA_QualifiedName messageName = UA_QUALIFIEDNAME(0, "Message");
+    UA_QualifiedName sourceName = UA_QUALIFIEDNAME(0, "SourceNode");
+    UA_SimpleAttributeOperand severity, message, sourceNode;
+    setFieldOperand(&severity, &severityName);
+    setFieldOperand(&message, &messageName);
+    setFieldOperand(&sourceNode, &sourceName);
+
+    UA_Int32 lowValue = 500, highValue = 2000;
+    UA_Double lowDouble = 999.5;
+    UA_String matching = UA_STRING("Gen%Ev_nt");
+    UA_String notMatching = UA_STRING("Gen[^e]%");
+    UA_NodeId serverId = UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER);
+    UA_NodeId auditTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_AUDITEVENTTYPE);
+    UA_LiteralOperand lit[3];
+    for(size_t i = 0; i < 3; i++)
+        UA_LiteralOperand_init(&lit[i]);
+
+    UA_ContentFilterElement elements[3];
+    UA_ExtensionObject operands[3][3];
+    for(size_t i = 0; i < 3; i++) {
+        UA_ContentFilterElement_init(&elements[i]);
+        elements[i].filterOperands = operands[i];
+    }
+    UA_ContentFilter where;
+    where.elements = elements;
+    where.elementsSize = 1;
+
+    /* The UInt16 Severity is compared with an Int32 literal */
+    elements[0].filterOperator = UA_FILTEROPERATOR_GREATERTHAN;
+    elements[0].filterOperandsSize = 2;
+    setOperand(&operands[0][0], &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND], &severity);
+    setOperand(&operands[0][1], &UA_TYPES[UA_TYPES_LITERALOPERAND], &lit[0]);
+    UA_Variant_setScalar(&lit[0].value, &lowValue, &UA_TYPES[UA_TYPES_INT32]);
+    checkWhereClause(&where, true);
+    UA_Variant_setScalar(&lit[0].value, &highValue, &UA_TYPES[UA_TYPES_INT32]);
+    checkWhereClause(&where, false);
+
+    /* Between with literals of different types */
+    elements[0].filterOperator = UA_FILTEROPERATOR_BETWEEN;
+    elements[0].filterOperandsSize = 3;
+    setOperand(&operands[0][2], &UA_TYPES[UA_TYPES_LITERALOPERAND], &lit[1]);
+    UA_Variant_setScalar(&lit[0].value, &lowDouble, &UA_TYPES[UA_TYPES_DOUBLE]);
+    UA_Variant_setScalar(&lit[1].value, &highValue, &UA_TYPES[UA_TYPES_INT32]);
+    checkWhereClause(&where, true);
+
+    /* Like on the text of the Message */
+    elements[0].filterOperator = UA_FILTEROPERATOR_LIKE;
+    elements[0].filterOperandsSize = 2;
+    setOperand(&operands[0][0], &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND], &message);
+    UA_Variant_setScalar(&lit[0].value, &matching, &UA_TYPES[UA_TYPES_STRING]);
+    checkWhereClause(&where, true);
+    UA_Variant_setScalar(&lit[0].value, &notMatching, &UA_TYPES[UA_TYPES_STRING]);
+    checkWhereClause(&where, false);
+
+    /* And of an Equals on the SourceNode and an OfType */
+    where.elementsSize = 3;
+    elements[0].filterOperator = UA_FILTEROPERATOR_AND;
+    elements[0].filterOperandsSize = 2;
+    UA_ElementOperand first, second;
+    first.index = 1;
+    second.index = 2;
+    setOperand(&operands[0][0], &UA_TYPES[UA_TYPES_ELEMENTOPERAND], &first);
+    setOperand(&operands[0][1], &UA_TYPES[UA_TYPES_ELEMENTOPERAND], &second);
+    elements[1].filterOperator = UA_FILTEROPERATOR_EQUALS;
+    elements[1].filterOperandsSize = 2;
+    setOperand(&operands[1][0], &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND], &sourceNode);
+    setOperand(&operands[1][1], &UA_TYPES[UA_TYPES_LITERALOPERAND], &lit[0]);
+    UA_Variant_setScalar(&lit[0].value, &serverId, &UA_TYPES[UA_TYPES_NODEID]);
+    elements[2].filterOperator = UA_FILTEROPERATOR_OFTYPE;
+    elements[2].filterOperandsSize = 1;
+    setOperand(&operands[2][0], &UA_TYPES[UA_TYPES_LITERALOPERAND], &lit[1]);
+    UA_Variant_setScalar(&lit[1].value, &eventType, &UA_TYPES[UA_TYPES_NODEID]);
+    checkWhereClause(&where, true);
+    UA_Variant_setScalar(&lit[1].value, &auditTypeId, &UA_TYPES[UA_TYPES_NODEID]);
+    checkWhereClause(&where, false);
+
+    /* Element operands must point forward */
+    first.index = 0;
+    ck_assert_uint_eq(createWithWhereClause(&where), UA_STATUSCODE_BADFILTEROPERANDINVALID);
+    first.index = 3;
+    ck_assert_uint_eq(createWithWhereClause(&where), UA_STATUSCODE_BADFILTEROPERANDINVALID);
+    first.index = 1;
+
+    /* Wrong number of operands */
+    elements[1].filterOperandsSize = 1;
+    ck_assert_uint_eq(createWithWhereClause(&where),
+                      UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH);
+    elements[1].filterOperandsSize = 2;
+
+    /* Unsupported operators are rejected when the MonitoredItem is created */
+    elements[1].filterOperator = UA_FILTEROPERATOR_CAST;
+    ck_assert_uint_eq(createWithWhereClause(&where),
+                      UA_STATUSCODE_BADFILTEROPERATORUNSUPPORTED);
+
+    /* The number of elements is limited */
+    elements[1].filterOperator = UA_FILTEROPERATOR_EQUALS;
+    serverMutexLock();
+    UA_Server_getConfig(server)->maxWhereClauseElements = 2;
+    serverMutexUnlock();
+    ck_assert_uint_eq(createWithWhereClause(&where), UA_STATUSCODE_BADTOOMANYOPERATIONS);
+    serverMutexLock();
+    UA_Server_getConfig(server)->maxWhereClauseElements = 64;
+    serverMutexUnlock();
+} END_TEST
+
+/* Every element references the next one twice. Each element is evaluated only
+ * once. Otherwise the evaluation takes 2^elementsSize steps. */
+START_TEST(whereClauseShared) {
+    UA_QualifiedName severityName = UA_QUALIFIEDNAME(0, "Severity");
+    UA_SimpleAttributeOperand severity;
+    setFieldOperand(&severity, &severityName);
+    UA_Int32 value = 1;
+    UA_LiteralOperand lit;
+    UA_LiteralOperand_init(&lit);
+    UA_Variant_setScalar(&lit.value, &value, &UA_TYPES[UA_TYPES_INT32]);
+
+    UA_ContentFilterElement elements[64];
+    UA_ExtensionObject operands[64][2];
+    UA_ElementOperand next[64];
+    for(size_t i = 0; i < 63; i++) {
+        UA_ContentFilterElement_init(&elements[i]);
+        elements[i].filterOperator = UA_FILTEROPERATOR_OR;
+        elements[i].filterOperandsSize = 2;
+        elements[i].filterOperands = operands[i];
+        next[i].index = (UA_UInt32)i + 1;
+        setOperand(&operands[i][0], &UA_TYPES[UA_TYPES_ELEMENTOPERAND], &next[i]);
+        setOperand(&operands[i][1], &UA_TYPES[UA_TYPES_ELEMENTOPERAND], &next[i]);
+    }
+    UA_ContentFilterElement_init(&elements[63]);
+    elements[63].filterOperator = UA_FILTEROPERATOR_EQUALS;
+    elements[63].filterOperandsSize = 2;
+    elements[63].filterOperands = operands[63];
+    setOperand(&operands[63][0], &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND], &severity);
+    setOperand(&operands[63][1], &UA_TYPES[UA_TYPES_LITERALOPERAND], &lit);
+
+    UA_ContentFilter where;
+    where.elements = elements;
+    where.elementsSize = 64;
+    checkWhereClause(&where, false);
+    value = 1000;
+    checkWhereClause(&where, true);
 } END_TEST
 
 static bool hasBaseModelChangeEventType(void) {
@@ -674,6 +1027,11 @@ static Suite *testSuite_Client(void) {
     tcase_add_unchecked_fixture(tc_server, setup, teardown);
     tcase_add_test(tc_server, generateEventEmptyFilter);
     tcase_add_test(tc_server, generateEvents);
+    tcase_add_test(tc_server, generateEventsEncoded);
+    tcase_add_test(tc_server, emitEvent);
+    tcase_add_test(tc_server, eventIndex);
+    tcase_add_test(tc_server, whereClause);
+    tcase_add_test(tc_server, whereClauseShared);
     tcase_add_test(tc_server, createAbstractEvent);
     tcase_add_test(tc_server, createAbstractEventWithParent);
     tcase_add_test(tc_server, createNonAbstractEventWithParent);